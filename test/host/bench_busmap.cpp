@@ -0,0 +1,74 @@
+/*
+ * Bus lookup benchmark: BusManager::getBusIndex() and setPixelColor() through the sorted bus map against the
+ * linear scan over all busses it replaced, for sequential and random pixel order.
+ *
+ *   bench_busmap [--leds=N] [--rounds=N] [--quick]
+ *
+ * Every lookup is also checked against the linear scan, a mismatch makes the run fail.
+ */
+#include "harness.h"
+#include <random>
+
+static volatile int sink;
+
+// lookup as done before the bus map
+static int8_t linearBusIndex(uint16_t pix)
+{
+  for (uint8_t i = 0; i < busses.getNumBusses(); i++) {
+    Bus *b = busses.getBus(i);
+    if (b->containsPixel(pix)) return i;
+  }
+  return -1;
+}
+
+static void linearSetPixelColor(uint16_t pix, uint32_t c)
+{
+  for (uint8_t i = 0; i < busses.getNumBusses(); i++) {
+    Bus *b = busses.getBus(i);
+    uint16_t bstart = b->getStart();
+    if (pix < bstart || pix >= bstart + b->getLength()) continue;
+    b->setPixelColor(pix - bstart, c);
+  }
+}
+
+template<typename F> static double timeNs(const std::vector<uint16_t> &order, unsigned rounds, F f)
+{
+  double t0 = harness::nowNs();
+  for (unsigned r = 0; r < rounds; r++) for (uint16_t p : order) f(p);
+  return (harness::nowNs() - t0) / ((double)rounds * order.size());
+}
+
+int main(int argc, char **argv)
+{
+  bool quick = harness::hasFlag(argc, argv, "--quick");
+  long leds   = harness::option(argc, argv, "leds", quick ? 512 : 4096);
+  long rounds = harness::option(argc, argv, "rounds", quick ? 2 : 200);
+
+  printf("%ld LEDs, %ld rounds, ns per pixel\n", leds, rounds);
+  printf("%6s %-10s %12s %12s %12s %12s\n", "busses", "order", "index map", "index scan", "set map", "set scan");
+  const uint8_t counts[] = {1, 2, 4, 8, WLED_MAX_BUSSES};
+  for (uint8_t n : counts) {
+    if (n > WLED_MAX_BUSSES) continue;
+    harness::setupStrip(leds / n, n);
+    unsigned total = strip.getLengthTotal();
+    CHECK_EQ(busses.getNumBusses(), n);
+
+    std::vector<uint16_t> seq(total), rnd(total);
+    for (unsigned i = 0; i < total; i++) seq[i] = rnd[i] = i;
+    std::shuffle(rnd.begin(), rnd.end(), std::mt19937(n));
+    // a few pixels past the end must resolve to "no bus" in both versions
+    for (unsigned i = total; i < total + 8; i++) CHECK_EQ(busses.getBusIndex(i), linearBusIndex(i));
+    for (uint16_t p : rnd) CHECK_EQ(busses.getBusIndex(p), linearBusIndex(p));
+
+    for (int o = 0; o < 2; o++) {
+      const std::vector<uint16_t> &order = o ? rnd : seq;
+      double mapIdx  = timeNs(order, rounds, [](uint16_t p) { sink = busses.getBusIndex(p); });
+      double scanIdx = timeNs(order, rounds, [](uint16_t p) { sink = linearBusIndex(p); });
+      double mapSet  = timeNs(order, rounds, [](uint16_t p) { busses.setPixelColor(p, p); });
+      double scanSet = timeNs(order, rounds, [](uint16_t p) { linearSetPixelColor(p, p); });
+      printf("%6u %-10s %12.2f %12.2f %12.2f %12.2f\n", n, o ? "random" : "sequential", mapIdx, scanIdx, mapSet, scanSet);
+    }
+    for (uint16_t p : rnd) CHECK_EQ(busses.getPixelColor(p), (uint32_t)p & 0xFFFFFF);
+  }
+  return harness::finish("bench_busmap");
+}
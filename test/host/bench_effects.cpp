@@ -0,0 +1,57 @@
+/*
+ * Effect benchmark: renders every effect for a number of frames on a RAM bus and reports time per frame and per pixel.
+ *
+ *   bench_effects[_rt] [--leds=N] [--segments=N] [--width=W --height=H] [--frames=N] [--mode=ID] [--quick]
+ *
+ * Without --width/--height a 1D strip of --leds LEDs is used (default 300), 2D effects then run their 1D fallback.
+ * With --segments the strip is split into that many busses with one segment each, all running the effect.
+ * bench_effects_rt is built with WLED_ENABLE_PARALLEL_RENDER and renders the segments on two cores (threads).
+ * The clock is stopped and advanced by one frame time per frame, so effect output is repeatable; the hash of the
+ * last frame is printed to compare runs of different builds.
+ */
+#include "harness.h"
+
+int main(int argc, char **argv)
+{
+  bool quick = harness::hasFlag(argc, argv, "--quick");
+  long width  = harness::option(argc, argv, "width", 0);
+  long height = harness::option(argc, argv, "height", 0);
+  long leds   = harness::option(argc, argv, "leds", quick ? 64 : 300);
+  long frames = harness::option(argc, argv, "frames", quick ? 3 : 200);
+  long only   = harness::option(argc, argv, "mode", -1);
+  long segs   = harness::option(argc, argv, "segments", 1);
+
+  if (width > 1 && height > 1) harness::setupMatrix(width, height);
+  else {
+    harness::setupStrip(leds / segs, segs);
+    autoSegments = true;
+    strip.makeAutoSegments(true); // one segment per bus
+  }
+  unsigned pixels = strip.getLengthTotal();
+  printf("%s %u pixels, %u segments, %ld frames per effect\n", strip.isMatrix ? "matrix" : "strip", pixels, strip.getSegmentsNum(), frames);
+  printf("%3s  %-24s %12s %10s  %s\n", "id", "effect", "ns/frame", "ns/pixel", "hash");
+
+  double total = 0;
+  unsigned count = 0;
+  for (uint8_t m = 0; m < strip.getModeCount(); m++) {
+    if (only >= 0 && m != only) continue;
+    const char *data = strip.getModeData(m);
+    if (!strncmp_P("RSVD", data, 4)) continue;
+    char name[25];
+    size_t n = 0;
+    while (data[n] && data[n] != '@' && n < sizeof(name) - 1) { name[n] = data[n]; n++; }
+    name[n] = 0;
+
+    harness::setMode(m, -1);
+    harness::frame(); // first frame allocates effect data
+    double t0 = harness::nowNs();
+    harness::frames(frames);
+    double ns = (harness::nowNs() - t0) / frames;
+    total += ns;
+    count++;
+    printf("%3u  %-24s %12.0f %10.2f  %08x\n", m, name, ns, ns / pixels, harness::pixelHash());
+  }
+  if (count) printf("average %.0f ns/frame, %.2f ns/pixel over %u effects\n", total / count, total / count / pixels, count);
+  fflush(stdout);
+  _exit(0);
+}
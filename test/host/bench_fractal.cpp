@@ -0,0 +1,149 @@
+/*
+ * Fractal kernel benchmark: fractalEscape() (fixed point, used by Julia and Mandelbrot) against the float loop Julia
+ * used before, with the same smoothing done in float. Views are those of the effects: the Julia set around
+ * the PixelBlaze constant and Mandelbrot zoomed into seahorse valley.
+ * Reports pixels and iterations per second of both kernels and how far their escape times are from a double
+ * precision reference: pixels classified differently (inside/outside the set) and the 95th percentile error of the
+ * smoothed escape time, in iterations and in palette index (as used for the pixel color). All kernels get the same
+ * Q16 coordinates, so only the arithmetic is compared. Near the border of the set rounding errors grow with every
+ * iteration, so fixed point must not be much worse than float, not exact.
+ * The host has an FPU, on ESP32-C3 and ESP8266 float is emulated and far slower than shown here.
+ *
+ *   bench_fractal [--size=N] [--ms=N] [--quick]
+ */
+#include "harness.h"
+#include <algorithm>
+#include <cmath>
+
+static const uint16_t BOUNDED = UINT16_MAX;
+
+// Julia loop before the fixed point kernel, smoothed like fractalEscape(); Q8 iterations or BOUNDED
+template<typename T> static uint16_t floatEscape(T a, T b, T cRe, T cIm, uint8_t maxIter)
+{
+  for (int iter = 0; iter < maxIter; iter++) {
+    T aa = a * a;
+    T bb = b * b;
+    T len = aa + bb;
+    if (len > 16) {
+      T smooth = iter + 1 - std::log2(std::log2(len) / 4);
+      return smooth > 0 ? smooth * 256 + T(0.5) : 0;
+    }
+    b = 2*a*b + cIm;
+    a = aa - bb + cRe;
+  }
+  return BOUNDED;
+}
+
+struct View {
+  const char *name;
+  bool mandelbrot;
+  int32_t x0, y0, dx, dy, cRe, cIm; // Q16
+  uint8_t maxIter;
+};
+
+static View julia(uint16_t size, float t)
+{
+  // whole set as shown by Julia with default sliders, c moving as in mode_2DJulia()
+  float cRe = -0.94299f + sinf(t / 305.f) / 20.f;
+  float cIm =  0.3162f  + sinf(t / 405.f) / 20.f;
+  return {"Julia", false, int32_t(-1.2f * 65536), int32_t(-0.8f * 65536), int32_t(2.4f * 65536 / size), int32_t(1.8f * 65536 / size),
+          int32_t(cRe * 65536), int32_t(cIm * 65536), 127};
+}
+
+static View mandelbrot(uint16_t size, uint8_t octaves)
+{
+  // seahorse valley as in mode_2DMandelbrot()
+  int32_t width = (3L << 16) >> octaves;
+  int32_t d = MAX(1, width / size);
+  return {octaves ? "Mandelbrot zoomed" : "Mandelbrot", true, -48735 - d * size / 2, 8639 - d * size / 2, d, d, 0, 0, 127};
+}
+
+enum Kernel { FIXED, FLOAT, DOUBLE };
+static const char *KERNELS[] = {"fixed", "float", "double"};
+
+static uint16_t escape(const View &v, Kernel k, int x, int y)
+{
+  int32_t px = v.x0 + x * v.dx, py = v.y0 + y * v.dy;
+  if (k == FIXED) return v.mandelbrot ? fractalEscape(0, 0, px, py, v.maxIter) : fractalEscape(px, py, v.cRe, v.cIm, v.maxIter);
+  if (k == FLOAT) {
+    float fx = px / 65536.f, fy = py / 65536.f;
+    return v.mandelbrot ? floatEscape(0.f, 0.f, fx, fy, v.maxIter) : floatEscape(fx, fy, v.cRe / 65536.f, v.cIm / 65536.f, v.maxIter);
+  }
+  double dx = px / 65536., dy = py / 65536.;
+  return v.mandelbrot ? floatEscape(0., 0., dx, dy, v.maxIter) : floatEscape(dx, dy, v.cRe / 65536., v.cIm / 65536., v.maxIter);
+}
+
+// escape times of a whole view, returns iterations done
+static uint64_t render(const View &v, Kernel k, uint16_t size, std::vector<uint16_t> &out)
+{
+  uint64_t iterations = 0;
+  for (int y = 0; y < size; y++) for (int x = 0; x < size; x++) {
+    uint16_t e = escape(v, k, x, y);
+    out[y * size + x] = e;
+    iterations += e == BOUNDED ? v.maxIter : (e >> 8) + 1;
+  }
+  return iterations;
+}
+
+static uint8_t paletteIndex(uint16_t e, uint8_t maxIter) { return MIN(255U, e * 255U / (maxIter << 8)); }
+
+// deviation of escape times from the reference
+struct Error {
+  float misclassified; // % of pixels inside the set in one and outside in the other
+  float iterations;    // 95th percentile of escape time difference
+  int   index;         // 95th percentile of palette index difference
+};
+
+static Error compare(const std::vector<uint16_t> &esc, const std::vector<uint16_t> &reference, uint8_t maxIter)
+{
+  unsigned misclassified = 0;
+  std::vector<float> iterations;
+  std::vector<int> index;
+  for (size_t i = 0; i < esc.size(); i++) {
+    if ((esc[i] == BOUNDED) != (reference[i] == BOUNDED)) { misclassified++; continue; }
+    if (esc[i] == BOUNDED) continue;
+    iterations.push_back(fabsf(esc[i] - reference[i]) / 256.f);
+    index.push_back(abs(paletteIndex(esc[i], maxIter) - paletteIndex(reference[i], maxIter)));
+  }
+  CHECK(!iterations.empty());
+  std::sort(iterations.begin(), iterations.end());
+  std::sort(index.begin(), index.end());
+  return {100.f * misclassified / esc.size(), iterations[iterations.size() * 95 / 100], index[index.size() * 95 / 100]};
+}
+
+int main(int argc, char **argv)
+{
+  bool quick = harness::hasFlag(argc, argv, "--quick");
+  long size  = harness::option(argc, argv, "size", quick ? 32 : 128);
+  long ms    = harness::option(argc, argv, "ms", quick ? 20 : 1000);
+
+  std::vector<View> views = {julia(size, 0), julia(size, 40000), mandelbrot(size, 0), mandelbrot(size, 4)};
+  std::vector<uint16_t> reference(size * size), esc(size * size);
+
+  printf("%ldx%ld pixels, %ld ms per run, errors against double\n", size, size, ms);
+  printf("%-18s %-6s %10s %10s %8s %9s %8s\n", "view", "kernel", "Mpixels/s", "Miter/s", "class%", "p95 iter", "p95 idx");
+  for (const View &v : views) {
+    render(v, DOUBLE, size, reference);
+    for (Kernel k : {FIXED, FLOAT}) {
+      render(v, k, size, esc);
+      Error err = compare(esc, reference, v.maxIter);
+      if (k == FIXED) {
+        // chaotic pixels at the border of the set may escape differently, all others must match closely
+        CHECK(err.misclassified < 1.0f);
+        CHECK(err.iterations < 0.05f);
+        CHECK(err.index <= 1);
+      }
+      uint64_t iterations = 0;
+      unsigned images = 0;
+      double t0 = harness::nowNs(), elapsed;
+      do {
+        iterations += render(v, k, size, esc);
+        images++;
+      } while ((elapsed = harness::nowNs() - t0) < ms * 1e6);
+      double s = elapsed / 1e9;
+      printf("%-18s %-6s %10.2f %10.1f %8.2f %9.3f %8d\n", k == FIXED ? v.name : "", KERNELS[k], images * size * size / s / 1e6,
+             iterations / s / 1e6, err.misclassified, err.iterations, err.index);
+    }
+  }
+  return harness::finish("bench_fractal");
+}
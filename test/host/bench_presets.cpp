@@ -0,0 +1,64 @@
+/*
+ * Preset file benchmark: presets per second read from presets.json with the object index (readObjectFromFileUsingId())
+ * and by scanning the file for the key (readObjectFromFile(), as before the index), and presets per second saved.
+ * Presets hold the state of a strip with 3 segments. Both reads must return the same presets.
+ *
+ *   bench_presets [--presets=N] [--ms=N] [--quick]
+ */
+#include "harness.h"
+
+static const char *PRESETS = "/presets.json";
+
+static std::string key(int id) { return "\"" + std::to_string(id) + "\":"; }
+
+int main(int argc, char **argv)
+{
+  bool quick   = harness::hasFlag(argc, argv, "--quick");
+  long presets = harness::option(argc, argv, "presets", quick ? 20 : 250);
+  long ms      = harness::option(argc, argv, "ms", quick ? 20 : 1000);
+  presets = constrain(presets, 1, 250);
+
+  harness::setupStrip(300, 3);
+  strip.makeAutoSegments(true);
+  DynamicJsonDocument preset(8192);
+  serializeState(preset.to<JsonObject>(), true);
+
+  for (int id = 1; id <= presets; id++) {
+    preset["n"] = "preset " + std::to_string(id);
+    writeObjectToFileUsingId(PRESETS, id, &preset);
+  }
+  closeFile();
+  File file = WLED_FS.open(PRESETS, "r");
+  printf("%ld presets, %u bytes, %ld ms per run\n", presets, (unsigned)file.size(), ms);
+  file.close();
+
+  DynamicJsonDocument indexed(8192), scanned(8192);
+  for (int id = 1; id <= presets; id++) {
+    CHECK(readObjectFromFileUsingId(PRESETS, id, &indexed));
+    CHECK(readObjectFromFile(PRESETS, key(id).c_str(), &scanned));
+    CHECK(indexed == scanned);
+    CHECK(indexed["n"] == ("preset " + std::to_string(id)).c_str());
+  }
+
+  printf("%-10s %12s\n", "access", "presets/s");
+  for (int access = 0; access < 3; access++) {
+    unsigned n = 0;
+    double t0 = harness::nowNs(), elapsed;
+    do {
+      int id = random(1, presets + 1);
+      switch (access) {
+        case 0: readObjectFromFileUsingId(PRESETS, id, &indexed); break;
+        case 1: readObjectFromFile(PRESETS, key(id).c_str(), &scanned); break;
+        default:
+          preset["n"] = "preset " + std::to_string(id);
+          writeObjectToFileUsingId(PRESETS, id, &preset);
+          closeFile();
+          break;
+      }
+      n++;
+    } while ((elapsed = harness::nowNs() - t0) < ms * 1e6);
+    static const char *ACCESS[] = {"indexed", "scan", "save"};
+    printf("%-10s %12.0f\n", ACCESS[access], n / (elapsed / 1e9));
+  }
+  return harness::finish("bench_presets");
+}
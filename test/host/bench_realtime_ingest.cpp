@@ -0,0 +1,89 @@
+/*
+ * Realtime ingest benchmark: replays DDP and E1.31 frames (as sent by a WLED network bus) into the receive
+ * handlers and reports pixels per second written to the strip, with and without gamma correction.
+ * "bulk" delivers the packets to the DDP/E1.31 listeners (setRealtimePixels()), "per pixel" decodes the same
+ * packets and writes them with setRealtimePixel() one LED at a time, as the handlers did before. Both must
+ * give the same strip contents. strip.show() is not included.
+ *
+ *   bench_realtime_ingest [--leds=N] [--ms=N] [--quick]
+ */
+#include "harness.h"
+
+static const char *PROTOCOLS[] = {"DDP", "E1.31"};
+
+// per pixel replay of a DDP or E1.31 (DMX_MODE_MULTIPLE_RGB, DMX start address 1, first universe 1) packet
+static void perPixel(uint8_t type, const std::vector<uint8_t> &packet)
+{
+  const e131_packet_t *p = reinterpret_cast<const e131_packet_t*>(packet.data());
+  const uint8_t *data;
+  uint16_t start, count;
+  if (type == 0) {
+    start = htonl(p->channelOffset) / 3;
+    count = htons(p->dataLen) / 3;
+    data  = p->data;
+    realtimeLock(realtimeTimeoutMs, REALTIME_MODE_DDP);
+  } else {
+    start = (htons(p->universe) - 1) * 170;
+    count = (htons(p->property_value_count) - 1) / 3;
+    data  = p->property_values + 1;
+    realtimeLock(realtimeTimeoutMs, REALTIME_MODE_E131);
+  }
+  for (uint16_t i = start; i < start + count; i++, data += 3) setRealtimePixel(i, data[0], data[1], data[2], 0);
+}
+
+int main(int argc, char **argv)
+{
+  bool quick = harness::hasFlag(argc, argv, "--quick");
+  long leds  = harness::option(argc, argv, "leds", quick ? 512 : E131_MAX_UNIVERSE_COUNT * 170);
+  leds = MIN(leds, E131_MAX_UNIVERSE_COUNT * 170); // E1.31 receiver handles up to E131_MAX_UNIVERSE_COUNT universes
+  long ms    = harness::option(argc, argv, "ms", quick ? 20 : 1000);
+
+  harness::setupStrip(leds);
+  interfacesInited = true;
+  e131Universe = 1;
+  DMXAddress = 1;
+  DMXMode = DMX_MODE_MULTIPLE_RGB;
+  e131FrameSync = false;
+  realtimeTimeoutMs = 60000;
+  e131.begin(false, E131_DEFAULT_PORT, e131Universe, E131_MAX_UNIVERSE_COUNT);
+  ddp.begin(false, DDP_DEFAULT_PORT);
+
+  std::vector<uint8_t> buffer(leds * 3);
+  for (uint8_t &b : buffer) b = random(256);
+
+  printf("%ld pixels, %ld ms per run\n", leds, ms);
+  printf("%-6s %-5s %-9s %10s %14s\n", "proto", "gamma", "ingest", "frames/s", "pixels/s");
+  for (uint8_t type = 0; type < 2; type++) {
+    // one frame as sent by a network bus
+    std::vector<uint8_t> packet(realtimePacketSize(type));
+    realtimePacketInit(type, packet.data());
+    host::udpCapture(true);
+    realtimeBroadcast(type, IPAddress(192, 168, 1, 50), leds, buffer.data(), packet.data());
+    std::vector<host::UdpPacket> frame = host::sentPackets;
+    host::udpCapture(false);
+    const uint16_t port = type == 0 ? DDP_DEFAULT_PORT : E131_DEFAULT_PORT;
+
+    for (int gamma = 0; gamma < 2; gamma++) {
+      arlsDisableGammaCorrection = !gamma;
+      uint32_t hash[2];
+      for (int pixelwise = 0; pixelwise < 2; pixelwise++) {
+        strip.fill(BLACK);
+        unsigned frames = 0;
+        double t0 = harness::nowNs(), elapsed;
+        do {
+          for (const host::UdpPacket &p : frame) {
+            if (pixelwise) perPixel(type, p.data);
+            else host::asyncUdpReceive(port, p.data.data(), p.data.size());
+          }
+          frames++;
+        } while ((elapsed = harness::nowNs() - t0) < ms * 1e6);
+        hash[pixelwise] = harness::pixelHash();
+        double s = elapsed / 1e9;
+        printf("%-6s %-5s %-9s %10.0f %14.0f\n", PROTOCOLS[type], gamma ? "on" : "off", pixelwise ? "per pixel" : "bulk", frames / s, frames * leds / s);
+      }
+      CHECK_EQ(hash[0], hash[1]);
+    }
+  }
+  arlsDisableGammaCorrection = true;
+  return harness::finish("bench_realtime_ingest");
+}
@@ -0,0 +1,122 @@
+/*
+ * Network bus output benchmark: packets per second sent by realtimeBroadcast() for DDP, E1.31 and Art-Net,
+ * at full and reduced brightness (which scales every channel), against the previous implementation that wrote
+ * each packet byte by byte with scale8() ("per byte", DDP and Art-Net only). Both must send identical packets.
+ * The UDP stub only appends to a buffer, so this measures packet assembly, not the network stack.
+ *
+ *   bench_realtime_send [--leds=N] [--ms=N] [--quick]
+ */
+#include "harness.h"
+
+// protocol constants private to udp.cpp
+#define DDP_FLAGS1_VER1 0x40
+#define DDP_FLAGS1_PUSH 0x01
+#define DDP_ID_DISPLAY 1
+#define DDP_CHANNELS_PER_PACKET 1440
+
+static const IPAddress DEST(192, 168, 1, 50);
+static const char *PROTOCOLS[] = {"DDP", "E1.31", "Art-Net"};
+
+// realtimeBroadcast() before packets were assembled in a preallocated buffer (DDP and Art-Net)
+static uint8_t perByteBroadcast(uint8_t type, IPAddress client, uint16_t length, const uint8_t *buffer, uint8_t bri, bool isRGBW)
+{
+  static const byte ART_NET_HEADER[] = {0x41,0x72,0x74,0x2d,0x4e,0x65,0x74,0x00,0x00,0x50,0x00,0x0e};
+  static size_t sequenceNumber = 0;
+  WiFiUDP udp;
+  const size_t channelCount = length * (isRGBW ? 4 : 3);
+  const size_t perPacket = type == 0 ? DDP_CHANNELS_PER_PACKET : (isRGBW ? 512 : 510);
+  const size_t packetCount = ((channelCount - 1) / perPacket) + 1;
+  uint32_t channel = 0;
+  size_t bufferOffset = 0;
+  if (type == 2) sequenceNumber++;
+  for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
+    size_t packetSize = perPacket;
+    if (currentPacket == packetCount - 1U && (channelCount % perPacket)) packetSize = channelCount % perPacket;
+    if (type == 0) {
+      if (sequenceNumber > 15) sequenceNumber = 0;
+      if (!udp.beginPacket(client, DDP_DEFAULT_PORT)) return 1;
+      udp.write(currentPacket == packetCount - 1U ? DDP_FLAGS1_VER1 | DDP_FLAGS1_PUSH : DDP_FLAGS1_VER1);
+      udp.write(sequenceNumber++ & 0x0F);
+      udp.write(isRGBW ? DDP_TYPE_RGBW32 : DDP_TYPE_RGB24);
+      udp.write(DDP_ID_DISPLAY);
+      udp.write(0xFF & (channel >> 24));
+      udp.write(0xFF & (channel >> 16));
+      udp.write(0xFF & (channel >>  8));
+      udp.write(0xFF & (channel      ));
+      udp.write(0xFF & (packetSize >> 8));
+      udp.write(0xFF & (packetSize     ));
+    } else {
+      if (sequenceNumber > 255) sequenceNumber = 0;
+      if (!udp.beginPacket(client, ARTNET_DEFAULT_PORT)) return 1;
+      udp.write(ART_NET_HEADER, sizeof(ART_NET_HEADER));
+      udp.write(sequenceNumber & 0xFF);
+      udp.write((uint8_t)0x00);
+      udp.write(currentPacket & 0xFF);
+      udp.write((uint8_t)0x00);
+      udp.write(0xFF & (packetSize >> 8));
+      udp.write(0xFF & (packetSize     ));
+    }
+    for (size_t i = 0; i < packetSize; i += (isRGBW ? 4 : 3)) {
+      udp.write(scale8(buffer[bufferOffset++], bri));
+      udp.write(scale8(buffer[bufferOffset++], bri));
+      udp.write(scale8(buffer[bufferOffset++], bri));
+      if (isRGBW) udp.write(scale8(buffer[bufferOffset++], bri));
+    }
+    if (!udp.endPacket()) return 1;
+    channel += packetSize;
+  }
+  return 0;
+}
+
+// packets of one frame with sequence numbers cleared
+static std::vector<std::vector<uint8_t>> capture(bool perByte, uint8_t type, uint16_t leds, const uint8_t *buffer, uint8_t *packet, uint8_t bri, bool rgbw)
+{
+  host::udpCapture(true);
+  if (perByte) perByteBroadcast(type, DEST, leds, buffer, bri, rgbw);
+  else realtimeBroadcast(type, DEST, leds, const_cast<uint8_t*>(buffer), packet, bri, rgbw);
+  std::vector<std::vector<uint8_t>> packets;
+  for (host::UdpPacket &p : host::sentPackets) {
+    p.data[type == 0 ? 1 : 12] = 0;
+    packets.push_back(p.data);
+  }
+  host::udpCapture(false);
+  return packets;
+}
+
+int main(int argc, char **argv)
+{
+  bool quick = harness::hasFlag(argc, argv, "--quick");
+  long leds  = harness::option(argc, argv, "leds", 4096);
+  long ms    = harness::option(argc, argv, "ms", quick ? 20 : 1000);
+
+  interfacesInited = true; // realtimeBroadcast() sends nothing before
+  std::vector<uint8_t> buffer(leds * 4);
+  for (uint8_t &b : buffer) b = random(256);
+
+  printf("%ld pixels, %ld ms per run\n", leds, ms);
+  printf("%-8s %-5s %4s %-9s %12s %12s %10s\n", "protocol", "type", "bri", "assembly", "frames/s", "packets/s", "MB/s");
+  for (uint8_t type = 0; type < 3; type++) {
+    std::vector<uint8_t> packet(realtimePacketSize(type));
+    realtimePacketInit(type, packet.data());
+    for (int rgbw = 0; rgbw < 2; rgbw++) {
+      for (uint8_t bri : {255, 128}) {
+        if (type != 1) CHECK(capture(true, type, leds, buffer.data(), nullptr, bri, rgbw) == capture(false, type, leds, buffer.data(), packet.data(), bri, rgbw));
+        for (int perByte = 0; perByte < 2; perByte++) {
+          if (perByte && type == 1) continue; // E1.31 output did not exist before
+          host::udpCapture(false); // resets counters
+          unsigned frames = 0;
+          double t0 = harness::nowNs(), elapsed;
+          do {
+            if (perByte) perByteBroadcast(type, DEST, leds, buffer.data(), bri, rgbw);
+            else realtimeBroadcast(type, DEST, leds, buffer.data(), packet.data(), bri, rgbw);
+            frames++;
+          } while ((elapsed = harness::nowNs() - t0) < ms * 1e6);
+          double s = elapsed / 1e9;
+          printf("%-8s %-5s %4u %-9s %12.0f %12.0f %10.1f\n", PROTOCOLS[type], rgbw ? "RGBW" : "RGB", bri, perByte ? "per byte" : "buffer",
+                 frames / s, host::sentPacketCount / s, host::sentByteCount / s / 1e6);
+        }
+      }
+    }
+  }
+  return harness::finish("bench_realtime_send");
+}
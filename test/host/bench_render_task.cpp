@@ -0,0 +1,104 @@
+/*
+ * Render task benchmark: runs WLED setup() and loop() on the real clock with busses that take 30us per LED to
+ * send a frame, and measures frame rate, loop() duration and the time from a color change made in loop() to
+ * the next shown frame. Built twice: bench_render_task renders in loop(), bench_render_task_rt with
+ * WLED_ENABLE_RENDER_TASK (and WLED_ENABLE_PARALLEL_RENDER) renders on its own task.
+ *
+ *   bench_render_task[_rt] [--leds=N] [--busses=N] [--fps=N] [--mode=ID] [--ms=N] [--quick]
+ */
+#include "harness.h"
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+static std::atomic<uint32_t> shownFrames(0);
+static std::atomic<bool>     changePending(false);
+static std::atomic<double>   changeTime(0);
+static std::vector<double>   latencies; // only written by the show callback while changePending is set
+
+static void countingShowCallback()
+{
+  handleOverlayDraw();
+  shownFrames++;
+  if (changePending) {
+    latencies.push_back(harness::nowNs() - changeTime);
+    changePending = false;
+  }
+}
+
+int main(int argc, char **argv)
+{
+  bool quick  = harness::hasFlag(argc, argv, "--quick");
+  long leds   = harness::option(argc, argv, "leds", quick ? 200 : 1000);
+  long count  = harness::option(argc, argv, "busses", 2);
+  long fps    = harness::option(argc, argv, "fps", 120);
+  long mode   = harness::option(argc, argv, "mode", FX_MODE_COLORWAVES);
+  long ms     = harness::option(argc, argv, "ms", quick ? 300 : 5000);
+
+  host::realTime();
+  host::busWireTime(true);
+  harness::realTime = true;
+  WLED::instance().setup();
+
+  strip.lock();
+  harness::setupStrip(leds / count, count);
+  harness::setMode(mode);
+  strip.setTargetFps(fps);
+  strip.setShowCallback(countingShowCallback);
+  setValuesFromMainSeg(); // colorUpdated() applies global values (effectCurrent...) to segments
+  fadeTransition = false;
+  strip.unlock();
+
+  #ifdef WLED_ENABLE_RENDER_TASK
+  const char *variant = "render task";
+  #else
+  const char *variant = "in loop()";
+  #endif
+  printf("%s: %u LEDs on %ld busses, target %ld FPS, effect %ld, %ld ms\n", variant, strip.getLengthTotal(), count, fps, mode, ms);
+
+  // let start-up (boot fade, first frames) pass before measuring
+  for (double t0 = harness::nowNs(); harness::nowNs() - t0 < 200e6; ) WLED::instance().loop();
+
+  std::vector<double> loopNs;
+  loopNs.reserve(1 << 20);
+  latencies.reserve(1024);
+  double start = harness::nowNs(), lastChange = start;
+  uint32_t frames0 = shownFrames;
+  uint8_t hue = 0;
+  while (harness::nowNs() - start < ms * 1e6) {
+    double t0 = harness::nowNs();
+    if (!changePending && t0 - lastChange > 50e6) { // a color change as made by a JSON or UDP handler
+      strip.lock();
+      col[0] = hue; col[1] = 255 - hue; col[2] = 128;
+      colorUpdated(CALL_MODE_DIRECT_CHANGE);
+      hue += 16;
+      changeTime = harness::nowNs();
+      changePending = true;
+      strip.unlock();
+      lastChange = t0;
+    }
+    WLED::instance().loop();
+    loopNs.push_back(harness::nowNs() - t0);
+  }
+  double elapsed = (harness::nowNs() - start) / 1e9;
+  uint32_t frames = shownFrames - frames0;
+
+  strip.lock(); // keep render task off the strip from here on
+  std::sort(loopNs.begin(), loopNs.end());
+  std::vector<double> lat(latencies);
+  std::sort(lat.begin(), lat.end());
+  double loopAvg = 0;
+  for (double t : loopNs) loopAvg += t;
+  loopAvg /= loopNs.size();
+  printf("frames/s        %10.1f\n", frames / elapsed);
+  printf("loop()/s        %10.0f\n", loopNs.size() / elapsed);
+  printf("loop() avg us   %10.1f\n", loopAvg / 1e3);
+  printf("loop() p99 us   %10.1f\n", loopNs[loopNs.size() * 99 / 100] / 1e3);
+  printf("loop() max us   %10.1f\n", loopNs.back() / 1e3);
+  if (!lat.empty()) {
+    printf("change->shown avg ms %5.2f\n", std::accumulate(lat.begin(), lat.end(), 0.0) / lat.size() / 1e6);
+    printf("change->shown max ms %5.2f\n", lat.back() / 1e6);
+  }
+  CHECK(frames > 0);
+  return harness::finish("bench_render_task");
+}
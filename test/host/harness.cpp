@@ -0,0 +1,120 @@
+#include "harness.h"
+
+namespace harness {
+
+unsigned failures = 0;
+bool realTime = false;
+
+static void initStrip()
+{
+  strip.finalizeInit();
+  strip.resetSegments();
+  strip.setTransition(0);
+  strip.setBrightness(255, true);
+  bri = briT = 255;
+  strip.trigger();
+}
+
+void setupStrip(uint16_t length, uint8_t count, bool rgbw)
+{
+  if (!realTime) host::setMillis(1000);
+  busses.removeAll();
+  strip.isMatrix = false;
+  strip.panel.clear();
+  strip.panels = 0;
+  static const uint8_t outputPins[] = {2, 4, 5, 12, 13, 14, 15, 16, 17, 18, 19, 21, 22, 23}; // ESP32 pins not used by flash
+  for (uint8_t i = 0; i < count && i < sizeof(outputPins); i++) {
+    uint8_t pins[] = {outputPins[i]};
+    BusConfig bc(rgbw ? TYPE_SK6812_RGBW : TYPE_WS2812_RGB, pins, i * length, length, COL_ORDER_GRB, false, 0, rgbw ? RGBW_MODE_AUTO_BRIGHTER : RGBW_MODE_MANUAL_ONLY);
+    busses.add(bc);
+  }
+  initStrip();
+}
+
+void setupMatrix(uint16_t width, uint16_t height)
+{
+  if (!realTime) host::setMillis(1000);
+  busses.removeAll();
+  uint8_t pins[] = {2};
+  BusConfig bc(TYPE_WS2812_RGB, pins, 0, width * height);
+  busses.add(bc);
+  strip.isMatrix = true;
+  strip.panel.clear();
+  for (uint16_t y = 0; y < height; y += 32) {
+    for (uint16_t x = 0; x < width; x += 32) {
+      WS2812FX::Panel p;
+      p.xOffset = x;
+      p.yOffset = y;
+      p.width  = std::min<uint16_t>(32, width - x);
+      p.height = std::min<uint16_t>(32, height - y);
+      strip.panel.push_back(p);
+    }
+  }
+  strip.panels = strip.panel.size();
+  initStrip(); // finalizeInit() calls setUpMatrix()
+}
+
+void setMode(uint8_t mode, int segment)
+{
+  for (size_t i = 0; i < strip.getSegmentsNum(); i++) {
+    if (segment >= 0 && (int)i != segment) continue;
+    Segment &seg = strip.getSegment(i);
+    seg.setMode(mode, true);
+    seg.markForReset();
+  }
+  strip.trigger();
+}
+
+void frame(uint16_t ms)
+{
+  host::advance(ms ? ms : strip.getFrameTime());
+  strip.trigger(); // render every segment regardless of the delay its effect asked for
+  strip.service();
+}
+
+void frames(unsigned n, uint16_t ms)
+{
+  while (n--) frame(ms);
+}
+
+uint32_t pixelHash()
+{
+  uint32_t h = 2166136261u;
+  for (unsigned i = 0; i < strip.getLengthTotal(); i++) {
+    uint32_t c = strip.getPixelColor(i);
+    for (int b = 0; b < 4; b++) { h ^= (c >> (8*b)) & 0xFF; h *= 16777619u; }
+  }
+  return h;
+}
+
+bool hasFlag(int argc, char **argv, const char *flag)
+{
+  for (int i = 1; i < argc; i++) if (!strcmp(argv[i], flag)) return true;
+  return false;
+}
+
+long option(int argc, char **argv, const char *name, long def)
+{
+  size_t n = strlen(name);
+  for (int i = 1; i < argc; i++) {
+    if (!strncmp(argv[i], "--", 2) && !strncmp(argv[i] + 2, name, n) && argv[i][2 + n] == '=') return atol(argv[i] + 3 + n);
+  }
+  return def;
+}
+
+void fail(const char *file, int line, const std::string &what)
+{
+  failures++;
+  fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what.c_str());
+}
+
+int finish(const char *name)
+{
+  if (failures) fprintf(stderr, "%s: %u check(s) failed\n", name, failures);
+  else printf("%s: all checks passed\n", name);
+  fflush(stdout);
+  // a render task (if one was started) never returns, skip static destructors that would race with it
+  _exit(failures ? 1 : 0);
+}
+
+}
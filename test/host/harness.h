@@ -0,0 +1,39 @@
+#pragma once
+/*
+ * Helpers shared by the host tests and benchmarks: strip set-up, frame stepping, timing and checks.
+ */
+#include "wled.h"
+#include <chrono>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace harness {
+
+  // set-up functions stop the clock at 1000 ms unless realTime is set
+  extern bool realTime;
+  // replace the busses by `busses` WS2812 (or SK6812 RGBW) busses of `length` LEDs each and (re)initialise the strip
+  void setupStrip(uint16_t length, uint8_t busses = 1, bool rgbw = false);
+  // width x height matrix made of panels of at most 32x32 LEDs, on a single bus
+  void setupMatrix(uint16_t width, uint16_t height);
+  // set segment 0 (or all segments) to effect `mode` with default parameters and mark it for reset
+  void setMode(uint8_t mode, int segment = 0);
+  // advance the clock by one frame time and let the strip render and show
+  void frame(uint16_t ms = 0);
+  void frames(unsigned n, uint16_t ms = 0);
+  // FNV-1a hash of the colors of all LEDs (strip.getPixelColor())
+  uint32_t pixelHash();
+
+  inline double nowNs() { return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count(); }
+  bool hasFlag(int argc, char **argv, const char *flag);
+  // value of "--name=value" or def
+  long option(int argc, char **argv, const char *name, long def);
+
+  // test checks: failures are reported and counted, finish() returns the exit code
+  extern unsigned failures;
+  void fail(const char *file, int line, const std::string &what);
+  int finish(const char *name);
+}
+
+#define CHECK(cond) do { if (!(cond)) harness::fail(__FILE__, __LINE__, #cond); } while (0)
+#define CHECK_EQ(a, b) do { auto _a = (a); auto _b = (b); if (!(_a == _b)) harness::fail(__FILE__, __LINE__, std::string(#a " == " #b " (") + std::to_string((long long)_a) + " != " + std::to_string((long long)_b) + ")"); } while (0)
@@ -0,0 +1,425 @@
+#pragma once
+/*
+ * Host build: minimal Arduino core (ESP32 flavour) for running WLED sources on Linux.
+ * Only what WLED uses is provided; hardware functions are no-ops.
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdarg.h>
+#include <time.h>
+#include <algorithm>
+#include <functional>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+typedef unsigned int word;
+inline uint16_t makeWord(uint8_t h, uint8_t l) { return (h << 8) | l; }
+#define word(...) makeWord(__VA_ARGS__)
+
+#define PROGMEM
+#define PGM_P const char*
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+#define RTC_DATA_ATTR
+#define PSTR(s) (s)
+class __FlashStringHelper;
+#define FPSTR(p) ((const __FlashStringHelper *)(p))
+#define F(s) ((const __FlashStringHelper *)(s))
+#define pgm_read_byte(a) (*(const uint8_t*)(a))
+#define pgm_read_byte_near(a) (*(const uint8_t*)(a))
+#define pgm_read_word(a) (*(const uint16_t*)(a))
+// typed read where possible: WLED also uses pgm_read_dword() for (32 bit) pointers
+inline uint32_t pgm_read_dword_host(const void *a) { return *(const uint32_t*)a; }
+template<class T> inline T pgm_read_dword_host(T const *a) { return *a; }
+#define pgm_read_dword(a) pgm_read_dword_host(a)
+#define pgm_read_ptr(a) (*(void* const*)(a))
+#define pgm_read_float(a) (*(const float*)(a))
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcat_P strcat
+#define strncat_P strncat
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+#define strstr_P strstr
+#define strlen_P strlen
+#define strchr_P strchr
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
+#define sscanf_P sscanf
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define INPUT_PULLDOWN 3
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define LED_BUILTIN 2
+#define RX 3
+#define TX 1
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+using std::min; using std::max;
+// size_t is 32 bit on the ESP32, allow the mixed integer types that are identical there
+template<class T, class U> inline typename std::common_type<T,U>::type min(T a, U b) { return b < a ? b : a; }
+template<class T, class U> inline typename std::common_type<T,U>::type max(T a, U b) { return a < b ? b : a; }
+#define radians(deg) ((deg)*DEG_TO_RAD)
+#define degrees(rad) ((rad)*RAD_TO_DEG)
+#define sq(x) ((x)*(x))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  const long dividend = out_max - out_min, divisor = in_max - in_min, delta = x - in_min;
+  if (divisor == 0) return -1;
+  return (delta * dividend + (divisor / 2)) / divisor + out_min;
+}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return LOW; }
+inline int analogRead(uint8_t) { return 0; }
+inline void analogWrite(uint8_t, int) {}
+inline uint16_t analogReadMilliVolts(uint8_t) { return 0; }
+inline double ledcSetup(uint8_t, double freq, uint8_t) { return freq; }
+inline void ledcAttachPin(uint8_t, uint8_t) {}
+inline void ledcDetachPin(uint8_t) {}
+inline void ledcWrite(uint8_t, uint32_t) {}
+inline uint16_t touchRead(uint8_t) { return 0; }
+inline int digitalPinToInterrupt(int p) { return p; }
+inline bool digitalPinIsValid(int p) { return p >= 0 && p < 40 && p != 20 && p != 24 && (p < 28 || p > 31); }
+inline bool digitalPinCanOutput(int p) { return digitalPinIsValid(p) && p < 34; }
+inline int8_t digitalPinToAnalogChannel(uint8_t) { return -1; }
+inline bool psramFound() { return false; }
+inline void *ps_malloc(size_t n) { return malloc(n); }
+inline void *ps_calloc(size_t n, size_t s) { return calloc(n, s); }
+inline void *ps_realloc(void *p, size_t n) { return realloc(p, n); }
+uint32_t esp_random();
+int64_t esp_timer_get_time();
+inline uint32_t getCpuFrequencyMhz() { return 240; }
+inline float temperatureRead() { return 40.0f; }
+inline uint32_t crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len) {
+  crc = ~crc;
+  while (len--) { crc ^= *buf++; for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1))); }
+  return ~crc;
+}
+inline int esp_reset_reason() { return 1; }
+#define ESP_RST_POWERON 1
+#define CONFIG_IDF_TARGET_ESP32 1
+#define ESP_IDF_VERSION_MAJOR 4
+#define ESP_IDF_VERSION_MINOR 4
+#define ESP_IDF_VERSION_VAL(a,b,c) ((a)*10000+(b)*100+(c))
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(4,4,0)
+#define ESP_ARDUINO_VERSION_MAJOR 2
+static const uint8_t SDA = 21, SCL = 22, MOSI = 23, MISO = 19, SCK = 18, SS = 5;
+
+// FreeRTOS (tasks are threads, see freertos.cpp)
+typedef void* TaskHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef void* QueueHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+#define portMAX_DELAY 0xffffffff
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(x) (x)
+#define tskIDLE_PRIORITY 0
+#define configMAX_PRIORITIES 25
+typedef void (*TaskFunction_t)(void*);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *param, UBaseType_t prio, TaskHandle_t *handle, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *param, UBaseType_t prio, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t);
+void vTaskDelay(TickType_t ticks);
+inline void vTaskSuspend(TaskHandle_t) {}
+inline void vTaskResume(TaskHandle_t) {}
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait);
+void xTaskNotifyGive(TaskHandle_t task);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+inline UBaseType_t uxTaskPriorityGet(TaskHandle_t) { return 1; }
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 4096; }
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+SemaphoreHandle_t xSemaphoreCreateBinary();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t, TickType_t);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t);
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t);
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t);
+void vSemaphoreDelete(SemaphoreHandle_t);
+BaseType_t xPortGetCoreID();
+typedef struct { volatile uint32_t owner; volatile uint32_t count; } portMUX_TYPE; // recursive spinlock, owner is a thread id
+#define portMUX_INITIALIZER_UNLOCKED {0,0}
+void portENTER_CRITICAL(portMUX_TYPE*);
+void portEXIT_CRITICAL(portMUX_TYPE*);
+#define portENTER_CRITICAL_ISR portENTER_CRITICAL
+#define portEXIT_CRITICAL_ISR portEXIT_CRITICAL
+
+class String;
+class Printable;
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) { size_t n = 0; while (size--) n += write(*buffer++); return n; }
+  size_t write(const char *str) { return str ? write((const uint8_t*)str, strlen(str)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+  size_t print(const __FlashStringHelper *s) { return write((const char*)s); }
+  size_t print(const String &s);
+  size_t print(const char s[]) { return write(s); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char n, int base = DEC) { return print((unsigned long long)n, base); }
+  size_t print(int n, int base = DEC) { return print((long long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((unsigned long long)n, base); }
+  size_t print(long n, int base = DEC) { return print((long long)n, base); }
+  size_t print(unsigned long n, int base = DEC) { return print((unsigned long long)n, base); }
+  size_t print(long long n, int base = DEC);
+  size_t print(unsigned long long n, int base = DEC);
+  size_t print(double n, int digits = 2);
+  size_t print(const Printable &p);
+  template<typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+  template<typename T> size_t println(T v, int f) { size_t n = print(v, f); return n + println(); }
+  size_t println(void) { return write("\r\n"); }
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+  size_t printf_P(const char *format, ...);
+  virtual void flush() {}
+  virtual int availableForWrite() { return 0; }
+};
+class Printable { public: virtual ~Printable() {} virtual size_t printTo(Print &p) const = 0; };
+
+class Stream : public Print {
+protected:
+  unsigned long _timeout = 1000;
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long t) { _timeout = t; }
+  bool find(const char *target);
+  size_t readBytes(char *buffer, size_t length);
+  size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char*)buffer, length); }
+  size_t readBytesUntil(char terminator, char *buffer, size_t length);
+  String readString();
+  String readStringUntil(char terminator);
+};
+
+class String {
+  std::string _s;
+  static std::string num(long long v, int base);
+  static std::string unum(unsigned long long v, int base);
+  static std::string flt(double v, unsigned decimals) { char b[64]; snprintf(b, sizeof(b), "%.*f", (int)decimals, v); return b; }
+public:
+  String(const char *cstr = "") : _s(cstr ? cstr : "") {}
+  String(const char *cstr, unsigned int len) : _s(cstr, len) {}
+  String(const String &str) = default;
+  String(String &&rval) = default;
+  String(const std::string &s) : _s(s) {}
+  String(const __FlashStringHelper *str) : _s(str ? (const char*)str : "") {}
+  explicit String(char c) : _s(1, c) {}
+  explicit String(unsigned char v, unsigned char base = 10) : _s(unum(v, base)) {}
+  explicit String(int v, unsigned char base = 10) : _s(num(v, base)) {}
+  explicit String(unsigned int v, unsigned char base = 10) : _s(unum(v, base)) {}
+  explicit String(long v, unsigned char base = 10) : _s(num(v, base)) {}
+  explicit String(unsigned long v, unsigned char base = 10) : _s(unum(v, base)) {}
+  explicit String(float v, unsigned int decimals = 2) : _s(flt(v, decimals)) {}
+  explicit String(double v, unsigned int decimals = 2) : _s(flt(v, decimals)) {}
+  ~String() {}
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+  unsigned int length(void) const { return _s.length(); }
+  String &operator =(const String &rhs) = default;
+  String &operator =(String &&rval) = default;
+  String &operator =(const char *cstr) { _s = cstr ? cstr : ""; return *this; }
+  String &operator =(const __FlashStringHelper *str) { _s = str ? (const char*)str : ""; return *this; }
+  bool concat(const String &str) { _s += str._s; return true; }
+  bool concat(const char *cstr) { if (cstr) _s += cstr; return true; }
+  bool concat(const char *cstr, unsigned int length) { _s.append(cstr, length); return true; }
+  bool concat(char c) { _s += c; return true; }
+  bool concat(unsigned char c) { _s += unum(c, 10); return true; }
+  bool concat(int num) { _s += String::num(num, 10); return true; }
+  bool concat(unsigned int num) { _s += unum(num, 10); return true; }
+  bool concat(long num) { _s += String::num(num, 10); return true; }
+  bool concat(unsigned long num) { _s += unum(num, 10); return true; }
+  bool concat(float num) { _s += flt(num, 2); return true; }
+  bool concat(double num) { _s += flt(num, 2); return true; }
+  bool concat(const __FlashStringHelper *str) { return concat((const char*)str); }
+  template<class T> String &operator +=(T rhs) { concat(rhs); return *this; }
+  explicit operator bool() const { return true; }
+  int compareTo(const String &s) const { return _s.compare(s._s); }
+  bool equals(const String &s) const { return _s == s._s; }
+  bool equals(const char *cstr) const { return _s == (cstr ? cstr : ""); }
+  bool operator ==(const String &rhs) const { return equals(rhs); }
+  bool operator ==(const char *cstr) const { return equals(cstr); }
+  bool operator !=(const String &rhs) const { return !equals(rhs); }
+  bool operator !=(const char *cstr) const { return !equals(cstr); }
+  bool operator <(const String &rhs) const { return _s < rhs._s; }
+  bool equalsIgnoreCase(const String &s) const { return strcasecmp(c_str(), s.c_str()) == 0; }
+  bool startsWith(const String &prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+  bool endsWith(const String &suffix) const { return _s.size() >= suffix._s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0; }
+  char charAt(unsigned int index) const { return index < _s.size() ? _s[index] : 0; }
+  void setCharAt(unsigned int index, char c) { if (index < _s.size()) _s[index] = c; }
+  char operator [](unsigned int index) const { return charAt(index); }
+  char &operator [](unsigned int index) { return _s[index]; }
+  void getBytes(unsigned char *buf, unsigned int bufsize, unsigned int index = 0) const { toCharArray((char*)buf, bufsize, index); }
+  void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const {
+    if (!bufsize || !buf) return;
+    size_t n = index < _s.size() ? std::min<size_t>(bufsize - 1, _s.size() - index) : 0;
+    memcpy(buf, _s.data() + (n ? index : 0), n); buf[n] = 0;
+  }
+  const char *c_str() const { return _s.c_str(); }
+  char *begin() { return &_s[0]; }
+  char *end() { return &_s[0] + _s.size(); }
+  const char *begin() const { return _s.data(); }
+  const char *end() const { return _s.data() + _s.size(); }
+  int indexOf(char ch, unsigned int fromIndex = 0) const { size_t p = _s.find(ch, fromIndex); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const String &str, unsigned int fromIndex = 0) const { size_t p = _s.find(str._s, fromIndex); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const char *str, unsigned int fromIndex = 0) const { size_t p = _s.find(str, fromIndex); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const __FlashStringHelper *str, unsigned int fromIndex = 0) const { return indexOf((const char*)str, fromIndex); }
+  int lastIndexOf(char ch) const { size_t p = _s.rfind(ch); return p == std::string::npos ? -1 : (int)p; }
+  int lastIndexOf(const String &str) const { size_t p = _s.rfind(str._s); return p == std::string::npos ? -1 : (int)p; }
+  String substring(unsigned int beginIndex) const { return beginIndex < _s.size() ? String(_s.substr(beginIndex)) : String(); }
+  String substring(unsigned int beginIndex, unsigned int endIndex) const {
+    if (beginIndex > endIndex) std::swap(beginIndex, endIndex);
+    if (beginIndex >= _s.size()) return String();
+    return String(_s.substr(beginIndex, endIndex - beginIndex));
+  }
+  void replace(char find, char replace) { std::replace(_s.begin(), _s.end(), find, replace); }
+  void replace(const String &find, const String &replace) {
+    if (find._s.empty()) return;
+    for (size_t p = 0; (p = _s.find(find._s, p)) != std::string::npos; p += replace._s.size()) _s.replace(p, find._s.size(), replace._s);
+  }
+  void remove(unsigned int index) { if (index < _s.size()) _s.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < _s.size()) _s.erase(index, count); }
+  void toLowerCase(void) { for (auto &c : _s) c = tolower(c); }
+  void toUpperCase(void) { for (auto &c : _s) c = toupper(c); }
+  void trim(void) { size_t b = _s.find_first_not_of(" \t\r\n"); size_t e = _s.find_last_not_of(" \t\r\n"); _s = b == std::string::npos ? "" : _s.substr(b, e - b + 1); }
+  long toInt(void) const { return atol(_s.c_str()); }
+  float toFloat(void) const { return atof(_s.c_str()); }
+  double toDouble(void) const { return atof(_s.c_str()); }
+  friend String operator+(const String &lhs, const String &rhs) { return String(lhs._s + rhs._s); }
+};
+inline String operator+(const String &lhs, const char *rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const char *lhs, const String &rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, const __FlashStringHelper *rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, char rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, int rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, unsigned int rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, long rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(const String &lhs, unsigned long rhs) { String s(lhs); s.concat(rhs); return s; }
+inline String operator+(char lhs, const String &rhs) { String s(lhs); s.concat(rhs); return s; }
+class StringSumHelper : public String { public: using String::String; StringSumHelper(const String &s) : String(s) {} };
+inline size_t Print::print(const String &s) { return write((const uint8_t*)s.c_str(), s.length()); }
+
+// Serial prints to stdout (output is discarded unless host::serialEcho(true)), reads from a buffer fed by tests
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud, uint32_t config = 0, int8_t rxPin = -1, int8_t txPin = -1, bool invert = false, unsigned long timeout_ms = 20000UL, uint8_t rxfifo_full_thrhd = 112) {}
+  void end(bool = true) {}
+  int available() override;
+  int peek() override;
+  int read() override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buf, size_t n) override;
+  using Print::write;
+  void flush() override {}
+  void updateBaudRate(unsigned long) {}
+  size_t setRxBufferSize(size_t n) { return n; }
+  void setDebugOutput(bool) {}
+  operator bool() const { return true; }
+  int availableForWrite() override { return 128; }
+};
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+#define SERIAL_8N1 0x800001c
+
+class EspClass {
+public:
+  uint32_t getFreeHeap();
+  uint32_t getHeapSize() { return 320000; }
+  uint32_t getMaxAllocHeap() { return getFreeHeap() / 2; }
+  uint32_t getMinFreeHeap() { return getFreeHeap(); }
+  uint32_t getPsramSize() { return 0; }
+  uint32_t getFreePsram() { return 0; }
+  uint32_t getMinFreePsram() { return 0; }
+  uint32_t getMaxAllocPsram() { return 0; }
+  uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+  uint32_t getFlashChipSpeed() { return 80000000; }
+  uint32_t getCpuFreqMHz() { return 240; }
+  uint32_t getCycleCount() { return (uint32_t)(esp_timer_get_time() * 240); }
+  uint32_t getFreeSketchSpace() { return 1536 * 1024; }
+  uint32_t getSketchSize() { return 1024 * 1024; }
+  const char *getSdkVersion() { return "host"; }
+  const char *getChipModel() { return "host"; }
+  uint8_t getChipCores() { return 2; }
+  uint8_t getChipRevision() { return 3; }
+  uint64_t getEfuseMac() { return 0x0000a1b2c3d4e5f6ULL; }
+  void restart();
+  void deepSleep(uint64_t) {}
+};
+extern EspClass ESP;
+
+#include "IPAddress.h"
+
+char *itoa(int value, char *str, int base);
+char *utoa(unsigned value, char *str, int base);
+char *ltoa(long value, char *str, int base);
+char *ultoa(unsigned long value, char *str, int base);
+char *dtostrf(double val, signed char width, unsigned char prec, char *s);
+#if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+inline size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) { size_t n = len < size - 1 ? len : size - 1; memcpy(dst, src, n); dst[n] = 0; }
+  return len;
+}
+inline size_t strlcat(char *dst, const char *src, size_t size) {
+  size_t dl = strnlen(dst, size);
+  return dl == size ? size + strlen(src) : dl + strlcpy(dst + dl, src, size - dl);
+}
+#endif
+
+// host build controls (not part of the Arduino API)
+namespace host {
+  void setMillis(uint32_t ms);        // stop the clock at ms, from then on it only moves with delay()/advance()
+  void advance(uint32_t ms);
+  void realTime();                    // follow the monotonic clock again (default)
+  void setFreeHeap(uint32_t bytes);   // value reported by ESP.getFreeHeap()
+  void serialEcho(bool on);           // copy Serial output to stdout
+  void serialInput(const uint8_t *data, size_t len);
+  extern bool restartRequested;       // set by ESP.restart()
+  // digital busses take 30us per LED (+300us reset) to send a frame: show() waits for the previous frame
+  // like NeoPixelBus RMT/I2S methods do and canShow() is false while sending (only with the real clock)
+  void busWireTime(bool on);
+  bool busWireTimeEnabled();
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "Arduino.h"
+#include "WiFiUdp.h"
+#include <arpa/inet.h> // htonl() and friends (lwip)
+class AsyncUDPPacket : public Stream {
+  uint8_t *_data; size_t _len; size_t _pos = 0; IPAddress _remote; uint16_t _port; uint16_t _localPort;
+public:
+  AsyncUDPPacket(uint8_t *data, size_t len, IPAddress remote = IPAddress(192,168,1,2), uint16_t port = 5568, uint16_t localPort = 0) : _data(data), _len(len), _remote(remote), _port(port), _localPort(localPort) {}
+  uint8_t *data() { return _data; }
+  size_t length() { return _len; }
+  bool isBroadcast() { return false; }
+  bool isMulticast() { return false; }
+  bool isIPv6() { return false; }
+  IPAddress localIP() { return IPAddress(192,168,1,10); }
+  uint16_t localPort() { return _localPort; }
+  IPAddress remoteIP() { return _remote; }
+  uint16_t remotePort() { return _port; }
+  size_t write(const uint8_t*, size_t len) override { return len; }
+  size_t write(uint8_t) override { return 1; }
+  int available() override { return _len - _pos; }
+  size_t read(uint8_t *data, size_t len) { size_t n = std::min(len, _len - _pos); memcpy(data, _data + _pos, n); _pos += n; return n; }
+  int read() override { return _pos < _len ? _data[_pos++] : -1; }
+  int peek() override { return _pos < _len ? _data[_pos] : -1; }
+  void flush() override {}
+};
+typedef std::function<void(AsyncUDPPacket &packet)> AuPacketHandlerFunction;
+class AsyncUDP;
+namespace host {
+  void asyncUdpListen(AsyncUDP *udp, uint16_t port); // port 0 removes the listener
+  // delivers a packet to the handler of the AsyncUDP listening on localPort (synchronously, like the async UDP task would)
+  bool asyncUdpReceive(uint16_t localPort, const uint8_t *data, size_t len, IPAddress from = IPAddress(192,168,1,2));
+}
+// packets are delivered by calling the handler (see host::udpReceive() for WiFiUDP)
+class AsyncUDP : public Print {
+  AuPacketHandlerFunction _cb;
+public:
+  ~AsyncUDP() { host::asyncUdpListen(this, 0); }
+  void onPacket(AuPacketHandlerFunction cb) { _cb = cb; }
+  bool listen(uint16_t port) { host::asyncUdpListen(this, port); return true; }
+  bool listenMulticast(const IPAddress, uint16_t port, uint8_t = 1) { host::asyncUdpListen(this, port); return true; }
+  size_t writeTo(const uint8_t *data, size_t len, const IPAddress addr, uint16_t port) { host::udpRecord(addr, port, data, len); return len; }
+  size_t broadcastTo(uint8_t *data, size_t len, uint16_t port) { host::udpRecord(IPAddress(255,255,255,255), port, data, len); return len; }
+  size_t write(const uint8_t*, size_t len) override { return len; }
+  size_t write(uint8_t) override { return 1; }
+  void close() { host::asyncUdpListen(this, 0); }
+  bool connected() { return true; }
+  void deliver(AsyncUDPPacket &p) { if (_cb) _cb(p); }
+};
@@ -0,0 +1,10 @@
+#pragma once
+#include "Arduino.h"
+enum class DNSReplyCode { NoError = 0, FormError, ServerFailure, NonExistentDomain, NotImplemented, Refused };
+class DNSServer {
+public:
+  bool start(const uint16_t &, const String &, const IPAddress &) { return true; }
+  void stop() {}
+  void processNextRequest() {}
+  void setErrorReplyCode(const DNSReplyCode &) {}
+};
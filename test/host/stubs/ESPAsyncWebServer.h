@@ -0,0 +1,419 @@
+#pragma once
+/*
+ * Host build: ESPAsyncWebServer (Aircoookie fork) API without networking.
+ * Requests are created by tests, responses are kept by the request and their content is pulled
+ * with AsyncWebServerRequest::body() the way the TCP stack would (in chunks of a given size).
+ */
+#include "Arduino.h"
+#include "FS.h"
+#include <functional>
+#include <vector>
+#include <list>
+#include <map>
+#include <string>
+#define SPIFFS_EDITOR_AIRCOOOKIE
+
+typedef enum {
+  HTTP_GET     = 0b00000001,
+  HTTP_POST    = 0b00000010,
+  HTTP_DELETE  = 0b00000100,
+  HTTP_PUT     = 0b00001000,
+  HTTP_PATCH   = 0b00010000,
+  HTTP_HEAD    = 0b00100000,
+  HTTP_OPTIONS = 0b01000000,
+  HTTP_ANY     = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebServer; class AsyncWebServerRequest; class AsyncWebServerResponse;
+class AsyncWebHandler; class AsyncStaticWebHandler; class AsyncCallbackWebHandler; class AsyncResponseStream;
+
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+typedef std::function<String(const String&)> AwsTemplateProcessor;
+
+class AsyncWebParameter {
+  String _name, _value; bool _isPost, _isFile;
+public:
+  AsyncWebParameter(const String &name, const String &value, bool post = false, bool file = false) : _name(name), _value(value), _isPost(post), _isFile(file) {}
+  const String &name() const { return _name; }
+  const String &value() const { return _value; }
+  size_t size() const { return _value.length(); }
+  bool isPost() const { return _isPost; }
+  bool isFile() const { return _isFile; }
+};
+class AsyncWebHeader {
+  String _name, _value;
+public:
+  AsyncWebHeader(const String &name, const String &value) : _name(name), _value(value) {}
+  const String &name() const { return _name; }
+  const String &value() const { return _value; }
+  String toString() const { return _name + ": " + _value + "\r\n"; }
+};
+
+class AsyncClient {
+public:
+  IPAddress remoteIP() { return IPAddress(192,168,1,2); }
+  uint16_t remotePort() { return 50000; }
+  bool connected() { return true; }
+  size_t space() { return 5744; }
+};
+
+class AsyncWebServerResponse {
+protected:
+  int _code = 0; String _contentType; size_t _contentLength = 0; bool _sendContentLength = true; bool _chunked = false;
+  size_t _headLength = 0; size_t _sentLength = 0; size_t _ackedLength = 0; size_t _writtenLength = 0;
+  std::vector<AsyncWebHeader> _headers;
+public:
+  AsyncWebServerResponse() {}
+  virtual ~AsyncWebServerResponse() {}
+  virtual void setCode(int code) { _code = code; }
+  virtual void setContentLength(size_t len) { _contentLength = len; }
+  virtual void setContentType(const String &type) { _contentType = type; }
+  virtual void addHeader(const String &name, const String &value) { _headers.emplace_back(name, value); }
+  virtual bool _sourceValid() const { return false; }
+  // host: next part of the content (at most maxLen bytes), 0 at the end
+  virtual size_t _fillBuffer(uint8_t *buf, size_t maxLen) { return 0; }
+  int code() const { return _code; }
+  const String &contentType() const { return _contentType; }
+  size_t contentLength() const { return _contentLength; }
+  bool chunked() const { return _chunked; }
+  const String *header(const char *name) const { for (auto &h : _headers) if (h.name().equalsIgnoreCase(name)) return &h.value(); return nullptr; }
+};
+class AsyncBasicResponse : public AsyncWebServerResponse {
+  String _content; size_t _pos = 0;
+public:
+  AsyncBasicResponse(int code, const String &contentType = String(), const String &content = String()) : _content(content) {
+    _code = code; _contentType = contentType; _contentLength = content.length();
+  }
+  bool _sourceValid() const override { return true; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen) override {
+    size_t n = std::min(maxLen, _content.length() - _pos); memcpy(buf, _content.c_str() + _pos, n); _pos += n; return n;
+  }
+};
+class AsyncAbstractResponse : public AsyncWebServerResponse {
+public:
+  AsyncAbstractResponse(AwsTemplateProcessor callback = nullptr) {}
+  bool _sourceValid() const override { return false; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen) override { return 0; }
+};
+class AsyncCallbackResponse : public AsyncAbstractResponse {
+  AwsResponseFiller _content; size_t _filled = 0;
+public:
+  AsyncCallbackResponse(const String &contentType, size_t len, AwsResponseFiller callback) : _content(callback) {
+    _code = 200; _contentType = contentType; _contentLength = len;
+  }
+  bool _sourceValid() const override { return !!_content; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen) override {
+    if (_filled >= _contentLength) return 0;
+    size_t n = _content(buf, std::min(maxLen, _contentLength - _filled), _filled); _filled += n; return n;
+  }
+};
+class AsyncChunkedResponse : public AsyncAbstractResponse {
+  AwsResponseFiller _content; size_t _filled = 0;
+public:
+  AsyncChunkedResponse(const String &contentType, AwsResponseFiller callback) : _content(callback) {
+    _code = 200; _contentType = contentType; _sendContentLength = false; _chunked = true;
+  }
+  bool _sourceValid() const override { return !!_content; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen) override { size_t n = _content(buf, maxLen, _filled); _filled += n; return n; }
+};
+class AsyncProgmemResponse : public AsyncAbstractResponse {
+  const uint8_t *_content; size_t _pos = 0;
+public:
+  AsyncProgmemResponse(int code, const String &contentType, const uint8_t *content, size_t len) : _content(content) {
+    _code = code; _contentType = contentType; _contentLength = len;
+  }
+  bool _sourceValid() const override { return true; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen) override {
+    size_t n = std::min(maxLen, _contentLength - _pos); memcpy(buf, _content + _pos, n); _pos += n; return n;
+  }
+};
+class AsyncFileResponse : public AsyncAbstractResponse {
+  File _content;
+public:
+  AsyncFileResponse(File content, const String &contentType) : _content(content) {
+    _code = 200; _contentType = contentType; _contentLength = content ? content.size() : 0;
+  }
+  ~AsyncFileResponse() { if (_content) _content.close(); }
+  bool _sourceValid() const override { return !!_content; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen) override { return _content.read(buf, maxLen); }
+};
+class AsyncResponseStream : public AsyncAbstractResponse, public Print {
+  std::string _content; size_t _pos = 0;
+public:
+  AsyncResponseStream(const String &contentType, size_t bufferSize) { _code = 200; _contentType = contentType; _content.reserve(bufferSize); }
+  bool _sourceValid() const override { return true; }
+  size_t _fillBuffer(uint8_t *buf, size_t maxLen) override {
+    size_t n = std::min(maxLen, _content.size() - _pos); memcpy(buf, _content.data() + _pos, n); _pos += n; return n;
+  }
+  size_t write(const uint8_t *data, size_t len) override { _content.append((const char*)data, len); _contentLength = _content.size(); return len; }
+  size_t write(uint8_t data) override { return write(&data, 1); }
+  using Print::write;
+};
+
+class AsyncWebServerRequest {
+  String _url, _host = "192.168.1.10", _contentType;
+  WebRequestMethodComposite _method;
+  std::vector<AsyncWebHeader> _headers;
+  std::vector<AsyncWebParameter> _params;
+  AsyncClient _client;
+  AsyncWebServerResponse *_response = nullptr;
+public:
+  File _tempFile;
+  void *_tempObject = nullptr;
+  AsyncWebServerRequest(const String &url, WebRequestMethodComposite method = HTTP_GET) : _url(url), _method(method) {}
+  ~AsyncWebServerRequest() { delete _response; if (_tempObject) free(_tempObject); }
+  // host: request set-up and inspection
+  void addHeader(const String &name, const String &value) { _headers.emplace_back(name, value); }
+  void addParam(const String &name, const String &value, bool post = false) { _params.emplace_back(name, value, post); }
+  AsyncWebServerResponse *response() { return _response; }
+  // content of the response, between() is called after each chunk of chunkSize bytes
+  std::string body(size_t chunkSize = 1460, std::function<void()> between = nullptr) {
+    std::string out;
+    if (!_response || !_response->_sourceValid()) return out;
+    std::vector<uint8_t> buf(chunkSize);
+    while (size_t n = _response->_fillBuffer(buf.data(), chunkSize)) {
+      if (n == RESPONSE_TRY_AGAIN) continue;
+      out.append((const char*)buf.data(), n);
+      if (between) between();
+    }
+    return out;
+  }
+
+  AsyncClient *client() { return &_client; }
+  uint8_t version() const { return 1; }
+  WebRequestMethodComposite method() const { return _method; }
+  const String &url() const { return _url; }
+  const String &host() const { return _host; }
+  const String &contentType() const { return _contentType; }
+  size_t contentLength() const { return 0; }
+  bool multipart() const { return false; }
+  const char *methodToString() const { return _method == HTTP_POST ? "POST" : "GET"; }
+  void redirect(const String &url) { AsyncWebServerResponse *r = beginResponse(302); r->addHeader("Location", url); send(r); }
+  void send(AsyncWebServerResponse *response) { delete _response; _response = response; }
+  void send(int code, const String &contentType = String(), const String &content = String()) { send(beginResponse(code, contentType, content)); }
+  void send(FS &fs, const String &path, const String &contentType = String(), bool download = false, AwsTemplateProcessor callback = nullptr) { send(beginResponse(fs, path, contentType, download, callback)); }
+  void send(File content, const String &path, const String &contentType = String(), bool download = false, AwsTemplateProcessor callback = nullptr) { send(beginResponse(content, path, contentType, download, callback)); }
+  void send(const String &contentType, size_t len, AwsResponseFiller callback, AwsTemplateProcessor templateCallback = nullptr) { send(beginResponse(contentType, len, callback)); }
+  void sendChunked(const String &contentType, AwsResponseFiller callback, AwsTemplateProcessor templateCallback = nullptr) { send(beginChunkedResponse(contentType, callback)); }
+  void send_P(int code, const String &contentType, const uint8_t *content, size_t len, AwsTemplateProcessor callback = nullptr) { send(beginResponse_P(code, contentType, content, len)); }
+  void send_P(int code, const String &contentType, PGM_P content, AwsTemplateProcessor callback = nullptr) { send(beginResponse_P(code, contentType, content)); }
+  AsyncWebServerResponse *beginResponse(int code, const String &contentType = String(), const String &content = String()) { return new AsyncBasicResponse(code, contentType, content); }
+  AsyncWebServerResponse *beginResponse(FS &fs, const String &path, const String &contentType = String(), bool download = false, AwsTemplateProcessor callback = nullptr) { return new AsyncFileResponse(fs.open(path, "r"), contentType); }
+  AsyncWebServerResponse *beginResponse(File content, const String &path, const String &contentType = String(), bool download = false, AwsTemplateProcessor callback = nullptr) { return new AsyncFileResponse(content, contentType); }
+  AsyncWebServerResponse *beginResponse(const String &contentType, size_t len, AwsResponseFiller callback, AwsTemplateProcessor templateCallback = nullptr) { return new AsyncCallbackResponse(contentType, len, callback); }
+  AsyncWebServerResponse *beginChunkedResponse(const String &contentType, AwsResponseFiller callback, AwsTemplateProcessor templateCallback = nullptr) { return new AsyncChunkedResponse(contentType, callback); }
+  AsyncResponseStream *beginResponseStream(const String &contentType, size_t bufferSize = 1460) { return new AsyncResponseStream(contentType, bufferSize); }
+  AsyncWebServerResponse *beginResponse_P(int code, const String &contentType, const uint8_t *content, size_t len, AwsTemplateProcessor callback = nullptr) { return new AsyncProgmemResponse(code, contentType, content, len); }
+  AsyncWebServerResponse *beginResponse_P(int code, const String &contentType, PGM_P content, AwsTemplateProcessor callback = nullptr) { return new AsyncProgmemResponse(code, contentType, (const uint8_t*)content, strlen(content)); }
+  size_t headers() const { return _headers.size(); }
+  bool hasHeader(const String &name) const { return getHeader(name) != nullptr; }
+  bool hasHeader(const __FlashStringHelper *data) const { return hasHeader(String(data)); }
+  AsyncWebHeader *getHeader(const String &name) const { for (auto &h : _headers) if (h.name().equalsIgnoreCase(name)) return (AsyncWebHeader*)&h; return nullptr; }
+  AsyncWebHeader *getHeader(const __FlashStringHelper *data) const { return getHeader(String(data)); }
+  AsyncWebHeader *getHeader(size_t num) const { return num < _headers.size() ? (AsyncWebHeader*)&_headers[num] : nullptr; }
+  size_t params() const { return _params.size(); }
+  bool hasParam(const String &name, bool post = false, bool file = false) const { return getParam(name, post, file) != nullptr; }
+  bool hasParam(const __FlashStringHelper *data, bool post = false, bool file = false) const { return hasParam(String(data), post, file); }
+  AsyncWebParameter *getParam(const String &name, bool post = false, bool file = false) const {
+    for (auto &p : _params) if (p.name() == name && p.isPost() == post && p.isFile() == file) return (AsyncWebParameter*)&p;
+    return nullptr;
+  }
+  AsyncWebParameter *getParam(const __FlashStringHelper *data, bool post, bool file) const { return getParam(String(data), post, file); }
+  AsyncWebParameter *getParam(size_t num) const { return num < _params.size() ? (AsyncWebParameter*)&_params[num] : nullptr; }
+  size_t args() const { return _params.size(); }
+  const String &arg(const String &name) const { static String empty; for (auto &p : _params) if (p.name() == name) return p.value(); return empty; }
+  const String &arg(const __FlashStringHelper *data) const { return arg(String(data)); }
+  const String &arg(size_t i) const { static String empty; return i < _params.size() ? _params[i].value() : empty; }
+  const String &argName(size_t i) const { static String empty; return i < _params.size() ? _params[i].name() : empty; }
+  bool hasArg(const char *name) const { for (auto &p : _params) if (p.name() == name) return true; return false; }
+  bool hasArg(const __FlashStringHelper *data) const { return hasArg((const char*)data); }
+  const String &header(const char *name) const { static String empty; AsyncWebHeader *h = getHeader(String(name)); return h ? h->value() : empty; }
+  void addInterestingHeader(const String &name) {}
+};
+
+class AsyncWebHandler {
+public:
+  virtual ~AsyncWebHandler() {}
+  virtual bool canHandle(AsyncWebServerRequest *request) { return false; }
+  virtual void handleRequest(AsyncWebServerRequest *request) {}
+  virtual void handleUpload(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final) {}
+  virtual void handleBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {}
+  virtual bool isRequestHandlerTrivial() { return true; }
+};
+typedef std::function<void(AsyncWebServerRequest *request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total)> ArBodyHandlerFunction;
+class AsyncCallbackWebHandler : public AsyncWebHandler {
+public:
+  String _uri; WebRequestMethodComposite _method = HTTP_ANY; ArRequestHandlerFunction _onRequest; ArUploadHandlerFunction _onUpload; ArBodyHandlerFunction _onBody;
+  void setUri(const String &uri) { _uri = uri; }
+  bool canHandle(AsyncWebServerRequest *request) override { return (_method & request->method()) && request->url() == _uri; }
+  void handleRequest(AsyncWebServerRequest *request) override { if (_onRequest) _onRequest(request); }
+};
+class AsyncStaticWebHandler : public AsyncWebHandler {
+public:
+  AsyncStaticWebHandler &setCacheControl(const char *cache_control) { return *this; }
+};
+
+// handlers are registered but requests are only dispatched by handle() (to on() handlers and onNotFound())
+class AsyncWebServer {
+  std::list<AsyncWebHandler*> _handlers;
+  AsyncStaticWebHandler _static;
+  ArRequestHandlerFunction _notFound;
+public:
+  AsyncWebServer(uint16_t port) {}
+  ~AsyncWebServer() { reset(); }
+  void begin() {}
+  void end() {}
+  AsyncWebHandler &addHandler(AsyncWebHandler *handler) { _handlers.push_back(handler); return *handler; }
+  bool removeHandler(AsyncWebHandler *handler) { _handlers.remove(handler); return true; }
+  AsyncCallbackWebHandler &on(const char *uri, ArRequestHandlerFunction onRequest) { return on(uri, HTTP_ANY, onRequest); }
+  AsyncCallbackWebHandler &on(const char *uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload = nullptr, ArBodyHandlerFunction onBody = nullptr) {
+    AsyncCallbackWebHandler *h = new AsyncCallbackWebHandler();
+    h->_uri = uri; h->_method = method; h->_onRequest = onRequest; h->_onUpload = onUpload; h->_onBody = onBody;
+    _handlers.push_back(h);
+    return *h;
+  }
+  AsyncStaticWebHandler &serveStatic(const char *uri, fs::FS &fs, const char *path, const char *cache_control = NULL) { return _static; }
+  void onNotFound(ArRequestHandlerFunction fn) { _notFound = fn; }
+  void onFileUpload(ArUploadHandlerFunction fn) {}
+  void onRequestBody(ArBodyHandlerFunction fn) {}
+  void reset() { _handlers.clear(); _notFound = nullptr; }
+  // host: dispatch a request like the server would
+  void handle(AsyncWebServerRequest *request) {
+    for (AsyncWebHandler *h : _handlers) if (h->canHandle(request)) { h->handleRequest(request); return; }
+    if (_notFound) _notFound(request);
+  }
+};
+// the host is always connected as a station
+inline bool ON_STA_FILTER(AsyncWebServerRequest *request) { return true; }
+inline bool ON_AP_FILTER(AsyncWebServerRequest *request) { return false; }
+class DefaultHeaders {
+public:
+  void addHeader(const String &name, const String &value) {}
+  static DefaultHeaders &Instance() { static DefaultHeaders d; return d; }
+};
+
+// websockets
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+typedef enum { WS_MSG_SENDING, WS_MSG_SENT, WS_MSG_ERROR } AwsMessageStatus;
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+typedef enum { WS_DISCONNECTED, WS_CONNECTED, WS_DISCONNECTING } AwsClientStatus;
+typedef struct { uint8_t message_opcode; uint32_t num; uint8_t final; uint8_t masked; uint8_t opcode; uint64_t len; uint8_t mask[4]; uint64_t index; } AwsFrameInfo;
+
+class AsyncWebSocketMessageBuffer {
+  std::vector<uint8_t> _data; uint32_t _count = 0; bool _lock = false;
+public:
+  AsyncWebSocketMessageBuffer() {}
+  AsyncWebSocketMessageBuffer(size_t size) : _data(size + 1, 0) {}
+  AsyncWebSocketMessageBuffer(uint8_t *data, size_t size) : _data(data, data + size) { _data.push_back(0); }
+  void operator ++(int i) { _count++; }
+  void operator --(int i) { if (_count) _count--; }
+  bool reserve(size_t size) { _data.assign(size + 1, 0); return true; }
+  void lock() { _lock = true; }
+  void unlock() { _lock = false; }
+  uint8_t *get() { return _data.data(); }
+  size_t length() { return _data.empty() ? 0 : _data.size() - 1; }
+  uint32_t count() { return _count; }
+  bool canDelete() { return !_count && !_lock; }
+};
+
+class AsyncWebSocket;
+// messages sent to a client are recorded in its text/binary lists
+class AsyncWebSocketClient {
+  uint32_t _id; AsyncWebSocket *_server; AsyncClient _client; AwsClientStatus _status = WS_CONNECTED;
+public:
+  std::vector<std::string> texts;
+  std::vector<std::vector<uint8_t>> binaries;
+  size_t hostQueueLength = 0; // reported by queueLength()
+  AsyncWebSocketClient(uint32_t id, AsyncWebSocket *server) : _id(id), _server(server) {}
+  uint32_t id() { return _id; }
+  AwsClientStatus status() { return _status; }
+  AsyncClient *client() { return &_client; }
+  AsyncWebSocket *server() { return _server; }
+  IPAddress remoteIP() { return IPAddress(192,168,1,2); }
+  uint16_t remotePort() { return 50000 + _id; }
+  void close(uint16_t code = 0, const char *message = NULL) { _status = WS_DISCONNECTED; }
+  void ping(uint8_t *data = NULL, size_t len = 0) {}
+  void keepAlivePeriod(uint16_t seconds) {}
+  size_t queueLength() { return hostQueueLength; }
+  size_t queueLen() { return hostQueueLength; }
+  bool queueIsFull() { return hostQueueLength >= 8; }
+  bool canSend() { return !queueIsFull(); }
+  void text(const char *message, size_t len) { texts.emplace_back(message, len); }
+  void text(const char *message) { text(message, strlen(message)); }
+  void text(uint8_t *message, size_t len) { text((const char*)message, len); }
+  void text(char *message) { text((const char*)message); }
+  void text(const String &message) { text(message.c_str(), message.length()); }
+  void text(const __FlashStringHelper *data) { text((const char*)data); }
+  void text(AsyncWebSocketMessageBuffer *buffer) { text((const char*)buffer->get(), strnlen((const char*)buffer->get(), buffer->length())); }
+  void binary(const char *message, size_t len) { binaries.emplace_back((const uint8_t*)message, (const uint8_t*)message + len); }
+  void binary(const char *message) { binary(message, strlen(message)); }
+  void binary(uint8_t *message, size_t len) { binary((const char*)message, len); }
+  void binary(char *message) { binary((const char*)message); }
+  void binary(const String &message) { binary(message.c_str(), message.length()); }
+  void binary(const __FlashStringHelper *data, size_t len) { binary((const char*)data, len); }
+  void binary(AsyncWebSocketMessageBuffer *buffer) { binary((const char*)buffer->get(), buffer->length()); }
+};
+typedef std::function<void(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)> AwsEventHandler;
+class AsyncWebSocket : public AsyncWebHandler {
+  String _url; bool _enabled = true; AwsEventHandler _handler; uint32_t _nextId = 1;
+  std::list<AsyncWebSocketClient*> _clients;
+  std::list<AsyncWebSocketMessageBuffer*> _buffers;
+public:
+  bool hostFailAlloc = false; // makeBuffer() returns nullptr
+  AsyncWebSocket(const String &url) : _url(url) {}
+  ~AsyncWebSocket() { for (auto c : _clients) delete c; for (auto b : _buffers) delete b; }
+  // host: client connections and incoming messages
+  AsyncWebSocketClient *hostConnect() {
+    AsyncWebSocketClient *c = new AsyncWebSocketClient(_nextId++, this);
+    _clients.push_back(c);
+    if (_handler) _handler(this, c, WS_EVT_CONNECT, nullptr, nullptr, 0);
+    return c;
+  }
+  void hostDisconnect(AsyncWebSocketClient *c) {
+    if (_handler) _handler(this, c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+    _clients.remove(c); delete c;
+  }
+  void hostReceive(AsyncWebSocketClient *c, const char *text) {
+    AwsFrameInfo info = {}; info.final = 1; info.opcode = WS_TEXT; info.len = strlen(text);
+    std::vector<uint8_t> d(text, text + info.len + 1);
+    if (_handler) _handler(this, c, WS_EVT_DATA, &info, d.data(), info.len);
+  }
+  const char *url() const { return _url.c_str(); }
+  void enable(bool e) { _enabled = e; }
+  bool enabled() const { return _enabled; }
+  bool availableForWriteAll() { return true; }
+  bool availableForWrite(uint32_t id) { return true; }
+  size_t count() const { size_t n = 0; for (auto c : _clients) if (c->status() == WS_CONNECTED) n++; return n; }
+  AsyncWebSocketClient *client(uint32_t id) { for (auto c : _clients) if (c->id() == id && c->status() == WS_CONNECTED) return c; return nullptr; }
+  bool hasClient(uint32_t id) { return client(id) != nullptr; }
+  void close(uint32_t id, uint16_t code = 0, const char *message = NULL) { if (client(id)) client(id)->close(code, message); }
+  void closeAll(uint16_t code = 0, const char *message = NULL) { for (auto c : _clients) c->close(code, message); }
+  void cleanupClients(uint16_t maxClients = 4) {}
+  void text(uint32_t id, const char *message, size_t len) { if (client(id)) client(id)->text(message, len); }
+  void text(uint32_t id, const char *message) { text(id, message, strlen(message)); }
+  void text(uint32_t id, const String &message) { text(id, message.c_str(), message.length()); }
+  void textAll(const char *message, size_t len) { for (auto c : _clients) if (c->status() == WS_CONNECTED) c->text(message, len); }
+  void textAll(const char *message) { textAll(message, strlen(message)); }
+  void textAll(const String &message) { textAll(message.c_str(), message.length()); }
+  void textAll(const __FlashStringHelper *message) { textAll((const char*)message); }
+  void textAll(AsyncWebSocketMessageBuffer *buffer) { for (auto c : _clients) if (c->status() == WS_CONNECTED) c->text(buffer); }
+  void binary(uint32_t id, const char *message, size_t len) { if (client(id)) client(id)->binary(message, len); }
+  void binaryAll(const char *message, size_t len) { for (auto c : _clients) if (c->status() == WS_CONNECTED) c->binary(message, len); }
+  void binaryAll(uint8_t *message, size_t len) { binaryAll((const char*)message, len); }
+  void binaryAll(AsyncWebSocketMessageBuffer *buffer) { for (auto c : _clients) if (c->status() == WS_CONNECTED) c->binary(buffer); }
+  void onEvent(AwsEventHandler handler) { _handler = handler; }
+  AsyncWebSocketMessageBuffer *makeBuffer(size_t size = 0) {
+    if (hostFailAlloc) return nullptr;
+    AsyncWebSocketMessageBuffer *b = new AsyncWebSocketMessageBuffer(size); _buffers.push_back(b); return b;
+  }
+  AsyncWebSocketMessageBuffer *makeBuffer(uint8_t *data, size_t size) {
+    if (hostFailAlloc) return nullptr;
+    AsyncWebSocketMessageBuffer *b = new AsyncWebSocketMessageBuffer(data, size); _buffers.push_back(b); return b;
+  }
+  void _cleanBuffers() { for (auto it = _buffers.begin(); it != _buffers.end(); ) { if ((*it)->canDelete()) { delete *it; it = _buffers.erase(it); } else ++it; } }
+  std::vector<AsyncWebSocketClient*> getClients() const { return std::vector<AsyncWebSocketClient*>(_clients.begin(), _clients.end()); }
+};
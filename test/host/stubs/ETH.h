@@ -0,0 +1,22 @@
+#pragma once
+#include "Arduino.h"
+typedef int eth_phy_type_t; typedef int eth_clock_mode_t;
+#define ETH_PHY_LAN8720 0
+#define ETH_PHY_TLK110 1
+#define ETH_PHY_IP101 2
+#define ETH_CLOCK_GPIO0_IN 0
+#define ETH_CLOCK_GPIO16_OUT 2
+#define ETH_CLOCK_GPIO17_OUT 3
+class ETHClass {
+public:
+  bool begin(uint8_t, int, int, int, eth_phy_type_t, eth_clock_mode_t) { return false; }
+  IPAddress localIP() { return IPAddress(); }
+  IPAddress subnetMask() { return IPAddress(); }
+  IPAddress gatewayIP() { return IPAddress(); }
+  IPAddress dnsIP(uint8_t = 0) { return IPAddress(); }
+  String macAddress() { return String("00:00:00:00:00:00"); }
+  uint8_t *macAddress(uint8_t *m) { memset(m, 0, 6); return m; }
+  bool config(IPAddress, IPAddress, IPAddress, IPAddress = (uint32_t)0, IPAddress = (uint32_t)0) { return true; }
+  bool setHostname(const char*) { return true; }
+};
+extern ETHClass ETH;
@@ -0,0 +1,58 @@
+#pragma once
+#include "Arduino.h"
+#include <memory>
+// filesystem backed by a host directory (see host::fsRoot())
+namespace host { void fsRoot(const char *dir); const char *fsRoot(); }
+namespace fs {
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+struct FileImpl;
+class File : public Stream {
+  std::shared_ptr<FileImpl> _p;
+public:
+  File() {}
+  File(std::shared_ptr<FileImpl> p) : _p(p) {}
+  size_t write(uint8_t) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override;
+  size_t read(uint8_t *buf, size_t size);
+  size_t readBytes(char *buffer, size_t length) { return read((uint8_t*)buffer, length); }
+  bool seek(uint32_t pos, SeekMode mode);
+  bool seek(uint32_t pos) { return seek(pos, SeekSet); }
+  size_t position() const;
+  size_t size() const;
+  void close();
+  operator bool() const;
+  time_t getLastWrite();
+  const char *path() const;
+  const char *name() const;
+  bool isDirectory(void);
+  File openNextFile(const char *mode = "r");
+  void rewindDirectory(void);
+};
+class FS {
+public:
+  File open(const char *path, const char *mode = "r", const bool create = false);
+  File open(const String &path, const char *mode = "r", const bool create = false) { return open(path.c_str(), mode, create); }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *pathFrom, const char *pathTo);
+  bool rename(const String &pathFrom, const String &pathTo) { return rename(pathFrom.c_str(), pathTo.c_str()); }
+  bool mkdir(const char *path);
+  bool rmdir(const char *path);
+  bool begin(bool formatOnFail = false, const char *basePath = "/littlefs", uint8_t maxOpenFiles = 10, const char *partitionLabel = nullptr) { return true; }
+  bool format();
+  size_t totalBytes() { return 1024 * 1024; }
+  size_t usedBytes();
+  void end() {}
+};
+}
+using fs::FS; using fs::File; using fs::SeekSet; using fs::SeekCur; using fs::SeekEnd; using fs::SeekMode;
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
@@ -0,0 +1,384 @@
+#pragma once
+/*
+ * Host build: the part of FastLED 3.5 that WLED uses (lib8tion, CRGB/CHSV, palettes, noise).
+ * lib8tion follows the FastLED C implementations with FASTLED_SCALE8_FIXED and FASTLED_BLEND_FIXED.
+ * The Perlin noise uses FastLED's 16 bit algorithm with its own permutation table and derives the
+ * 8 bit variants from it, so noise values differ from the real library (they are only compared
+ * against themselves in host tests).
+ */
+#include "Arduino.h"
+
+typedef uint8_t fract8;
+typedef uint16_t fract16;
+typedef uint16_t accum88;
+typedef int16_t saccum78;
+typedef int16_t saccum87;
+typedef uint32_t accum1616;
+typedef int32_t saccum1516;
+typedef uint16_t accum124;
+typedef int32_t saccum114;
+
+#define FASTLED_SCALE8_FIXED 1
+#define FASTLED_BLEND_FIXED 1
+#define FL_PROGMEM
+#define FL_PGM_READ_BYTE_NEAR(x) (*((const uint8_t*)(x)))
+#define FL_PGM_READ_DWORD_NEAR(x) (*((const uint32_t*)(x)))
+#define LIB8STATIC inline
+#define LIB8STATIC_ALWAYS_INLINE inline
+#ifdef USE_GET_MILLISECOND_TIMER
+uint32_t get_millisecond_timer(); // provided by the application
+#define GET_MILLIS get_millisecond_timer
+#else
+#define GET_MILLIS millis
+#endif
+
+LIB8STATIC uint8_t scale8(uint8_t i, fract8 scale) { return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8; }
+LIB8STATIC uint8_t scale8_video(uint8_t i, fract8 scale) { return (((uint16_t)i * (uint16_t)scale) >> 8) + ((i && scale) ? 1 : 0); }
+LIB8STATIC uint8_t scale8_LEAVING_R1_DIRTY(uint8_t i, fract8 scale) { return scale8(i, scale); }
+LIB8STATIC uint8_t scale8_video_LEAVING_R1_DIRTY(uint8_t i, fract8 scale) { return scale8_video(i, scale); }
+LIB8STATIC void cleanup_R1() {}
+LIB8STATIC uint16_t scale16(uint16_t i, fract16 scale) { return ((uint32_t)i * (1 + (uint32_t)scale)) >> 16; }
+LIB8STATIC uint16_t scale16by8(uint16_t i, fract8 scale) { return ((uint32_t)i * (1 + (uint32_t)scale)) >> 8; }
+LIB8STATIC void nscale8x3(uint8_t &r, uint8_t &g, uint8_t &b, fract8 scale) { r = scale8(r, scale); g = scale8(g, scale); b = scale8(b, scale); }
+LIB8STATIC void nscale8x3_video(uint8_t &r, uint8_t &g, uint8_t &b, fract8 scale) { r = scale8_video(r, scale); g = scale8_video(g, scale); b = scale8_video(b, scale); }
+LIB8STATIC uint8_t qadd8(uint8_t i, uint8_t j) { unsigned t = i + j; return t > 255 ? 255 : t; }
+LIB8STATIC int8_t qadd7(int8_t i, int8_t j) { int t = i + j; return t > 127 ? 127 : (t < -128 ? -128 : t); }
+LIB8STATIC uint8_t qsub8(uint8_t i, uint8_t j) { int t = i - j; return t < 0 ? 0 : t; }
+LIB8STATIC uint8_t add8(uint8_t i, uint8_t j) { return i + j; }
+LIB8STATIC uint16_t add8to16(uint8_t i, uint16_t j) { return i + j; }
+LIB8STATIC uint8_t sub8(uint8_t i, uint8_t j) { return i - j; }
+LIB8STATIC uint8_t avg8(uint8_t i, uint8_t j) { return (i + j) >> 1; }
+LIB8STATIC uint16_t avg16(uint16_t i, uint16_t j) { return (uint32_t)((uint32_t)i + (uint32_t)j) >> 1; }
+LIB8STATIC int8_t avg7(int8_t i, int8_t j) { return (i >> 1) + (j >> 1) + (i & 0x1); }
+LIB8STATIC uint8_t mod8(uint8_t a, uint8_t m) { while (a >= m) a -= m; return a; }
+LIB8STATIC uint8_t addmod8(uint8_t a, uint8_t b, uint8_t m) { a += b; while (a >= m) a -= m; return a; }
+LIB8STATIC uint8_t submod8(uint8_t a, uint8_t b, uint8_t m) { a -= b; while (a >= m) a -= m; return a; }
+LIB8STATIC uint8_t mul8(uint8_t i, uint8_t j) { return ((unsigned)i * (unsigned)j) & 0xFF; }
+LIB8STATIC uint8_t qmul8(uint8_t i, uint8_t j) { unsigned p = (unsigned)i * (unsigned)j; return p > 255 ? 255 : p; }
+LIB8STATIC int8_t abs8(int8_t i) { return i < 0 ? -i : i; }
+LIB8STATIC uint8_t sqrt16(uint16_t x) {
+  if (x <= 1) return x;
+  uint8_t low = 1, hi, mid;
+  if (x > 7904) hi = 255; else hi = (x >> 5) + 8;
+  do {
+    mid = (low + hi) >> 1;
+    if ((uint16_t)(mid * mid) > x) hi = mid - 1; else { if (mid == 255) return 255; low = mid + 1; }
+  } while (hi >= low);
+  return low - 1;
+}
+LIB8STATIC uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+  uint16_t partial = (a << 8) | b;
+  partial += (b * amountOfB);
+  partial -= (a * amountOfB);
+  return partial >> 8;
+}
+LIB8STATIC uint8_t dim8_raw(uint8_t x) { return scale8(x, x); }
+LIB8STATIC uint8_t dim8_video(uint8_t x) { return scale8_video(x, x); }
+LIB8STATIC uint8_t dim8_lin(uint8_t x) { if (x & 0x80) x = scale8(x, x); else { x += 1; x /= 2; } return x; }
+LIB8STATIC uint8_t brighten8_raw(uint8_t x) { uint8_t ix = 255 - x; return 255 - scale8(ix, ix); }
+LIB8STATIC uint8_t brighten8_video(uint8_t x) { uint8_t ix = 255 - x; return 255 - scale8_video(ix, ix); }
+LIB8STATIC uint8_t brighten8_lin(uint8_t x) { uint8_t ix = 255 - x; if (ix & 0x80) ix = scale8(ix, ix); else { ix += 1; ix /= 2; } return 255 - ix; }
+LIB8STATIC uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+  if (b > a) return a + scale8(b - a, frac);
+  return a - scale8(a - b, frac);
+}
+LIB8STATIC uint16_t lerp16by16(uint16_t a, uint16_t b, fract16 frac) {
+  if (b > a) return a + scale16(b - a, frac);
+  return a - scale16(a - b, frac);
+}
+LIB8STATIC uint16_t lerp16by8(uint16_t a, uint16_t b, fract8 frac) {
+  if (b > a) return a + scale16by8(b - a, frac);
+  return a - scale16by8(a - b, frac);
+}
+LIB8STATIC int16_t lerp15by8(int16_t a, int16_t b, fract8 frac) {
+  if (b > a) return a + (int16_t)scale16by8((uint16_t)(b - a), frac);
+  return a - (int16_t)scale16by8((uint16_t)(a - b), frac);
+}
+LIB8STATIC int16_t lerp15by16(int16_t a, int16_t b, fract16 frac) {
+  if (b > a) return a + (int16_t)scale16((uint16_t)(b - a), frac);
+  return a - (int16_t)scale16((uint16_t)(a - b), frac);
+}
+LIB8STATIC uint8_t map8(uint8_t in, uint8_t rangeStart, uint8_t rangeEnd) { return scale8(in, rangeEnd - rangeStart) + rangeStart; }
+LIB8STATIC uint8_t ease8InOutQuad(uint8_t i) {
+  uint8_t j = i;
+  if (j & 0x80) j = 255 - j;
+  uint8_t jj2 = scale8(j, j) << 1;
+  if (i & 0x80) jj2 = 255 - jj2;
+  return jj2;
+}
+LIB8STATIC uint16_t ease16InOutQuad(uint16_t i) {
+  uint16_t j = i;
+  if (j & 0x8000) j = 65535 - j;
+  uint16_t jj2 = scale16(j, j) << 1;
+  if (i & 0x8000) jj2 = 65535 - jj2;
+  return jj2;
+}
+LIB8STATIC fract8 ease8InOutCubic(fract8 i) {
+  uint8_t ii = scale8(i, i);
+  uint8_t iii = scale8(ii, i);
+  uint16_t r1 = (3 * (uint16_t)ii) - (2 * (uint16_t)iii);
+  return (r1 & 0x100) ? 255 : r1;
+}
+LIB8STATIC fract8 ease8InOutApprox(fract8 i) {
+  if (i < 64) i /= 2;
+  else if (i > (255 - 64)) { i = 255 - i; i /= 2; i = 255 - i; }
+  else { i -= 64; i += (i / 2); i += 32; }
+  return i;
+}
+LIB8STATIC uint8_t triwave8(uint8_t in) { if (in & 0x80) in = 255 - in; return in << 1; }
+LIB8STATIC uint8_t quadwave8(uint8_t in) { return ease8InOutQuad(triwave8(in)); }
+LIB8STATIC uint8_t cubicwave8(uint8_t in) { return ease8InOutCubic(triwave8(in)); }
+LIB8STATIC uint8_t squarewave8(uint8_t in, uint8_t pulsewidth = 128) { return (in < pulsewidth || pulsewidth == 255) ? 255 : 0; }
+LIB8STATIC uint8_t sin8(uint8_t theta) {
+  static const uint8_t b_m16_interleave[] = { 0, 49, 49, 41, 90, 27, 117, 10 };
+  uint8_t offset = theta;
+  if (theta & 0x40) offset = (uint8_t)255 - offset;
+  offset &= 0x3F;
+  uint8_t secoffset = offset & 0x0F;
+  if (theta & 0x40) ++secoffset;
+  uint8_t section = offset >> 4;
+  const uint8_t *p = b_m16_interleave + section * 2;
+  uint8_t b = p[0], m16 = p[1];
+  uint8_t mx = (m16 * secoffset) >> 4;
+  int8_t y = mx + b;
+  if (theta & 0x80) y = -y;
+  y += 128;
+  return y;
+}
+LIB8STATIC uint8_t cos8(uint8_t theta) { return sin8(theta + 64); }
+LIB8STATIC int16_t sin16(uint16_t theta) {
+  static const uint16_t base[] = { 0, 6393, 12539, 18204, 23170, 27245, 30273, 32137 };
+  static const uint8_t slope[] = { 49, 48, 44, 38, 31, 23, 14, 4 };
+  uint16_t offset = (theta & 0x3FFF) >> 3;
+  if (theta & 0x4000) offset = 2047 - offset;
+  uint8_t section = offset / 256;
+  uint16_t b = base[section];
+  uint8_t m = slope[section];
+  uint8_t secoffset8 = (uint8_t)(offset) / 2;
+  uint16_t mx = m * secoffset8;
+  int16_t y = mx + b;
+  if (theta & 0x8000) y = -y;
+  return y;
+}
+LIB8STATIC int16_t cos16(uint16_t theta) { return sin16(theta + 16384); }
+
+// random numbers (the seed is global, as in FastLED)
+extern uint16_t rand16seed;
+#define FASTLED_RAND16_2053 ((uint16_t)(2053))
+#define FASTLED_RAND16_13849 ((uint16_t)(13849))
+LIB8STATIC uint8_t random8() {
+  rand16seed = (rand16seed * FASTLED_RAND16_2053) + FASTLED_RAND16_13849;
+  return (uint8_t)(((uint8_t)(rand16seed & 0xFF)) + ((uint8_t)(rand16seed >> 8)));
+}
+LIB8STATIC uint16_t random16() { rand16seed = (rand16seed * FASTLED_RAND16_2053) + FASTLED_RAND16_13849; return rand16seed; }
+LIB8STATIC uint8_t random8(uint8_t lim) { uint8_t r = random8(); r = (r * lim) >> 8; return r; }
+LIB8STATIC uint8_t random8(uint8_t min, uint8_t lim) { uint8_t delta = lim - min; return random8(delta) + min; }
+LIB8STATIC uint16_t random16(uint16_t lim) { uint16_t r = random16(); uint32_t p = (uint32_t)lim * (uint32_t)r; return p >> 16; }
+LIB8STATIC uint16_t random16(uint16_t min, uint16_t lim) { uint16_t delta = lim - min; return random16(delta) + min; }
+LIB8STATIC void random16_set_seed(uint16_t seed) { rand16seed = seed; }
+LIB8STATIC uint16_t random16_get_seed() { return rand16seed; }
+LIB8STATIC void random16_add_entropy(uint16_t entropy) { rand16seed += entropy; }
+
+// time based
+LIB8STATIC uint16_t beat88(accum88 beats_per_minute_88, uint32_t timebase = 0) { return (((GET_MILLIS()) - timebase) * beats_per_minute_88 * 280) >> 16; }
+LIB8STATIC uint16_t beat16(accum88 beats_per_minute, uint32_t timebase = 0) { if (beats_per_minute < 256) beats_per_minute <<= 8; return beat88(beats_per_minute, timebase); }
+LIB8STATIC uint8_t beat8(accum88 beats_per_minute, uint32_t timebase = 0) { return beat16(beats_per_minute, timebase) >> 8; }
+LIB8STATIC uint16_t beatsin88(accum88 beats_per_minute_88, uint16_t lowest = 0, uint16_t highest = 65535, uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beat = beat88(beats_per_minute_88, timebase);
+  uint16_t beatsin = (sin16(beat + phase_offset) + 32768);
+  return lowest + scale16(beatsin, highest - lowest);
+}
+LIB8STATIC uint16_t beatsin16(accum88 beats_per_minute, uint16_t lowest = 0, uint16_t highest = 65535, uint32_t timebase = 0, uint16_t phase_offset = 0) {
+  uint16_t beat = beat16(beats_per_minute, timebase);
+  uint16_t beatsin = (sin16(beat + phase_offset) + 32768);
+  return lowest + scale16(beatsin, highest - lowest);
+}
+LIB8STATIC uint8_t beatsin8(accum88 beats_per_minute, uint8_t lowest = 0, uint8_t highest = 255, uint32_t timebase = 0, uint8_t phase_offset = 0) {
+  uint8_t beat = beat8(beats_per_minute, timebase);
+  uint8_t beatsin = sin8(beat + phase_offset);
+  return lowest + scale8(beatsin, highest - lowest);
+}
+LIB8STATIC uint16_t seconds16() { return GET_MILLIS() / 1000; }
+LIB8STATIC uint16_t minutes16() { return GET_MILLIS() / 60000; }
+LIB8STATIC uint8_t hours8() { return GET_MILLIS() / 3600000; }
+
+// noise
+int16_t inoise16_raw(uint32_t x, uint32_t y, uint32_t z);
+uint16_t inoise16(uint32_t x, uint32_t y, uint32_t z);
+uint16_t inoise16(uint32_t x, uint32_t y);
+uint16_t inoise16(uint32_t x);
+int8_t inoise8_raw(uint16_t x, uint16_t y, uint16_t z);
+uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z);
+uint8_t inoise8(uint16_t x, uint16_t y);
+uint8_t inoise8(uint16_t x);
+
+struct CRGB;
+struct CHSV {
+  union {
+    struct {
+      union { uint8_t hue; uint8_t h; };
+      union { uint8_t saturation; uint8_t sat; uint8_t s; };
+      union { uint8_t value; uint8_t val; uint8_t v; };
+    };
+    uint8_t raw[3];
+  };
+  inline uint8_t &operator[] (uint8_t x) { return raw[x]; }
+  inline const uint8_t &operator[] (uint8_t x) const { return raw[x]; }
+  CHSV() {}
+  constexpr CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+  CHSV &setHSV(uint8_t ih, uint8_t is, uint8_t iv) { h = ih; s = is; v = iv; return *this; }
+};
+void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb);
+void hsv2rgb_spectrum(const CHSV &hsv, CRGB &rgb);
+void hsv2rgb_raw(const CHSV &hsv, CRGB &rgb);
+CHSV rgb2hsv_approximate(const CRGB &rgb);
+
+struct CRGB {
+  union {
+    struct {
+      union { uint8_t r; uint8_t red; };
+      union { uint8_t g; uint8_t green; };
+      union { uint8_t b; uint8_t blue; };
+    };
+    uint8_t raw[3];
+  };
+  inline uint8_t &operator[] (uint8_t x) { return raw[x]; }
+  inline const uint8_t &operator[] (uint8_t x) const { return raw[x]; }
+  CRGB() {}
+  constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  constexpr CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b((colorcode >> 0) & 0xFF) {}
+  CRGB(const CHSV &rhs) { hsv2rgb_rainbow(rhs, *this); }
+  CRGB &operator= (const uint32_t colorcode) { r = (colorcode >> 16) & 0xFF; g = (colorcode >> 8) & 0xFF; b = colorcode & 0xFF; return *this; }
+  CRGB &operator= (const CHSV &rhs) { hsv2rgb_rainbow(rhs, *this); return *this; }
+  CRGB &setRGB(uint8_t nr, uint8_t ng, uint8_t nb) { r = nr; g = ng; b = nb; return *this; }
+  CRGB &setHSV(uint8_t hue, uint8_t sat, uint8_t val) { hsv2rgb_rainbow(CHSV(hue, sat, val), *this); return *this; }
+  CRGB &setHue(uint8_t hue) { hsv2rgb_rainbow(CHSV(hue, 255, 255), *this); return *this; }
+  CRGB &setColorCode(uint32_t colorcode) { return *this = colorcode; }
+  CRGB &operator+= (const CRGB &rhs) { r = qadd8(r, rhs.r); g = qadd8(g, rhs.g); b = qadd8(b, rhs.b); return *this; }
+  CRGB &addToRGB(uint8_t d) { r = qadd8(r, d); g = qadd8(g, d); b = qadd8(b, d); return *this; }
+  CRGB &operator-= (const CRGB &rhs) { r = qsub8(r, rhs.r); g = qsub8(g, rhs.g); b = qsub8(b, rhs.b); return *this; }
+  CRGB &subtractFromRGB(uint8_t d) { r = qsub8(r, d); g = qsub8(g, d); b = qsub8(b, d); return *this; }
+  CRGB &operator-- () { subtractFromRGB(1); return *this; }
+  CRGB operator-- (int) { CRGB retval(*this); --(*this); return retval; }
+  CRGB &operator++ () { addToRGB(1); return *this; }
+  CRGB operator++ (int) { CRGB retval(*this); ++(*this); return retval; }
+  CRGB &operator/= (uint8_t d) { r /= d; g /= d; b /= d; return *this; }
+  CRGB &operator>>= (uint8_t d) { r >>= d; g >>= d; b >>= d; return *this; }
+  CRGB &operator*= (uint8_t d) { r = qmul8(r, d); g = qmul8(g, d); b = qmul8(b, d); return *this; }
+  CRGB &nscale8_video(uint8_t scaledown) { nscale8x3_video(r, g, b, scaledown); return *this; }
+  CRGB &operator%= (uint8_t scaledown) { nscale8x3_video(r, g, b, scaledown); return *this; }
+  CRGB &fadeLightBy(uint8_t fadefactor) { nscale8x3_video(r, g, b, 255 - fadefactor); return *this; }
+  CRGB &nscale8(uint8_t scaledown) { nscale8x3(r, g, b, scaledown); return *this; }
+  CRGB &nscale8(const CRGB &scaledown) { r = ::scale8(r, scaledown.r); g = ::scale8(g, scaledown.g); b = ::scale8(b, scaledown.b); return *this; }
+  CRGB scale8(uint8_t scaledown) const { CRGB out = *this; nscale8x3(out.r, out.g, out.b, scaledown); return out; }
+  CRGB scale8(const CRGB &scaledown) const { CRGB out; out.r = ::scale8(r, scaledown.r); out.g = ::scale8(g, scaledown.g); out.b = ::scale8(b, scaledown.b); return out; }
+  CRGB &fadeToBlackBy(uint8_t fadefactor) { nscale8x3(r, g, b, 255 - fadefactor); return *this; }
+  CRGB &operator|= (const CRGB &rhs) { if (rhs.r > r) r = rhs.r; if (rhs.g > g) g = rhs.g; if (rhs.b > b) b = rhs.b; return *this; }
+  CRGB &operator|= (uint8_t d) { if (d > r) r = d; if (d > g) g = d; if (d > b) b = d; return *this; }
+  CRGB &operator&= (const CRGB &rhs) { if (rhs.r < r) r = rhs.r; if (rhs.g < g) g = rhs.g; if (rhs.b < b) b = rhs.b; return *this; }
+  CRGB &operator&= (uint8_t d) { if (d < r) r = d; if (d < g) g = d; if (d < b) b = d; return *this; }
+  explicit operator bool() const { return r || g || b; }
+  operator uint32_t() const { return uint32_t(0xff000000) | (uint32_t{r} << 16) | (uint32_t{g} << 8) | uint32_t{b}; }
+  CRGB operator- () const { return CRGB(255 - r, 255 - g, 255 - b); }
+  uint8_t getLuma() const { return ::scale8(r, 54) + ::scale8(g, 183) + ::scale8(b, 18); }
+  uint8_t getAverageLight() const { return ::scale8(r, 85) + ::scale8(g, 85) + ::scale8(b, 85); }
+  void maximizeBrightness(uint8_t limit = 255) {
+    uint8_t max = std::max(r, std::max(g, b));
+    if (max == 0) return;
+    uint16_t factor = ((uint16_t)(limit) * 256) / max;
+    r = (r * factor) / 256; g = (g * factor) / 256; b = (b * factor) / 256;
+  }
+  CRGB lerp8(const CRGB &other, fract8 frac) const { return CRGB(lerp8by8(r, other.r, frac), lerp8by8(g, other.g, frac), lerp8by8(b, other.b, frac)); }
+  typedef enum {
+    AliceBlue=0xF0F8FF, Amethyst=0x9966CC, Aqua=0x00FFFF, Aquamarine=0x7FFFD4, Black=0x000000, Blue=0x0000FF, CadetBlue=0x5F9EA0,
+    CornflowerBlue=0x6495ED, Cyan=0x00FFFF, DarkBlue=0x00008B, DarkCyan=0x008B8B, DarkGreen=0x006400, DarkOliveGreen=0x556B2F,
+    DarkOrange=0xFF8C00, DarkRed=0x8B0000, ForestGreen=0x228B22, Gray=0x808080, Green=0x008000, LawnGreen=0x7CFC00,
+    LightBlue=0xADD8E6, LightGreen=0x90EE90, LightSkyBlue=0x87CEFA, LimeGreen=0x32CD32, Magenta=0xFF00FF, Maroon=0x800000,
+    MediumAquamarine=0x66CDAA, MediumBlue=0x0000CD, MidnightBlue=0x191970, Navy=0x000080, OliveDrab=0x6B8E23, Orange=0xFFA500,
+    Purple=0x800080, Red=0xFF0000, SeaGreen=0x2E8B57, SkyBlue=0x87CEEB, Teal=0x008080, White=0xFFFFFF, Yellow=0xFFFF00,
+    YellowGreen=0x9ACD32
+  } HTMLColorCode;
+};
+inline bool operator== (const CRGB &lhs, const CRGB &rhs) { return (lhs.r == rhs.r) && (lhs.g == rhs.g) && (lhs.b == rhs.b); }
+inline bool operator!= (const CRGB &lhs, const CRGB &rhs) { return !(lhs == rhs); }
+inline CRGB operator+ (const CRGB &p1, const CRGB &p2) { return CRGB(qadd8(p1.r, p2.r), qadd8(p1.g, p2.g), qadd8(p1.b, p2.b)); }
+inline CRGB operator- (const CRGB &p1, const CRGB &p2) { return CRGB(qsub8(p1.r, p2.r), qsub8(p1.g, p2.g), qsub8(p1.b, p2.b)); }
+inline CRGB operator* (const CRGB &p1, uint8_t d) { return CRGB(qmul8(p1.r, d), qmul8(p1.g, d), qmul8(p1.b, d)); }
+inline CRGB operator/ (const CRGB &p1, uint8_t d) { return CRGB(p1.r / d, p1.g / d, p1.b / d); }
+inline CRGB operator& (const CRGB &p1, const CRGB &p2) { return CRGB(std::min(p1.r, p2.r), std::min(p1.g, p2.g), std::min(p1.b, p2.b)); }
+inline CRGB operator| (const CRGB &p1, const CRGB &p2) { return CRGB(std::max(p1.r, p2.r), std::max(p1.g, p2.g), std::max(p1.b, p2.b)); }
+inline CRGB operator% (const CRGB &p1, uint8_t d) { CRGB retval(p1); retval.nscale8_video(d); return retval; }
+
+typedef uint32_t TProgmemRGBPalette16[16];
+typedef const uint8_t TProgmemRGBGradientPalette_byte;
+typedef const TProgmemRGBGradientPalette_byte *TProgmemRGBGradientPalette_bytes;
+typedef TProgmemRGBGradientPalette_bytes TDynamicRGBGradientPalette_bytes;
+typedef union { struct { uint8_t index, r, g, b; }; uint32_t dword; uint8_t bytes[4]; } TRGBGradientPaletteEntryUnion;
+#define DEFINE_GRADIENT_PALETTE(X) extern const TProgmemRGBGradientPalette_byte X[] FL_PROGMEM =
+#define DECLARE_GRADIENT_PALETTE(X) extern const TProgmemRGBGradientPalette_byte X[] FL_PROGMEM
+
+void fill_solid(struct CRGB *targetArray, int numToFill, const struct CRGB &color);
+void fill_rainbow(struct CRGB *targetArray, int numToFill, uint8_t initialhue, uint8_t deltahue = 5);
+void fill_gradient_RGB(CRGB *leds, uint16_t startpos, CRGB startcolor, uint16_t endpos, CRGB endcolor);
+
+class CRGBPalette16 {
+public:
+  CRGB entries[16];
+  CRGBPalette16() {}
+  CRGBPalette16(const CRGB &c00, const CRGB &c01, const CRGB &c02, const CRGB &c03, const CRGB &c04, const CRGB &c05, const CRGB &c06, const CRGB &c07,
+                const CRGB &c08, const CRGB &c09, const CRGB &c10, const CRGB &c11, const CRGB &c12, const CRGB &c13, const CRGB &c14, const CRGB &c15) {
+    entries[0] = c00; entries[1] = c01; entries[2] = c02; entries[3] = c03; entries[4] = c04; entries[5] = c05; entries[6] = c06; entries[7] = c07;
+    entries[8] = c08; entries[9] = c09; entries[10] = c10; entries[11] = c11; entries[12] = c12; entries[13] = c13; entries[14] = c14; entries[15] = c15;
+  }
+  CRGBPalette16(const CRGBPalette16 &rhs) { memmove(entries, rhs.entries, sizeof(entries)); }
+  CRGBPalette16(const CRGB rhs[16]) { memmove(entries, rhs, sizeof(entries)); }
+  CRGBPalette16 &operator=(const CRGBPalette16 &rhs) { memmove(entries, rhs.entries, sizeof(entries)); return *this; }
+  CRGBPalette16 &operator=(const CRGB rhs[16]) { memmove(entries, rhs, sizeof(entries)); return *this; }
+  CRGBPalette16(const TProgmemRGBPalette16 &rhs) { for (int i = 0; i < 16; i++) entries[i] = rhs[i]; }
+  CRGBPalette16 &operator=(const TProgmemRGBPalette16 &rhs) { for (int i = 0; i < 16; i++) entries[i] = rhs[i]; return *this; }
+  bool operator==(const CRGBPalette16 &rhs) const { return memcmp(entries, rhs.entries, sizeof(entries)) == 0; }
+  bool operator!=(const CRGBPalette16 &rhs) const { return !(*this == rhs); }
+  CRGB &operator[] (uint8_t x) { return entries[x]; }
+  const CRGB &operator[] (uint8_t x) const { return entries[x]; }
+  CRGB &operator[] (int x) { return entries[(uint8_t)x]; }
+  const CRGB &operator[] (int x) const { return entries[(uint8_t)x]; }
+  operator CRGB*() { return &(entries[0]); }
+  CRGBPalette16(const CHSV &c1) { fill_solid(entries, 16, CRGB(c1)); }
+  CRGBPalette16(const CHSV &c1, const CHSV &c2) { fill_gradient_RGB(entries, 0, c1, 15, c2); }
+  CRGBPalette16(const CHSV &c1, const CHSV &c2, const CHSV &c3) { fill_gradient_RGB(entries, 0, c1, 7, c2); fill_gradient_RGB(entries, 7, c2, 15, c3); }
+  CRGBPalette16(const CHSV &c1, const CHSV &c2, const CHSV &c3, const CHSV &c4) {
+    fill_gradient_RGB(entries, 0, c1, 5, c2); fill_gradient_RGB(entries, 5, c2, 10, c3); fill_gradient_RGB(entries, 10, c3, 15, c4);
+  }
+  CRGBPalette16(const CRGB &c1) { fill_solid(entries, 16, c1); }
+  CRGBPalette16(const CRGB &c1, const CRGB &c2) { fill_gradient_RGB(entries, 0, c1, 15, c2); }
+  CRGBPalette16(const CRGB &c1, const CRGB &c2, const CRGB &c3) { fill_gradient_RGB(entries, 0, c1, 7, c2); fill_gradient_RGB(entries, 7, c2, 15, c3); }
+  CRGBPalette16(const CRGB &c1, const CRGB &c2, const CRGB &c3, const CRGB &c4) {
+    fill_gradient_RGB(entries, 0, c1, 5, c2); fill_gradient_RGB(entries, 5, c2, 10, c3); fill_gradient_RGB(entries, 10, c3, 15, c4);
+  }
+  CRGBPalette16(TProgmemRGBGradientPalette_bytes progpal) { *this = progpal; }
+  CRGBPalette16 &operator=(TProgmemRGBGradientPalette_bytes progpal) { return loadDynamicGradientPalette(progpal); }
+  CRGBPalette16 &loadDynamicGradientPalette(TDynamicRGBGradientPalette_bytes gpal);
+};
+typedef enum { NOBLEND=0, LINEARBLEND=1, LINEARBLEND_NOWRAP=2 } TBlendType;
+CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness = 255, TBlendType blendType = LINEARBLEND);
+void nblendPaletteTowardPalette(CRGBPalette16 &currentPalette, CRGBPalette16 &targetPalette, uint8_t maxChanges = 24);
+CRGB &nblend(CRGB &existing, const CRGB &overlay, fract8 amountOfOverlay);
+CRGB blend(const CRGB &p1, const CRGB &p2, fract8 amountOfP2);
+void fadeToBlackBy(CRGB *leds, uint16_t num_leds, uint8_t fadeBy);
+void nscale8(CRGB *leds, uint16_t num_leds, uint8_t scale);
+void fadeLightBy(CRGB *leds, uint16_t num_leds, uint8_t fadeBy);
+void blur1d(CRGB *leds, uint16_t numLeds, fract8 blur_amount);
+CRGB HeatColor(uint8_t temperature);
+extern const TProgmemRGBPalette16 CloudColors_p, LavaColors_p, OceanColors_p, ForestColors_p, RainbowColors_p, RainbowStripeColors_p, PartyColors_p, HeatColors_p;
+
+// FastLED's CEveryNMillis
+class CEveryNMillis {
+  uint32_t _prev, _period;
+public:
+  CEveryNMillis(uint32_t period) : _prev(millis()), _period(period) {}
+  bool ready() { uint32_t now = millis(); if (now - _prev >= _period) { _prev = now; return true; } return false; }
+};
+#define EVERY_N_MILLIS_I(NAME, N) static CEveryNMillis NAME(N); if (NAME.ready())
+#define EVERY_N_MILLIS(N) EVERY_N_MILLIS_I(__everyNMillis##__LINE__, N)
+#define EVERY_N_MILLISECONDS(N) EVERY_N_MILLIS(N)
+#define EVERY_N_SECONDS(N) EVERY_N_MILLIS((N) * 1000)
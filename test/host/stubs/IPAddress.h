@@ -0,0 +1,29 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+class String;
+class IPAddress {
+  union { uint8_t bytes[4]; uint32_t dword; } _address;
+public:
+  IPAddress() { _address.dword = 0; }
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { _address.bytes[0] = a; _address.bytes[1] = b; _address.bytes[2] = c; _address.bytes[3] = d; }
+  IPAddress(uint32_t address) { _address.dword = address; }
+  IPAddress(const uint8_t *address) { for (int i = 0; i < 4; i++) _address.bytes[i] = address[i]; }
+  bool fromString(const char *address) {
+    unsigned a, b, c, d;
+    if (!address || sscanf(address, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255) return false;
+    *this = IPAddress(a, b, c, d); return true;
+  }
+  bool fromString(const String &address);
+  operator uint32_t() const { return _address.dword; }
+  bool operator==(const IPAddress &addr) const { return _address.dword == addr._address.dword; }
+  bool operator!=(const IPAddress &addr) const { return _address.dword != addr._address.dword; }
+  bool operator==(const uint8_t *addr) const { for (int i = 0; i < 4; i++) if (_address.bytes[i] != addr[i]) return false; return true; }
+  uint8_t operator[](int index) const { return _address.bytes[index]; }
+  uint8_t &operator[](int index) { return _address.bytes[index]; }
+  IPAddress &operator=(const uint8_t *address) { for (int i = 0; i < 4; i++) _address.bytes[i] = address[i]; return *this; }
+  IPAddress &operator=(uint32_t address) { _address.dword = address; return *this; }
+  String toString() const;
+};
+extern const IPAddress INADDR_NONE;
@@ -0,0 +1,63 @@
+#pragma once
+#define WIFI_SCAN_FAILED (-2)
+#define WIFI_SCAN_RUNNING (-1)
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "WiFiUdp.h"
+#include "WiFiClient.h"
+typedef enum { WL_NO_SHIELD=255, WL_IDLE_STATUS=0, WL_NO_SSID_AVAIL, WL_SCAN_COMPLETED, WL_CONNECTED, WL_CONNECT_FAILED, WL_CONNECTION_LOST, WL_DISCONNECTED } wl_status_t;
+typedef enum { WIFI_OFF=0, WIFI_STA, WIFI_AP, WIFI_AP_STA, WIFI_MODE_NULL=0, WIFI_MODE_STA=1, WIFI_MODE_AP=2, WIFI_MODE_APSTA=3 } wifi_mode_t;
+typedef int WiFiEvent_t;
+typedef int wifi_power_t;
+typedef int wifi_auth_mode_t;
+#define WIFI_AUTH_OPEN 0
+#define WIFI_POWER_19_5dBm 78
+#define WIFI_PS_NONE 0
+#define WIFI_PS_MIN_MODEM 1
+#define SYSTEM_EVENT_ETH_CONNECTED 20
+#define SYSTEM_EVENT_ETH_DISCONNECTED 21
+#define ARDUINO_EVENT_ETH_CONNECTED 20
+#define ARDUINO_EVENT_ETH_DISCONNECTED 21
+// the host is always connected to 192.168.1.10/24
+class WiFiClass {
+public:
+  wl_status_t status() { return WL_CONNECTED; }
+  IPAddress localIP() { return IPAddress(192,168,1,10); }
+  IPAddress subnetMask() { return IPAddress(255,255,255,0); }
+  IPAddress gatewayIP() { return IPAddress(192,168,1,1); }
+  IPAddress softAPIP() { return IPAddress(4,3,2,1); }
+  IPAddress dnsIP(uint8_t = 0) { return IPAddress(192,168,1,1); }
+  IPAddress broadcastIP() { return IPAddress(192,168,1,255); }
+  String macAddress() { return String("A1:B2:C3:D4:E5:F6"); }
+  uint8_t *macAddress(uint8_t *m) { const uint8_t a[6] = {0xa1,0xb2,0xc3,0xd4,0xe5,0xf6}; memcpy(m, a, 6); return m; }
+  String SSID() { return String("host"); }
+  String SSID(int) { return String("host"); }
+  String BSSIDstr() { return String("00:00:00:00:00:00"); }
+  String BSSIDstr(int) { return BSSIDstr(); }
+  int32_t RSSI() { return -50; }
+  int32_t RSSI(int) { return -50; }
+  int32_t channel() { return 1; }
+  int32_t channel(int) { return 1; }
+  int encryptionType(int) { return 3; }
+  uint8_t softAPgetStationNum() { return 0; }
+  bool mode(wifi_mode_t) { return true; }
+  wifi_mode_t getMode() { return WIFI_STA; }
+  bool softAP(const char*, const char* = nullptr, int = 1, int = 0, int = 4) { return true; }
+  bool softAPConfig(IPAddress, IPAddress, IPAddress) { return true; }
+  bool softAPdisconnect(bool = false) { return true; }
+  bool disconnect(bool = false, bool = false) { return true; }
+  bool config(IPAddress, IPAddress, IPAddress, IPAddress = (uint32_t)0, IPAddress = (uint32_t)0) { return true; }
+  int begin(const char*, const char* = nullptr, int32_t = 0, const uint8_t* = nullptr, bool = true) { return WL_CONNECTED; }
+  bool setHostname(const char*) { return true; }
+  bool setSleep(bool) { return true; }
+  bool setTxPower(wifi_power_t) { return true; }
+  int hostByName(const char *name, IPAddress &ip) { return ip.fromString(name); }
+  int16_t scanNetworks(bool = false, bool = false) { return 0; }
+  int16_t scanComplete() { return 0; }
+  void scanDelete() {}
+  void onEvent(std::function<void(WiFiEvent_t)>) {}
+  template<typename F> void onEvent(F) {}
+  bool persistent(bool) { return true; }
+  bool setAutoReconnect(bool) { return true; }
+};
+extern WiFiClass WiFi;
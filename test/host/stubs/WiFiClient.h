@@ -0,0 +1,15 @@
+#pragma once
+#include "Arduino.h"
+class WiFiClient : public Stream {
+public:
+  int connect(IPAddress, uint16_t) { return 0; }
+  int connect(const char*, uint16_t) { return 0; }
+  size_t write(uint8_t) override { return 1; }
+  size_t write(const uint8_t*, size_t size) override { return size; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void stop() {}
+  uint8_t connected() { return 0; }
+  operator bool() { return false; }
+};
@@ -0,0 +1,45 @@
+#pragma once
+#include "Arduino.h"
+#include "IPAddress.h"
+#include <vector>
+#include <deque>
+
+namespace host {
+  struct UdpPacket { IPAddress ip; uint16_t port; std::vector<uint8_t> data; };
+  extern std::vector<UdpPacket> sentPackets; // filled while udpCapture(true)
+  extern uint32_t sentPacketCount, sentByteCount;
+  void udpCapture(bool on);
+  void udpRecord(const IPAddress &ip, uint16_t port, const uint8_t *data, size_t len);
+  void udpReceive(uint16_t localPort, const uint8_t *data, size_t len, IPAddress from = IPAddress(192,168,1,2)); // returned by parsePacket()
+}
+
+class UDP : public Stream {};
+class WiFiUDP : public UDP {
+  uint16_t _port = 0;
+  IPAddress _txIp; uint16_t _txPort = 0;
+  std::vector<uint8_t> _tx;
+  std::vector<uint8_t> _rx; size_t _rxPos = 0; IPAddress _rxIp; uint16_t _rxPort = 0;
+public:
+  WiFiUDP() {}
+  uint8_t begin(uint16_t p) { _port = p; return 1; }
+  uint8_t begin(IPAddress, uint16_t p) { _port = p; return 1; }
+  uint8_t beginMulticast(IPAddress, uint16_t p) { _port = p; return 1; }
+  void stop() { _port = 0; }
+  int beginMulticastPacket() { _tx.clear(); return 1; }
+  int beginPacket() { _tx.clear(); return 1; }
+  int beginPacket(IPAddress ip, uint16_t port) { _txIp = ip; _txPort = port; _tx.clear(); return 1; }
+  int beginPacket(const char *host, uint16_t port) { _txIp.fromString(host); _txPort = port; _tx.clear(); return 1; }
+  int endPacket() { host::udpRecord(_txIp, _txPort, _tx.data(), _tx.size()); _tx.clear(); return 1; }
+  size_t write(uint8_t c) override { _tx.push_back(c); return 1; }
+  size_t write(const uint8_t *buffer, size_t size) override { _tx.insert(_tx.end(), buffer, buffer + size); return size; }
+  using Print::write;
+  int parsePacket();
+  int available() override { return _rx.size() - _rxPos; }
+  int read() override { return _rxPos < _rx.size() ? _rx[_rxPos++] : -1; }
+  int read(unsigned char *buffer, size_t len) { size_t n = std::min(len, _rx.size() - _rxPos); memcpy(buffer, _rx.data() + _rxPos, n); _rxPos += n; return n; }
+  int read(char *buffer, size_t len) { return read((unsigned char*)buffer, len); }
+  int peek() override { return _rxPos < _rx.size() ? _rx[_rxPos] : -1; }
+  void flush() override { _rxPos = _rx.size(); }
+  IPAddress remoteIP() { return _rxIp; }
+  uint16_t remotePort() { return _rxPort; }
+};
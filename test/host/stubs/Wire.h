@@ -0,0 +1,10 @@
+#pragma once
+#include "Arduino.h"
+class TwoWire {
+public:
+  bool begin(int = -1, int = -1, uint32_t = 0) { return true; }
+  bool setPins(int, int) { return true; }
+  void beginTransmission(uint8_t) {}
+  uint8_t endTransmission(bool = true) { return 2; } // NACK, nothing is connected
+};
+extern TwoWire Wire;
@@ -0,0 +1,256 @@
+// Host build: Arduino core runtime (time, random, Print/Stream/String helpers, Serial, ESP, network globals)
+#include "Arduino.h"
+#include "WiFi.h"
+#include "WiFiUdp.h"
+#include "ETH.h"
+#include "ESPmDNS.h"
+#include "Wire.h"
+#include "SPI.h"
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <random>
+
+// time
+static const auto startTime = std::chrono::steady_clock::now();
+static bool clockFrozen = false;
+static uint64_t frozenUs = 0;
+
+static uint64_t nowUs()
+{
+  if (clockFrozen) return frozenUs;
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long millis() { return nowUs() / 1000; }
+unsigned long micros() { return nowUs(); }
+int64_t esp_timer_get_time() { return nowUs(); }
+void delay(unsigned long ms)
+{
+  if (clockFrozen) frozenUs += (uint64_t)ms * 1000;
+  else if (ms) std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  else std::this_thread::yield();
+}
+void delayMicroseconds(unsigned int us)
+{
+  if (clockFrozen) frozenUs += us;
+  else std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+void yield() { std::this_thread::yield(); }
+
+// random (deterministic unless seeded)
+static std::mt19937 rng(12345);
+long random(long howbig) { return howbig <= 0 ? 0 : (long)(rng() % (unsigned long)howbig); }
+long random(long howsmall, long howbig) { return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall); }
+void randomSeed(unsigned long seed) { if (seed) rng.seed(seed); }
+uint32_t esp_random() { return rng(); }
+
+// Print
+size_t Print::print(long long n, int base)
+{
+  if (base == 10 && n < 0) return write('-') + print((unsigned long long)(-n), 10);
+  return print((unsigned long long)n, base);
+}
+size_t Print::print(unsigned long long n, int base)
+{
+  char buf[66]; char *p = buf + sizeof(buf) - 1; *p = 0;
+  if (base < 2) base = 10;
+  do { int d = n % base; *--p = d < 10 ? '0' + d : 'A' + d - 10; n /= base; } while (n);
+  return write(p);
+}
+size_t Print::print(double n, int digits)
+{
+  char buf[64];
+  if (std::isnan(n)) return write("nan");
+  if (std::isinf(n)) return write("inf");
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return write(buf);
+}
+size_t Print::print(const Printable &p) { return p.printTo(*this); }
+static size_t vprint(Print *p, const char *format, va_list args)
+{
+  char small[128];
+  va_list copy;
+  va_copy(copy, args);
+  int len = vsnprintf(small, sizeof(small), format, copy);
+  va_end(copy);
+  if (len < 0) return 0;
+  if ((size_t)len < sizeof(small)) return p->write((const uint8_t*)small, len);
+  std::string big(len + 1, '\0');
+  vsnprintf(&big[0], len + 1, format, args);
+  return p->write((const uint8_t*)big.data(), len);
+}
+size_t Print::printf(const char *format, ...)
+{
+  va_list args; va_start(args, format);
+  size_t n = vprint(this, format, args);
+  va_end(args);
+  return n;
+}
+size_t Print::printf_P(const char *format, ...)
+{
+  va_list args; va_start(args, format);
+  size_t n = vprint(this, format, args);
+  va_end(args);
+  return n;
+}
+
+// Stream (non-blocking: stops when no data is available)
+bool Stream::find(const char *target)
+{
+  size_t len = strlen(target), idx = 0;
+  if (!len) return true;
+  int c;
+  while ((c = read()) >= 0) {
+    if (c == target[idx]) { if (++idx == len) return true; }
+    else idx = (c == target[0]) ? 1 : 0;
+  }
+  return false;
+}
+size_t Stream::readBytes(char *buffer, size_t length)
+{
+  size_t n = 0; int c;
+  while (n < length && (c = read()) >= 0) buffer[n++] = c;
+  return n;
+}
+size_t Stream::readBytesUntil(char terminator, char *buffer, size_t length)
+{
+  size_t n = 0; int c;
+  while (n < length && (c = read()) >= 0 && c != terminator) buffer[n++] = c;
+  return n;
+}
+String Stream::readString()
+{
+  std::string s; int c;
+  while ((c = read()) >= 0) s += (char)c;
+  return String(s);
+}
+String Stream::readStringUntil(char terminator)
+{
+  std::string s; int c;
+  while ((c = read()) >= 0 && c != terminator) s += (char)c;
+  return String(s);
+}
+
+// String
+std::string String::num(long long v, int base)
+{
+  if (v < 0 && base == 10) return "-" + unum((unsigned long long)(-v), 10);
+  return unum((unsigned long long)v, base);
+}
+std::string String::unum(unsigned long long v, int base)
+{
+  char buf[66]; char *p = buf + sizeof(buf) - 1; *p = 0;
+  if (base < 2) base = 10;
+  do { int d = v % base; *--p = d < 10 ? '0' + d : 'a' + d - 10; v /= base; } while (v);
+  return p;
+}
+
+// Serial
+static bool echoSerial = false;
+static std::deque<uint8_t> serialRx;
+static std::mutex serialMutex;
+int HardwareSerial::available() { std::lock_guard<std::mutex> l(serialMutex); return this == &Serial ? serialRx.size() : 0; }
+int HardwareSerial::peek() { std::lock_guard<std::mutex> l(serialMutex); return (this == &Serial && !serialRx.empty()) ? serialRx.front() : -1; }
+int HardwareSerial::read()
+{
+  std::lock_guard<std::mutex> l(serialMutex);
+  if (this != &Serial || serialRx.empty()) return -1;
+  int c = serialRx.front(); serialRx.pop_front(); return c;
+}
+size_t HardwareSerial::write(uint8_t c) { if (echoSerial && this == &Serial) fputc(c, stdout); return 1; }
+size_t HardwareSerial::write(const uint8_t *buf, size_t n) { if (echoSerial && this == &Serial) fwrite(buf, 1, n, stdout); return n; }
+HardwareSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+
+// ESP
+static uint32_t freeHeap = 200000;
+uint32_t EspClass::getFreeHeap() { return freeHeap; }
+void EspClass::restart() { host::restartRequested = true; }
+EspClass ESP;
+
+// IPAddress
+String IPAddress::toString() const
+{
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _address.bytes[0], _address.bytes[1], _address.bytes[2], _address.bytes[3]);
+  return String(buf);
+}
+bool IPAddress::fromString(const String &address) { return fromString(address.c_str()); }
+const IPAddress INADDR_NONE(0, 0, 0, 0);
+
+// stdlib extensions
+static char *toBase(unsigned long long v, bool neg, char *str, int base)
+{
+  char buf[66]; char *p = buf + sizeof(buf) - 1; *p = 0;
+  if (base < 2 || base > 36) base = 10;
+  do { int d = v % base; *--p = d < 10 ? '0' + d : 'a' + d - 10; v /= base; } while (v);
+  if (neg) *--p = '-';
+  strcpy(str, p);
+  return str;
+}
+char *itoa(int value, char *str, int base) { return toBase(value < 0 && base == 10 ? -(long long)value : (unsigned)value, value < 0 && base == 10, str, base); }
+char *utoa(unsigned value, char *str, int base) { return toBase(value, false, str, base); }
+char *ltoa(long value, char *str, int base) { return toBase(value < 0 && base == 10 ? -(long long)value : (unsigned long)value, value < 0 && base == 10, str, base); }
+char *ultoa(unsigned long value, char *str, int base) { return toBase(value, false, str, base); }
+char *dtostrf(double val, signed char width, unsigned char prec, char *s) { sprintf(s, "%*.*f", width, prec, val); return s; }
+
+// network globals
+WiFiClass WiFi;
+ETHClass ETH;
+MDNSResponder MDNS;
+TwoWire Wire;
+SPIClass SPI;
+
+// UDP
+namespace host {
+  std::vector<UdpPacket> sentPackets;
+  uint32_t sentPacketCount = 0, sentByteCount = 0;
+  static bool captureUdp = false;
+  struct RxPacket { uint16_t port; IPAddress from; std::vector<uint8_t> data; };
+  static std::deque<RxPacket> rxQueue;
+  static std::mutex udpMutex;
+
+  void udpCapture(bool on) { std::lock_guard<std::mutex> l(udpMutex); captureUdp = on; sentPackets.clear(); sentPacketCount = sentByteCount = 0; }
+  void udpRecord(const IPAddress &ip, uint16_t port, const uint8_t *data, size_t len)
+  {
+    std::lock_guard<std::mutex> l(udpMutex);
+    sentPacketCount++; sentByteCount += len;
+    if (captureUdp) sentPackets.push_back({ip, port, std::vector<uint8_t>(data, data + len)});
+  }
+  void udpReceive(uint16_t localPort, const uint8_t *data, size_t len, IPAddress from)
+  {
+    std::lock_guard<std::mutex> l(udpMutex);
+    rxQueue.push_back({localPort, from, std::vector<uint8_t>(data, data + len)});
+  }
+}
+
+int WiFiUDP::parsePacket()
+{
+  std::lock_guard<std::mutex> l(host::udpMutex);
+  if (!_port) return 0;
+  for (auto it = host::rxQueue.begin(); it != host::rxQueue.end(); ++it) {
+    if (it->port != _port) continue;
+    _rx.swap(it->data); _rxPos = 0; _rxIp = it->from; _rxPort = 50000;
+    host::rxQueue.erase(it);
+    return _rx.size();
+  }
+  _rx.clear(); _rxPos = 0;
+  return 0;
+}
+
+// host controls
+namespace host {
+  bool restartRequested = false;
+  void setMillis(uint32_t ms) { frozenUs = (uint64_t)ms * 1000; clockFrozen = true; }
+  void advance(uint32_t ms) { frozenUs += (uint64_t)ms * 1000; }
+  void realTime() { clockFrozen = false; }
+  void setFreeHeap(uint32_t bytes) { freeHeap = bytes; }
+  void serialEcho(bool on) { echoSerial = on; }
+  static bool wireTime = false;
+  void busWireTime(bool on) { wireTime = on; }
+  bool busWireTimeEnabled() { return wireTime && !clockFrozen; }
+  void serialInput(const uint8_t *data, size_t len) { std::lock_guard<std::mutex> l(serialMutex); serialRx.insert(serialRx.end(), data, data + len); }
+}
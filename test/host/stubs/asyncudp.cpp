@@ -0,0 +1,25 @@
+// Host build: AsyncUDP packet delivery (E1.31, Art-Net and DDP listeners)
+#include "AsyncUDP.h"
+#include <map>
+
+// AsyncUDP listeners by local port
+namespace host {
+  static std::map<AsyncUDP*, uint16_t> &asyncListeners = *new std::map<AsyncUDP*, uint16_t>; // never destroyed: globals unregister on exit
+
+  void asyncUdpListen(AsyncUDP *udp, uint16_t port)
+  {
+    if (port) asyncListeners[udp] = port;
+    else asyncListeners.erase(udp);
+  }
+  bool asyncUdpReceive(uint16_t localPort, const uint8_t *data, size_t len, IPAddress from)
+  {
+    std::vector<uint8_t> buf(data, data + len); // handlers may modify the packet data
+    for (auto &l : asyncListeners) {
+      if (l.second != localPort) continue;
+      AsyncUDPPacket p(buf.data(), buf.size(), from, 50000, localPort);
+      l.first->deliver(p);
+      return true;
+    }
+    return false;
+  }
+}
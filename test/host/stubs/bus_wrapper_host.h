@@ -0,0 +1,110 @@
+#ifndef BusWrapper_h
+#define BusWrapper_h
+/*
+ * Host build: replaces wled00/bus_wrapper.h (force-included when compiling bus_manager.cpp, the include
+ * guard then hides the NeoPixelBus based original). Digital busses are RAM buffers that behave like
+ * NeoPixelBrightnessBus: colors are stored dimmed by the bus brightness and read back brightened.
+ */
+#include "Arduino.h"
+#include "const.h"
+
+#define I_NONE 0
+#define I_HOST_3 1
+#define I_HOST_4 2
+
+struct HostPixelBus {
+  uint8_t *data;       // 4 bytes per pixel, channel order as it would go out on the wire (W in byte 3)
+  uint16_t len;
+  uint8_t bri = 255;
+  uint32_t shows = 0;  // number of show() calls
+  unsigned long busyUntil = 0; // micros() when sending of last frame ends (host::busWireTime())
+};
+
+class PolyBus {
+ public:
+  static void begin(void* busPtr, uint8_t busType, uint8_t* pins) {}
+  static void* create(uint8_t busType, uint8_t* pins, uint16_t len, uint8_t channel) {
+    if (busType == I_NONE) return nullptr;
+    HostPixelBus *b = new HostPixelBus();
+    b->data = (uint8_t*)calloc(len ? len : 1, 4);
+    b->len = len;
+    return b;
+  }
+  static void show(void* busPtr, uint8_t busType) {
+    HostPixelBus *b = static_cast<HostPixelBus*>(busPtr);
+    if (!b) return;
+    b->shows++;
+    if (!host::busWireTimeEnabled()) return;
+    while ((long)(micros() - b->busyUntil) < 0) delayMicroseconds(20);
+    b->busyUntil = micros() + 30UL * b->len + 300;
+  }
+  static bool canShow(void* busPtr, uint8_t busType) {
+    HostPixelBus *b = static_cast<HostPixelBus*>(busPtr);
+    return !b || !host::busWireTimeEnabled() || (long)(micros() - b->busyUntil) >= 0;
+  }
+  static void setPixelColor(void* busPtr, uint8_t busType, uint16_t pix, uint32_t c, uint8_t co) {
+    HostPixelBus *b = static_cast<HostPixelBus*>(busPtr);
+    if (!b || pix >= b->len) return;
+    uint8_t r = c >> 16, g = c >> 8, bl = c, w = c >> 24;
+    uint8_t R, G, B, W;
+    switch (co & 0x0F) {
+      default: G = g; R = r; B = bl; break; //0 = GRB, default
+      case  1: G = r; R = g; B = bl; break; //1 = RGB
+      case  2: G = bl; R = r; B = g; break; //2 = BRG
+      case  3: G = r; R = bl; B = g; break; //3 = RBG
+      case  4: G = bl; R = g; B = r; break; //4 = BGR
+      case  5: G = g; R = bl; B = r; break; //5 = GBR
+    }
+    switch (co >> 4) {
+      default: W = w;        break;
+      case  1: W = B; B = w; break;
+      case  2: W = G; G = w; break;
+      case  3: W = R; R = w; break;
+    }
+    if (busType == I_HOST_3) W = 0;
+    uint8_t *p = b->data + 4*pix;
+    uint16_t s = b->bri + 1;
+    p[0] = (R * s) >> 8; p[1] = (G * s) >> 8; p[2] = (B * s) >> 8; p[3] = (W * s) >> 8;
+  }
+  // like NeoPixelBrightnessBus::SetBrightness() the stored (dimmed) colors are rescaled to the new brightness
+  static void setBrightness(void* busPtr, uint8_t busType, uint8_t b) {
+    HostPixelBus *bus = static_cast<HostPixelBus*>(busPtr);
+    if (!bus || bus->bri == b) return;
+    uint16_t scale = (((uint16_t)b + 1) << 8) / ((uint16_t)bus->bri + 1);
+    for (uint32_t i = 0; i < 4U * bus->len; i++) bus->data[i] = ((uint16_t)bus->data[i] * scale) >> 8;
+    bus->bri = b;
+  }
+  static uint32_t getPixelColor(void* busPtr, uint8_t busType, uint16_t pix, uint8_t co) {
+    HostPixelBus *b = static_cast<HostPixelBus*>(busPtr);
+    if (!b || pix >= b->len) return 0;
+    const uint8_t *p = b->data + 4*pix;
+    uint16_t s = b->bri + 1;
+    auto brighten = [s](uint8_t v) -> uint8_t { uint32_t o = ((uint32_t)v << 8) / s; return o > 255 ? 255 : o; };
+    uint8_t R = brighten(p[0]), G = brighten(p[1]), B = brighten(p[2]), W = brighten(p[3]), t = W;
+    switch (co >> 4) {
+      case 1: W = B; B = t; break;
+      case 2: W = G; G = t; break;
+      case 3: W = R; R = t; break;
+    }
+    switch (co & 0x0F) {
+      default: return ((W << 24) | (G << 8) | (R << 16) | (B)); //0 = GRB, default
+      case  1: return ((W << 24) | (R << 8) | (G << 16) | (B)); //1 = RGB
+      case  2: return ((W << 24) | (B << 8) | (R << 16) | (G)); //2 = BRG
+      case  3: return ((W << 24) | (B << 8) | (G << 16) | (R)); //3 = RBG
+      case  4: return ((W << 24) | (R << 8) | (B << 16) | (G)); //4 = BGR
+      case  5: return ((W << 24) | (G << 8) | (B << 16) | (R)); //5 = GBR
+    }
+  }
+  static void cleanup(void* busPtr, uint8_t busType) {
+    HostPixelBus *b = static_cast<HostPixelBus*>(busPtr);
+    if (!b) return;
+    free(b->data);
+    delete b;
+  }
+  static uint8_t getI(uint8_t busType, uint8_t* pins, uint8_t num = 0) {
+    if (!IS_DIGITAL(busType)) return I_NONE;
+    return (busType == TYPE_SK6812_RGBW || busType == TYPE_TM1814) ? I_HOST_4 : I_HOST_3;
+  }
+};
+
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+typedef int esp_err_t;
+inline esp_err_t esp_task_wdt_init(uint32_t, bool) { return 0; }
+inline esp_err_t esp_task_wdt_add(void*) { return 0; }
+inline esp_err_t esp_task_wdt_delete(void*) { return 0; }
+inline esp_err_t esp_task_wdt_reset() { return 0; }
@@ -0,0 +1,12 @@
+#pragma once
+#include <stdint.h>
+#include <string.h>
+typedef int esp_err_t;
+#define ESP_OK 0
+#define WIFI_IF_STA 0
+#define WIFI_IF_AP 1
+typedef struct { uint8_t mac[6]; int8_t rssi; } wifi_sta_info_t;
+typedef struct { wifi_sta_info_t sta[10]; int num; } wifi_sta_list_t;
+inline esp_err_t esp_wifi_set_ps(int) { return ESP_OK; }
+inline esp_err_t esp_wifi_get_mac(int, uint8_t *mac) { const uint8_t m[6] = {0xa1,0xb2,0xc3,0xd4,0xe5,0xf6}; memcpy(mac, m, 6); return ESP_OK; }
+inline esp_err_t esp_wifi_ap_get_sta_list(wifi_sta_list_t *l) { l->num = 0; return ESP_OK; }
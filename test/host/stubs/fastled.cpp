@@ -0,0 +1,335 @@
+// Host build: non-inline part of the FastLED subset (see FastLED.h)
+#include "FastLED.h"
+
+uint16_t rand16seed = 1337;
+
+// HSV -> RGB (hsv2rgb.cpp)
+void hsv2rgb_rainbow(const CHSV &hsv, CRGB &rgb)
+{
+  const uint8_t K255 = 255, K171 = 171, K170 = 170, K85 = 85;
+  uint8_t hue = hsv.hue, sat = hsv.sat, val = hsv.val;
+  uint8_t offset8 = (hue & 0x1F) << 3;
+  uint8_t third = scale8(offset8, (256 / 3));
+  uint8_t r, g, b;
+  if (!(hue & 0x80)) {
+    if (!(hue & 0x40)) {
+      if (!(hue & 0x20)) { r = K255 - third; g = third; b = 0; }           // R -> O
+      else { r = K171; g = K85 + third; b = 0; }                          // O -> Y
+    } else {
+      if (!(hue & 0x20)) {                                                // Y -> G
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+        r = K171 - twothirds; g = K170 + third; b = 0;
+      } else { r = 0; g = K255 - third; b = third; }                      // G -> A
+    }
+  } else {
+    if (!(hue & 0x40)) {
+      if (!(hue & 0x20)) {                                                // A -> B
+        uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+        r = 0; g = K171 - twothirds; b = K85 + twothirds;
+      } else { r = third; g = 0; b = K255 - third; }                      // B -> P
+    } else {
+      if (!(hue & 0x20)) { r = K85 + third; g = 0; b = K171 - third; }    // P -> K
+      else { r = K170 + third; g = 0; b = K85 - third; }                  // K -> R
+    }
+  }
+  if (sat != 255) {
+    if (sat == 0) { r = 255; b = 255; g = 255; }
+    else {
+      uint8_t desat = 255 - sat;
+      desat = scale8_video(desat, desat);
+      uint8_t satscale = 255 - desat;
+      r = scale8(r, satscale) + desat; g = scale8(g, satscale) + desat; b = scale8(b, satscale) + desat;
+    }
+  }
+  if (val != 255) {
+    val = scale8_video(val, val);
+    if (val == 0) { r = 0; g = 0; b = 0; }
+    else { r = scale8(r, val); g = scale8(g, val); b = scale8(b, val); }
+  }
+  rgb.r = r; rgb.g = g; rgb.b = b;
+}
+
+void hsv2rgb_raw(const CHSV &hsv, CRGB &rgb)
+{
+  const uint8_t HSV_SECTION_3 = 0x40;
+  uint8_t value = hsv.val;
+  uint8_t invsat = 255 - hsv.sat;
+  uint8_t brightness_floor = (value * invsat) / 256;
+  uint8_t color_amplitude = value - brightness_floor;
+  uint8_t section = hsv.hue / HSV_SECTION_3;
+  uint8_t offset = hsv.hue % HSV_SECTION_3;
+  uint8_t rampup = offset;
+  uint8_t rampdown = (HSV_SECTION_3 - 1) - offset;
+  uint8_t rampup_adj_with_floor   = (rampup   * color_amplitude) / (256 / 4) + brightness_floor;
+  uint8_t rampdown_adj_with_floor = (rampdown * color_amplitude) / (256 / 4) + brightness_floor;
+  if (section) {
+    if (section == 1) { rgb.r = brightness_floor; rgb.g = rampdown_adj_with_floor; rgb.b = rampup_adj_with_floor; }
+    else              { rgb.r = rampup_adj_with_floor; rgb.g = brightness_floor; rgb.b = rampdown_adj_with_floor; }
+  } else              { rgb.r = rampdown_adj_with_floor; rgb.g = rampup_adj_with_floor; rgb.b = brightness_floor; }
+}
+
+void hsv2rgb_spectrum(const CHSV &hsv, CRGB &rgb)
+{
+  CHSV hsv2(hsv);
+  hsv2.hue = scale8(hsv2.hue, 191);
+  hsv2rgb_raw(hsv2, rgb);
+}
+
+// plain RGB -> HSV with FastLED's hue scale (FastLED uses an approximation with the same ranges)
+CHSV rgb2hsv_approximate(const CRGB &rgb)
+{
+  uint8_t mx = std::max(rgb.r, std::max(rgb.g, rgb.b));
+  uint8_t mn = std::min(rgb.r, std::min(rgb.g, rgb.b));
+  if (mx == 0) return CHSV(0, 0, 0);
+  uint8_t delta = mx - mn;
+  uint8_t s = (uint16_t)delta * 255 / mx;
+  if (delta == 0) return CHSV(0, 0, mx);
+  int h;
+  if (mx == rgb.r)      h = 0   + 43 * (int(rgb.g) - int(rgb.b)) / delta;
+  else if (mx == rgb.g) h = 85  + 43 * (int(rgb.b) - int(rgb.r)) / delta;
+  else                  h = 171 + 43 * (int(rgb.r) - int(rgb.g)) / delta;
+  return CHSV((uint8_t)h, s, mx);
+}
+
+// colorutils.cpp
+void fill_solid(struct CRGB *targetArray, int numToFill, const struct CRGB &color)
+{
+  for (int i = 0; i < numToFill; ++i) targetArray[i] = color;
+}
+
+void fill_rainbow(struct CRGB *targetArray, int numToFill, uint8_t initialhue, uint8_t deltahue)
+{
+  CHSV hsv(initialhue, 240, 255);
+  for (int i = 0; i < numToFill; ++i) { targetArray[i] = hsv; hsv.hue += deltahue; }
+}
+
+void fill_gradient_RGB(CRGB *leds, uint16_t startpos, CRGB startcolor, uint16_t endpos, CRGB endcolor)
+{
+  if (endpos < startpos) { std::swap(endpos, startpos); std::swap(endcolor, startcolor); }
+  saccum87 rdistance87 = (endcolor.r - startcolor.r) << 7;
+  saccum87 gdistance87 = (endcolor.g - startcolor.g) << 7;
+  saccum87 bdistance87 = (endcolor.b - startcolor.b) << 7;
+  uint16_t pixeldistance = endpos - startpos;
+  int16_t divisor = pixeldistance ? pixeldistance : 1;
+  saccum87 rdelta87 = (rdistance87 / divisor) * 2;
+  saccum87 gdelta87 = (gdistance87 / divisor) * 2;
+  saccum87 bdelta87 = (bdistance87 / divisor) * 2;
+  accum88 r88 = startcolor.r << 8, g88 = startcolor.g << 8, b88 = startcolor.b << 8;
+  for (uint16_t i = startpos; i <= endpos; ++i) {
+    leds[i] = CRGB(r88 >> 8, g88 >> 8, b88 >> 8);
+    r88 += rdelta87; g88 += gdelta87; b88 += bdelta87;
+  }
+}
+
+CRGBPalette16 &CRGBPalette16::loadDynamicGradientPalette(TDynamicRGBGradientPalette_bytes gpal)
+{
+  const TRGBGradientPaletteEntryUnion *ent = (const TRGBGradientPaletteEntryUnion*)gpal;
+  TRGBGradientPaletteEntryUnion u;
+  uint16_t count = 0;
+  do { u = ent[count]; ++count; } while (u.index != 255);
+  int8_t lastSlotUsed = -1;
+  u = *ent;
+  CRGB rgbstart(u.r, u.g, u.b);
+  int indexstart = 0;
+  while (indexstart < 255) {
+    ++ent;
+    u = *ent;
+    int indexend = u.index;
+    CRGB rgbend(u.r, u.g, u.b);
+    uint8_t istart8 = indexstart / 16;
+    uint8_t iend8 = indexend / 16;
+    if (count < 16) {
+      if ((istart8 <= lastSlotUsed) && (lastSlotUsed < 15)) {
+        istart8 = lastSlotUsed + 1;
+        if (iend8 < istart8) iend8 = istart8;
+      }
+      lastSlotUsed = iend8;
+    }
+    fill_gradient_RGB(&(entries[0]), istart8, rgbstart, iend8, rgbend);
+    indexstart = indexend;
+    rgbstart = rgbend;
+  }
+  return *this;
+}
+
+CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness, TBlendType blendType)
+{
+  if (blendType == LINEARBLEND_NOWRAP) index = map8(index, 0, 239);
+  uint8_t hi4 = index >> 4;
+  uint8_t lo4 = index & 0x0F;
+  const CRGB *entry = &(pal[0]) + hi4;
+  bool blend = lo4 && (blendType != NOBLEND);
+  uint8_t red1 = entry->red, green1 = entry->green, blue1 = entry->blue;
+  if (blend) {
+    if (hi4 == 15) entry = &(pal[0]); else ++entry;
+    uint8_t f2 = lo4 << 4;
+    uint8_t f1 = 255 - f2;
+    red1   = scale8(red1, f1)   + scale8(entry->red, f2);
+    green1 = scale8(green1, f1) + scale8(entry->green, f2);
+    blue1  = scale8(blue1, f1)  + scale8(entry->blue, f2);
+  }
+  if (brightness != 255) {
+    if (brightness) {
+      ++brightness;
+      if (red1)   red1   = scale8(red1, brightness);
+      if (green1) green1 = scale8(green1, brightness);
+      if (blue1)  blue1  = scale8(blue1, brightness);
+    } else {
+      red1 = 0; green1 = 0; blue1 = 0;
+    }
+  }
+  return CRGB(red1, green1, blue1);
+}
+
+void nblendPaletteTowardPalette(CRGBPalette16 &current, CRGBPalette16 &target, uint8_t maxChanges)
+{
+  uint8_t *p1 = (uint8_t*)current.entries;
+  uint8_t *p2 = (uint8_t*)target.entries;
+  uint8_t changes = 0;
+  for (uint8_t i = 0; i < sizeof(CRGBPalette16); ++i) {
+    if (p1[i] == p2[i]) continue;
+    if (p1[i] < p2[i]) { ++p1[i]; ++changes; }
+    if (p1[i] > p2[i]) { --p1[i]; ++changes; if (p1[i] > p2[i]) --p1[i]; }
+    if (changes >= maxChanges) break;
+  }
+}
+
+CRGB &nblend(CRGB &existing, const CRGB &overlay, fract8 amountOfOverlay)
+{
+  if (amountOfOverlay == 0) return existing;
+  if (amountOfOverlay == 255) { existing = overlay; return existing; }
+  existing.red   = blend8(existing.red,   overlay.red,   amountOfOverlay);
+  existing.green = blend8(existing.green, overlay.green, amountOfOverlay);
+  existing.blue  = blend8(existing.blue,  overlay.blue,  amountOfOverlay);
+  return existing;
+}
+
+CRGB blend(const CRGB &p1, const CRGB &p2, fract8 amountOfP2)
+{
+  CRGB nu(p1);
+  nblend(nu, p2, amountOfP2);
+  return nu;
+}
+
+void nscale8(CRGB *leds, uint16_t num_leds, uint8_t scale) { for (uint16_t i = 0; i < num_leds; ++i) leds[i].nscale8(scale); }
+void fadeToBlackBy(CRGB *leds, uint16_t num_leds, uint8_t fadeBy) { nscale8(leds, num_leds, 255 - fadeBy); }
+void fadeLightBy(CRGB *leds, uint16_t num_leds, uint8_t fadeBy) { for (uint16_t i = 0; i < num_leds; ++i) leds[i].nscale8_video(255 - fadeBy); }
+
+void blur1d(CRGB *leds, uint16_t numLeds, fract8 blur_amount)
+{
+  uint8_t keep = 255 - blur_amount;
+  uint8_t seep = blur_amount >> 1;
+  CRGB carryover = CRGB::Black;
+  for (uint16_t i = 0; i < numLeds; ++i) {
+    CRGB cur = leds[i];
+    CRGB part = cur;
+    part.nscale8(seep);
+    cur.nscale8(keep);
+    cur += carryover;
+    if (i) leds[i-1] += part;
+    leds[i] = cur;
+    carryover = part;
+  }
+}
+
+CRGB HeatColor(uint8_t temperature)
+{
+  CRGB heatcolor;
+  uint8_t t192 = scale8_video(temperature, 191);
+  uint8_t heatramp = (t192 & 0x3F) << 2;
+  if (t192 & 0x80)      { heatcolor.r = 255; heatcolor.g = 255; heatcolor.b = heatramp; }
+  else if (t192 & 0x40) { heatcolor.r = 255; heatcolor.g = heatramp; heatcolor.b = 0; }
+  else                  { heatcolor.r = heatramp; heatcolor.g = 0; heatcolor.b = 0; }
+  return heatcolor;
+}
+
+// colorpalettes.cpp
+const TProgmemRGBPalette16 CloudColors_p = {
+  CRGB::Blue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue, CRGB::DarkBlue,
+  CRGB::Blue, CRGB::DarkBlue, CRGB::SkyBlue, CRGB::SkyBlue, CRGB::LightBlue, CRGB::White, CRGB::LightBlue, CRGB::SkyBlue };
+const TProgmemRGBPalette16 LavaColors_p = {
+  CRGB::Black, CRGB::Maroon, CRGB::Black, CRGB::Maroon, CRGB::DarkRed, CRGB::DarkRed, CRGB::Maroon, CRGB::DarkRed,
+  CRGB::DarkRed, CRGB::DarkRed, CRGB::Red, CRGB::Orange, CRGB::White, CRGB::Orange, CRGB::Red, CRGB::DarkRed };
+const TProgmemRGBPalette16 OceanColors_p = {
+  CRGB::MidnightBlue, CRGB::DarkBlue, CRGB::MidnightBlue, CRGB::Navy, CRGB::DarkBlue, CRGB::MediumBlue, CRGB::SeaGreen, CRGB::Teal,
+  CRGB::CadetBlue, CRGB::Blue, CRGB::DarkCyan, CRGB::CornflowerBlue, CRGB::Aquamarine, CRGB::SeaGreen, CRGB::Aqua, CRGB::LightSkyBlue };
+const TProgmemRGBPalette16 ForestColors_p = {
+  CRGB::DarkGreen, CRGB::DarkGreen, CRGB::DarkOliveGreen, CRGB::DarkGreen, CRGB::Green, CRGB::ForestGreen, CRGB::OliveDrab, CRGB::Green,
+  CRGB::SeaGreen, CRGB::MediumAquamarine, CRGB::LimeGreen, CRGB::YellowGreen, CRGB::LightGreen, CRGB::LawnGreen, CRGB::MediumAquamarine, CRGB::ForestGreen };
+const TProgmemRGBPalette16 RainbowColors_p = {
+  0xFF0000, 0xD52A00, 0xAB5500, 0xAB7F00, 0xABAB00, 0x56D500, 0x00FF00, 0x00D52A,
+  0x00AB55, 0x0056AA, 0x0000FF, 0x2A00D5, 0x5500AB, 0x7F0081, 0xAB0055, 0xD5002B };
+const TProgmemRGBPalette16 RainbowStripeColors_p = {
+  0xFF0000, 0x000000, 0xAB5500, 0x000000, 0xABAB00, 0x000000, 0x00FF00, 0x000000,
+  0x00AB55, 0x000000, 0x0000FF, 0x000000, 0x5500AB, 0x000000, 0xAB0055, 0x000000 };
+const TProgmemRGBPalette16 PartyColors_p = {
+  0x5500AB, 0x84007C, 0xB5004B, 0xE5001B, 0xE81700, 0xB84700, 0xAB7700, 0xABAB00,
+  0xAB5500, 0xDD2200, 0xF2000E, 0xC2003E, 0x8F0071, 0x5F00A1, 0x2F00D0, 0x0007F9 };
+const TProgmemRGBPalette16 HeatColors_p = {
+  0x000000, 0x330000, 0x660000, 0x990000, 0xCC0000, 0xFF0000, 0xFF3300, 0xFF6600,
+  0xFF9900, 0xFFCC00, 0xFFFF00, 0xFFFF33, 0xFFFF66, 0xFFFF99, 0xFFFFCC, 0xFFFFFF };
+
+// noise.cpp: 16 bit Perlin noise, the permutation table is generated once
+static uint8_t perm[513];
+static bool permInit = false;
+static void initPerm()
+{
+  for (int i = 0; i < 256; i++) perm[i] = i;
+  uint32_t s = 0x2545F491;
+  for (int i = 255; i > 0; i--) {
+    s = s * 1103515245 + 12345;
+    int j = (s >> 16) % (i + 1);
+    std::swap(perm[i], perm[j]);
+  }
+  for (int i = 256; i < 513; i++) perm[i] = perm[i & 255];
+  permInit = true;
+}
+#define P(x) perm[(x)]
+#define AVG15(U,V) (((U)+(V)) >> 1)
+#define LERP(a,b,u) lerp15by16(a,b,u)
+
+static int16_t grad16(uint8_t hash, int16_t x, int16_t y, int16_t z)
+{
+  hash = hash & 15;
+  int16_t u = hash < 8 ? x : y;
+  int16_t v = hash < 4 ? y : hash == 12 || hash == 14 ? x : z;
+  if (hash & 1) u = -u;
+  if (hash & 2) v = -v;
+  return AVG15(u, v);
+}
+
+int16_t inoise16_raw(uint32_t x, uint32_t y, uint32_t z)
+{
+  if (!permInit) initPerm();
+  uint8_t X = (x >> 16) & 0xFF, Y = (y >> 16) & 0xFF, Z = (z >> 16) & 0xFF;
+  uint8_t A = P(X) + Y, AA = P(A) + Z, AB = P(A + 1) + Z;
+  uint8_t B = P(X + 1) + Y, BA = P(B) + Z, BB = P(B + 1) + Z;
+  uint16_t u = x & 0xFFFF, v = y & 0xFFFF, w = z & 0xFFFF;
+  int16_t xx = (u >> 1) & 0x7FFF, yy = (v >> 1) & 0x7FFF, zz = (w >> 1) & 0x7FFF;
+  const uint16_t N = 0x8000L;
+  u = ease16InOutQuad(u); v = ease16InOutQuad(v); w = ease16InOutQuad(w);
+  int16_t X1 = LERP(grad16(P(AA), xx, yy, zz), grad16(P(BA), xx - N, yy, zz), u);
+  int16_t X2 = LERP(grad16(P(AB), xx, yy - N, zz), grad16(P(BB), xx - N, yy - N, zz), u);
+  int16_t X3 = LERP(grad16(P(AA + 1), xx, yy, zz - N), grad16(P(BA + 1), xx - N, yy, zz - N), u);
+  int16_t X4 = LERP(grad16(P(AB + 1), xx, yy - N, zz - N), grad16(P(BB + 1), xx - N, yy - N, zz - N), u);
+  int16_t Y1 = LERP(X1, X2, v);
+  int16_t Y2 = LERP(X3, X4, v);
+  return LERP(Y1, Y2, w);
+}
+
+uint16_t inoise16(uint32_t x, uint32_t y, uint32_t z)
+{
+  int32_t ans = inoise16_raw(x, y, z);
+  ans = ans + 19052L;
+  uint32_t pan = ans;
+  pan *= 440L;
+  pan >>= 8;
+  return pan > 65535 ? 65535 : pan;
+}
+uint16_t inoise16(uint32_t x, uint32_t y) { return inoise16(x, y, 0); }
+uint16_t inoise16(uint32_t x) { return inoise16(x, 0, 0); }
+
+int8_t inoise8_raw(uint16_t x, uint16_t y, uint16_t z) { return inoise16_raw((uint32_t)x << 8, (uint32_t)y << 8, (uint32_t)z << 8) >> 8; }
+uint8_t inoise8(uint16_t x, uint16_t y, uint16_t z) { return inoise16((uint32_t)x << 8, (uint32_t)y << 8, (uint32_t)z << 8) >> 8; }
+uint8_t inoise8(uint16_t x, uint16_t y) { return inoise8(x, y, 0); }
+uint8_t inoise8(uint16_t x) { return inoise8(x, 0, 0); }
@@ -0,0 +1,145 @@
+// Host build: FreeRTOS task, notification, semaphore and spinlock API on std::thread.
+// Tasks are detached threads that report the core they were pinned to; the main thread is the
+// Arduino loop task on core 1. Tasks never end, so programs that started one exit with _exit().
+#include "Arduino.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include <pthread.h>
+
+namespace {
+  struct Task {
+    std::mutex m;
+    std::condition_variable cv;
+    uint32_t notify = 0;
+    int core;
+    explicit Task(int c) : core(c) {}
+  };
+  Task mainTask(1);
+  thread_local Task *currentTask = &mainTask;
+  std::atomic<uint32_t> nextThreadId(1);
+  thread_local uint32_t threadId = 0;
+
+  uint32_t myThreadId() { if (!threadId) threadId = nextThreadId++; return threadId; }
+
+  enum SemKind { SEM_MUTEX, SEM_RECURSIVE, SEM_BINARY };
+  struct Semaphore {
+    SemKind kind;
+    std::recursive_timed_mutex rm;
+    std::timed_mutex m;
+    std::mutex bm;
+    std::condition_variable bcv;
+    bool given = false;
+    explicit Semaphore(SemKind k) : kind(k) {}
+  };
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *param, UBaseType_t prio, TaskHandle_t *handle, BaseType_t core)
+{
+  Task *t = new Task(core == 0 ? 0 : 1);
+  if (handle) *handle = t;
+  std::thread([fn, param, t]() { currentTask = t; fn(param); }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *param, UBaseType_t prio, TaskHandle_t *handle)
+{
+  return xTaskCreatePinnedToCore(fn, name, stack, param, prio, handle, 1);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+  if (task == nullptr || task == currentTask) pthread_exit(nullptr); // other tasks cannot be stopped on the host
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+  // ticks are real milliseconds even when the Arduino clock is stopped (host::setMillis())
+  if (ticks) std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+  else std::this_thread::yield();
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t wait)
+{
+  Task *t = currentTask;
+  std::unique_lock<std::mutex> l(t->m);
+  if (wait == portMAX_DELAY) t->cv.wait(l, [t]{ return t->notify > 0; });
+  else t->cv.wait_for(l, std::chrono::milliseconds(wait), [t]{ return t->notify > 0; });
+  uint32_t v = t->notify;
+  if (v) t->notify = clearOnExit ? 0 : v - 1;
+  return v;
+}
+
+void xTaskNotifyGive(TaskHandle_t task)
+{
+  Task *t = static_cast<Task*>(task);
+  if (!t) return;
+  { std::lock_guard<std::mutex> l(t->m); t->notify++; }
+  t->cv.notify_one();
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask; }
+BaseType_t xPortGetCoreID() { return currentTask->core; }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new Semaphore(SEM_MUTEX); }
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new Semaphore(SEM_RECURSIVE); }
+SemaphoreHandle_t xSemaphoreCreateBinary() { return new Semaphore(SEM_BINARY); }
+void vSemaphoreDelete(SemaphoreHandle_t s) { delete static_cast<Semaphore*>(s); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait)
+{
+  Semaphore *s = static_cast<Semaphore*>(sem);
+  auto timeout = std::chrono::milliseconds(wait);
+  switch (s->kind) {
+    case SEM_RECURSIVE:
+      if (wait == portMAX_DELAY) { s->rm.lock(); return pdTRUE; }
+      return s->rm.try_lock_for(timeout) ? pdTRUE : pdFALSE;
+    case SEM_MUTEX:
+      if (wait == portMAX_DELAY) { s->m.lock(); return pdTRUE; }
+      return s->m.try_lock_for(timeout) ? pdTRUE : pdFALSE;
+    default: {
+      std::unique_lock<std::mutex> l(s->bm);
+      if (wait == portMAX_DELAY) s->bcv.wait(l, [s]{ return s->given; });
+      else if (!s->bcv.wait_for(l, timeout, [s]{ return s->given; })) return pdFALSE;
+      s->given = false;
+      return pdTRUE;
+    }
+  }
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+  Semaphore *s = static_cast<Semaphore*>(sem);
+  switch (s->kind) {
+    case SEM_RECURSIVE: s->rm.unlock(); break;
+    case SEM_MUTEX:     s->m.unlock();  break;
+    default: {
+      { std::lock_guard<std::mutex> l(s->bm); if (s->given) return pdFALSE; s->given = true; }
+      s->bcv.notify_one();
+    }
+  }
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t wait) { return xSemaphoreTake(sem, wait); }
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem) { return xSemaphoreGive(sem); }
+
+// portMUX: recursive spinlock (as on ESP-IDF the owner may nest critical sections)
+void portENTER_CRITICAL(portMUX_TYPE *mux)
+{
+  uint32_t me = myThreadId();
+  if (__atomic_load_n(&mux->owner, __ATOMIC_ACQUIRE) == me) { mux->count++; return; }
+  uint32_t expected = 0;
+  while (!__atomic_compare_exchange_n(&mux->owner, &expected, me, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+    expected = 0;
+    std::this_thread::yield();
+  }
+  mux->count = 1;
+}
+
+void portEXIT_CRITICAL(portMUX_TYPE *mux)
+{
+  if (--mux->count == 0) __atomic_store_n(&mux->owner, 0, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,150 @@
+// Host build: LittleFS on a host directory (a fresh temporary directory unless host::fsRoot() is set)
+#include "FS.h"
+#include "LittleFS.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#include <algorithm>
+
+static std::string rootDir;
+
+static const std::string &root()
+{
+  if (rootDir.empty()) {
+    char tmpl[] = "/tmp/wled-host-XXXXXX";
+    const char *d = mkdtemp(tmpl);
+    rootDir = d ? d : "/tmp";
+  }
+  return rootDir;
+}
+
+static std::string realPath(const char *path)
+{
+  std::string p = path ? path : "/";
+  if (p.empty() || p[0] != '/') p = "/" + p;
+  return root() + p;
+}
+
+namespace host {
+  void fsRoot(const char *dir) { rootDir = dir; ::mkdir(dir, 0755); }
+  const char *fsRoot() { return root().c_str(); }
+}
+
+namespace fs {
+
+struct FileImpl {
+  FILE *f = nullptr;
+  std::string path, name;               // path as seen by WLED ("/presets.json"), name without directories
+  bool dir = false;
+  std::vector<std::string> entries;     // directory listing
+  size_t next = 0;
+  ~FileImpl() { if (f) fclose(f); }
+};
+
+static std::shared_ptr<FileImpl> makeImpl(const std::string &path)
+{
+  auto p = std::make_shared<FileImpl>();
+  p->path = path.empty() || path[0] != '/' ? "/" + path : path;
+  size_t slash = p->path.find_last_of('/');
+  p->name = p->path.substr(slash + 1);
+  return p;
+}
+
+size_t File::write(uint8_t c) { return write(&c, 1); }
+size_t File::write(const uint8_t *buf, size_t size) { return (_p && _p->f) ? fwrite(buf, 1, size, _p->f) : 0; }
+int File::available()
+{
+  if (!_p || !_p->f) return 0;
+  long pos = ftell(_p->f);
+  return (int)(size() - (pos < 0 ? 0 : pos));
+}
+int File::read() { uint8_t c; return read(&c, 1) == 1 ? c : -1; }
+int File::peek()
+{
+  if (!_p || !_p->f) return -1;
+  int c = fgetc(_p->f);
+  if (c != EOF) ungetc(c, _p->f);
+  return c == EOF ? -1 : c;
+}
+void File::flush() { if (_p && _p->f) fflush(_p->f); }
+size_t File::read(uint8_t *buf, size_t size) { return (_p && _p->f) ? fread(buf, 1, size, _p->f) : 0; }
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+  if (!_p || !_p->f) return false;
+  int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+  return fseek(_p->f, pos, whence) == 0;
+}
+size_t File::position() const { if (!_p || !_p->f) return 0; long p = ftell(_p->f); return p < 0 ? 0 : p; }
+size_t File::size() const
+{
+  if (!_p) return 0;
+  if (_p->f) fflush(_p->f);
+  struct stat st;
+  return stat(realPath(_p->path.c_str()).c_str(), &st) == 0 ? st.st_size : 0;
+}
+void File::close() { _p.reset(); }
+File::operator bool() const { return _p && (_p->f || _p->dir); }
+time_t File::getLastWrite()
+{
+  struct stat st;
+  return (_p && stat(realPath(_p->path.c_str()).c_str(), &st) == 0) ? st.st_mtime : 0;
+}
+const char *File::path() const { return _p ? _p->path.c_str() : ""; }
+const char *File::name() const { return _p ? _p->name.c_str() : ""; }
+bool File::isDirectory(void) { return _p && _p->dir; }
+File File::openNextFile(const char *mode)
+{
+  if (!_p || !_p->dir || _p->next >= _p->entries.size()) return File();
+  std::string base = _p->path == "/" ? "" : _p->path;
+  return LittleFS.open((base + "/" + _p->entries[_p->next++]).c_str(), mode);
+}
+void File::rewindDirectory(void) { if (_p) _p->next = 0; }
+
+File FS::open(const char *path, const char *mode, const bool create)
+{
+  std::string real = realPath(path);
+  auto p = makeImpl(path);
+  struct stat st;
+  if (mode[0] == 'r' && stat(real.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+    p->dir = true;
+    if (DIR *d = opendir(real.c_str())) {
+      while (struct dirent *e = readdir(d)) if (e->d_name[0] != '.') p->entries.push_back(e->d_name);
+      closedir(d);
+    }
+    std::sort(p->entries.begin(), p->entries.end());
+    return File(p);
+  }
+  std::string m = mode;
+  if (m.find('b') == std::string::npos) m += 'b';
+  p->f = fopen(real.c_str(), m.c_str());
+  if (!p->f) return File();
+  return File(p);
+}
+bool FS::exists(const char *path) { struct stat st; return stat(realPath(path).c_str(), &st) == 0; }
+bool FS::remove(const char *path) { return ::unlink(realPath(path).c_str()) == 0; }
+bool FS::rename(const char *pathFrom, const char *pathTo) { return ::rename(realPath(pathFrom).c_str(), realPath(pathTo).c_str()) == 0; }
+bool FS::mkdir(const char *path) { return ::mkdir(realPath(path).c_str(), 0755) == 0; }
+bool FS::rmdir(const char *path) { return ::rmdir(realPath(path).c_str()) == 0; }
+bool FS::format()
+{
+  if (DIR *d = opendir(root().c_str())) {
+    while (struct dirent *e = readdir(d)) if (e->d_name[0] != '.') ::unlink((root() + "/" + e->d_name).c_str());
+    closedir(d);
+  }
+  return true;
+}
+size_t FS::usedBytes()
+{
+  size_t used = 0;
+  if (DIR *d = opendir(root().c_str())) {
+    struct stat st;
+    while (struct dirent *e = readdir(d)) if (e->d_name[0] != '.' && stat((root() + "/" + e->d_name).c_str(), &st) == 0) used += st.st_size;
+    closedir(d);
+  }
+  return used;
+}
+
+} // namespace fs
+
+fs::FS LittleFS;
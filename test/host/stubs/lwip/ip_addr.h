@@ -0,0 +1,6 @@
+#pragma once
+#include <stdint.h>
+typedef struct ip4_addr { uint32_t addr; } ip4_addr_t;
+typedef ip4_addr_t ip_addr_t;
+#define LWIP_VERSION_MAJOR 2
+#define IPADDR4_INIT(u32val) { u32val }
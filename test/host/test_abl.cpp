@@ -0,0 +1,69 @@
+/*
+ * Current limiter: power sums are cached per bus and only recalculated for busses with changed pixels.
+ * After every show() the estimate must equal a calculation from all pixels, for RGB and RGBW busses,
+ * with and without white balance correction (which reads colors back from the busses).
+ * Bus readback is only exact at full bus brightness, so the limit is not reached with white balance correction.
+ */
+#include "harness.h"
+
+// estimateCurrentAndLimitBri() calculated from scratch
+static uint32_t expectedMilliamps()
+{
+  uint32_t puPerMilliamp = 195075 / strip.milliampsPerLed;
+  uint16_t pLen = strip.getLengthPhysical();
+  uint32_t powerBudget = (strip.ablMilliampsMax - 100) * puPerMilliamp;
+  powerBudget = powerBudget > puPerMilliamp * pLen ? powerBudget - puPerMilliamp * pLen : 0;
+  uint32_t powerSum = 0;
+  for (uint8_t b = 0; b < busses.getNumBusses(); b++) {
+    Bus *bus = busses.getBus(b);
+    uint32_t busSum = 0;
+    for (uint16_t i = 0; i < bus->getLength(); i++) {
+      uint32_t c;
+      if (correctWB) c = bus->getPixelColor(i);
+      else c = bus->hasWhite() ? bus->autoWhiteCalc(strip.getPixelColor(bus->getStart() + i)) : strip.getPixelColor(bus->getStart() + i);
+      busSum += R(c) + G(c) + B(c) + W(c);
+    }
+    if (bus->hasWhite()) busSum = (busSum * 3) >> 2;
+    powerSum += busSum;
+  }
+  uint32_t mA;
+  uint32_t scaled = powerSum * strip.getBrightness();
+  if (scaled > powerBudget) {
+    float scale = (float)powerBudget / (float)scaled;
+    uint16_t scaleI = scale * 255;
+    uint8_t newBri = scale8(strip.getBrightness(), scaleI > 255 ? 255 : scaleI);
+    mA = (powerSum * newBri) / puPerMilliamp;
+  } else {
+    mA = scaled / puPerMilliamp;
+  }
+  return mA + 100 + pLen;
+}
+
+int main()
+{
+  const uint8_t modes[] = {FX_MODE_STATIC, FX_MODE_RAINBOW_CYCLE, FX_MODE_COLORWAVES, FX_MODE_TWINKLEFOX, FX_MODE_FIRE_2012, FX_MODE_BREATH};
+  for (int rgbw = 0; rgbw < 2; rgbw++) {
+    for (int wb = 0; wb < 2; wb++) {
+      correctWB = wb;
+      harness::setupStrip(100, 3, rgbw);
+      uint16_t limit = wb ? 20000 : 1500;
+      strip.ablMilliampsMax = limit;
+      strip.milliampsPerLed = 55;
+      unsigned mismatches = 0;
+      for (unsigned f = 0; f < 300; f++) {
+        if (f % 50 == 0) harness::setMode(modes[(f / 50) % sizeof(modes)]);
+        if (f % 7 == 0) strip.setPixelColor(random(300), RGBW32(random(256), random(256), random(256), random(256))); // outside of effects
+        if (f == 150) strip.ablMilliampsMax = 0; // disabled for a few frames: cache is rebuilt when enabled again
+        if (f == 160) strip.ablMilliampsMax = limit;
+        harness::frame();
+        if (!strip.ablMilliampsMax) continue;
+        if (strip.currentMilliamps != expectedMilliamps() && !mismatches++)
+          harness::fail(__FILE__, __LINE__, "rgbw " + std::to_string(rgbw) + " wb " + std::to_string(wb) + " frame " + std::to_string(f) +
+                        ": " + std::to_string(strip.currentMilliamps) + " mA != " + std::to_string(expectedMilliamps()) + " mA");
+      }
+      CHECK(strip.currentMilliamps > 100 + 300U); // some LEDs are lit
+    }
+  }
+  correctWB = false;
+  return harness::finish("test_abl");
+}
@@ -0,0 +1,116 @@
+/*
+ * Segment data arena (built with SEGMENT_ARENA_SIZE): blocks freed by effect changes leave holes, compactArena()
+ * (run by service() between frames) moves the remaining blocks together and updates the segments owning them.
+ * Data must survive moves, after compaction all free space is at the end, and an allocation that did not fit any
+ * hole fits again. Allocations that do not fit the arena use heap and are never moved.
+ */
+#include "harness.h"
+
+static const int SEGMENTS = 8;
+static const size_t HDR = 4; // arena block header
+
+static std::vector<size_t> lengths(SEGMENTS);
+
+static void fill(int s)
+{
+  Segment &seg = strip.getSegment(s);
+  for (size_t i = 0; i < lengths[s]; i++) seg.data[i] = (uint8_t)(s * 31 + i);
+}
+
+static bool intact(int s)
+{
+  Segment &seg = strip.getSegment(s);
+  if (!lengths[s]) return !seg.data;
+  if (!seg.data) return false;
+  for (size_t i = 0; i < lengths[s]; i++) if (seg.data[i] != (uint8_t)(s * 31 + i)) return false;
+  return true;
+}
+
+static bool allocate(int s, size_t len)
+{
+  Segment &seg = strip.getSegment(s);
+  lengths[s] = seg.allocateData(len) ? len : 0;
+  if (lengths[s]) fill(s);
+  return lengths[s];
+}
+
+static void release(int s)
+{
+  strip.getSegment(s).deallocateData();
+  lengths[s] = 0;
+}
+
+static void checkAll(const std::string &what)
+{
+  for (int s = 0; s < SEGMENTS; s++) {
+    if (!intact(s)) harness::fail(__FILE__, __LINE__, what + ": data of segment " + std::to_string(s) + " changed");
+  }
+}
+
+// no holes: largest free block is the space after the last block
+static bool compacted()
+{
+  return Segment::getArenaLargestFree() + HDR == Segment::getArenaSize() - Segment::getArenaUsed();
+}
+
+int main()
+{
+  harness::setupStrip(SEGMENTS * 50);
+  for (int s = 1; s < SEGMENTS; s++) strip.appendSegment();
+  for (int s = 0; s < SEGMENTS; s++) {
+    strip.setSegment(s, s * 50, s * 50 + 50);
+    strip.getSegment(s).setMode(FX_MODE_STATIC);
+  }
+  harness::frame();
+  CHECK_EQ(strip.getSegmentsNum(), SEGMENTS);
+  const uint16_t size = Segment::getArenaSize();
+  CHECK_EQ(size, SEGMENT_ARENA_SIZE);
+  CHECK_EQ(Segment::getArenaUsed(), 0);
+
+  // fill the arena, free every other block: free space is in holes
+  const size_t block = (size / SEGMENTS) - HDR - 16;
+  uint16_t heapAllocs = Segment::getArenaHeapAllocs();
+  for (int s = 0; s < SEGMENTS; s++) CHECK(allocate(s, block));
+  CHECK_EQ(Segment::getArenaHeapAllocs(), heapAllocs);
+  for (int s = 1; s < SEGMENTS; s += 2) release(s);
+  CHECK(!compacted());
+  CHECK(Segment::getArenaLargestFree() < 2 * block);
+  // does not fit a hole before compaction
+  byte *before = strip.getSegment(0).data;
+  byte *moved = strip.getSegment(2).data;
+  CHECK(allocate(1, 2 * block));
+  CHECK_EQ(Segment::getArenaHeapAllocs(), heapAllocs + 1);
+  release(1);
+  checkAll("fragmented");
+
+  harness::frame(); // compacts
+  CHECK(compacted());
+  CHECK(strip.getSegment(0).data == before);
+  CHECK(strip.getSegment(2).data != moved);
+  checkAll("compacted");
+  CHECK(allocate(1, 2 * block)); // fits now
+  CHECK_EQ(Segment::getArenaHeapAllocs(), heapAllocs + 1);
+  checkAll("allocated after compaction");
+
+  // random effect data changes between frames, some allocations spill to heap
+  for (int round = 0; round < 500; round++) {
+    int s = random(SEGMENTS);
+    if (random(3)) allocate(s, random(1, size / 4));
+    else release(s);
+    checkAll("round " + std::to_string(round));
+    if (round % 5 == 4) {
+      harness::frame();
+      checkAll("compaction in round " + std::to_string(round));
+      if (!compacted()) harness::fail(__FILE__, __LINE__, "holes left in round " + std::to_string(round));
+    }
+  }
+  CHECK(Segment::getArenaHeapAllocs() > heapAllocs + 1);
+  CHECK(Segment::getArenaCompactions() > 10);
+  CHECK(Segment::getArenaPeak() <= size);
+
+  for (int s = 0; s < SEGMENTS; s++) release(s);
+  harness::frame();
+  CHECK_EQ(Segment::getArenaUsed(), 0);
+  CHECK(compacted());
+  return harness::finish("test_arena");
+}
@@ -0,0 +1,197 @@
+/*
+ * 2D blur and move parity: blurRow(), blurCol(), box_blur(), moveX() and moveY() process a line buffer and write it
+ * back once. They must give the same pixels as the previous per-pixel implementations (kept below), on plain,
+ * reversed, mirrored and transposed segments. box_blur() uses integers instead of floats and may differ by 1.
+ */
+#include "harness.h"
+
+// previous implementations, working pixel by pixel through getPixelColorXY()/setPixelColorXY()
+static void oldBlurRow(Segment &seg, uint16_t row, fract8 blur_amount)
+{
+  const uint16_t cols = seg.virtualWidth();
+  const uint16_t rows = seg.virtualHeight();
+  if (row >= rows) return;
+  uint8_t keep = 255 - blur_amount;
+  uint8_t seep = blur_amount >> 1;
+  CRGB carryover = CRGB::Black;
+  for (uint16_t x = 0; x < cols; x++) {
+    CRGB cur = seg.getPixelColorXY(x, row);
+    CRGB part = cur;
+    part.nscale8(seep);
+    cur.nscale8(keep);
+    cur += carryover;
+    if (x) {
+      CRGB prev = CRGB(seg.getPixelColorXY(x-1, row)) + part;
+      seg.setPixelColorXY(x-1, row, prev);
+    }
+    seg.setPixelColorXY(x, row, cur);
+    carryover = part;
+  }
+}
+
+static void oldBlurCol(Segment &seg, uint16_t col, fract8 blur_amount)
+{
+  const uint16_t cols = seg.virtualWidth();
+  const uint16_t rows = seg.virtualHeight();
+  if (col >= cols) return;
+  uint8_t keep = 255 - blur_amount;
+  uint8_t seep = blur_amount >> 1;
+  CRGB carryover = CRGB::Black;
+  for (uint16_t i = 0; i < rows; i++) {
+    CRGB cur = seg.getPixelColorXY(col, i);
+    CRGB part = cur;
+    part.nscale8(seep);
+    cur.nscale8(keep);
+    cur += carryover;
+    if (i) {
+      CRGB prev = CRGB(seg.getPixelColorXY(col, i-1)) + part;
+      seg.setPixelColorXY(col, i-1, prev);
+    }
+    seg.setPixelColorXY(col, i, cur);
+    carryover = part;
+  }
+}
+
+static void oldBoxBlur(Segment &seg, uint16_t i, bool vertical, fract8 blur_amount)
+{
+  const uint16_t cols = seg.virtualWidth();
+  const uint16_t rows = seg.virtualHeight();
+  const uint16_t dim1 = vertical ? rows : cols;
+  const uint16_t dim2 = vertical ? cols : rows;
+  if (i >= dim2) return;
+  const float seep = blur_amount/255.f;
+  const float keep = 3.f - 2.f*seep;
+  CRGB tmp[dim1];
+  for (uint16_t j = 0; j < dim1; j++) {
+    uint16_t x = vertical ? i : j;
+    uint16_t y = vertical ? j : i;
+    uint16_t xp = vertical ? x : x-1;
+    uint16_t yp = vertical ? y-1 : y;
+    uint16_t xn = vertical ? x : x+1;
+    uint16_t yn = vertical ? y+1 : y;
+    CRGB curr = seg.getPixelColorXY(x,y);
+    // was (xp<0 || yp<0), never true for unsigned: the first pixel read a pixel outside the line (e.g. of the mirrored
+    // half on reversed, mirrored and transposed segments) instead of black, fixed by the line buffered version
+    CRGB prev = !j ? CRGB::Black : seg.getPixelColorXY(xp,yp);
+    CRGB next = ((vertical && yn>=dim1) || (!vertical && xn>=dim1)) ? CRGB::Black : seg.getPixelColorXY(xn,yn);
+    uint16_t r, g, b;
+    r = (curr.r*keep + (prev.r + next.r)*seep) / 3;
+    g = (curr.g*keep + (prev.g + next.g)*seep) / 3;
+    b = (curr.b*keep + (prev.b + next.b)*seep) / 3;
+    tmp[j] = CRGB(r,g,b);
+  }
+  for (uint16_t j = 0; j < dim1; j++) {
+    uint16_t x = vertical ? i : j;
+    uint16_t y = vertical ? j : i;
+    seg.setPixelColorXY(x, y, tmp[j]);
+  }
+}
+
+static void oldMoveX(Segment &seg, int8_t delta)
+{
+  const uint16_t cols = seg.virtualWidth();
+  const uint16_t rows = seg.virtualHeight();
+  if (!delta) return;
+  if (delta > 0) {
+    for (uint8_t y = 0; y < rows; y++) for (uint8_t x = 0; x < cols-1; x++) {
+      if (x + delta >= cols) break;
+      seg.setPixelColorXY(x, y, seg.getPixelColorXY((x + delta)%cols, y));
+    }
+  } else {
+    for (uint8_t y = 0; y < rows; y++) for (int16_t x = cols-1; x >= 0; x--) {
+      if (x + delta < 0) break;
+      seg.setPixelColorXY(x, y, seg.getPixelColorXY(x + delta, y));
+    }
+  }
+}
+
+static void oldMoveY(Segment &seg, int8_t delta)
+{
+  const uint16_t cols = seg.virtualWidth();
+  const uint16_t rows = seg.virtualHeight();
+  if (!delta) return;
+  if (delta > 0) {
+    for (uint8_t x = 0; x < cols; x++) for (uint8_t y = 0; y < rows-1; y++) {
+      if (y + delta >= rows) break;
+      seg.setPixelColorXY(x, y, seg.getPixelColorXY(x, (y + delta)));
+    }
+  } else {
+    for (uint8_t x = 0; x < cols; x++) for (int16_t y = rows-1; y >= 0; y--) {
+      if (y + delta < 0) break;
+      seg.setPixelColorXY(x, y, seg.getPixelColorXY(x, y + delta));
+    }
+  }
+}
+
+static std::vector<uint32_t> pixels()
+{
+  std::vector<uint32_t> p(strip.getLengthTotal());
+  for (size_t i = 0; i < p.size(); i++) p[i] = strip.getPixelColor(i);
+  return p;
+}
+
+static void restore(const std::vector<uint32_t> &p)
+{
+  for (size_t i = 0; i < p.size(); i++) strip.setPixelColor(i, p[i]);
+}
+
+// largest difference of a color channel between a and b
+static int maxDiff(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b)
+{
+  int d = 0;
+  for (size_t i = 0; i < a.size(); i++) {
+    for (int s = 0; s < 32; s += 8) d = std::max(d, abs((int)((a[i] >> s) & 0xFF) - (int)((b[i] >> s) & 0xFF)));
+  }
+  return d;
+}
+
+// applies the old and the new implementation to the same random pixels
+static void compare(const std::string &what, std::function<void()> oldFn, std::function<void()> newFn, int tolerance = 0)
+{
+  Segment &seg = strip.getSegment(0);
+  for (int x = 0; x < seg.virtualWidth(); x++) for (int y = 0; y < seg.virtualHeight(); y++) {
+    seg.setPixelColorXY(x, y, random(4) ? (uint32_t)random(0x7FFFFFFF) * 2 : 0);
+  }
+  std::vector<uint32_t> start = pixels();
+  oldFn();
+  std::vector<uint32_t> expected = pixels();
+  restore(start);
+  newFn();
+  int d = maxDiff(expected, pixels());
+  if (d > tolerance) harness::fail(__FILE__, __LINE__, what + ": pixels differ by " + std::to_string(d));
+}
+
+int main()
+{
+  harness::setupMatrix(40, 24);
+  strip.setBrightness(255, true);
+  Segment &seg = strip.getSegment(0);
+  static const char *FLAGS[] = {"plain", "reversed", "reversed y", "mirrored", "mirrored y", "transposed", "all"};
+  for (int flags = 0; flags < 7; flags++) {
+    seg.reverse   = flags == 1 || flags == 6;
+    seg.reverse_y = flags == 2 || flags == 6;
+    seg.mirror    = flags == 3 || flags == 6;
+    seg.mirror_y  = flags == 4 || flags == 6;
+    seg.transpose = flags == 5 || flags == 6;
+    const uint16_t cols = seg.virtualWidth(), rows = seg.virtualHeight();
+    for (uint8_t amount : {0, 1, 64, 127, 172, 255}) {
+      std::string what = std::string(FLAGS[flags]) + " " + std::to_string(amount) + " ";
+      compare(what + "blurRow", [&]() { for (uint16_t y = 0; y < rows; y++) oldBlurRow(seg, y, amount); },
+                                [&]() { for (uint16_t y = 0; y < rows; y++) seg.blurRow(y, amount); });
+      compare(what + "blurCol", [&]() { for (uint16_t x = 0; x < cols; x++) oldBlurCol(seg, x, amount); },
+                                [&]() { for (uint16_t x = 0; x < cols; x++) seg.blurCol(x, amount); });
+      for (int vertical = 0; vertical < 2; vertical++) {
+        uint16_t n = vertical ? cols : rows;
+        compare(what + (vertical ? "box_blur vertical" : "box_blur"),
+                [&]() { for (uint16_t i = 0; i < n; i++) oldBoxBlur(seg, i, vertical, amount); },
+                [&]() { for (uint16_t i = 0; i < n; i++) seg.box_blur(i, vertical, amount); }, 1);
+      }
+    }
+    for (int8_t delta : {1, 3, 17, -1, -5, -23, 60, -60}) {
+      std::string what = std::string(FLAGS[flags]) + " " + std::to_string(delta) + " ";
+      compare(what + "moveX", [&]() { oldMoveX(seg, delta); }, [&]() { seg.moveX(delta); });
+      compare(what + "moveY", [&]() { oldMoveY(seg, delta); }, [&]() { seg.moveY(delta); });
+    }
+  }
+  return harness::finish("test_blur_parity");
+}
@@ -0,0 +1,154 @@
+/*
+ * E1.31 output loopback: packets sent by realtimeBroadcast() (network busses) are decoded with the
+ * e131_packet_t layout and checked against E1.31-2016 (layer lengths, vectors, CID, universes, sequence
+ * numbers, synchronization packet), then received by WLED's own E1.31 listener, which must show the sent frame.
+ */
+#include "harness.h"
+
+static const IPAddress UNICAST(192, 168, 1, 50);
+static const IPAddress MULTICAST(239, 255, 0, 1);
+
+// flags (0x7) and length of a PDU starting at offset
+static uint16_t pduLength(uint16_t packetLength, uint16_t offset) { return 0x7000 | (packetLength - offset); }
+
+static void checkRootLayer(const host::UdpPacket &pkt, const uint8_t *cid)
+{
+  const e131_packet_t *p = reinterpret_cast<const e131_packet_t*>(pkt.data.data());
+  static const uint8_t acnId[12] = {0x41,0x53,0x43,0x2d,0x45,0x31,0x2e,0x31,0x37,0x00,0x00,0x00};
+  CHECK_EQ(pkt.port, E131_DEFAULT_PORT);
+  CHECK_EQ(htons(p->preamble_size), 0x0010);
+  CHECK_EQ(p->postamble_size, 0);
+  CHECK(!memcmp(p->acn_id, acnId, sizeof(acnId)));
+  CHECK_EQ(htons(p->root_flength), pduLength(pkt.data.size(), E131_ROOT_FLENGTH));
+  CHECK(!memcmp(p->cid, cid, sizeof(p->cid)));
+}
+
+// sends one frame of `leds` pixels and checks the packets, returns them
+static std::vector<host::UdpPacket> sendFrame(const std::vector<uint8_t> &buffer, uint16_t leds, bool rgbw, uint8_t bri, IPAddress dest)
+{
+  std::vector<uint8_t> packet(realtimePacketSize(1));
+  realtimePacketInit(1, packet.data());
+  host::udpCapture(true);
+  CHECK_EQ(realtimeBroadcast(1, dest, leds, const_cast<uint8_t*>(buffer.data()), packet.data(), bri, rgbw), 0);
+  std::vector<host::UdpPacket> sent = host::sentPackets;
+  host::udpCapture(false);
+
+  const size_t channels = leds * (rgbw ? 4 : 3);
+  const size_t perUniverse = rgbw ? 512 : 510;
+  const size_t universes = (channels + perUniverse - 1) / perUniverse;
+  const bool sync = e131FrameSync && universes > 1;
+  CHECK_EQ(sent.size(), universes + sync);
+  if (sent.size() != universes + sync) return sent;
+
+  uint8_t cid[16];
+  memcpy(cid, "WLED-E131-", 10);
+  WiFi.macAddress(cid + 10);
+  size_t offset = 0;
+  for (size_t u = 0; u < universes; u++) {
+    const host::UdpPacket &pkt = sent[u];
+    const e131_packet_t *p = reinterpret_cast<const e131_packet_t*>(pkt.data.data());
+    const size_t n = std::min(perUniverse, channels - offset);
+    CHECK_EQ(pkt.data.size(), E131_DMP_DATA + 1 + n);
+    checkRootLayer(pkt, cid);
+    CHECK_EQ(htonl(p->root_vector), 0x04);        // VECTOR_ROOT_E131_DATA
+    // framing layer
+    CHECK_EQ(htons(p->frame_flength), pduLength(pkt.data.size(), E131_FRAME_FLENGTH));
+    CHECK_EQ(htonl(p->frame_vector), 0x02);       // VECTOR_E131_DATA_PACKET
+    CHECK(!strncmp((const char*)p->source_name, serverDescription, 64));
+    CHECK_EQ(p->priority, 100);
+    CHECK_EQ(htons(p->sync_address), sync ? 1 : 0);
+    CHECK_EQ(p->options, 0);
+    CHECK_EQ(htons(p->universe), u + 1);
+    // DMP layer
+    CHECK_EQ(htons(p->dmp_flength), pduLength(pkt.data.size(), E131_DMP_FLENGTH));
+    CHECK_EQ(p->dmp_vector, 0x02);                // VECTOR_DMP_SET_PROPERTY
+    CHECK_EQ(p->type, 0xA1);
+    CHECK_EQ(htons(p->first_address), 0);
+    CHECK_EQ(htons(p->address_increment), 1);
+    CHECK_EQ(htons(p->property_value_count), n + 1);
+    CHECK_EQ(p->property_values[0], 0);           // DMX start code
+    unsigned wrong = 0;
+    for (size_t c = 0; c < n; c++) wrong += p->property_values[1 + c] != scale8(buffer[offset + c], bri);
+    CHECK_EQ(wrong, 0);
+    CHECK(pkt.ip == (dest[0] == 239 ? IPAddress(239, 255, 0, u + 1) : dest));
+    offset += n;
+  }
+  if (sync) {
+    // synchronization packet (E1.31: 6.3)
+    const host::UdpPacket &pkt = sent.back();
+    const e131_packet_t *p = reinterpret_cast<const e131_packet_t*>(pkt.data.data());
+    CHECK_EQ(pkt.data.size(), E131_SYNC_PACKET_SIZE);
+    checkRootLayer(pkt, cid);
+    CHECK_EQ(htonl(p->root_vector), E131_VECTOR_ROOT_EXTENDED);
+    CHECK_EQ(htons(p->sync_flength), pduLength(pkt.data.size(), E131_FRAME_FLENGTH));
+    CHECK_EQ(htonl(p->sync_vector), E131_VECTOR_EXTENDED_SYNC);
+    CHECK_EQ(htons(p->sync_universe), 1);
+    CHECK_EQ(p->sync_reserved, 0);
+    CHECK(pkt.ip == (dest[0] == 239 ? IPAddress(239, 255, 0, 1) : dest));
+  }
+  return sent;
+}
+
+// strip shows the frame (after gamma, which is off for realtime data by default)
+static unsigned wrongPixels(const std::vector<uint8_t> &buffer, uint16_t leds, bool rgbw, uint8_t bri)
+{
+  const uint8_t ch = rgbw ? 4 : 3;
+  unsigned wrong = 0;
+  for (uint16_t i = 0; i < leds; i++) {
+    const uint8_t *c = &buffer[i * ch];
+    uint32_t expected = RGBW32(scale8(c[0], bri), scale8(c[1], bri), scale8(c[2], bri), rgbw ? scale8(c[3], bri) : 0);
+    wrong += strip.getPixelColor(i) != expected;
+  }
+  return wrong;
+}
+
+static void loopback(uint16_t leds, bool rgbw, bool frameSync, IPAddress dest)
+{
+  std::string what = std::to_string(leds) + (rgbw ? " RGBW" : " RGB") + (frameSync ? " sync " : " ") + dest.toString().c_str();
+  harness::setupStrip(leds, 1, rgbw);
+  e131FrameSync = frameSync;
+  DMXMode = rgbw ? DMX_MODE_MULTIPLE_RGBW : DMX_MODE_MULTIPLE_RGB;
+  std::vector<uint8_t> buffer(leds * (rgbw ? 4 : 3));
+
+  std::vector<uint8_t> lastSeq;
+  for (unsigned frame = 0; frame < 3; frame++) {
+    for (uint8_t &b : buffer) b = random(256);
+    uint8_t bri = frame ? 200 : 255;
+    unsigned failures = harness::failures;
+    std::vector<host::UdpPacket> sent = sendFrame(buffer, leds, rgbw, bri, dest);
+    if (harness::failures != failures) { harness::fail(__FILE__, __LINE__, what); return; }
+
+    // every universe has its own sequence number, incremented once per frame
+    for (size_t u = 0; u < sent.size() - (e131FrameSync && sent.size() > 1); u++) {
+      uint8_t seq = reinterpret_cast<const e131_packet_t*>(sent[u].data.data())->sequence_number;
+      if (frame) CHECK_EQ(seq, (uint8_t)(lastSeq[u] + 1));
+      if (lastSeq.size() <= u) lastSeq.resize(u + 1);
+      lastSeq[u] = seq;
+    }
+
+    uint32_t committed = e131FramesCommitted;
+    for (const host::UdpPacket &pkt : sent) CHECK(host::asyncUdpReceive(E131_DEFAULT_PORT, pkt.data.data(), pkt.data.size()));
+    if (e131FrameSync) CHECK_EQ(e131FramesCommitted, committed + 1);
+    unsigned wrong = wrongPixels(buffer, leds, rgbw, bri);
+    if (wrong) harness::fail(__FILE__, __LINE__, what + ": " + std::to_string(wrong) + " pixels differ in frame " + std::to_string(frame));
+  }
+}
+
+int main()
+{
+  interfacesInited = true; // realtimeBroadcast() sends nothing before
+  e131Universe = 1;
+  DMXAddress = 1;
+  e131SkipOutOfSequence = true;
+  e131.begin(false, E131_DEFAULT_PORT, e131Universe, E131_MAX_UNIVERSE_COUNT);
+
+  loopback(100, false, false, UNICAST);  // single universe
+  loopback(100, false, true,  UNICAST);  // single universe, no sync packet needed
+  loopback(600, false, false, UNICAST);  // 4 universes, last one partly filled
+  loopback(600, false, true,  UNICAST);
+  loopback(510, false, true,  MULTICAST); // 3 full universes
+  loopback(300, true,  true,  UNICAST);
+  loopback(256, true,  true,  MULTICAST); // 2 full RGBW universes
+  e131FrameSync = false;
+  return harness::finish("test_e131_loopback");
+}
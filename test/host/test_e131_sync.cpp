@@ -0,0 +1,176 @@
+/*
+ * E1.31 receive side frame synchronization (e131FrameSync): universes are staged and shown together.
+ * Frames complete without sync packets, also when the source sends fewer universes than the strip needs,
+ * frames announcing a synchronization address are held for the sync packet from the first frame on,
+ * and late universes of a frame that has already been shown are ignored.
+ */
+#include "harness.h"
+
+static const uint16_t LEDS = 600; // 4 RGB universes
+static const uint32_t E131_SYNC_TIMEOUT_MS = 2600; // longer than E131_SYNC_TIMEOUT (e131.cpp)
+
+// E1.31 packets of one frame of `leds` pixels as sent by a WLED network bus, with or without sync packet
+static std::vector<host::UdpPacket> makeFrame(const std::vector<uint8_t> &buffer, uint16_t leds, bool withSync)
+{
+  std::vector<uint8_t> packet(realtimePacketSize(1));
+  realtimePacketInit(1, packet.data());
+  bool frameSync = e131FrameSync;
+  e131FrameSync = withSync; // sender side setting
+  host::udpCapture(true);
+  realtimeBroadcast(1, IPAddress(192, 168, 1, 50), leds, const_cast<uint8_t*>(buffer.data()), packet.data());
+  std::vector<host::UdpPacket> sent = host::sentPackets;
+  host::udpCapture(false);
+  e131FrameSync = frameSync;
+  return sent;
+}
+
+static void receive(const host::UdpPacket &p) { CHECK(host::asyncUdpReceive(E131_DEFAULT_PORT, p.data.data(), p.data.size())); }
+
+static std::vector<uint8_t> randomFrame()
+{
+  std::vector<uint8_t> buffer(LEDS * 3);
+  for (uint8_t &b : buffer) b = random(256);
+  return buffer;
+}
+
+// number of the first `leds` pixels not showing buffer
+static unsigned wrongPixels(const std::vector<uint8_t> &buffer, uint16_t leds)
+{
+  unsigned wrong = 0;
+  for (uint16_t i = 0; i < leds; i++) wrong += strip.getPixelColor(i) != RGBW32(buffer[i*3], buffer[i*3+1], buffer[i*3+2], 0);
+  return wrong;
+}
+
+static void setup()
+{
+  harness::setupStrip(LEDS);
+  realtimeTimeoutMs = 60000;
+  host::advance(E131_SYNC_TIMEOUT_MS); // no sync source from previous cases
+  std::vector<uint8_t> off(LEDS * 3);
+  e131FrameSync = false;
+  for (const host::UdpPacket &p : makeFrame(off, LEDS, false)) receive(p); // releases staging buffers
+  e131FrameSync = true;
+}
+
+int main()
+{
+  e131Universe = 1;
+  DMXAddress = 1;
+  DMXMode = DMX_MODE_MULTIPLE_RGB;
+  interfacesInited = true;
+  e131.begin(false, E131_DEFAULT_PORT, e131Universe, E131_MAX_UNIVERSE_COUNT);
+
+  // all universes of the strip, no sync packets: shown when the last universe arrived
+  setup();
+  for (int f = 0; f < 3; f++) {
+    std::vector<uint8_t> frame = randomFrame();
+    std::vector<host::UdpPacket> packets = makeFrame(frame, LEDS, false);
+    CHECK_EQ(packets.size(), 4);
+    uint32_t committed = e131FramesCommitted;
+    for (size_t u = 0; u < packets.size(); u++) {
+      CHECK_EQ(e131FramesCommitted, committed);
+      receive(packets[u]);
+    }
+    CHECK_EQ(e131FramesCommitted, committed + 1);
+    CHECK_EQ(wrongPixels(frame, LEDS), 0);
+  }
+
+  // source sends 2 universes for a 4 universe strip: the first frame is shown when the next one starts,
+  // then every frame as soon as its 2 universes arrived
+  setup();
+  uint32_t dropped = e131FramesDropped;
+  std::vector<uint8_t> previous;
+  for (int f = 0; f < 4; f++) {
+    std::vector<uint8_t> frame = randomFrame();
+    std::vector<host::UdpPacket> packets = makeFrame(frame, 340, false);
+    CHECK_EQ(packets.size(), 2);
+    uint32_t committed = e131FramesCommitted;
+    receive(packets[0]);
+    if (f == 0) CHECK_EQ(e131FramesCommitted, committed);
+    if (f == 1) { CHECK_EQ(e131FramesCommitted, committed + 1); CHECK_EQ(wrongPixels(previous, 340), 0); committed++; }
+    receive(packets[1]);
+    if (f == 0) CHECK_EQ(e131FramesCommitted, committed); // 2 more universes expected
+    else {
+      CHECK_EQ(e131FramesCommitted, committed + 1);
+      CHECK_EQ(wrongPixels(frame, 340), 0);
+    }
+    previous = frame;
+  }
+  CHECK_EQ(e131FramesDropped, dropped + 1);
+
+  // a lost universe: the incomplete frame is shown when the next one starts, which is still expected complete
+  setup();
+  {
+    std::vector<uint8_t> frame = randomFrame();
+    for (const host::UdpPacket &p : makeFrame(frame, LEDS, false)) receive(p);
+    std::vector<uint8_t> lost = randomFrame();
+    std::vector<host::UdpPacket> packets = makeFrame(lost, LEDS, false);
+    uint32_t committed = e131FramesCommitted;
+    dropped = e131FramesDropped;
+    receive(packets[0]); receive(packets[1]); receive(packets[2]); // universe 4 lost
+    CHECK_EQ(e131FramesCommitted, committed);
+    frame = randomFrame();
+    packets = makeFrame(frame, LEDS, false);
+    receive(packets[0]);
+    CHECK_EQ(e131FramesCommitted, committed + 1);
+    CHECK_EQ(e131FramesDropped, dropped + 1);
+    CHECK_EQ(wrongPixels(lost, 510), 0);
+    receive(packets[1]); receive(packets[2]);
+    CHECK_EQ(e131FramesCommitted, committed + 1);
+    receive(packets[3]);
+    CHECK_EQ(e131FramesCommitted, committed + 2);
+    CHECK_EQ(wrongPixels(frame, LEDS), 0);
+  }
+
+  // source announces a synchronization address: universes are held until the sync packet, from the first frame on
+  setup();
+  for (int f = 0; f < 3; f++) {
+    std::vector<uint8_t> frame = randomFrame();
+    std::vector<host::UdpPacket> packets = makeFrame(frame, LEDS, true);
+    CHECK_EQ(packets.size(), 5);
+    uint32_t committed = e131FramesCommitted;
+    for (size_t i = 0; i < 4; i++) receive(packets[i]);
+    CHECK_EQ(e131FramesCommitted, committed);
+    receive(packets[4]);
+    CHECK_EQ(e131FramesCommitted, committed + 1);
+    CHECK_EQ(wrongPixels(frame, LEDS), 0);
+    host::advance(25);
+  }
+
+  // sync packets stop: after E131_SYNC_TIMEOUT the held frame is shown when the next one starts,
+  // then complete frames are shown again
+  {
+    std::vector<uint8_t> held = randomFrame();
+    std::vector<host::UdpPacket> packets = makeFrame(held, LEDS, true);
+    uint32_t committed = e131FramesCommitted;
+    for (size_t i = 0; i < 4; i++) receive(packets[i]);
+    CHECK_EQ(e131FramesCommitted, committed); // waiting for sync
+    host::advance(E131_SYNC_TIMEOUT_MS);
+    std::vector<uint8_t> frame = randomFrame();
+    packets = makeFrame(frame, LEDS, true);
+    receive(packets[0]);
+    CHECK_EQ(e131FramesCommitted, committed + 1);
+    CHECK_EQ(wrongPixels(held, LEDS), 0);
+    for (size_t i = 1; i < 4; i++) receive(packets[i]);
+    CHECK_EQ(e131FramesCommitted, committed + 2);
+    CHECK_EQ(wrongPixels(frame, LEDS), 0);
+  }
+
+  // a universe arriving after its frame was shown is ignored
+  setup();
+  {
+    std::vector<uint8_t> first = randomFrame();
+    std::vector<host::UdpPacket> late = makeFrame(first, LEDS, false);
+    for (const host::UdpPacket &p : late) receive(p);
+    std::vector<uint8_t> second = randomFrame();
+    for (const host::UdpPacket &p : makeFrame(second, LEDS, false)) receive(p);
+    uint32_t lateUniverses = e131LateUniverses, committed = e131FramesCommitted;
+    receive(late[1]);
+    CHECK_EQ(e131LateUniverses, lateUniverses + 1);
+    CHECK_EQ(e131FramesCommitted, committed);
+    CHECK_EQ(wrongPixels(second, LEDS), 0);
+  }
+
+  e131FrameSync = false;
+  return harness::finish("test_e131_sync");
+}
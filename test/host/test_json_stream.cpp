@@ -0,0 +1,62 @@
+/*
+ * Read-only /json requests are written into the response without the JSON buffer: the response must be the
+ * state when the request was handled, also if segments change while it is being sent, and report errorFlag once.
+ */
+#include "harness.h"
+
+static std::string expectedState()
+{
+  DynamicJsonDocument d(32768);
+  serializeState(d.to<JsonObject>());
+  std::string json;
+  serializeJson(d, json);
+  return json;
+}
+
+static void apply(const char *json)
+{
+  DynamicJsonDocument d(2048);
+  deserializeJson(d, json);
+  strip.lock();
+  deserializeState(d.as<JsonObject>());
+  strip.unlock();
+}
+
+int main()
+{
+  harness::setupStrip(300);
+  apply("{\"seg\":[{\"id\":0,\"start\":0,\"stop\":100},{\"id\":1,\"start\":100,\"stop\":200},{\"id\":2,\"start\":200,\"stop\":300}]}");
+
+  for (const char *url : {"/json/state", "/json/si", "/json"}) {
+    std::string expected = expectedState();
+    errorFlag = ERR_FS_PLOAD;
+    AsyncWebServerRequest request(url);
+    serveJson(&request);
+    CHECK_EQ(errorFlag, ERR_NONE);
+    // segments are added, changed and removed while the response is sent in small chunks
+    int chunk = 0;
+    std::string body = request.body(64, [&chunk]() {
+      char buf[96];
+      switch (chunk++ % 3) {
+        case 0: snprintf(buf, sizeof(buf), "{\"seg\":{\"id\":3,\"start\":%d,\"stop\":%d}}", chunk % 100, 100 + chunk % 100); break;
+        case 1: snprintf(buf, sizeof(buf), "{\"seg\":{\"id\":0,\"fx\":%d,\"n\":\"chunk %d\"}}", chunk % 100, chunk); break;
+        default: strcpy(buf, "{\"seg\":{\"id\":3,\"stop\":0}}"); break;
+      }
+      apply(buf);
+    });
+    CHECK(chunk > 10);
+
+    DynamicJsonDocument d(65536);
+    CHECK(!deserializeJson(d, body));
+    JsonObject state = strcmp(url, "/json/state") ? d["state"] : d.as<JsonObject>();
+    CHECK_EQ(state["error"].as<int>(), ERR_FS_PLOAD);
+    state.remove("error");
+    std::string json;
+    serializeJson(state, json);
+    if (json != expected) harness::fail(__FILE__, __LINE__, std::string(url) + ": state differs from state at request time");
+    if (strcmp(url, "/json/state")) CHECK(d["info"]["leds"]["count"] == 300);
+    if (!strcmp(url, "/json")) CHECK(d["effects"].size() == strip.getModeCount());
+    apply("{\"seg\":{\"id\":3,\"stop\":0}}");
+  }
+  return harness::finish("test_json_stream");
+}
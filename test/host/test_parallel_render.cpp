@@ -0,0 +1,77 @@
+/*
+ * Parallel rendering must give the same frames as rendering segments one after the other.
+ * Built twice: test_parallel_render_serial (default build) renders every effect on four segments and writes the
+ * frame hashes to a file, test_parallel_render (WLED_ENABLE_PARALLEL_RENDER) renders the same and compares.
+ * Effects using Arduino random() (hardware RNG on ESP32) are never repeatable. The serial build finds them by
+ * rendering every effect twice with different random() seeds and marks them, they are not compared.
+ */
+#include "harness.h"
+#include <fstream>
+#include <sstream>
+
+static const char    *FRAMES_FILE = "parallel_render_frames.txt";
+static const uint16_t LEDS = 64; // per segment
+static const uint8_t  SEGMENTS = 4;
+static const unsigned FRAMES = 10;
+
+static std::vector<uint32_t> render(uint8_t mode, unsigned long seed)
+{
+  harness::setupStrip(LEDS, SEGMENTS);
+  autoSegments = true;
+  strip.makeAutoSegments(true); // one segment per bus
+  for (render_context_t &ctx : strip._ctx) { ctx.randSeed = 1337; ctx.virtualLength = 0; } // segments are seeded from it on reset
+  randomSeed(seed);
+  harness::setMode(mode, -1);
+  std::vector<uint32_t> hashes;
+  for (unsigned f = 0; f < FRAMES; f++) {
+    harness::frame();
+    hashes.push_back(harness::pixelHash());
+  }
+  return hashes;
+}
+
+int main()
+{
+#ifndef WLED_ENABLE_PARALLEL_RENDER
+  std::ofstream out(FRAMES_FILE);
+  for (uint8_t m = 0; m < strip.getModeCount(); m++) {
+    if (!strncmp_P("RSVD", strip.getModeData(m), 4)) continue;
+    std::vector<uint32_t> hashes = render(m, 1);
+    bool repeatable = render(m, 2) == hashes;
+    out << (int)m << (repeatable ? "" : " random");
+    for (uint32_t h : hashes) out << ' ' << h;
+    out << '\n';
+  }
+  out.close(); // finish() does not return
+  CHECK(!out.fail());
+  CHECK_EQ(strip.getSegmentsNum(), SEGMENTS);
+  return harness::finish("test_parallel_render_serial");
+#else
+  std::ifstream in(FRAMES_FILE);
+  CHECK(in.good());
+  unsigned compared = 0, skipped = 0, helped = 0;
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream ls(line);
+    int m;
+    ls >> m;
+    if (line.find("random") != std::string::npos) { skipped++; continue; }
+    std::vector<uint32_t> expected;
+    for (uint32_t h; ls >> h; ) expected.push_back(h);
+    std::vector<uint32_t> hashes = render(m, 1);
+    compared++;
+    for (unsigned f = 0; f < FRAMES && f < expected.size(); f++) {
+      if (hashes[f] == expected[f]) continue;
+      harness::fail(__FILE__, __LINE__, "effect " + std::to_string(m) + " differs from serial rendering in frame " + std::to_string(f));
+      break;
+    }
+    // the helper task renders on core 0, service() runs on core 1 (host main task)
+    // (the main task takes all segments if the helper thread does not get to run in time)
+    if (strip._ctx[0].virtualLength) helped++;
+  }
+  CHECK(compared > 100);
+  CHECK(helped > 0);
+  printf("%u effects compared (%u rendered in parallel), %u using random() skipped\n", compared, helped, skipped);
+  return harness::finish("test_parallel_render");
+#endif
+}
@@ -0,0 +1,90 @@
+/*
+ * presets.json object index: presets written with writeObjectToFileUsingId() are read back with a single seek,
+ * also after they were replaced, deleted or moved. A file replaced by an upload of the same size must not be
+ * read with the index of the previous file (IDs it did not contain would not be found).
+ */
+#include "harness.h"
+
+void handleUpload(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final);
+
+static const char *PRESETS = "/presets.json";
+
+static std::string name(int id) { return "preset " + std::to_string(id); }
+
+static bool writePreset(int id, const std::string &n, int bri)
+{
+  DynamicJsonDocument d(256);
+  if (!n.empty()) { d["n"] = n; d["bri"] = bri; }
+  return writeObjectToFileUsingId(PRESETS, id, &d);
+}
+
+// preset id is in the file with name n (empty: not in file)
+static bool readPreset(int id, const std::string &n)
+{
+  DynamicJsonDocument d(256);
+  bool found = readObjectFromFileUsingId(PRESETS, id, &d);
+  if (n.empty()) return !found;
+  return found && n == d["n"].as<const char*>();
+}
+
+static std::string fileContent()
+{
+  closeFile();
+  File file = WLED_FS.open(PRESETS, "r");
+  std::string s;
+  while (file.available()) s += (char)file.read();
+  file.close();
+  return s;
+}
+
+int main()
+{
+  std::map<int, std::string> expected;
+  for (int id = 1; id <= 40; id++) { CHECK(writePreset(id, name(id), id)); expected[id] = name(id); }
+  for (int id = 1; id <= 41; id++) CHECK(readPreset(id, expected[id]));
+
+  // replaced in place, grown (moved to the end), deleted, re-added
+  for (int round = 0; round < 200; round++) {
+    int id = random(1, 60);
+    switch (random(3)) {
+      case 0: expected[id] = name(id) + std::string(random(0, 40), 'x'); break;
+      case 1: expected[id] = name(id); break;
+      default: expected[id].clear(); break;
+    }
+    CHECK(writePreset(id, expected[id], round & 0xFF));
+    int check = random(1, 60);
+    if (!readPreset(check, expected[check])) harness::fail(__FILE__, __LINE__, "preset " + std::to_string(check) + " after round " + std::to_string(round));
+  }
+  for (int id = 1; id < 60; id++) CHECK(readPreset(id, expected[id]));
+
+  // upload of a file of the same size with other IDs: presets in reverse order, 40 renamed to 41
+  expected.clear();
+  std::string upload = "{\"0\":{}";
+  for (int id = 40; id >= 1; id--) {
+    int n = id == 40 ? 41 : id;
+    upload += ",\"" + std::to_string(n) + "\":{\"n\":\"" + name(n) + "\",\"bri\":" + std::to_string(id) + "}";
+    expected[n] = name(n);
+  }
+  upload += "}";
+  for (int id = 1; id <= 40; id++) CHECK(writePreset(id, name(id), id)); // file holding 1-40
+  std::string old = fileContent();
+  if (upload.size() > old.size()) harness::fail(__FILE__, __LINE__, "upload larger than file");
+  upload.insert(upload.size() - 1, old.size() - upload.size(), ' ');
+  CHECK(readPreset(1, name(1))); // index is valid for the old file
+  AsyncWebServerRequest request("/upload", HTTP_POST);
+  handleUpload(&request, PRESETS, 0, (uint8_t*)upload.data(), upload.size(), true);
+  CHECK(fileContent() == upload);
+  for (int id = 1; id <= 42; id++) {
+    if (!readPreset(id, expected[id])) harness::fail(__FILE__, __LINE__, "preset " + std::to_string(id) + " after upload");
+  }
+
+  // presets file deleted and created again
+  closeFile();
+  WLED_FS.remove(PRESETS);
+  initPresetsFile();
+  for (int id = 1; id <= 41; id++) CHECK(readPreset(id, ""));
+  CHECK(writePreset(41, name(41), 1));
+  CHECK(readPreset(41, name(41)));
+  closeFile();
+  return harness::finish("test_preset_index");
+}
@@ -0,0 +1,61 @@
+/*
+ * Effect crossfades write only the pixels of the transitioning segment: gaps left by grouping and spacing show the
+ * segment underneath as rendered in the same frame, in 1D and 2D. Crossfading blends previous and new effect
+ * from the first transition frame on.
+ */
+#include "harness.h"
+
+// pixel x of a segment with grouping 1 and spacing 2 is set by it
+static bool owned(int x, int start) { return (x - start) % 3 == 0; }
+
+// background (Colorloop, same color on every pixel) is shown in all gaps
+static void checkGaps(const std::string &what, uint16_t w, uint16_t h, uint16_t start, uint16_t stop)
+{
+  uint32_t background = strip.getPixelColor(0);
+  unsigned wrong = 0;
+  for (int y = 0; y < h; y++) for (int x = 0; x < w; x++) {
+    bool inBox = x >= start && x < stop && (h == 1 || (y >= start && y < stop));
+    if (inBox && owned(x, start) && (h == 1 || owned(y, start))) continue;
+    wrong += strip.getPixelColor(y * w + x) != background;
+  }
+  if (wrong) harness::fail(__FILE__, __LINE__, what + ": " + std::to_string(wrong) + " pixels do not show the background");
+}
+
+static void run(const std::string &what, uint16_t w, uint16_t h)
+{
+  const uint16_t start = 4, stop = h == 1 ? 80 : 13;
+  if (h == 1) harness::setupStrip(w);
+  else        harness::setupMatrix(w, h);
+  strip.setTransition(0);
+  strip.setSegment(0, 0, w, 1, 0, 0, 0, h);
+  strip.appendSegment();
+  strip.setSegment(1, start, stop, 1, 2, 0, h == 1 ? 0 : start, h == 1 ? 1 : stop);
+  Segment &bg = strip.getSegment(0), &seg = strip.getSegment(1);
+  bg.setMode(FX_MODE_RAINBOW);
+  bg.speed = 255;
+  seg.setMode(FX_MODE_STATIC);
+  seg.setColor(0, BLUE);
+  harness::frames(5);
+  checkGaps(what + " before transition", w, h, start, stop);
+  CHECK_EQ(strip.getPixelColor(h == 1 ? start : start * w + start), BLUE);
+
+  strip.setTransition(1000);
+  seg.setMode(FX_MODE_RAINBOW_CYCLE);
+  bool blended = false;
+  for (int f = 0; f < 30; f++) {
+    harness::frame(50);
+    checkGaps(what + " frame " + std::to_string(f), w, h, start, stop);
+    // old effect is only shown unchanged by a switch half way
+    if (f < 5 && strip.getPixelColor(h == 1 ? start : start * w + start) != BLUE) blended = true;
+  }
+  CHECK(blended);
+  CHECK(!seg.transitional);
+  checkGaps(what + " after transition", w, h, start, stop);
+}
+
+int main()
+{
+  run("1D", 100, 1);
+  run("2D", 16, 16);
+  return harness::finish("test_transition_crossfade");
+}
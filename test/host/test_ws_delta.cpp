@@ -0,0 +1,230 @@
+/*
+ * WebSocket state deltas: clients that sent {"delta":true} receive only changed segments and removed segment
+ * IDs ("rm"). Applying every broadcast the way index.js does (mergeState(), full snapshot requested with
+ * {"v":true} if a sequence number "sv" was skipped) must always reproduce serializeState().
+ * Also covers the state sent to a single client (sv not incremented, next broadcast is full), failed buffer
+ * allocation (next broadcast is full and continues the sequence) and clients without delta support.
+ */
+#include "harness.h"
+#include <map>
+
+// state as held by index.js (wsState): top level values and segments by ID, each as serialized JSON
+struct ClientState {
+  std::map<std::string, std::string> values;
+  std::map<int, std::string> segs;
+  bool operator==(const ClientState &o) const { return values == o.values && segs == o.segs; }
+};
+
+static ClientState decode(JsonObjectConst state)
+{
+  ClientState s;
+  for (JsonPairConst kv : state) {
+    std::string json;
+    if (strcmp(kv.key().c_str(), "seg")) { serializeJson(kv.value(), json); s.values[kv.key().c_str()] = json; continue; }
+    for (JsonObjectConst seg : kv.value().as<JsonArrayConst>()) { json.clear(); serializeJson(seg, json); s.segs[seg["id"]] = json; }
+  }
+  return s;
+}
+
+// index.js mergeState(): values replaced, removed segments dropped, received segments replaced or added
+static void mergeState(ClientState &base, const ClientState &delta, JsonArrayConst rm)
+{
+  for (auto &kv : delta.values) base.values[kv.first] = kv.second;
+  for (JsonVariantConst id : rm) base.segs.erase(id.as<int>());
+  for (auto &kv : delta.segs) base.segs[kv.first] = kv.second;
+}
+
+struct Client {
+  AsyncWebSocketClient *ws;
+  bool delta;
+  ClientState state;
+  bool valid = false;
+  long sv = -1;
+  size_t handled = 0;
+  unsigned resyncs = 0; // full state requested after a missed broadcast
+  // last message
+  bool lastDelta = false;
+  long lastSv = -1;
+  size_t lastSegs = 0;
+  bool lastRm = false;
+};
+
+static std::vector<Client> clients;
+
+// handles received messages like makeWS() in index.js
+static void receive(Client &c)
+{
+  while (c.handled < c.ws->texts.size()) {
+    DynamicJsonDocument json(32768);
+    CHECK(!deserializeJson(json, c.ws->texts[c.handled++]));
+    if (!json.containsKey("sv")) continue; // {"success":true}
+    JsonObjectConst s = json["state"];
+    c.lastDelta = json["delta"];
+    c.lastSv = json["sv"];
+    c.lastSegs = s["seg"].size();
+    c.lastRm = json.containsKey("rm");
+    if (c.lastDelta) {
+      if (!c.valid || c.lastSv != c.sv + 1) {
+        c.valid = false;
+        c.resyncs++;
+        ws.hostReceive(c.ws, "{\"v\":true}");
+        continue;
+      }
+      mergeState(c.state, decode(s), json["rm"]);
+    } else {
+      c.state = decode(s);
+    }
+    c.valid = true;
+    c.sv = c.lastSv;
+  }
+}
+
+static Client &connect(bool delta)
+{
+  clients.push_back({ws.hostConnect(), delta});
+  Client &c = clients.back();
+  if (delta) ws.hostReceive(c.ws, "{\"delta\":true}");
+  receive(c);
+  return c;
+}
+
+static void apply(const char *json)
+{
+  DynamicJsonDocument d(2048);
+  deserializeJson(d, json);
+  strip.lock();
+  deserializeState(d.as<JsonObject>());
+  strip.unlock();
+}
+
+static void broadcast()
+{
+  host::advance(200); // WS_MIN_BROADCAST_INTERVAL
+  sendDataWs();
+  for (Client &c : clients) receive(c);
+}
+
+// every client holds the current state
+static void checkClients(const std::string &step)
+{
+  DynamicJsonDocument expected(32768);
+  serializeState(expected.to<JsonObject>());
+  ClientState s = decode(expected.as<JsonObjectConst>());
+  for (Client &c : clients) {
+    if (c.valid && c.state == s) continue;
+    harness::fail(__FILE__, __LINE__, "client " + std::to_string(c.ws->id()) + " state differs after " + step);
+  }
+}
+
+// a random change as made by the UI
+static std::string randomChange()
+{
+  char buf[160];
+  uint8_t n = strip.getSegmentsNum();
+  int id = random(n);
+  switch (random(8)) {
+    case 0: snprintf(buf, sizeof(buf), "{\"bri\":%ld}", random(1, 256)); break;
+    case 1: snprintf(buf, sizeof(buf), "{\"seg\":{\"id\":%d,\"col\":[[%ld,%ld,%ld]]}}", id, random(256), random(256), random(256)); break;
+    case 2: snprintf(buf, sizeof(buf), "{\"seg\":{\"id\":%d,\"fx\":%ld,\"sx\":%ld}}", id, random(1, 100), random(256)); break;
+    case 3: if (n < 6) { snprintf(buf, sizeof(buf), "{\"seg\":{\"id\":%d,\"start\":%d,\"stop\":%d}}", n, n * 40, n * 40 + 30); break; } // add
+            // fall through
+    case 4: if (n > 1) { snprintf(buf, sizeof(buf), "{\"seg\":{\"id\":%d,\"stop\":0}}", n - 1); break; }                           // remove
+            // fall through
+    case 5: snprintf(buf, sizeof(buf), "{\"on\":%s}", random(2) ? "true" : "false"); break;
+    case 6: snprintf(buf, sizeof(buf), "{\"seg\":{\"id\":%d,\"n\":\"seg%ld\"}}", id, random(100)); break;
+    default: buf[0] = 0; break; // nothing changed
+  }
+  return buf;
+}
+
+int main()
+{
+  harness::setupStrip(300);
+  ws.onEvent(wsEvent);
+  apply("{\"seg\":[{\"id\":0,\"start\":0,\"stop\":100},{\"id\":1,\"start\":100,\"stop\":200},{\"id\":2,\"start\":200,\"stop\":300}]}");
+
+  connect(true);
+  connect(true);
+  broadcast();
+  checkClients("connect");
+
+  // random changes, all clients apply deltas
+  unsigned deltas = 0, partial = 0, removed = 0;
+  for (int step = 0; step < 300; step++) {
+    std::string change = randomChange();
+    if (!change.empty()) apply(change.c_str());
+    broadcast();
+    checkClients(change.empty() ? "no change" : change);
+    deltas  += clients[0].lastDelta;
+    partial += clients[0].lastDelta && clients[0].lastSegs < strip.getSegmentsNum();
+    removed += clients[0].lastRm;
+  }
+  CHECK(deltas > 250);
+  CHECK(partial > 100); // unchanged segments left out
+  CHECK(removed > 0);
+  for (Client &c : clients) CHECK_EQ(c.resyncs, 0);
+
+  // state sent to a single client carries the sequence number of the last broadcast, the next broadcast is full
+  {
+    Client &c = clients[0];
+    long sv = c.sv;
+    ws.hostReceive(c.ws, "{\"v\":true}");
+    receive(c);
+    CHECK(!c.lastDelta);
+    CHECK_EQ(c.lastSv, sv);
+    apply("{\"seg\":{\"id\":0,\"fx\":9}}");
+    broadcast();
+    CHECK(!clients[0].lastDelta);
+    CHECK(!clients[1].lastDelta);
+    CHECK_EQ(clients[1].lastSv, sv + 1);
+    checkClients("single client update");
+    apply("{\"seg\":{\"id\":0,\"fx\":10}}");
+    broadcast();
+    CHECK(clients[0].lastDelta);
+    CHECK_EQ(clients[0].lastSegs, 1);
+    checkClients("delta after full");
+  }
+
+  // failed buffer allocation: nothing sent, next broadcast is full and continues the sequence
+  {
+    long sv = clients[0].sv;
+    size_t sent = clients[0].ws->texts.size();
+    ws.hostFailAlloc = true;
+    apply("{\"seg\":{\"id\":0,\"stop\":0}}");
+    broadcast();
+    CHECK_EQ(clients[0].ws->texts.size(), sent);
+    ws.hostFailAlloc = false;
+    apply("{\"seg\":{\"id\":1,\"fx\":20}}");
+    broadcast();
+    CHECK(!clients[0].lastDelta);
+    CHECK_EQ(clients[0].lastSv, sv + 1);
+    checkClients("allocation failure");
+    for (Client &c : clients) CHECK_EQ(c.resyncs, 0);
+    apply("{\"seg\":{\"id\":1,\"fx\":21}}");
+    broadcast();
+    CHECK(clients[0].lastDelta);
+    checkClients("delta after allocation failure");
+  }
+
+  // a client without delta support gets full state, so do all others while it is connected
+  {
+    Client &plain = connect(false);
+    for (int step = 0; step < 20; step++) {
+      std::string change = randomChange();
+      if (!change.empty()) apply(change.c_str());
+      broadcast();
+      for (Client &c : clients) CHECK(!c.lastDelta);
+      checkClients(change);
+    }
+    ws.hostDisconnect(plain.ws);
+    clients.pop_back();
+    for (int step = 0; step < 20; step++) {
+      std::string change = randomChange();
+      if (!change.empty()) apply(change.c_str());
+      broadcast();
+      CHECK(clients[0].lastDelta);
+      checkClients(change);
+    }
+  }
+  return harness::finish("test_ws_delta");
+}
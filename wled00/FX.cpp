@@ -3716,8 +3716,6 @@ CRGB pacifica_one_layer(uint16_t i, CRGBPalette16& p, uint16_t cistart, uint16_t
 
 uint16_t mode_pacifica()
 {
-  uint32_t nowOld = strip.now;
-
   CRGBPalette16 pacifica_palette_1 =
     { 0x000507, 0x000409, 0x00030B, 0x00030D, 0x000210, 0x000212, 0x000114, 0x000117,
       0x000019, 0x00001C, 0x000026, 0x000031, 0x00003B, 0x000046, 0x14554B, 0x28AA50 };
@@ -3739,7 +3737,8 @@ uint16_t mode_pacifica()
   uint16_t sCIStart1 = SEGENV.aux0, sCIStart2 = SEGENV.aux1, sCIStart3 = SEGENV.step, sCIStart4 = SEGENV.step >> 16;
   uint32_t deltams = (FRAMETIME >> 2) + ((FRAMETIME * SEGMENT.speed) >> 7);
   uint64_t deltat = (strip.now >> 2) + ((strip.now * SEGMENT.speed) >> 7);
-  strip.now = deltat;
+  // beat functions run on scaled time (strip.now is shared with segments rendered on the other core)
+  strip.renderContext().timeOffset = (uint32_t)deltat - strip.now;
 
   uint16_t speedfactor1 = beatsin16(3, 179, 269);
   uint16_t speedfactor2 = beatsin16(4, 179, 269);
@@ -3785,7 +3784,7 @@ uint16_t mode_pacifica()
     SEGMENT.setPixelColor(i, c.red, c.green, c.blue);
   }
 
-  strip.now = nowOld;
+  strip.renderContext().timeOffset = 0;
   return FRAMETIME;
 }
 static const char _data_FX_MODE_PACIFICA[] PROGMEM = "Pacifica@!,Angle;;!;;pal=51";
@@ -4843,114 +4842,176 @@ static const char _data_FX_MODE_2DFRIZZLES[] PROGMEM = "Frizzles@X frequency,Y f
 ///////////////////////////////////////////
 //   2D Cellular Automata Game of life   //
 ///////////////////////////////////////////
-typedef struct ColorCount {
-  CRGB color;
-  int8_t count;
-} colorCount;
+// rule sets in B/S notation (neighbour counts for birth / survival), selected by Rule slider
+static const char _data_GOL_RULES[] PROGMEM = "B3/S23,B36/S23,B3678/S34678,B2/S,B3/S012345678,B36/S125,B3/S12345,B35678/S5678,B368/S245,B34/S34";
+
+typedef struct LifeState {
+  uint16_t cols, rows;     // grid size state was initialised for
+  uint16_t birth, survive; // bit n set: birth/survival with n neighbours
+  uint8_t  rule;           // rule set birth/survive were parsed from
+  uint8_t  cur;            // current generation plane (0/1)
+  bool     cycle;          // generations repeat (reset after 3s)
+  uint32_t checkHash;      // Brent's cycle detection: hash of checkpoint generation
+  uint16_t power, lambda;  // generations between checkpoints, generations since last checkpoint
+} lifeState;
+
+// parses birth/survival masks of rule set st->rule (wraps around) from _data_GOL_RULES
+static void golParseRule(lifeState *st) {
+  uint8_t count = 1;
+  for (const char *p = _data_GOL_RULES; pgm_read_byte(p); p++) count += (pgm_read_byte(p) == ',');
+  uint8_t n = 0, idx = st->rule % count;
+  uint16_t *mask = nullptr;
+  st->birth = st->survive = 0;
+  for (const char *p = _data_GOL_RULES; char c = pgm_read_byte(p); p++) {
+    if (c == ',') { if (++n > idx) break; continue; }
+    if (n != idx) continue;
+    if      (c == 'B' || c == 'b') mask = &st->birth;
+    else if (c == 'S' || c == 's') mask = &st->survive;
+    else if (c >= '0' && c <= '8' && mask) *mask |= 1 << (c - '0');
+  }
+}
+
+// cells x-1 (w) and x+1 (e) of a 32 cell word k of a row, wrapping around
+static inline uint32_t golWest(const uint32_t *row, int k, int words, int cols) {
+  return (row[k] << 1) | (k ? row[k-1] >> 31 : (row[words-1] >> ((cols-1) & 31)) & 1);
+}
+static inline uint32_t golEast(const uint32_t *row, int k, int words, int cols) {
+  if (k < words-1) return (row[k] >> 1) | (row[k+1] << 31);
+  return (row[k] >> 1) | ((row[0] & 1) << ((cols-1) & 31));
+}
 
 uint16_t mode_2Dgameoflife(void) { // Written by Ewoud Wijma, inspired by https://natureofcode.com/book/chapter-7-cellular-automata/ and https://github.com/DougHaber/nlife-color
   if (!strip.isMatrix) return mode_static(); // not a 2D set-up
 
   const uint16_t cols = SEGMENT.virtualWidth();
   const uint16_t rows = SEGMENT.virtualHeight();
-  const uint16_t dataSize = sizeof(CRGB) * SEGMENT.length();  // using width*height prevents reallocation if mirroring is enabled
-  const uint16_t crcBufferLen = 2; //(SEGMENT.width() + SEGMENT.height())*71/100; // roughly sqrt(2)/2 for better repetition detection (Ewowi)
-
-  if (!SEGENV.allocateData(dataSize + sizeof(uint16_t)*crcBufferLen)) return mode_static(); //allocation failed
-  CRGB *prevLeds = reinterpret_cast<CRGB*>(SEGENV.data);
-  uint16_t *crcBuffer = reinterpret_cast<uint16_t*>(SEGENV.data + dataSize); 
+  // alive cells are packed into 32 bit words (2 planes: current and next generation), colors are palette indices
+  const uint16_t words = (cols + 31) / 32;
+  const uint16_t planeSize = sizeof(uint32_t) * words * rows;
+  const uint32_t lastMask = (cols & 31) ? (1UL << (cols & 31)) - 1 : 0xFFFFFFFFUL;
 
-  CRGB backgroundColor = SEGCOLOR(1);
+  if (!SEGENV.allocateData(sizeof(lifeState) + 2*planeSize + cols*rows)) return mode_static(); //allocation failed
+  lifeState *st = reinterpret_cast<lifeState*>(SEGENV.data);
+  uint32_t *planes = reinterpret_cast<uint32_t*>(SEGENV.data + sizeof(lifeState));
+  uint8_t *colors = SEGENV.data + sizeof(lifeState) + 2*planeSize;
 
-  if (SEGENV.call == 0) SEGMENT.setUpLeds();
+  uint32_t bgc = RGBW32(SEGCOLOR(1) >> 16 & 0xFF, SEGCOLOR(1) >> 8 & 0xFF, SEGCOLOR(1) & 0xFF, 0);
+  uint8_t rule = SEGMENT.custom3;
 
-  if (SEGENV.call == 0 || strip.now - SEGMENT.step > 3000) {
+  if (SEGENV.call == 0 || st->cols != cols || st->rows != rows || strip.now - SEGMENT.step > 3000) {
     SEGENV.step = strip.now;
-    SEGENV.aux0 = 0;
     random16_set_seed(millis()>>2); //seed the random generator
 
-    //give the leds random state and colors (based on intensity, colors from palette or all posible colors are chosen)
-    for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
-      uint8_t state = random8()%2;
-      if (state == 0)
-        SEGMENT.setPixelColorXY(x,y, backgroundColor);
-      else
-        SEGMENT.setPixelColorXY(x,y, SEGMENT.color_from_palette(random8(), false, PALETTE_SOLID_WRAP, 255));
-    }
-
-    for (int y = 0; y < rows; y++) for (int x = 0; x < cols; x++) prevLeds[XY(x,y)] = CRGB::Black;
-    memset(crcBuffer, 0, sizeof(uint16_t)*crcBufferLen);
+    //give the cells random state and colors (from palette)
+    st->cols = cols;
+    st->rows = rows;
+    st->cur = 0;
+    for (int i = 0; i < words * rows; i++) {
+      planes[i] = ((uint32_t)random16() << 16) | random16();
+      if ((i % words) == words-1) planes[i] &= lastMask;
+    }
+    for (int i = 0; i < cols * rows; i++) colors[i] = random8();
+    st->rule = rule+1; // force parsing
+    st->cycle = false;
+    st->checkHash = 0;
+    st->power = 1;
+    st->lambda = 0;
   } else if (strip.now - SEGENV.step < FRAMETIME_FIXED * (uint32_t)map(SEGMENT.speed,0,255,64,4)) {
     // update only when appropriate time passes (in 42 FPS slots)
     return FRAMETIME;
-  }
-
-  //copy previous leds (save previous generation)
-  //NOTE: using lossy getPixelColor() is a benefit as endlessly repeating patterns will eventually fade out causing a reset
-  for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) prevLeds[XY(x,y)] = SEGMENT.getPixelColorXY(x,y);
-
-  //calculate new leds
-  for (int x = 0; x < cols; x++) for (int y = 0; y < rows; y++) {
-
-    colorCount colorsCount[9]; // count the different colors in the 3*3 matrix
-    for (int i=0; i<9; i++) colorsCount[i] = {backgroundColor, 0}; // init colorsCount
-
-    // iterate through neighbors and count them and their different colors
-    int neighbors = 0;
-    for (int i = -1; i <= 1; i++) for (int j = -1; j <= 1; j++) { // iterate through 3*3 matrix
-      if (i==0 && j==0) continue; // ignore itself
-      // wrap around segment
-      int16_t xx = x+i, yy = y+j;
-      if (x+i < 0) xx = cols-1; else if (x+i >= cols) xx = 0;
-      if (y+j < 0) yy = rows-1; else if (y+j >= rows) yy = 0;
-
-      uint16_t xy = XY(xx, yy); // previous cell xy to check
-      // count different neighbours and colors
-      if (prevLeds[xy] != backgroundColor) {
-        neighbors++;
-        bool colorFound = false;
-        int k;
-        for (k=0; k<9 && colorsCount[i].count != 0; k++)
-          if (colorsCount[k].color == prevLeds[xy]) {
-            colorsCount[k].count++;
-            colorFound = true;
+  } else {
+    //calculate next generation
+    const uint32_t *prev = planes + st->cur * words * rows;
+    uint32_t *next = planes + (st->cur ^ 1) * words * rows;
+    for (int y = 0; y < rows; y++) {
+      const uint32_t *up = prev + ((y + rows - 1) % rows) * words;
+      const uint32_t *mid = prev + y * words;
+      const uint32_t *dn = prev + ((y + 1) % rows) * words;
+      for (int k = 0; k < words; k++) {
+        // count neighbours of 32 cells at once, bit n of c0..c3 holds count of cell n
+        const uint32_t nb[8] = { up[k], golWest(up, k, words, cols), golEast(up, k, words, cols),
+                                 golWest(mid, k, words, cols), golEast(mid, k, words, cols),
+                                 dn[k], golWest(dn, k, words, cols), golEast(dn, k, words, cols) };
+        uint32_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+        for (int i = 0; i < 8; i++) {
+          uint32_t carry0 = c0 & nb[i]; c0 ^= nb[i];
+          uint32_t carry1 = c1 & carry0; c1 ^= carry0;
+          uint32_t carry2 = c2 & carry1; c2 ^= carry1;
+          c3 |= carry2;
+        }
+        // Rules of Life
+        uint32_t alive = mid[k];
+        uint32_t born = 0, stay = 0, two = 0;
+        for (int n = 0; n <= 8; n++) {
+          uint32_t eq = (n & 1 ? c0 : ~c0) & (n & 2 ? c1 : ~c1) & (n & 4 ? c2 : ~c2) & (n & 8 ? c3 : ~c3);
+          if (st->birth   & (1 << n)) born |= eq;
+          if (st->survive & (1 << n)) stay |= eq;
+          if (n == 2) two = eq;
+        }
+        born &= ~alive;
+        uint32_t mutate = SEGMENT.check1 ? two & ~alive & ~born : 0;
+        if (k == words-1) { born &= lastMask; mutate &= lastMask; }
+        next[y * words + k] = alive & stay;
+
+        // Reproduction: assign dominant color of neighbours, w/ a bit of randomness to avoid "gliders"
+        for (; born; born &= born - 1) {
+          int x = k * 32 + __builtin_ctz(born);
+          if (SEGMENT.check1 && !random8(128)) continue;
+          uint8_t nbColors[8];
+          uint8_t found = 0;
+          for (int j = -1; j <= 1; j++) for (int i = -1; i <= 1; i++) {
+            if (i == 0 && j == 0) continue;
+            int xx = (x + i + cols) % cols, yy = (y + j + rows) % rows;
+            if (prev[yy * words + xx / 32] & (1UL << (xx & 31))) nbColors[found++] = colors[yy * cols + xx];
+          }
+          uint8_t dominant = nbColors[0], maxCount = 0;
+          for (int a = 0; a < found; a++) {
+            uint8_t count = 0;
+            for (int b = a; b < found; b++) count += (nbColors[b] == nbColors[a]);
+            if (count > maxCount) { maxCount = count; dominant = nbColors[a]; }
           }
-        if (!colorFound) colorsCount[k] = {prevLeds[xy], 1}; //add new color found in the array
+          colors[y * cols + x] = found ? dominant : random8();
+          next[y * words + k] |= 1UL << (x & 31);
+        }
+        // Mutation
+        for (; mutate; mutate &= mutate - 1) {
+          if (random8(128)) continue;
+          int x = k * 32 + __builtin_ctz(mutate);
+          colors[y * cols + x] = random8();
+          next[y * words + k] |= 1UL << (x & 31);
+        }
       }
-    } // i,j
-
-    // Rules of Life
-    uint32_t col = prevLeds[XY(x,y)];
-    uint32_t bgc = RGBW32(backgroundColor.r, backgroundColor.g, backgroundColor.b, 0);
-    if      ((col != bgc) && (neighbors <  2)) SEGMENT.setPixelColorXY(x,y, bgc); // Loneliness
-    else if ((col != bgc) && (neighbors >  3)) SEGMENT.setPixelColorXY(x,y, bgc); // Overpopulation
-    else if ((col == bgc) && (neighbors == 3)) {                                  // Reproduction
-      // find dominant color and assign it to a cell
-      colorCount dominantColorCount = {backgroundColor, 0};
-      for (int i=0; i<9 && colorsCount[i].count != 0; i++)
-        if (colorsCount[i].count > dominantColorCount.count) dominantColorCount = colorsCount[i];
-      // assign the dominant color w/ a bit of randomness to avoid "gliders"
-      if (dominantColorCount.count > 0 && random8(128)) SEGMENT.setPixelColorXY(x,y, dominantColorCount.color);
-    } else if ((col == bgc) && (neighbors == 2) && !random8(128)) {               // Mutation
-      SEGMENT.setPixelColorXY(x,y, SEGMENT.color_from_palette(random8(), false, PALETTE_SOLID_WRAP, 255));
-    }
-    // else do nothing!
-  } //x,y
-
-  // calculate CRC16 of leds
-  uint16_t crc = crc16((const unsigned char*)prevLeds, dataSize);
-  // check if we had same CRC and reset if needed
-  bool repetition = false;
-  for (int i=0; i<crcBufferLen && !repetition; i++) repetition = (crc == crcBuffer[i]); // (Ewowi)
-  // same CRC would mean image did not change or was repeating itself
-  if (!repetition) SEGENV.step = strip.now; //if no repetition avoid reset
-  // remember CRCs across frames
-  crcBuffer[SEGENV.aux0] = crc;
-  ++SEGENV.aux0 %= crcBufferLen;
+    }
+    st->cur ^= 1;
+
+    // detect repeating generations (still lifes, oscillators, gliders wrapping around) using Brent's algorithm
+    uint32_t hash = 2166136261UL;
+    for (int i = 0; i < words * rows; i++) hash = (hash ^ next[i]) * 16777619UL;
+    if (hash == st->checkHash) st->cycle = true;
+    if (++st->lambda == st->power) {
+      st->checkHash = hash;
+      st->lambda = 0;
+      if (st->power < 0x8000) st->power <<= 1;
+    }
+    if (!st->cycle) SEGENV.step = strip.now; //if no repetition avoid reset
+  }
+  if (st->rule != rule) { st->rule = rule; golParseRule(st); }
+
+  // draw current generation
+  const uint32_t *cells = planes + st->cur * words * rows;
+  uint32_t span[PIXEL_SPAN_LEN];
+  for (int y = 0; y < rows; y++) for (int x0 = 0; x0 < cols; x0 += PIXEL_SPAN_LEN) {
+    int n = MIN(cols - x0, PIXEL_SPAN_LEN);
+    for (int i = 0; i < n; i++) {
+      int x = x0 + i;
+      span[i] = (cells[y * words + x / 32] & (1UL << (x & 31))) ? SEGMENT.color_from_palette(colors[y * cols + x], false, PALETTE_SOLID_WRAP, 255) : bgc;
+    }
+    SEGMENT.setPixelColorsXY(x0, y, span, n);
+  }
 
   return FRAMETIME;
 } // mode_2Dgameoflife()
-static const char _data_FX_MODE_2DGAMEOFLIFE[] PROGMEM = "Game Of Life@!;!,!;!;2";
+static const char _data_FX_MODE_2DGAMEOFLIFE[] PROGMEM = "Game Of Life@!,,,,Rule,Mutation;!,!;!;2;c3=0,o1=1";
 
 
 /////////////////////////
@@ -4982,10 +5043,89 @@ static const char _data_FX_MODE_2DHIPHOTIC[] PROGMEM = "Hiphotic@X scale,Y scale
 // Custom1 = Location of X centerpoint
 // Custom2 = Location of Y centerpoint
 // Custom3 = Size of the area (small value = smaller area)
+// view and progress of a fractal image rendered by fractalRender(), parameters are taken when a new image starts
+typedef struct Fractal {
+  int32_t  x0, y0;     // top left (Q16)
+  int32_t  dx, dy;     // pixel size (Q16)
+  int32_t  cRe, cIm;   // constant c of Julia set (Q16)
+  uint8_t  maxIter;
+  uint8_t  pass;       // interleaved rendering: pass (row offset) and next row to render
+  uint16_t row;
+  bool     complete;   // an image was rendered, coarse passes no longer fill blocks of rows
+} fractal;
+
+// log2 of Q16 value (>= 1.0) in Q8, mantissa approximated by log2(1+t) ~ t + 0.34*t*(1-t)
+static uint16_t fractalLog2(uint32_t x) {
+  uint8_t msb = 31 - __builtin_clz(x);
+  uint16_t t = ((x << (31 - msb)) >> 23) & 0xFF;
+  return ((msb - 16) << 8) + t + ((t * (256 - t) * 87) >> 16);
+}
+
+// escape time of z -> z^2 + c, smoothed (in Q8 iterations) or UINT16_MAX if z stays bounded
+// arguments are Q16, iteration is done in Q22 (6 more bits, so errors growing with every iteration near the border
+// of the set stay small): for |c| < 3 and |z| <= 4, |z^2 + c| stays below 19 and its square fits int32
+#define FRACTAL_BITS 22
+uint16_t fractalEscape(int32_t a, int32_t b, int32_t cRe, int32_t cIm, uint8_t maxIter) {
+  const int32_t q = 1 << (FRACTAL_BITS - 16);
+  a *= q; b *= q; cRe *= q; cIm *= q;
+  for (uint16_t iter = 0; iter < maxIter; iter++) {
+    int32_t aa = ((int64_t)a * a) >> FRACTAL_BITS;
+    int32_t bb = ((int64_t)b * b) >> FRACTAL_BITS;
+    if (aa + bb > (16 << FRACTAL_BITS)) {
+      // |z| = sqrt(a^2+b^2) is above 4, fraction of iteration from log2(log2(|z|^2)/log2(16))
+      int nu = fractalLog2((uint32_t)fractalLog2((uint32_t)(aa + bb) >> (FRACTAL_BITS - 16)) << 6);
+      int smooth = ((iter + 1) << 8) - nu;
+      return smooth > 0 ? smooth : 0;
+    }
+    b = (((int64_t)a * b) >> (FRACTAL_BITS - 1)) + cIm;  // z -> z^2+c where z=a+ib c=(cRe,cIm). Remember to use 'foil'.
+    a = aa - bb + cRe;
+  }
+  return UINT16_MAX;
+}
+
+// renders rows of Julia (or Mandelbrot) set until half of frame time is used, rows are rendered interleaved
+// (every 8th row first) so image is refined progressively; returns true when an image was completed
+static bool fractalRender(fractal *f, bool mandelbrot) {
+  static const uint8_t offsets[8] = {0, 4, 2, 6, 1, 5, 3, 7};
+  const uint16_t cols = SEGMENT.virtualWidth();
+  const uint16_t rows = SEGMENT.virtualHeight();
+  const uint32_t maxSmooth = (f->maxIter ? f->maxIter : 1) << 8;
+  uint32_t start = micros();
+  uint32_t span[PIXEL_SPAN_LEN];
+  do {
+    if (f->row >= rows) {
+      f->row = 0;
+      while (++f->pass < 8 && offsets[f->pass] >= rows);
+      if (f->pass >= 8) {
+        f->pass = 0;
+        f->complete = true;
+        return true;
+      }
+      f->row = offsets[f->pass];
+    }
+    uint8_t off = offsets[f->pass];
+    uint8_t fill = f->complete ? 1 : (off ? off & -off : 8); // block of rows not rendered yet
+    int32_t y = f->y0 + f->row * f->dy;
+    for (int x0 = 0; x0 < cols; x0 += PIXEL_SPAN_LEN) {
+      int n = MIN(cols - x0, PIXEL_SPAN_LEN);
+      for (int i = 0; i < n; i++) {
+        int32_t x = f->x0 + (x0 + i) * f->dx;
+        uint16_t esc = mandelbrot ? fractalEscape(0, 0, x, y, f->maxIter) : fractalEscape(x, y, f->cRe, f->cIm, f->maxIter);
+        // color each pixel based on how long it takes to get to infinity, or black if it never gets there
+        span[i] = esc == UINT16_MAX ? 0 : SEGMENT.color_from_palette(MIN(255U, esc * 255U / maxSmooth), false, PALETTE_SOLID_WRAP, 0);
+      }
+      for (int r = 0; r < fill && f->row + r < rows; r++) SEGMENT.setPixelColorsXY(x0, f->row + r, span, n);
+    }
+    f->row += 8;
+  } while (micros() - start < FRAMETIME * 500U);
+  return false;
+}
+
 typedef struct Julia {
   float xcen;
   float ycen;
   float xymag;
+  fractal f;
 } julia;
 
 uint16_t mode_2DJulia(void) {                           // An animated Julia set by Andrew Tuline.
@@ -5017,78 +5157,77 @@ uint16_t mode_2DJulia(void) {                           // An animated Julia set
   if (julias->xymag < 0.01f) julias->xymag = 0.01f;
   if (julias->xymag > 1.0f) julias->xymag = 1.0f;
 
-  float xmin = julias->xcen - julias->xymag;
-  float xmax = julias->xcen + julias->xymag;
-  float ymin = julias->ycen - julias->xymag;
-  float ymax = julias->ycen + julias->xymag;
-
-  // Whole set should be within -1.2,1.2 to -.8 to 1.
-  xmin = constrain(xmin, -1.2f, 1.2f);
-  xmax = constrain(xmax, -1.2f, 1.2f);
-  ymin = constrain(ymin, -0.8f, 1.0f);
-  ymax = constrain(ymax, -0.8f, 1.0f);
-
-  float dx;                       // Delta x is mapped to the matrix size.
-  float dy;                       // Delta y is mapped to the matrix size.
-
-  int maxIterations = 15;         // How many iterations per pixel before we give up. Make it 8 bits to match our range of colours.
-  float maxCalc = 16.0;           // How big is each calculation allowed to be before we give up.
-
-  maxIterations = SEGMENT.intensity/2;
-
-
-  // Resize section on the fly for some animaton.
-  reAl = -0.94299f;               // PixelBlaze example
-  imAg = 0.3162f;
-
-  reAl += sin_t((float)millis()/305.f)/20.f;
-  imAg += sin_t((float)millis()/405.f)/20.f;
-
-  dx = (xmax - xmin) / (cols);     // Scale the delta x and y values to our matrix size.
-  dy = (ymax - ymin) / (rows);
+  fractal *f = &julias->f;
+  if (f->pass == 0 && f->row == 0) { // starting new image
+    float xmin = julias->xcen - julias->xymag;
+    float xmax = julias->xcen + julias->xymag;
+    float ymin = julias->ycen - julias->xymag;
+    float ymax = julias->ycen + julias->xymag;
+
+    // Whole set should be within -1.2,1.2 to -.8 to 1.
+    xmin = constrain(xmin, -1.2f, 1.2f);
+    xmax = constrain(xmax, -1.2f, 1.2f);
+    ymin = constrain(ymin, -0.8f, 1.0f);
+    ymax = constrain(ymax, -0.8f, 1.0f);
+
+    // Resize section on the fly for some animaton.
+    reAl = -0.94299f;               // PixelBlaze example
+    imAg = 0.3162f;
+
+    reAl += sin_t((float)millis()/305.f)/20.f;
+    imAg += sin_t((float)millis()/405.f)/20.f;
+
+    f->x0  = xmin * 65536.f;
+    f->y0  = ymin * 65536.f;
+    f->dx  = (xmax - xmin) * 65536.f / cols; // Scale the delta x and y values to our matrix size.
+    f->dy  = (ymax - ymin) * 65536.f / rows;
+    f->cRe = reAl * 65536.f;
+    f->cIm = imAg * 65536.f;
+    f->maxIter = SEGMENT.intensity/2; // How many iterations per pixel before we give up.
+  }
+  fractalRender(f, false);
+//  SEGMENT.blur(64);
 
-  // Start y
-  float y = ymin;
-  for (int j = 0; j < rows; j++) {
+  return FRAMETIME;
+} // mode_2DJulia()
+static const char _data_FX_MODE_2DJULIA[] PROGMEM = "Julia@,Max iterations per pixel,X center,Y center,Area size;!;!;2;ix=24,c1=128,c2=128,c3=16";
 
-    // Start x
-    float x = xmin;
-    for (int i = 0; i < cols; i++) {
 
-      // Now we test, as we iterate z = z^2 + c does z tend towards infinity?
-      float a = x;
-      float b = y;
-      int iter = 0;
+/////////////////////////
+//   2D Mandelbrot     //
+/////////////////////////
+// Sliders are:
+// speed = Zoom speed (zooms in and out of the center)
+// intensity = Maximum number of iterations per pixel.
+// Custom1 = X offset of centerpoint
+// Custom2 = Y offset of centerpoint
+uint16_t mode_2DMandelbrot(void) {
+  if (!strip.isMatrix) return mode_static(); // not a 2D set-up
 
-      while (iter < maxIterations) {    // Here we determine whether or not we're out of bounds.
-        float aa = a * a;
-        float bb = b * b;
-        float len = aa + bb;
-        if (len > maxCalc) {            // |z| = sqrt(a^2+b^2) OR z^2 = a^2+b^2 to save on having to perform a square root.
-          break;  // Bail
-        }
+  const uint16_t cols = SEGMENT.virtualWidth();
+  const uint16_t rows = SEGMENT.virtualHeight();
 
-       // This operation corresponds to z -> z^2+c where z=a+ib c=(x,y). Remember to use 'foil'.
-        b = 2*a*b + imAg;
-        a = aa - bb + reAl;
-        iter++;
-      } // while
+  if (!SEGENV.allocateData(sizeof(fractal))) return mode_static();
+  fractal *f = reinterpret_cast<fractal*>(SEGENV.data);
 
-      // We color each pixel based on how long it takes to get to infinity, or black if it never gets there.
-      if (iter == maxIterations) {
-        SEGMENT.setPixelColorXY(i, j, 0);
-      } else {
-        SEGMENT.setPixelColorXY(i, j, SEGMENT.color_from_palette(iter*255/maxIterations, false, PALETTE_SOLID_WRAP, 0));
-      }
-      x += dx;
-    }
-    y += dy;
+  if (f->pass == 0 && f->row == 0) { // starting new image
+    // zoom in and out of a seahorse valley point by up to 8 octaves
+    uint8_t zoom = triwave8(((strip.now >> 4) * ((SEGMENT.speed >> 3) + 1)) >> 8);
+    int32_t size = (3L << 16) >> (zoom >> 5);                 // width of view (Q16)
+    size -= (size * (zoom & 0x1F)) >> 6;                        // 2^-f ~ 1 - f/2
+    int32_t xcen = -48735 + (SEGMENT.custom1 - 128) * 64;      // -0.74364 + offset
+    int32_t ycen =   8639 + (SEGMENT.custom2 - 128) * 64;      //  0.13182 + offset
+    f->dx = MAX(1, size / cols);
+    f->dy = f->dx;                                              // square pixels
+    f->x0 = xcen - f->dx * cols / 2;
+    f->y0 = ycen - f->dy * rows / 2;
+    f->maxIter = SEGMENT.intensity/2;
   }
-//  SEGMENT.blur(64);
+  fractalRender(f, true);
 
   return FRAMETIME;
-} // mode_2DJulia()
-static const char _data_FX_MODE_2DJULIA[] PROGMEM = "Julia@,Max iterations per pixel,X center,Y center,Area size;!;!;2;ix=24,c1=128,c2=128,c3=16";
+} // mode_2DMandelbrot()
+static const char _data_FX_MODE_2DMANDELBROT[] PROGMEM = "Mandelbrot@Zoom speed,Max iterations per pixel,X center,Y center;!;!;2;sx=64,ix=64,c1=128,c2=128";
 
 
 //////////////////////////////
@@ -7407,6 +7546,7 @@ void WS2812FX::addEffect(uint8_t id, mode_ptr mode_fn, const char *mode_name) {
     _modeData.push_back(mode_name);
     if (_modeCount < _mode.size()) _modeCount++;
   }
+  _modeRev++;
 }
 
 void WS2812FX::setupEffectData() {
@@ -7604,6 +7744,7 @@ void WS2812FX::setupEffectData() {
   addEffect(FX_MODE_2DSUNRADIATION, &mode_2DSunradiation, _data_FX_MODE_2DSUNRADIATION);
   addEffect(FX_MODE_2DCOLOREDBURSTS, &mode_2DColoredBursts, _data_FX_MODE_2DCOLOREDBURSTS);
   addEffect(FX_MODE_2DJULIA, &mode_2DJulia, _data_FX_MODE_2DJULIA);
+  addEffect(FX_MODE_2DMANDELBROT, &mode_2DMandelbrot, _data_FX_MODE_2DMANDELBROT);
 
   addEffect(FX_MODE_2DGAMEOFLIFE, &mode_2Dgameoflife, _data_FX_MODE_2DGAMEOFLIFE);
   addEffect(FX_MODE_2DTARTAN, &mode_2Dtartan, _data_FX_MODE_2DTARTAN);
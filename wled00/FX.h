@@ -79,20 +79,52 @@
   #endif
 #endif
 
+/* Runtime data and leds[] of all segments can be taken from a single block (arena) allocated at boot, so effect
+  changes do not fragment the heap; arena is compacted between frames, allocations that do not fit use heap.
+  The arena is held even if no effect needs data, so it is off (heap only) unless a size is set in the build,
+  e.g. -D SEGMENT_ARENA_SIZE=16384 (the peak usage "pk" reported in info helps sizing it). */
+#ifndef SEGMENT_ARENA_SIZE
+  #define SEGMENT_ARENA_SIZE 0
+#endif
+#if SEGMENT_ARENA_SIZE > 65532
+  #error "Segment arena must be smaller than 64k!"
+#endif
+
+/* How much data bytes scratch frame buffers for effect crossfades may use (pool is allocated while segments transition,
+  no larger than needed for the strip), each transitioning segment takes 8 bytes per pixel and a bit mask of the
+  pixels it sets; segments that do not fit switch effect half way */
+#ifndef MAX_TRANSITION_DATA
+  #ifdef ESP8266
+    #define MAX_TRANSITION_DATA  4096
+  #elif defined(ARDUINO_ARCH_ESP32S2) || defined(CONFIG_IDF_TARGET_ESP32C3)
+    #define MAX_TRANSITION_DATA 16384
+  #else
+    #define MAX_TRANSITION_DATA 32768
+  #endif
+#endif
+
+// crossfade bit mask of segment pixels (in words following the frames, see Segment::probeTransitionPixels())
+#define TRANSITION_MASK_LEN(len)     (((len) + 31) / 32)
+#define TRANSITION_MASK_GET(mask, k) ((mask)[(k) >> 5] & (1UL << ((k) & 31)))
+#define TRANSITION_MASK_SET(mask, k) ((mask)[(k) >> 5] |= (1UL << ((k) & 31)))
+
 /* How much data bytes each segment should max allocate to leave enough space for other segments,
   assuming each segment uses the same amount of data. 256 for ESP8266, 640 for ESP32. */
 #define FAIR_DATA_PER_SEG (MAX_SEGMENT_DATA / strip.getMaxSegments())
 
 #define MIN_SHOW_DELAY   (_frametime < 16 ? 8 : 15)
 
+/* number of pixels processed at once by span (batch) pixel functions, uses 4 bytes of stack per pixel */
+#define PIXEL_SPAN_LEN   32
+
 #define NUM_COLORS       3 /* number of colors per segment */
 #define SEGMENT          strip._segments[strip.getCurrSegmentId()]
 #define SEGENV           strip._segments[strip.getCurrSegmentId()]
 //#define SEGCOLOR(x)      strip._segments[strip.getCurrSegmentId()].currentColor(x, strip._segments[strip.getCurrSegmentId()].colors[x])
 //#define SEGLEN           strip._segments[strip.getCurrSegmentId()].virtualLength()
 #define SEGCOLOR(x)      strip.segColor(x) /* saves us a few kbytes of code */
-#define SEGPALETTE       strip._currentPalette
-#define SEGLEN           strip._virtualSegmentLength /* saves us a few kbytes of code */
+#define SEGPALETTE       strip.renderContext().palette
+#define SEGLEN           strip.renderContext().virtualLength /* saves us a few kbytes of code */
 #define SPEED_FORMULA_L  (5U + (50U*(255U - SEGMENT.speed))/SEGLEN)
 
 // some common colors
@@ -316,8 +348,9 @@
 #define FX_MODE_WAVESINS               184
 #define FX_MODE_ROCKTAVES              185
 #define FX_MODE_2DAKEMI                186
+#define FX_MODE_2DMANDELBROT           187
 
-#define MODE_COUNT                     187
+#define MODE_COUNT                     188
 
 typedef enum mapping1D2D {
   M12_Pixels = 0,
@@ -374,9 +407,9 @@ typedef struct Segment {
     uint32_t call;  // call counter
     uint16_t aux0;  // custom var
     uint16_t aux1;  // custom var
+    uint16_t randSeed; // state of random8()/random16() used by effect (seeded on reset)
     byte* data;     // effect data pointer
-    CRGB* leds;     // local leds[] array (may be a pointer to global)
-    static CRGB *_globalLeds;             // global leds[] array
+    CRGB* leds;     // local leds[] array
     static uint16_t maxWidth, maxHeight;  // these define matrix width & height (max. segment dimensions)
 
   private:
@@ -393,6 +426,41 @@ typedef struct Segment {
     uint16_t _dataLen;
     static uint16_t _usedSegmentData;
 
+    // arena holding runtime data and leds[] of all segments, blocks are contiguous from _arena to _arenaTop
+    static byte    *_arena;
+    static uint16_t _arenaTop;
+    static uint16_t _arenaUsed;        // bytes in used blocks (including headers)
+    static uint16_t _arenaPeak;        // high-water mark of _arenaUsed
+    static uint16_t _arenaHeapAllocs;  // allocations that did not fit arena
+    static uint16_t _arenaCompactions;
+    static bool     _arenaCompact;     // there are holes, compact before next frame
+    static volatile bool _arenaCompacting; // blocks are being moved, no other block may be taken or merged
+    static bool     inArena(const void *p) { return _arena && (const byte*)p >= _arena && (const byte*)p < _arena + SEGMENT_ARENA_SIZE; }
+
+    // cached physical pixel indices of each logical pixel (1D segments with grouping, spacing, mirror, reverse or offset)
+    // header holds the geometry the map was built for, followed by len*stride indices (0xFFFF if pixel is not set)
+    // for 2D segments using Arc or Corner 1D expansion stride is 0 and the header is followed by len+1 offsets
+    // into a list of virtual (x,y) targets packed as y*width+x (only targets within the segment are listed)
+    struct PixelMap {
+      uint16_t start, stop, offset, len;
+      uint16_t width, height, size;   // virtual dimensions (2D expansion) and number of entries following the header
+      uint16_t stride;                // entries per logical pixel (grouping, doubled if mirrored), 0 for 1D to 2D expansion
+      uint8_t  grouping, spacing, map1D2D;
+      bool     reverse, mirror;
+      inline uint16_t *indices() { return reinterpret_cast<uint16_t*>(this + 1); }
+    } *_pixMap;
+
+    // palette used for rendering expanded to 256 colors (already blended), src is the palette the colors were expanded from
+    struct PaletteCache {
+      CRGBPalette16 src;
+      bool          noBlend;
+      CRGB          colors[256];
+    } *_palCache;
+
+#ifndef WLED_DISABLE_2D
+    static PixelMap *build1D2DMap(uint8_t map1D2D, uint16_t vW, uint16_t vH, uint16_t vLen);
+#endif
+
     // transition data, valid only if transitional==true, holds values during transition
     struct Transition {
       uint32_t      _colorT[NUM_COLORS];
@@ -401,9 +469,13 @@ typedef struct Segment {
       CRGBPalette16 _palT;        // temporary palette
       uint8_t       _prevPaletteBlends; // number of previous palette blends (there are max 255 belnds possible)
       uint8_t       _modeP;       // previous mode/effect
-      //uint16_t      _aux0, _aux1; // previous mode/effect runtime data
-      //uint32_t      _step, _call; // previous mode/effect runtime data
-      //byte         *_data;        // previous mode/effect runtime data
+      uint8_t       _modeN;       // mode/effect segment runtime data belongs to (while cross-fading)
+      uint16_t      _aux0, _aux1; // previous mode/effect runtime data
+      uint32_t      _step, _call; // previous mode/effect runtime data
+      byte         *_data;        // previous mode/effect runtime data
+      uint16_t      _dataLen;
+      CRGB         *_leds;        // previous mode/effect leds[] array
+      uint32_t     *_frames;      // last frame of previous and new effect (2x segment length) and mask of segment pixels from strip's pool, null if not cross-fading
       uint32_t      _start;
       uint16_t      _dur;
       Transition(uint16_t dur=750)
@@ -412,6 +484,12 @@ typedef struct Segment {
         , _palT(CRGBPalette16(CRGB::Black))
         , _prevPaletteBlends(0)
         , _modeP(FX_MODE_STATIC)
+        , _modeN(FX_MODE_STATIC)
+        , _aux0(0), _aux1(0), _step(0), _call(0)
+        , _data(nullptr)
+        , _dataLen(0)
+        , _leds(nullptr)
+        , _frames(nullptr)
         , _start(millis())
         , _dur(dur)
       {}
@@ -421,13 +499,24 @@ typedef struct Segment {
         , _palT(CRGBPalette16(CRGB::Black))
         , _prevPaletteBlends(0)
         , _modeP(FX_MODE_STATIC)
+        , _modeN(FX_MODE_STATIC)
+        , _aux0(0), _aux1(0), _step(0), _call(0)
+        , _data(nullptr)
+        , _dataLen(0)
+        , _leds(nullptr)
+        , _frames(nullptr)
         , _start(millis())
         , _dur(d)
       {
         for (size_t i=0; i<NUM_COLORS; i++) _colorT[i] = o[i];
       }
+      Transition(const Transition&) = delete; // owns previous effect's data
+      ~Transition();
     } *_t;
 
+    void swapEffectState(void); // exchange runtime data of previous effect (in _t) with segment's
+    void probeTransitionPixels(void); // mark pixels of bounding box set by segment in crossfade mask
+
   public:
 
     Segment(uint16_t sStart=0, uint16_t sStop=30) :
@@ -458,10 +547,13 @@ typedef struct Segment {
       call(0),
       aux0(0),
       aux1(0),
+      randSeed(0),
       data(nullptr),
       leds(nullptr),
       _capabilities(0),
       _dataLen(0),
+      _pixMap(nullptr),
+      _palCache(nullptr),
       _t(nullptr)
     {
       //refreshLightCapabilities();
@@ -483,7 +575,9 @@ typedef struct Segment {
       //if (leds) Serial.printf(" [%u]", length()*sizeof(CRGB));
       //Serial.println();
       //#endif
-      if (!Segment::_globalLeds && leds) free(leds);
+      if (leds) arenaFree(leds);
+      if (_pixMap) free(_pixMap);
+      if (_palCache) free(_palCache);
       if (name) delete[] name;
       if (_t) delete _t;
       deallocateData();
@@ -493,7 +587,7 @@ typedef struct Segment {
     Segment& operator= (Segment &&orig) noexcept; // move assignment
 
 #ifdef WLED_DEBUG
-    size_t getSize() const { return sizeof(Segment) + (data?_dataLen:0) + (name?strlen(name):0) + (_t?sizeof(Transition):0) + (!Segment::_globalLeds && leds?sizeof(CRGB)*length():0); }
+    size_t getSize() const { return sizeof(Segment) + (data?_dataLen:0) + (name?strlen(name):0) + (_t?sizeof(Transition):0) + (leds?sizeof(CRGB)*length():0) + (_pixMap?sizeof(PixelMap)+sizeof(uint16_t)*_pixMap->size:0) + (_palCache?sizeof(PaletteCache):0); }
 #endif
 
     inline bool     getOption(uint8_t n) const { return ((options >> n) & 0x01); }
@@ -511,6 +605,16 @@ typedef struct Segment {
 
     static uint16_t getUsedSegmentData(void)    { return _usedSegmentData; }
     static void     addUsedSegmentData(int len) { _usedSegmentData += len; }
+    static void     initArena(void);            // allocate segment data arena (once)
+    static byte    *arenaAlloc(size_t len);     // block from arena (heap if it does not fit), not zeroed
+    static void     arenaFree(void *p);
+    static void     compactArena(void);         // only between frames, moves runtime data of segments
+    static uint16_t getArenaSize(void)          { return _arena ? SEGMENT_ARENA_SIZE : 0; }
+    static uint16_t getArenaUsed(void)          { return _arenaUsed; }
+    static uint16_t getArenaPeak(void)          { return _arenaPeak; }
+    static uint16_t getArenaLargestFree(void);
+    static uint16_t getArenaHeapAllocs(void)    { return _arenaHeapAllocs; }
+    static uint16_t getArenaCompactions(void)   { return _arenaCompactions; }
 
     void    set(uint16_t i1, uint16_t i2, uint8_t grp=1, uint8_t spc=0, uint16_t ofs=UINT16_MAX, uint16_t i1Y=0, uint16_t i2Y=1);
     bool    setColor(uint8_t slot, uint32_t c); //returns true if changed
@@ -535,10 +639,13 @@ typedef struct Segment {
       */
     inline void markForReset(void) { reset = true; }  // setOption(SEG_OPTION_RESET, true)
     void setUpLeds(void);   // set up leds[] array for loseless getPixelColor()
+    void updatePixelMap(void); // (re)build physical pixel index (or 1D to 2D expansion) map if geometry changed
+    void updatePaletteCache(const CRGBPalette16 &pal, bool alloc = false); // (re)build expanded palette if palette changed
 
     // transition functions
     void     startTransition(uint16_t dur); // transition has to start before actual segment values change
     void     handleTransition(void);
+    uint16_t runEffect(void); // runs effect function, cross-fades previous and new effect during transition
     uint16_t progress(void); //transition progression between 0-65535
     uint8_t  currentBri(uint8_t briNew, bool useCct = false);
     uint8_t  currentMode(uint8_t modeNew);
@@ -554,6 +661,7 @@ typedef struct Segment {
     void setPixelColor(float i, uint32_t c, bool aa = true);
     void setPixelColor(float i, uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0, bool aa = true) { setPixelColor(i, RGBW32(r,g,b,w), aa); }
     void setPixelColor(float i, CRGB c, bool aa = true)                                         { setPixelColor(i, RGBW32(c.r,c.g,c.b,0), aa); }
+    void setPixelColors(int n, const uint32_t *c, uint16_t count); // set a run of relative pixels within segment
     uint32_t getPixelColor(int i);
     // 1D support functions (some implement 2D as well)
     void blur(uint8_t);
@@ -582,6 +690,7 @@ typedef struct Segment {
     void setPixelColorXY(float x, float y, uint32_t c, bool aa = true);
     void setPixelColorXY(float x, float y, byte r, byte g, byte b, byte w = 0, bool aa = true) { setPixelColorXY(x, y, RGBW32(r,g,b,w), aa); }
     void setPixelColorXY(float x, float y, CRGB c, bool aa = true)                             { setPixelColorXY(x, y, RGBW32(c.r,c.g,c.b,0), aa); }
+    void setPixelColorsXY(int x, int y, const uint32_t *c, uint16_t count); // set a horizontal run of pixels within segment
     uint32_t getPixelColorXY(uint16_t x, uint16_t y);
     // 2D support functions
     void blendPixelColorXY(uint16_t x, uint16_t y, uint32_t color, uint8_t blend);
@@ -616,6 +725,7 @@ typedef struct Segment {
     void setPixelColorXY(float x, float y, uint32_t c, bool aa = true)     { setPixelColor(x, c, aa); }
     void setPixelColorXY(float x, float y, byte r, byte g, byte b, byte w = 0, bool aa = true) { setPixelColor(x, RGBW32(r,g,b,w), aa); }
     void setPixelColorXY(float x, float y, CRGB c, bool aa = true)         { setPixelColor(x, RGBW32(c.r,c.g,c.b,0), aa); }
+    void setPixelColorsXY(int x, int y, const uint32_t *c, uint16_t count) { setPixelColors(x, c, count); }
     uint32_t getPixelColorXY(uint16_t x, uint16_t y)                       { return getPixelColor(x); }
     void blendPixelColorXY(uint16_t x, uint16_t y, uint32_t c, uint8_t blend) { blendPixelColor(x, c, blend); }
     void blendPixelColorXY(uint16_t x, uint16_t y, CRGB c, uint8_t blend)  { blendPixelColor(x, RGBW32(c.r,c.g,c.b,0), blend); }
@@ -639,6 +749,24 @@ typedef struct Segment {
 } segment;
 //static int segSize = sizeof(Segment);
 
+// segment being rendered and values used by effect functions (through SEGMENT, SEGENV, SEGLEN, SEGCOLOR and SEGPALETTE macros)
+// with parallel rendering there is one context per core, each core renders a different segment
+typedef struct RenderContext {
+  uint8_t       segIndex;
+  uint16_t      virtualLength;
+  uint32_t      colors[NUM_COLORS]; // colors used for effect (includes transition, gamma corrected)
+  CRGBPalette16 palette;            // palette used for effect (includes transition)
+  uint16_t      randSeed;           // PRNG state of segment being rendered, see random8() below
+  uint32_t      timeOffset;         // added to strip.now for FastLED beat functions (effect running on its own time base)
+  RenderContext() : segIndex(0), virtualLength(0), colors{0,0,0}, palette(CRGBPalette16(CRGB::Black)), randSeed(1337), timeOffset(0) {}
+} render_context_t;
+
+#ifdef WLED_ENABLE_PARALLEL_RENDER
+  #define WLED_RENDER_CONTEXTS 2
+#else
+  #define WLED_RENDER_CONTEXTS 1
+#endif
+
 // main "strip" class
 class WS2812FX {  // 96 bytes
   typedef uint16_t (*mode_ptr)(void); // pointer to mode function
@@ -667,10 +795,6 @@ class WS2812FX {  // 96 bytes
 #ifndef WLED_DISABLE_2D
       panels(1),
 #endif
-      // semi-private (just obscured) used in effect functions through macros
-      _currentPalette(CRGBPalette16(CRGB::Black)),
-      _colors_t{0,0,0},
-      _virtualSegmentLength(0),
       // true private variables
       _length(DEFAULT_LED_COUNT),
       _brightness(DEFAULT_BRIGHTNESS),
@@ -678,17 +802,40 @@ class WS2812FX {  // 96 bytes
       _targetFps(WLED_FPS),
       _frametime(FRAMETIME_FIXED),
       _cumulativeFps(2),
+      _renderTime(0),
+      _showTime(0),
       _isServicing(false),
       _isOffRefreshRequired(false),
       _hasWhiteChannel(false),
       _triggered(false),
+      _ws2815PowerModel(false),
+      _busPowerValid(false),
       _modeCount(MODE_COUNT),
+      _modeRev(0),
       _callback(nullptr),
       customMappingTable(nullptr),
       customMappingSize(0),
+      _pixels(nullptr),
+      _pixelsDirtyStart(0),
+      _pixelsDirtyEnd(0),
+      _tPool(nullptr),
+      _tPoolLen(0),
+      _busPowerMask(0),
+      _busPowerAWMask(0),
+      _busPowerAWM(0),
       _lastShow(0),
-      _segment_index(0),
-      _mainSegment(0)
+      _mainSegment(0),
+      _renderJobCount(0)
+#ifdef WLED_ENABLE_PARALLEL_RENDER
+      , _renderJobNext(0)
+      , _renderHelperTime(0)
+      , _renderHelperNow(0)
+      , _renderHelper(nullptr)
+      , _renderMain(nullptr)
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+      , _stripLock(nullptr)
+#endif
     {
       WS2812FX::instance = this;
       _mode.reserve(_modeCount);     // allocate memory to prevent initial fragmentation (does not increase size())
@@ -706,7 +853,8 @@ class WS2812FX {  // 96 bytes
       panel.clear();
 #endif
       customPalettes.clear();
-      if (useLedsArray && Segment::_globalLeds) free(Segment::_globalLeds);
+      if (_pixels) free(_pixels);
+      if (_tPool) free(_tPool);
     }
 
     static WS2812FX* getInstance(void) { return instance; }
@@ -731,6 +879,7 @@ class WS2812FX {  // 96 bytes
       makeAutoSegments(bool forceReset = false),
       fixInvalidSegments(),
       setPixelColor(int n, uint32_t c),
+      setPixelColors(int n, const uint32_t *c, uint16_t count),
       show(void),
       setTargetFps(uint8_t fps);
 
@@ -738,6 +887,8 @@ class WS2812FX {  // 96 bytes
     void fill(uint32_t c) { for (int i = 0; i < getLengthTotal(); i++) setPixelColor(i, c); } // fill whole strip with color (inline)
     void addEffect(uint8_t id, mode_ptr mode_fn, const char *mode_name); // add effect to the list; defined in FX.cpp
     void setupEffectData(void); // add default effects to the list; defined in FX.cpp
+    uint32_t *claimTransitionFrames(uint16_t len); // take block of len pixels from crossfade pool, null if it does not fit
+    void releaseTransitionFrames(uint32_t *frames);
 
     // outsmart the compiler :) by correctly overloading
     inline void setPixelColor(int n, uint8_t r, uint8_t g, uint8_t b, uint8_t w = 0) { setPixelColor(n, RGBW32(r,g,b,w)); }
@@ -745,7 +896,7 @@ class WS2812FX {  // 96 bytes
     inline void trigger(void) { _triggered = true; } // Forces the next frame to be computed on all active segments.
     inline void setShowCallback(show_callback cb) { _callback = cb; }
     inline void setTransition(uint16_t t) { _transitionDur = t; }
-    inline void appendSegment(const Segment &seg = Segment()) { _segments.push_back(seg); }
+    inline void appendSegment(const Segment &seg = Segment()) { lock(); _segments.push_back(seg); unlock(); }
 
     bool
       checkSegmentAlignment(void),
@@ -754,9 +905,18 @@ class WS2812FX {  // 96 bytes
       // return true if the strip is being sent pixel updates
       isUpdating(void),
       deserializeMap(uint8_t n=0),
-      useLedsArray = false;
+      useLedsArray = true;   // keep a frame buffer of all pixels (reads do not go through busses)
 
     inline bool isServicing(void) { return _isServicing; }
+#ifdef ARDUINO_ARCH_ESP32
+    // held by render task while running effects, other tasks changing segments or busses must hold it too (may be nested)
+    // async web handlers reading segments hold it as well (ESP8266 runs them in between loop() calls)
+    inline void lock(void)   { if (_stripLock) xSemaphoreTakeRecursive(_stripLock, portMAX_DELAY); }
+    inline void unlock(void) { if (_stripLock) xSemaphoreGiveRecursive(_stripLock); }
+#else
+    inline void lock(void)   {}
+    inline void unlock(void) {}
+#endif
     inline bool hasWhiteChannel(void) {return _hasWhiteChannel;}
     inline bool isOffRefreshRequired(void) {return _isOffRefreshRequired;}
 
@@ -773,7 +933,7 @@ class WS2812FX {  // 96 bytes
     inline uint8_t getBrightness(void) { return _brightness; }
     inline uint8_t getMaxSegments(void) { return MAX_NUM_SEGMENTS; }  // returns maximum number of supported segments (fixed value)
     inline uint8_t getSegmentsNum(void) { return _segments.size(); }  // returns currently present segments
-    inline uint8_t getCurrSegmentId(void) { return _segment_index; }
+    inline uint8_t getCurrSegmentId(void) { return renderContext().segIndex; }
     inline uint8_t getMainSegmentId(void) { return _mainSegment; }
     inline uint8_t getPaletteCount() { return 13 + GRADIENT_PALETTE_COUNT; }  // will only return built-in palette count
     inline uint8_t getTargetFps() { return _targetFps; }
@@ -794,10 +954,13 @@ class WS2812FX {  // 96 bytes
     uint32_t
       now,
       timebase,
-      getPixelColor(uint16_t);
+      getPixelColor(uint16_t),
+      getPixelColorAvg(uint16_t i, uint16_t w, uint16_t h = 1); // average of a block of pixels for live preview
 
     inline uint32_t getLastShow(void) { return _lastShow; }
-    inline uint32_t segColor(uint8_t i) { return _colors_t[i]; }
+    inline uint32_t getRenderTime(void) { return _renderTime; } // smoothed time (us) spent in effect functions per frame
+    inline uint32_t getShowTime(void) { return _showTime; }     // smoothed time (us) spent in show() per frame
+    inline uint32_t segColor(uint8_t i) { return renderContext().colors[i]; }
 
     const char *
       getModeData(uint8_t id = 0) { return (id && id<_modeCount) ? _modeData[id] : PSTR("Solid"); }
@@ -805,6 +968,8 @@ class WS2812FX {  // 96 bytes
     const char **
       getModeDataSrc(void) { return &(_modeData[0]); } // vectors use arrays for underlying data
 
+    inline uint8_t getModeRevision(void) { return _modeRev; } // changes if effects were added (i.e. by usermods)
+
     Segment&        getSegment(uint8_t id);
     inline Segment& getFirstSelectedSeg(void) { return _segments[getFirstSelectedSegId()]; }
     inline Segment& getMainSegment(void)      { return _segments[getMainSegmentId()]; }
@@ -858,13 +1023,16 @@ class WS2812FX {  // 96 bytes
   // end 2D support
 
     void loadCustomPalettes(void); // loads custom palettes from JSON
-    CRGBPalette16 _currentPalette; // palette used for current effect (includes transition)
     std::vector<CRGBPalette16> customPalettes; // TODO: move custom palettes out of WS2812FX class
 
     // using public variables to reduce code size increase due to inline function getSegment() (with bounds checking)
     // and color transitions
-    uint32_t _colors_t[3]; // color used for effect (includes transition)
-    uint16_t _virtualSegmentLength;
+    render_context_t _ctx[WLED_RENDER_CONTEXTS];
+#ifdef WLED_ENABLE_PARALLEL_RENDER
+    inline render_context_t &renderContext(void) { return _ctx[xPortGetCoreID()]; }
+#else
+    inline render_context_t &renderContext(void) { return _ctx[0]; }
+#endif
 
     std::vector<segment> _segments;
     friend class Segment;
@@ -877,6 +1045,8 @@ class WS2812FX {  // 96 bytes
     uint8_t  _targetFps;
     uint16_t _frametime;
     uint16_t _cumulativeFps;
+    uint32_t _renderTime;
+    uint32_t _showTime;
 
     // will require only 1 byte
     struct {
@@ -884,9 +1054,12 @@ class WS2812FX {  // 96 bytes
       bool _isOffRefreshRequired : 1; //periodic refresh is required for the strip to remain off.
       bool _hasWhiteChannel      : 1;
       bool _triggered            : 1;
+      bool _ws2815PowerModel     : 1; // power model used for _busPowerSum[]
+      bool _busPowerValid        : 1; // _busPowerSum[] is valid for busses without changed pixels
     };
 
     uint8_t                  _modeCount;
+    uint8_t                  _modeRev;  // incremented whenever an effect is added
     std::vector<mode_ptr>    _mode;     // SRAM footprint: 4 bytes per element
     std::vector<const char*> _modeData; // mode (effect) name and its slider control data array
 
@@ -895,16 +1068,86 @@ class WS2812FX {  // 96 bytes
     uint16_t* customMappingTable;
     uint16_t  customMappingSize;
 
+    // frame buffer holding colors of all physical pixels as set by segments (before bus color order and brightness)
+    uint32_t* _pixels;
+    uint16_t  _pixelsDirtyStart; // range of pixels changed since last show()
+    uint16_t  _pixelsDirtyEnd;
+    // pool of scratch frame buffers for effect crossfades (MAX_TRANSITION_DATA), one block per transitioning segment,
+    // allocated while blocks are claimed
+    uint32_t* _tPool;
+    uint16_t  _tPoolLen; // in pixels
+    struct { uint16_t start, len; } _tPoolClaims[MAX_NUM_SEGMENTS];
+    uint32_t  _busPowerSum[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES]; // channel sum of each physical bus
+    uint16_t  _busPowerMask;   // physical busses included in power calculation
+    uint16_t  _busPowerAWMask; // busses with white channel (auto white calculation and RGBW correction)
+    uint8_t   _busPowerAWM;    // global auto white mode used for _busPowerSum[]
+
+    inline void markDirty(uint16_t i) {
+      if (i <  _pixelsDirtyStart) _pixelsDirtyStart = i;
+      if (i >= _pixelsDirtyEnd)   _pixelsDirtyEnd   = i + 1;
+    }
+
+    // copy a run of pixels between frame buffer and a scratch buffer without updating busses (effect crossfade)
+    void readPixels(int i, uint32_t *c, uint16_t count);
+    void loadPixels(int i, const uint32_t *c, uint16_t count);
+    void freeUnusedTransitionPool(void);
+
     uint32_t _lastShow;
 
-    uint8_t _segment_index;
     uint8_t _mainSegment;
 
+    // segments to be rendered in current frame (run by service())
+    uint8_t _renderJobs[MAX_NUM_SEGMENTS];
+    uint8_t _renderJobCount;
+#ifdef WLED_ENABLE_PARALLEL_RENDER
+    volatile uint8_t _renderJobNext;    // next job to be taken by either core
+    uint32_t         _renderHelperTime; // time spent in effects by helper task
+    uint32_t         _renderHelperNow;  // millis() of current frame for helper task
+    TaskHandle_t     _renderHelper;     // task rendering segments on the other core
+    TaskHandle_t     _renderMain;       // task running service() (waiting for helper)
+
+    static void renderHelperTask(void *parameter);
+    int  nextRenderJob(void);
+    bool canRenderInParallel(void);
+#endif
+
+#ifdef ARDUINO_ARCH_ESP32
+    SemaphoreHandle_t _stripLock; // recursive mutex, see lock()
+#endif
+
     void
       estimateCurrentAndLimitBri(void);
+
+    uint32_t
+      calcBusPower(uint8_t bNum),
+      renderSegment(uint8_t id, uint32_t nowUp),
+      renderJobs(uint32_t nowUp);
 };
 
 extern const char JSON_mode_names[];
 extern const char JSON_palette_names[];
 
+// escape time of the fractal kernel used by Julia and Mandelbrot (Q16 arguments, Q8 smoothed result)
+uint16_t fractalEscape(int32_t a, int32_t b, int32_t cRe, int32_t cIm, uint8_t maxIter);
+
+// FastLED keeps a single PRNG state (rand16seed). With parallel rendering both cores would change it at the same
+// time and results would depend on which segment is rendered first, so random numbers come from the render
+// context of the calling core instead. It holds the state of the segment being rendered (Segment::randSeed).
+// Same algorithm as FastLED lib8tion.
+inline uint16_t &fx_random_seed() { return WS2812FX::getInstance()->renderContext().randSeed; }
+inline uint16_t fx_random16() { uint16_t &s = fx_random_seed(); s = (s * FASTLED_RAND16_2053) + FASTLED_RAND16_13849; return s; }
+inline uint16_t fx_random16(uint16_t lim) { return ((uint32_t)fx_random16() * lim) >> 16; }
+inline uint16_t fx_random16(uint16_t min, uint16_t lim) { return fx_random16(lim - min) + min; }
+inline uint8_t  fx_random8() { uint16_t s = fx_random16(); return (uint8_t)(s & 0xFF) + (uint8_t)(s >> 8); }
+inline uint8_t  fx_random8(uint8_t lim) { return (fx_random8() * lim) >> 8; }
+inline uint8_t  fx_random8(uint8_t min, uint8_t lim) { return fx_random8(lim - min) + min; }
+inline uint16_t fx_random16_get_seed() { return fx_random_seed(); }
+inline void     fx_random16_set_seed(uint16_t seed) { fx_random_seed() = seed; }
+inline void     fx_random16_add_entropy(uint16_t entropy) { fx_random_seed() += entropy; }
+#define random8              fx_random8
+#define random16             fx_random16
+#define random16_get_seed    fx_random16_get_seed
+#define random16_set_seed    fx_random16_set_seed
+#define random16_add_entropy fx_random16_add_entropy
+
 #endif
@@ -166,6 +166,8 @@ void /*IRAM_ATTR*/ WS2812FX::setPixelColorXY(int x, int y, uint32_t col)
 #endif
   if (index < customMappingSize) index = customMappingTable[index];
   if (index >= _length) return;
+  if (_pixels) _pixels[index] = col;
+  markDirty(index);
   busses.setPixelColor(index, col);
 }
 
@@ -178,6 +180,7 @@ uint32_t WS2812FX::getPixelColorXY(uint16_t x, uint16_t y) {
 #endif
   if (index < customMappingSize) index = customMappingTable[index];
   if (index >= _length) return 0;
+  if (_pixels) return _pixels[index];
   return busses.getPixelColor(index);
 }
 
@@ -241,6 +244,39 @@ void /*IRAM_ATTR*/ Segment::setPixelColorXY(int x, int y, uint32_t col)
   }
 }
 
+// sets a horizontal run of count pixels starting at x,y
+// rows of segments without grouping, mirroring, reversing or transposition are passed down at once
+void Segment::setPixelColorsXY(int x, int y, const uint32_t *c, uint16_t count)
+{
+  if (Segment::maxHeight==1) return; // not a matrix set-up
+  const uint16_t vW = virtualWidth();
+  if (x >= vW || y >= virtualHeight() || x<0 || y<0) return;  // if run would start out of virtual segment just exit
+  if (x + count > vW) count = vW - x;
+
+  if (groupLength() != 1 || reverse || transpose || mirror || mirror_y) {
+    for (uint16_t j = 0; j < count; j++) setPixelColorXY(x + j, y, c[j]);
+    return;
+  }
+
+  if (leds) for (uint16_t j = 0; j < count; j++) leds[XY(x + j, y)] = c[j];
+
+  uint8_t _bri_t = currentBri(on ? opacity : 0);
+  if (!_bri_t && !transitional) return;
+
+  if (reverse_y) y = virtualHeight() - y - 1;
+  uint32_t span[PIXEL_SPAN_LEN];
+  while (count) {
+    uint16_t n = count > PIXEL_SPAN_LEN ? PIXEL_SPAN_LEN : count;
+    for (uint16_t j = 0; j < n; j++) {
+      uint32_t col = c[j];
+      if (_bri_t < 255) col = RGBW32(scale8(R(col), _bri_t), scale8(G(col), _bri_t), scale8(B(col), _bri_t), scale8(W(col), _bri_t));
+      span[j] = col;
+    }
+    strip.setPixelColors((startY + y) * Segment::maxWidth + start + x, span, n);
+    x += n; c += n; count -= n;
+  }
+}
+
 // anti-aliased version of setPixelColorXY()
 void Segment::setPixelColorXY(float x, float y, uint32_t col, bool aa)
 {
@@ -313,29 +349,60 @@ void Segment::fadePixelColorXY(uint16_t x, uint16_t y, uint8_t fade) {
   setPixelColorXY(x, y, pix);
 }
 
+// line helpers for blur and move: a row or column is read into a buffer once, processed and written back once
+// (rows are written as a run, see setPixelColorsXY())
+// the buffer is on the stack, lines longer than the matrix (invalid segment dimensions) are not processed
+static inline bool lineFits(uint16_t len) {
+  return len <= MAX(Segment::maxWidth, Segment::maxHeight);
+}
+
+static void getLineXY(Segment &seg, uint16_t i, bool vertical, uint32_t *line, uint16_t len) {
+  for (uint16_t j = 0; j < len; j++) line[j] = vertical ? seg.getPixelColorXY(i, j) : seg.getPixelColorXY(j, i);
+}
+
+static void setLineXY(Segment &seg, uint16_t i, bool vertical, const uint32_t *line, uint16_t from, uint16_t count) {
+  if (!vertical) seg.setPixelColorsXY(from, i, line + from, count);
+  else for (uint16_t j = from; j < from + count; j++) seg.setPixelColorXY(i, j, line[j]);
+}
+
+// scale8() of R, G and B at once (W is dropped like CRGB conversion does)
+static inline uint32_t scaleRGB(uint32_t c, uint8_t scale) {
+  const uint32_t s = scale + 1;
+  return ((((c & 0xFF00FF) * s) >> 8) & 0xFF00FF) | ((((c & 0x00FF00) * s) >> 8) & 0x00FF00);
+}
+
+// qadd8() of R, G and B at once
+static inline uint32_t qaddRGB(uint32_t a, uint32_t b) {
+  uint32_t rb = (a & 0xFF00FF) + (b & 0xFF00FF);
+  uint32_t g  = (a & 0x00FF00) + (b & 0x00FF00);
+  rb |= (rb & 0x1000100) - ((rb & 0x1000100) >> 8); // saturate lanes that overflowed
+  g  |= (g & 0x10000) - ((g & 0x10000) >> 8);
+  return (rb & 0xFF00FF) | (g & 0x00FF00);
+}
+
+// blur a line of pixels, same as FastLED blurRows(): pixel keeps 255-blur_amount, spreads blur_amount/2 to each neighbour
+static void blurLine(uint32_t *line, uint16_t len, fract8 blur_amount) {
+  const uint8_t keep = 255 - blur_amount;
+  const uint8_t seep = blur_amount >> 1;
+  uint32_t carryover = 0;
+  for (uint16_t j = 0; j < len; j++) {
+    uint32_t part = scaleRGB(line[j], seep);
+    if (j) line[j-1] = qaddRGB(line[j-1], part);
+    line[j] = qaddRGB(scaleRGB(line[j], keep), carryover);
+    carryover = part;
+  }
+}
+
 // blurRow: perform a blur on a row of a rectangular matrix
 void Segment::blurRow(uint16_t row, fract8 blur_amount) {
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
 
-  if (row >= rows) return;
-  // blur one row
-  uint8_t keep = 255 - blur_amount;
-  uint8_t seep = blur_amount >> 1;
-  CRGB carryover = CRGB::Black;
-  for (uint16_t x = 0; x < cols; x++) {
-    CRGB cur = getPixelColorXY(x, row);
-    CRGB part = cur;
-    part.nscale8(seep);
-    cur.nscale8(keep);
-    cur += carryover;
-    if (x) {
-      CRGB prev = CRGB(getPixelColorXY(x-1, row)) + part;
-      setPixelColorXY(x-1, row, prev);
-    }
-    setPixelColorXY(x, row, cur);
-    carryover = part;
-  }
+  if (row >= rows || !lineFits(cols)) return;
+  uint32_t line[cols];
+  getLineXY(*this, row, false, line, cols);
+  blurLine(line, cols, blur_amount);
+  setLineXY(*this, row, false, line, 0, cols);
 }
 
 // blurCol: perform a blur on a column of a rectangular matrix
@@ -343,24 +410,11 @@ void Segment::blurCol(uint16_t col, fract8 blur_amount) {
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
 
-  if (col >= cols) return;
-  // blur one column
-  uint8_t keep = 255 - blur_amount;
-  uint8_t seep = blur_amount >> 1;
-  CRGB carryover = CRGB::Black;
-  for (uint16_t i = 0; i < rows; i++) {
-    CRGB cur = getPixelColorXY(col, i);
-    CRGB part = cur;
-    part.nscale8(seep);
-    cur.nscale8(keep);
-    cur += carryover;
-    if (i) {
-      CRGB prev = CRGB(getPixelColorXY(col, i-1)) + part;
-      setPixelColorXY(col, i-1, prev);
-    }
-    setPixelColorXY(col, i, cur);
-    carryover = part;
-  }
+  if (col >= cols || !lineFits(rows)) return;
+  uint32_t line[rows];
+  getLineXY(*this, col, true, line, rows);
+  blurLine(line, rows, blur_amount);
+  setLineXY(*this, col, true, line, 0, rows);
 }
 
 // 1D Box blur (with added weight - blur_amount: [0=no blur, 255=max blur])
@@ -369,32 +423,23 @@ void Segment::box_blur(uint16_t i, bool vertical, fract8 blur_amount) {
   const uint16_t rows = virtualHeight();
   const uint16_t dim1 = vertical ? rows : cols;
   const uint16_t dim2 = vertical ? cols : rows;
-  if (i >= dim2) return;
-  const float seep = blur_amount/255.f;
-  const float keep = 3.f - 2.f*seep;
-  // 1D box blur
-  CRGB tmp[dim1];
+  if (i >= dim2 || !lineFits(dim1)) return;
+  // each channel: (curr*(3-2*seep) + (prev+next)*seep) / 3 with seep = blur_amount/255, pixels outside are black
+  const uint32_t seep = blur_amount;
+  const uint32_t keep = 765 - 2*seep;
+  uint32_t line[dim1];
+  getLineXY(*this, i, vertical, line, dim1);
+  uint32_t prev = 0;
   for (uint16_t j = 0; j < dim1; j++) {
-    uint16_t x = vertical ? i : j;
-    uint16_t y = vertical ? j : i;
-    uint16_t xp = vertical ? x : x-1;
-    uint16_t yp = vertical ? y-1 : y;
-    uint16_t xn = vertical ? x : x+1;
-    uint16_t yn = vertical ? y+1 : y;
-    CRGB curr = getPixelColorXY(x,y);
-    CRGB prev = (xp<0 || yp<0) ? CRGB::Black : getPixelColorXY(xp,yp);
-    CRGB next = ((vertical && yn>=dim1) || (!vertical && xn>=dim1)) ? CRGB::Black : getPixelColorXY(xn,yn);
-    uint16_t r, g, b;
-    r = (curr.r*keep + (prev.r + next.r)*seep) / 3;
-    g = (curr.g*keep + (prev.g + next.g)*seep) / 3;
-    b = (curr.b*keep + (prev.b + next.b)*seep) / 3;
-    tmp[j] = CRGB(r,g,b);
-  }
-  for (uint16_t j = 0; j < dim1; j++) {
-    uint16_t x = vertical ? i : j;
-    uint16_t y = vertical ? j : i;
-    setPixelColorXY(x, y, tmp[j]);
+    uint32_t curr = line[j];
+    uint32_t next = j+1 < dim1 ? line[j+1] : 0;
+    uint8_t r = (R(curr)*keep + (R(prev) + R(next))*seep) / 765;
+    uint8_t g = (G(curr)*keep + (G(prev) + G(next))*seep) / 765;
+    uint8_t b = (B(curr)*keep + (B(prev) + B(next))*seep) / 765;
+    line[j] = RGBW32(r, g, b, 0);
+    prev = curr;
   }
+  setLineXY(*this, i, vertical, line, 0, dim1);
 }
 
 // blur1d: one-dimensional blur filter. Spreads light to 2 line neighbors.
@@ -416,38 +461,30 @@ void Segment::blur1d(fract8 blur_amount) {
   for (uint16_t y = 0; y < rows; y++) blurRow(y, blur_amount);
 }
 
+// shifts a line by delta pixels (towards index 0 if positive), pixels moved out of the line are lost
+// and vacated pixels keep their color
+static void moveLine(Segment &seg, uint16_t i, bool vertical, uint16_t len, int8_t delta) {
+  uint16_t d = abs(delta);
+  if (d >= len || !lineFits(len)) return;
+  uint32_t line[len];
+  getLineXY(seg, i, vertical, line, len);
+  if (delta > 0) memmove(line, line + d, (len - d) * sizeof(uint32_t));
+  else           memmove(line + d, line, (len - d) * sizeof(uint32_t));
+  setLineXY(seg, i, vertical, line, delta > 0 ? 0 : d, len - d);
+}
+
 void Segment::moveX(int8_t delta) {
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
   if (!delta) return;
-  if (delta > 0) {
-    for (uint8_t y = 0; y < rows; y++) for (uint8_t x = 0; x < cols-1; x++) {
-      if (x + delta >= cols) break;
-      setPixelColorXY(x, y, getPixelColorXY((x + delta)%cols, y));
-    }
-  } else {
-    for (uint8_t y = 0; y < rows; y++) for (int16_t x = cols-1; x >= 0; x--) {
-      if (x + delta < 0) break;
-      setPixelColorXY(x, y, getPixelColorXY(x + delta, y));
-    }
-  }
+  for (uint16_t y = 0; y < rows; y++) moveLine(*this, y, false, cols, delta);
 }
 
 void Segment::moveY(int8_t delta) {
   const uint16_t cols = virtualWidth();
   const uint16_t rows = virtualHeight();
   if (!delta) return;
-  if (delta > 0) {
-    for (uint8_t x = 0; x < cols; x++) for (uint8_t y = 0; y < rows-1; y++) {
-      if (y + delta >= rows) break;
-      setPixelColorXY(x, y, getPixelColorXY(x, (y + delta)));
-    }
-  } else {
-    for (uint8_t x = 0; x < cols; x++) for (int16_t y = rows-1; y >= 0; y--) {
-      if (y + delta < 0) break;
-      setPixelColorXY(x, y, getPixelColorXY(x, y + delta));
-    }
-  }
+  for (uint16_t x = 0; x < cols; x++) moveLine(*this, x, true, rows, delta);
 }
 
 // move() - move all pixels in desired direction delta number of pixels
@@ -69,14 +69,51 @@
   #error "Max segments must be at least max number of busses!"
 #endif
 
+#ifdef WLED_ENABLE_PARALLEL_RENDER
+// segments may be rendered on both cores, guards render job list and segment data accounting
+static portMUX_TYPE renderMux = portMUX_INITIALIZER_UNLOCKED;
+#define SEGDATA_LOCK()   portENTER_CRITICAL(&renderMux)
+#define SEGDATA_UNLOCK() portEXIT_CRITICAL(&renderMux)
+#else
+#define SEGDATA_LOCK()
+#define SEGDATA_UNLOCK()
+#endif
+
+#ifdef ARDUINO_ARCH_ESP32
+// arena block headers are changed from both cores (segment copies made by async web handlers, parallel render)
+// blocks are only moved by compactArena() under strip lock, which segment copies and segment list changes hold too
+static portMUX_TYPE arenaMux = portMUX_INITIALIZER_UNLOCKED;
+#define ARENA_LOCK()   portENTER_CRITICAL(&arenaMux)
+#define ARENA_UNLOCK() portEXIT_CRITICAL(&arenaMux)
+#else
+#define ARENA_LOCK()
+#define ARENA_UNLOCK()
+#endif
+
+// segment data arena block header, size of payload is a multiple of 4
+typedef struct {
+  uint16_t size;
+  uint16_t used;
+} arena_block_t;
+
+#define ARENA_HDR sizeof(arena_block_t)
+#define ARENA_BLOCK(pos) ((arena_block_t*)(Segment::_arena + (pos)))
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Segment class implementation
 ///////////////////////////////////////////////////////////////////////////////
 uint16_t Segment::_usedSegmentData = 0U; // amount of RAM all segments use for their data[]
-CRGB    *Segment::_globalLeds = nullptr;
 uint16_t Segment::maxWidth = DEFAULT_LED_COUNT;
 uint16_t Segment::maxHeight = 1;
+byte    *Segment::_arena = nullptr;
+uint16_t Segment::_arenaTop = 0;
+uint16_t Segment::_arenaUsed = 0;
+uint16_t Segment::_arenaPeak = 0;
+uint16_t Segment::_arenaHeapAllocs = 0;
+uint16_t Segment::_arenaCompactions = 0;
+bool     Segment::_arenaCompact = false;
+volatile bool Segment::_arenaCompacting = false;
 
 // copy constructor
 Segment::Segment(const Segment &orig) {
@@ -86,11 +123,15 @@ Segment::Segment(const Segment &orig) {
   data = nullptr;
   _dataLen = 0;
   _t = nullptr;
-  if (leds && !Segment::_globalLeds) leds = nullptr;
+  _pixMap = nullptr;
+  _palCache = nullptr;
+  leds = nullptr;
   if (orig.name) { name = new char[strlen(orig.name)+1]; if (name) strcpy(name, orig.name); }
+  strip.lock(); // orig.data and orig.leds must not be moved by compactArena() while copied
   if (orig.data) { if (allocateData(orig._dataLen)) memcpy(data, orig.data, orig._dataLen); }
+  if (orig.leds) { leds = (CRGB*)arenaAlloc(sizeof(CRGB)*length()); if (leds) memcpy(leds, orig.leds, sizeof(CRGB)*length()); }
+  strip.unlock();
   if (orig._t)   { _t = new Transition(orig._t->_dur, orig._t->_briT, orig._t->_cctT, orig._t->_colorT); }
-  if (orig.leds && !Segment::_globalLeds) { leds = (CRGB*)malloc(sizeof(CRGB)*length()); if (leds) memcpy(leds, orig.leds, sizeof(CRGB)*length()); }
 }
 
 // move constructor
@@ -102,6 +143,8 @@ Segment::Segment(Segment &&orig) noexcept {
   orig._dataLen = 0;
   orig._t   = nullptr;
   orig.leds = nullptr;
+  orig._pixMap = nullptr;
+  orig._palCache = nullptr;
 }
 
 // copy assignment
@@ -111,7 +154,9 @@ Segment& Segment::operator= (const Segment &orig) {
     // clean destination
     if (name) delete[] name;
     if (_t)   delete _t;
-    if (leds && !Segment::_globalLeds) free(leds);
+    if (leds) arenaFree(leds);
+    if (_pixMap) free(_pixMap);
+    if (_palCache) free(_palCache);
     deallocateData();
     // copy source
     memcpy((void*)this, (void*)&orig, sizeof(Segment));
@@ -120,12 +165,16 @@ Segment& Segment::operator= (const Segment &orig) {
     data = nullptr;
     _dataLen = 0;
     _t = nullptr;
-    if (!Segment::_globalLeds) leds = nullptr;
+    _pixMap = nullptr;
+    _palCache = nullptr;
+    leds = nullptr;
     // copy source data
     if (orig.name) { name = new char[strlen(orig.name)+1]; if (name) strcpy(name, orig.name); }
+    strip.lock(); // see copy constructor
     if (orig.data) { if (allocateData(orig._dataLen)) memcpy(data, orig.data, orig._dataLen); }
+    if (orig.leds) { leds = (CRGB*)arenaAlloc(sizeof(CRGB)*length()); if (leds) memcpy(leds, orig.leds, sizeof(CRGB)*length()); }
+    strip.unlock();
     if (orig._t)   { _t = new Transition(orig._t->_dur, orig._t->_briT, orig._t->_cctT, orig._t->_colorT); }
-    if (orig.leds && !Segment::_globalLeds) { leds = (CRGB*)malloc(sizeof(CRGB)*length()); if (leds) memcpy(leds, orig.leds, sizeof(CRGB)*length()); }
   }
   return *this;
 }
@@ -137,13 +186,17 @@ Segment& Segment::operator= (Segment &&orig) noexcept {
     if (name) delete[] name; // free old name
     deallocateData(); // free old runtime data
     if (_t) delete _t;
-    if (leds && !Segment::_globalLeds) free(leds);
+    if (leds) arenaFree(leds);
+    if (_pixMap) free(_pixMap);
+    if (_palCache) free(_palCache);
     memcpy((void*)this, (void*)&orig, sizeof(Segment));
     orig.name = nullptr;
     orig.data = nullptr;
     orig._dataLen = 0;
     orig._t   = nullptr;
     orig.leds = nullptr;
+    orig._pixMap = nullptr;
+    orig._palCache = nullptr;
   }
   return *this;
 }
@@ -151,16 +204,18 @@ Segment& Segment::operator= (Segment &&orig) noexcept {
 bool Segment::allocateData(size_t len) {
   if (data && _dataLen == len) return true; //already allocated
   deallocateData();
-  if (Segment::getUsedSegmentData() + len > MAX_SEGMENT_DATA) return false; //not enough memory
-  // if possible use SPI RAM on ESP32
-  #if defined(ARDUINO_ARCH_ESP32) && defined(WLED_USE_PSRAM)
-  if (psramFound())
-    data = (byte*) ps_malloc(len);
-  else
-  #endif
-    data = (byte*) malloc(len);
-  if (!data) return false; //allocation failed
-  Segment::addUsedSegmentData(len);
+  SEGDATA_LOCK();
+  bool enough = Segment::getUsedSegmentData() + len <= MAX_SEGMENT_DATA;
+  if (enough) Segment::addUsedSegmentData(len); // reserve (released if allocation fails)
+  SEGDATA_UNLOCK();
+  if (!enough) return false; //not enough memory
+  data = arenaAlloc(len);
+  if (!data) { //allocation failed
+    SEGDATA_LOCK();
+    Segment::addUsedSegmentData(-len);
+    SEGDATA_UNLOCK();
+    return false;
+  }
   _dataLen = len;
   memset(data, 0, len);
   return true;
@@ -168,12 +223,179 @@ bool Segment::allocateData(size_t len) {
 
 void Segment::deallocateData() {
   if (!data) return;
-  free(data);
+  arenaFree(data);
   data = nullptr;
+  SEGDATA_LOCK();
   Segment::addUsedSegmentData(-_dataLen);
+  SEGDATA_UNLOCK();
   _dataLen = 0;
 }
 
+/*
+ * Segment data arena (if SEGMENT_ARENA_SIZE is set): runtime data and leds[] of all segments live in a single
+ * block allocated at boot.
+ * Blocks are taken first fit (or from the end), freed blocks are merged with free neighbours and holes
+ * are removed by compactArena() between frames (see service()), which moves the blocks and updates
+ * pointers of the segments owning them. Blocks whose owner is not a segment of the strip (temporary
+ * segment copies) are left in place.
+ */
+void Segment::initArena() {
+  if (_arena || !SEGMENT_ARENA_SIZE) return;
+  #if defined(ARDUINO_ARCH_ESP32) && defined(WLED_USE_PSRAM)
+  if (psramFound())
+    _arena = (byte*) ps_malloc(SEGMENT_ARENA_SIZE);
+  else
+  #endif
+    _arena = (byte*) malloc(SEGMENT_ARENA_SIZE);
+  _arenaTop = _arenaUsed = 0;
+  if (!_arena) DEBUG_PRINTLN(F("Segment arena alloc error."));
+}
+
+byte *Segment::arenaAlloc(size_t len) {
+  byte *p = nullptr;
+  uint16_t need = (len + 3) & ~3U;
+  if (_arena && len && need + ARENA_HDR <= SEGMENT_ARENA_SIZE) {
+    ARENA_LOCK();
+    for (uint16_t pos = 0; pos < _arenaTop && !_arenaCompacting; pos += ARENA_HDR + ARENA_BLOCK(pos)->size) {
+      arena_block_t *b = ARENA_BLOCK(pos);
+      if (b->used || b->size < need) continue;
+      if (b->size >= need + ARENA_HDR + 4) { // split, remainder stays free
+        arena_block_t *r = ARENA_BLOCK(pos + ARENA_HDR + need);
+        r->size = b->size - need - ARENA_HDR;
+        r->used = 0;
+        b->size = need;
+      }
+      b->used = 1;
+      p = (byte*)b + ARENA_HDR;
+      break;
+    }
+    if (!p && !_arenaCompacting && _arenaTop + ARENA_HDR + need <= SEGMENT_ARENA_SIZE) {
+      arena_block_t *b = ARENA_BLOCK(_arenaTop);
+      b->size = need;
+      b->used = 1;
+      p = (byte*)b + ARENA_HDR;
+      _arenaTop += ARENA_HDR + need;
+    }
+    if (p) {
+      _arenaUsed += ARENA_HDR + ((arena_block_t*)(p - ARENA_HDR))->size;
+      if (_arenaUsed > _arenaPeak) _arenaPeak = _arenaUsed;
+    }
+    ARENA_UNLOCK();
+    if (p) return p;
+  }
+  // if possible use SPI RAM on ESP32
+  #if defined(ARDUINO_ARCH_ESP32) && defined(WLED_USE_PSRAM)
+  if (psramFound())
+    p = (byte*) ps_malloc(len);
+  else
+  #endif
+    p = (byte*) malloc(len);
+  if (p && _arena) _arenaHeapAllocs++;
+  return p;
+}
+
+void Segment::arenaFree(void *p) {
+  if (!p) return;
+  if (!inArena(p)) { free(p); return; }
+  ARENA_LOCK();
+  arena_block_t *b = (arena_block_t*)((byte*)p - ARENA_HDR);
+  b->used = 0;
+  _arenaUsed -= ARENA_HDR + b->size;
+  if (_arenaCompacting) { _arenaCompact = true; ARENA_UNLOCK(); return; } // merged by next compaction
+  // merge free neighbours, free space at the end is returned to the top
+  int freePos = -1;
+  for (uint16_t pos = 0; pos < _arenaTop; ) {
+    b = ARENA_BLOCK(pos);
+    if (!b->used && freePos >= 0) {
+      ARENA_BLOCK(freePos)->size += ARENA_HDR + b->size;
+      pos = freePos + ARENA_HDR + ARENA_BLOCK(freePos)->size;
+      continue;
+    }
+    freePos = b->used ? -1 : pos;
+    pos += ARENA_HDR + b->size;
+  }
+  if (freePos >= 0) _arenaTop = freePos;
+  // any free block left is a hole
+  for (uint16_t pos = 0; pos < _arenaTop && !_arenaCompact; pos += ARENA_HDR + ARENA_BLOCK(pos)->size) {
+    if (!ARENA_BLOCK(pos)->used) _arenaCompact = true;
+  }
+  ARENA_UNLOCK();
+}
+
+void Segment::compactArena() {
+  if (!_arena || !_arenaCompact) return;
+  // points segment (or its previous effect) owning a block to new location of the block
+  auto relocate = [](byte *from, byte *to) -> bool {
+    for (segment &seg : strip._segments) {
+      if      (seg.data == from)                       seg.data = to;
+      else if ((byte*)seg.leds == from)                seg.leds = (CRGB*)to;
+      else if (seg._t && seg._t->_data == from)        seg._t->_data = to;
+      else if (seg._t && (byte*)seg._t->_leds == from) seg._t->_leds = (CRGB*)to;
+      else continue;
+      return true;
+    }
+    return false;
+  };
+  // blocks are moved outside of the critical section, while moving arenaAlloc() uses heap and arenaFree() only marks blocks
+  strip.lock();
+  ARENA_LOCK();
+  _arenaCompacting = true;
+  _arenaCompact = false; // set again by blocks freed meanwhile, holes left by unknown owners are compacted once they are freed
+  uint16_t top = _arenaTop;
+  ARENA_UNLOCK();
+  uint16_t dst = 0; // where next used block goes
+  for (uint16_t pos = 0; pos < top; ) {
+    ARENA_LOCK();
+    arena_block_t *b = ARENA_BLOCK(pos);
+    uint16_t blockLen = ARENA_HDR + b->size;
+    bool used = b->used;
+    ARENA_UNLOCK();
+    if (!used) { pos += blockLen; continue; }
+    if (dst != pos) {
+      if (relocate((byte*)b + ARENA_HDR, _arena + dst + ARENA_HDR)) memmove(_arena + dst, b, blockLen);
+      else {
+        // owner unknown, block stays and space before it becomes a free block
+        ARENA_LOCK();
+        ARENA_BLOCK(dst)->size = pos - dst - ARENA_HDR;
+        ARENA_BLOCK(dst)->used = 0;
+        ARENA_UNLOCK();
+        dst = pos;
+      }
+    }
+    dst += blockLen;
+    pos += blockLen;
+  }
+  ARENA_LOCK();
+  _arenaTop = dst;
+  _arenaCompacting = false;
+  _arenaCompactions++;
+  ARENA_UNLOCK();
+  strip.unlock();
+}
+
+uint16_t Segment::getArenaLargestFree() {
+  if (!_arena || _arenaCompacting) return 0;
+  ARENA_LOCK();
+  uint16_t largest = SEGMENT_ARENA_SIZE - _arenaTop >= ARENA_HDR ? SEGMENT_ARENA_SIZE - _arenaTop - ARENA_HDR : 0;
+  for (uint16_t pos = 0; pos < _arenaTop; pos += ARENA_HDR + ARENA_BLOCK(pos)->size) {
+    if (!ARENA_BLOCK(pos)->used && ARENA_BLOCK(pos)->size > largest) largest = ARENA_BLOCK(pos)->size;
+  }
+  ARENA_UNLOCK();
+  return largest;
+}
+
+// frees runtime data of previous effect kept for crossfade
+Segment::Transition::~Transition() {
+  if (_data) {
+    arenaFree(_data);
+    SEGDATA_LOCK();
+    Segment::addUsedSegmentData(-_dataLen);
+    SEGDATA_UNLOCK();
+  }
+  if (_leds) arenaFree(_leds);
+  if (_frames) strip.releaseTransitionFrames(_frames);
+}
+
 /**
   * If reset of this segment was requested, clears runtime
   * settings of this segment.
@@ -183,29 +405,160 @@ void Segment::deallocateData() {
   */
 void Segment::resetIfRequired() {
   if (reset) {
-    if (leds && !Segment::_globalLeds) { free(leds); leds = nullptr; }
+    if (leds) { arenaFree(leds); leds = nullptr; }
     if (transitional && _t) { transitional = false; delete _t; _t = nullptr; }
     deallocateData();
     next_time = 0; step = 0; call = 0; aux0 = 0; aux1 = 0;
+    randSeed = random16();
     reset = false; // setOption(SEG_OPTION_RESET, false);
   }
 }
 
 void Segment::setUpLeds() {
   // deallocation happens in resetIfRequired() as it is called when segment changes or in destructor
-  if (Segment::_globalLeds)
-    #ifndef WLED_DISABLE_2D
-    leds = &Segment::_globalLeds[start + startY*Segment::maxWidth];
-    #else
-    leds = &Segment::_globalLeds[start];
-    #endif
-  else if (!leds) {
-    #if defined(ARDUINO_ARCH_ESP32) && defined(WLED_USE_PSRAM)
-    if (psramFound())
-      leds = (CRGB*)ps_malloc(sizeof(CRGB)*length());
-    else
-    #endif
-      leds = (CRGB*)malloc(sizeof(CRGB)*length());
+  if (!leds) leds = (CRGB*)arenaAlloc(sizeof(CRGB)*length());
+}
+
+#ifndef WLED_DISABLE_2D
+/*
+ * Expands virtual pixel i of a 1D effect into (x,y) targets for M12_pArc and M12_pCorner mappings.
+ * Only targets within vW x vH are returned (consecutive duplicates are skipped), packed as y*vW+x.
+ * Stores up to maxOut targets into out (if not null) and returns number of targets stored (or found if out is null).
+ */
+static uint16_t expand1D2D(uint8_t map1D2D, int i, uint16_t vW, uint16_t vH, uint16_t *out, uint16_t maxOut) {
+  uint16_t cnt = 0;
+  int px = -1, py = -1;
+  // returns true once out is full
+  auto add = [&](int x, int y) -> bool {
+    if (x >= vW || y >= vH || (x == px && y == py)) return false;
+    px = x; py = y;
+    if (out) out[cnt] = y * vW + x;
+    return (++cnt >= maxOut && out);
+  };
+  switch (map1D2D) {
+    case M12_pArc:
+      // expand in circular fashion from center
+      if (i==0) add(0, 0);
+      else {
+        float step = HALF_PI / (2.85f*i);
+        for (float rad = 0.0f; rad <= HALF_PI+step/2; rad += step) {
+          if (add(roundf(sin_t(rad) * i), roundf(cos_t(rad) * i))) break;
+        }
+      }
+      break;
+    case M12_pCorner:
+      for (int x = 0; x <= i; x++) if (add(x, i)) return cnt;
+      for (int y = 0; y <  i; y++) if (add(i, y)) return cnt;
+      break;
+  }
+  return cnt;
+}
+
+/*
+ * Builds expansion map of a 2D segment using Arc or Corner 1D mapping (called from updatePixelMap()).
+ */
+Segment::PixelMap *Segment::build1D2DMap(uint8_t map1D2D, uint16_t vW, uint16_t vH, uint16_t vLen) {
+  uint32_t targets = 0;
+  for (int i = 0; i < vLen; i++) targets += expand1D2D(map1D2D, i, vW, vH, nullptr, 0);
+  uint32_t size = vLen + 1 + targets;
+  if (size > UINT16_MAX) return nullptr;
+  PixelMap *map = (PixelMap*)malloc(sizeof(PixelMap) + sizeof(uint16_t) * size);
+  if (!map) return nullptr;
+  memset(map, 0, sizeof(PixelMap));
+  map->len     = vLen;
+  map->width   = vW;
+  map->height  = vH;
+  map->size    = size;
+  map->map1D2D = map1D2D;
+  uint16_t *offs = map->indices();
+  uint16_t *xy   = offs + vLen + 1;
+  uint16_t n = 0;
+  for (int i = 0; i < vLen; i++) {
+    offs[i] = n;
+    n += expand1D2D(map1D2D, i, vW, vH, xy + n, targets - n);
+  }
+  offs[vLen] = n;
+  return map;
+}
+#endif
+
+/*
+ * Builds the map of physical pixel indices for each logical pixel of a 1D segment, so setPixelColor()
+ * does not need to expand grouping, spacing, mirror, reverse and offset on each call.
+ * For 2D segments with Arc or Corner mapping the map holds (x,y) targets of each virtual pixel instead.
+ * Geometry is compared with the one the map was built for, so it is cheap to call on every frame.
+ * Must only be called from the thread rendering effects as it may free the map.
+ */
+void Segment::updatePixelMap() {
+  bool useMap = (grouping > 1 || spacing > 0 || mirror || offset > 0); // reverse alone is cheap to calculate
+#ifndef WLED_DISABLE_2D
+  if (is2D() && (map1D2D == M12_pArc || map1D2D == M12_pCorner)) {
+    uint16_t vW = virtualWidth();
+    uint16_t vH = virtualHeight();
+    if (_pixMap && _pixMap->stride == 0 && _pixMap->map1D2D == map1D2D &&
+        _pixMap->width == vW && _pixMap->height == vH) return; // map is up to date
+    if (_pixMap) free(_pixMap);
+    _pixMap = build1D2DMap(map1D2D, vW, vH, virtualLength()); // if null setPixelColor() will calculate targets
+    return;
+  }
+  if (is2D() || (Segment::maxHeight!=1 && start < Segment::maxWidth*Segment::maxHeight)) useMap = false;
+#endif
+  if (!useMap) {
+    if (_pixMap) free(_pixMap);
+    _pixMap = nullptr;
+    return;
+  }
+  if (_pixMap && _pixMap->stride && _pixMap->start == start && _pixMap->stop == stop && _pixMap->offset == offset &&
+      _pixMap->grouping == grouping && _pixMap->spacing == spacing &&
+      _pixMap->reverse == reverse && _pixMap->mirror == mirror) return; // map is up to date
+
+  uint16_t vLen = virtualLength();
+  uint16_t stride = grouping * (mirror ? 2 : 1);
+  size_t entries = (size_t)vLen * stride;
+  if (_pixMap) free(_pixMap);
+  _pixMap = nullptr;
+  if (entries > UINT16_MAX) return; // setPixelColor() will calculate indices
+  size_t mapSize = sizeof(PixelMap) + sizeof(uint16_t) * entries;
+  #ifdef ESP8266
+  if (ESP.getFreeHeap() < MIN_HEAP_SIZE + mapSize) return;
+  #endif
+  _pixMap = (PixelMap*)malloc(mapSize);
+  if (!_pixMap) return;
+  _pixMap->size     = entries;
+  _pixMap->start    = start;
+  _pixMap->stop     = stop;
+  _pixMap->offset   = offset;
+  _pixMap->len      = vLen;
+  _pixMap->grouping = grouping;
+  _pixMap->spacing  = spacing;
+  _pixMap->stride   = stride;
+  _pixMap->reverse  = reverse;
+  _pixMap->mirror   = mirror;
+
+  // same expansion as in setPixelColor()
+  uint16_t *idx = _pixMap->indices();
+  uint16_t len = length();
+  for (int v = 0; v < vLen; v++) {
+    int i = v * groupLength();
+    if (reverse) i = mirror ? (len - 1) / 2 - i : (len - 1) - i;
+    i += start;
+    for (int j = 0; j < grouping; j++) {
+      uint16_t *e = idx + v * stride + j * (mirror ? 2 : 1);
+      uint16_t indexSet = i + ((reverse) ? -j : j);
+      e[0] = 0xFFFFU;
+      if (mirror) e[1] = 0xFFFFU;
+      if (indexSet >= start && indexSet < stop) {
+        if (mirror) { //set the corresponding mirrored pixel
+          uint16_t indexMir = stop - indexSet + start - 1;
+          indexMir += offset; // offset/phase
+          if (indexMir >= stop) indexMir -= len; // wrap
+          e[1] = indexMir;
+        }
+        indexSet += offset; // offset/phase
+        if (indexSet >= stop) indexSet -= len; // wrap
+        e[0] = indexSet;
+      }
+    }
   }
 }
 
@@ -303,6 +656,27 @@ CRGBPalette16 &Segment::loadPalette(CRGBPalette16 &targetPalette, uint8_t pal) {
   return targetPalette;
 }
 
+/*
+ * (Re)builds the expanded palette used by color_from_palette() while rendering if pal (or blending mode) differs
+ * from the one the cache was built from. This covers palette change, transition steps and custom palette reload.
+ * Cache is only allocated (alloc==true) on first color_from_palette() call, so effects not using palettes do not
+ * waste memory. Must only be called from the thread rendering effects.
+ */
+void Segment::updatePaletteCache(const CRGBPalette16 &pal, bool alloc) {
+  bool noBlend = (strip.paletteBlend == 3); // NOTE: paletteBlend should be global
+  if (!_palCache) {
+    if (!alloc) return;
+    #ifdef ESP8266
+    if (ESP.getFreeHeap() < MIN_HEAP_SIZE + sizeof(PaletteCache)) return; // color_from_palette() will blend colors
+    #endif
+    _palCache = (PaletteCache*)malloc(sizeof(PaletteCache));
+    if (!_palCache) return;
+  } else if (_palCache->noBlend == noBlend && _palCache->src == pal) return; // cache is up to date
+  memcpy((void*)&_palCache->src, (const void*)&pal, sizeof(CRGBPalette16));
+  _palCache->noBlend = noBlend;
+  for (int i = 0; i < 256; i++) _palCache->colors[i] = ColorFromPalette(pal, i, 255, noBlend ? NOBLEND : LINEARBLEND);
+}
+
 void Segment::startTransition(uint16_t dur) {
   if (transitional || _t) return; // already in transition no need to store anything
 
@@ -370,7 +744,7 @@ void Segment::handleTransition() {
   if (mode == FX_MODE_STATIC && next_time > maxWait) next_time = maxWait;
   if (progress() == 0xFFFFU) {
     if (_t) {
-      if (_t->_modeP != mode) markForReset();
+      if (_t->_modeP != mode && !_t->_frames) markForReset(); // when cross-faded new effect already has its own runtime data
       delete _t;
       _t = nullptr;
     }
@@ -378,6 +752,110 @@ void Segment::handleTransition() {
   }
 }
 
+void Segment::swapEffectState() {
+  std::swap(aux0, _t->_aux0);
+  std::swap(aux1, _t->_aux1);
+  std::swap(step, _t->_step);
+  std::swap(call, _t->_call);
+  std::swap(data, _t->_data);
+  std::swap(_dataLen, _t->_dataLen);
+  std::swap(leds, _t->_leds);
+}
+
+/*
+ * Runs effect function of the segment. During effect transition previous and new effect are rendered
+ * into their own frame buffers (from strip's pool) and cross-faded, runtime data of previous effect is kept in _t.
+ * Falls back to switching effect half way if there is no frame buffer or pool space.
+ * Must only be called from renderSegment() as it moves and frees runtime data.
+ */
+uint16_t Segment::runEffect() {
+  if (!transitional || !_t || (_t->_modeP == mode && !_t->_frames) || progress() == 0xFFFFU || !strip._pixels)
+    return (*strip._mode[currentMode(mode)])();
+
+  uint16_t w = width();
+  uint16_t h = height();
+  uint16_t len = length();
+  if (!_t->_frames) {
+    _t->_frames = strip.claimTransitionFrames(2 * len + TRANSITION_MASK_LEN(len));
+    if (!_t->_frames) return (*strip._mode[currentMode(mode)])();
+    // both effects start from what is currently shown
+    for (int y = 0; y < h; y++) strip.readPixels((startY + y) * Segment::maxWidth + start, _t->_frames + y * w, w);
+    probeTransitionPixels();
+    memcpy(_t->_frames + len, _t->_frames, len * sizeof(uint32_t));
+    // runtime data belongs to previous effect, new effect starts clean
+    swapEffectState();
+    _t->_modeN = mode;
+  }
+  if (_t->_modeN != mode) {
+    // effect changed again while cross-fading, previous effect keeps fading out
+    if (leds) { arenaFree(leds); leds = nullptr; }
+    deallocateData();
+    step = 0; call = 0; aux0 = 0; aux1 = 0;
+    _t->_modeN = mode;
+  }
+  uint32_t *frameP = _t->_frames;
+  uint32_t *frameN = _t->_frames + len;
+  const uint32_t *mask = _t->_frames + 2 * len;
+
+  // pixels of the bounding box set by others (other segments, gaps) keep their current color
+  for (int k = 0; k < len; k++) {
+    if (TRANSITION_MASK_GET(mask, k)) continue;
+    frameP[k] = frameN[k] = strip.getPixelColor((startY + k / w) * Segment::maxWidth + start + k % w);
+  }
+
+  // previous effect
+  for (int y = 0; y < h; y++) strip.loadPixels((startY + y) * Segment::maxWidth + start, frameP + y * w, w);
+  swapEffectState();
+  (*strip._mode[_t->_modeP])();
+  if (_t->_modeP != FX_MODE_HALLOWEEN_EYES) call++;
+  swapEffectState();
+  for (int y = 0; y < h; y++) strip.readPixels((startY + y) * Segment::maxWidth + start, frameP + y * w, w);
+
+  // new effect
+  for (int y = 0; y < h; y++) strip.loadPixels((startY + y) * Segment::maxWidth + start, frameN + y * w, w);
+  uint16_t delay = (*strip._mode[mode])();
+  for (int y = 0; y < h; y++) strip.readPixels((startY + y) * Segment::maxWidth + start, frameN + y * w, w);
+
+  // blend runs of pixels set by the segment, others have their current color in the frame buffer again
+  uint8_t blend = progress() >> 8;
+  uint32_t span[PIXEL_SPAN_LEN];
+  for (int y = 0; y < h; y++) {
+    int row = y * w;
+    for (int x = 0; x < w; ) {
+      uint16_t n = 0;
+      while (x + n < w && n < PIXEL_SPAN_LEN && TRANSITION_MASK_GET(mask, row + x + n)) {
+        span[n] = color_blend(frameP[row + x + n], frameN[row + x + n], blend);
+        n++;
+      }
+      if (n) strip.setPixelColors((startY + y) * Segment::maxWidth + start + x, span, n);
+      x += n ? n : 1;
+    }
+  }
+  return delay;
+}
+
+// marks the pixels of the bounding box the segment sets in the mask following the frames (grouping and spacing
+// leave gaps, 1D to 2D mappings may not cover the whole box): the box is filled with a marker and the segment with
+// black, the box is restored from the first frame
+void Segment::probeTransitionPixels() {
+  const uint16_t w = width();
+  const uint16_t h = height();
+  const uint16_t len = length();
+  const uint32_t MARKER = 0x01020304;
+  uint32_t *frame = _t->_frames + len;
+  uint32_t *mask  = _t->_frames + 2 * len;
+  for (int k = 0; k < len; k++) frame[k] = MARKER;
+  for (int y = 0; y < h; y++) strip.loadPixels((startY + y) * Segment::maxWidth + start, frame + y * w, w);
+  CRGB *l = leds; // keep effect's pixel buffer
+  leds = nullptr;
+  fill(BLACK);
+  leds = l;
+  for (int y = 0; y < h; y++) strip.readPixels((startY + y) * Segment::maxWidth + start, frame + y * w, w);
+  memset(mask, 0, TRANSITION_MASK_LEN(len) * sizeof(uint32_t));
+  for (int k = 0; k < len; k++) if (frame[k] != MARKER) TRANSITION_MASK_SET(mask, k);
+  for (int y = 0; y < h; y++) strip.loadPixels((startY + y) * Segment::maxWidth + start, _t->_frames + y * w, w);
+}
+
 void Segment::set(uint16_t i1, uint16_t i2, uint8_t grp, uint8_t spc, uint16_t ofs, uint16_t i1Y, uint16_t i2Y) {
   //return if neither bounds nor grouping have changed
   bool boundsUnchanged = (start == i1 && stop == i2);
@@ -573,6 +1051,21 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
         else          for (int x = 0; x < vW; x++) setPixelColorXY(x, vH - i - 1, col);
         break;
       case M12_pArc:
+      case M12_pCorner:
+        // while rendering use precomputed targets (map is validated in service() before effect is run)
+        if (_pixMap && !_pixMap->stride && strip.isServicing()) {
+          if (i >= _pixMap->len) break;
+          const uint16_t *offs = _pixMap->indices();
+          const uint16_t *xy   = offs + _pixMap->len + 1;
+          const uint16_t w     = _pixMap->width;
+          for (int n = offs[i]; n < offs[i+1]; n++) setPixelColorXY(xy[n] % w, xy[n] / w, col);
+          break;
+        }
+        if (map1D2D == M12_pCorner) {
+          for (int x = 0; x <= i; x++) setPixelColorXY(x, i, col);
+          for (int y = 0; y <  i; y++) setPixelColorXY(i, y, col);
+          break;
+        }
         // expand in circular fashion from center
         if (i==0)
           setPixelColorXY(0, 0, col);
@@ -600,10 +1093,6 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
           //}
         }
         break;
-      case M12_pCorner:
-        for (int x = 0; x <= i; x++) setPixelColorXY(x, i, col);
-        for (int y = 0; y <  i; y++) setPixelColorXY(i, y, col);
-        break;
     }
     return;
   } else if (Segment::maxHeight!=1 && (width()==1 || height()==1)) {
@@ -631,6 +1120,14 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
     col = RGBW32(r, g, b, w);
   }
 
+  // while rendering use precomputed pixel indices (map is validated in service() before effect is run)
+  if (_pixMap && _pixMap->stride && strip.isServicing()) {
+    if (i >= _pixMap->len) return;
+    const uint16_t *idx = _pixMap->indices() + i * _pixMap->stride;
+    for (int j = 0; j < _pixMap->stride; j++) if (idx[j] != 0xFFFFU) strip.setPixelColor(idx[j], col);
+    return;
+  }
+
   // expand pixel (taking into account start, grouping, spacing [and offset])
   i = i * groupLength();
   if (reverse) { // is segment reversed?
@@ -659,6 +1156,43 @@ void IRAM_ATTR Segment::setPixelColor(int i, uint32_t col)
   }
 }
 
+// sets a run of count pixels starting at i
+// if the segment maps linearly onto the strip (no 2D, grouping, spacing, mirror or offset) the run is
+// passed down to the busses at once, otherwise it falls back to setPixelColor() for each pixel
+void Segment::setPixelColors(int i, const uint32_t *c, uint16_t count)
+{
+  uint16_t vLen = virtualLength();
+  if (i < 0 || i >= vLen) return;
+  if (i + count > vLen) count = vLen - i;
+
+  bool linear = (grouping == 1 && spacing == 0 && !mirror && offset == 0);
+#ifndef WLED_DISABLE_2D
+  if (is2D() || (Segment::maxHeight!=1 && start < Segment::maxWidth*Segment::maxHeight)) linear = false;
+#endif
+  if (!linear) {
+    for (uint16_t j = 0; j < count; j++) setPixelColor(i + j, c[j]);
+    return;
+  }
+
+  if (leds) for (uint16_t j = 0; j < count; j++) leds[i + j] = c[j];
+
+  uint8_t _bri_t = currentBri(on ? opacity : 0);
+  if (!_bri_t && !transitional) return;
+
+  uint32_t span[PIXEL_SPAN_LEN];
+  uint16_t len = length();
+  while (count) {
+    uint16_t n = count > PIXEL_SPAN_LEN ? PIXEL_SPAN_LEN : count;
+    for (uint16_t j = 0; j < n; j++) {
+      uint32_t col = c[j];
+      if (_bri_t < 255) col = RGBW32(scale8(R(col), _bri_t), scale8(G(col), _bri_t), scale8(B(col), _bri_t), scale8(W(col), _bri_t));
+      span[reverse ? n - j - 1 : j] = col;
+    }
+    strip.setPixelColors(reverse ? start + len - i - n : start + i, span, n);
+    i += n; c += n; count -= n;
+  }
+}
+
 // anti-aliased normalized version of setPixelColor()
 void Segment::setPixelColor(float i, uint32_t col, bool aa)
 {
@@ -711,9 +1245,18 @@ uint32_t Segment::getPixelColor(int i)
         else          return getPixelColorXY(0, vH - i -1);
         break;
       case M12_pArc:
-      case M12_pCorner:
-        // use longest dimension
-        return vW>vH ? getPixelColorXY(i, 0) : getPixelColorXY(0, i);
+      case M12_pCorner: {
+        // return first target pixel within segment (same expansion as setPixelColor())
+        uint16_t xy;
+        if (_pixMap && !_pixMap->stride && strip.isServicing()) {
+          if (i >= _pixMap->len) return 0;
+          const uint16_t *offs = _pixMap->indices();
+          if (offs[i] == offs[i+1]) return 0;
+          xy = offs[_pixMap->len + 1 + offs[i]];
+          vW = _pixMap->width;
+        } else if (!expand1D2D(map1D2D, i, vW, vH, &xy, 1)) return 0;
+        return getPixelColorXY(xy % vW, xy / vW);
+        }
         break;
     }
     return 0;
@@ -808,9 +1351,12 @@ void Segment::refreshLightCapabilities() {
 void Segment::fill(uint32_t c) {
   const uint16_t cols = is2D() ? virtualWidth() : virtualLength();
   const uint16_t rows = virtualHeight(); // will be 1 for 1D
-  for(uint16_t y = 0; y < rows; y++) for (uint16_t x = 0; x < cols; x++) {
-    if (is2D()) setPixelColorXY(x, y, c);
-    else        setPixelColor(x, c);
+  uint32_t span[PIXEL_SPAN_LEN];
+  for (uint8_t j = 0; j < PIXEL_SPAN_LEN; j++) span[j] = c;
+  for (uint16_t y = 0; y < rows; y++) for (uint16_t x = 0; x < cols; x += PIXEL_SPAN_LEN) {
+    uint16_t n = MIN(PIXEL_SPAN_LEN, cols - x);
+    if (is2D()) setPixelColorsXY(x, y, span, n);
+    else        setPixelColors(x, span, n);
   }
 }
 
@@ -845,26 +1391,31 @@ void Segment::fade_out(uint8_t rate) {
   int g2 = G(color);
   int b2 = B(color);
 
-  for (uint16_t y = 0; y < rows; y++) for (uint16_t x = 0; x < cols; x++) {
-    color = is2D() ? getPixelColorXY(x, y) : getPixelColor(x);
-    int w1 = W(color);
-    int r1 = R(color);
-    int g1 = G(color);
-    int b1 = B(color);
-
-    int wdelta = (w2 - w1) / mappedRate;
-    int rdelta = (r2 - r1) / mappedRate;
-    int gdelta = (g2 - g1) / mappedRate;
-    int bdelta = (b2 - b1) / mappedRate;
-
-    // if fade isn't complete, make sure delta is at least 1 (fixes rounding issues)
-    wdelta += (w2 == w1) ? 0 : (w2 > w1) ? 1 : -1;
-    rdelta += (r2 == r1) ? 0 : (r2 > r1) ? 1 : -1;
-    gdelta += (g2 == g1) ? 0 : (g2 > g1) ? 1 : -1;
-    bdelta += (b2 == b1) ? 0 : (b2 > b1) ? 1 : -1;
-
-    if (is2D()) setPixelColorXY(x, y, r1 + rdelta, g1 + gdelta, b1 + bdelta, w1 + wdelta);
-    else        setPixelColor(x, r1 + rdelta, g1 + gdelta, b1 + bdelta, w1 + wdelta);
+  uint32_t span[PIXEL_SPAN_LEN];
+  for (uint16_t y = 0; y < rows; y++) for (uint16_t x = 0; x < cols; x += PIXEL_SPAN_LEN) {
+    uint16_t n = MIN(PIXEL_SPAN_LEN, cols - x);
+    for (uint16_t j = 0; j < n; j++) {
+      color = is2D() ? getPixelColorXY(x + j, y) : getPixelColor(x + j);
+      int w1 = W(color);
+      int r1 = R(color);
+      int g1 = G(color);
+      int b1 = B(color);
+
+      int wdelta = (w2 - w1) / mappedRate;
+      int rdelta = (r2 - r1) / mappedRate;
+      int gdelta = (g2 - g1) / mappedRate;
+      int bdelta = (b2 - b1) / mappedRate;
+
+      // if fade isn't complete, make sure delta is at least 1 (fixes rounding issues)
+      wdelta += (w2 == w1) ? 0 : (w2 > w1) ? 1 : -1;
+      rdelta += (r2 == r1) ? 0 : (r2 > r1) ? 1 : -1;
+      gdelta += (g2 == g1) ? 0 : (g2 > g1) ? 1 : -1;
+      bdelta += (b2 == b1) ? 0 : (b2 > b1) ? 1 : -1;
+
+      span[j] = RGBW32(r1 + rdelta, g1 + gdelta, b1 + bdelta, w1 + wdelta);
+    }
+    if (is2D()) setPixelColorsXY(x, y, span, n);
+    else        setPixelColors(x, span, n);
   }
 }
 
@@ -897,23 +1448,32 @@ void Segment::blur(uint8_t blur_amount)
   uint8_t keep = 255 - blur_amount;
   uint8_t seep = blur_amount >> 1;
   CRGB carryover = CRGB::Black;
-  for(uint16_t i = 0; i < virtualLength(); i++)
+  // blurred pixels are collected in a span and written in runs; the last pixel of a run
+  // is held back as it still receives the seep from its right neighbour
+  uint32_t span[PIXEL_SPAN_LEN];
+  uint16_t spanStart = 0, n = 0;
+  const uint16_t len = virtualLength();
+  for (uint16_t i = 0; i < len; i++)
   {
     CRGB cur = CRGB(getPixelColor(i));
     CRGB part = cur;
     part.nscale8(seep);
     cur.nscale8(keep);
     cur += carryover;
-    if(i > 0) {
-      uint32_t c = getPixelColor(i-1);
-      uint8_t r = R(c);
-      uint8_t g = G(c);
-      uint8_t b = B(c);
-      setPixelColor(i-1, qadd8(r, part.red), qadd8(g, part.green), qadd8(b, part.blue));
+    if (n > 0) {
+      uint32_t c = span[n-1];
+      span[n-1] = RGBW32(qadd8(R(c), part.red), qadd8(G(c), part.green), qadd8(B(c), part.blue), 0);
+    }
+    if (n == PIXEL_SPAN_LEN) {
+      setPixelColors(spanStart, span, n-1);
+      span[0] = span[n-1];
+      spanStart += n-1;
+      n = 1;
     }
-    setPixelColor(i,cur.red, cur.green, cur.blue);
+    span[n++] = RGBW32(cur.red, cur.green, cur.blue, 0);
     carryover = part;
   }
+  if (n) setPixelColors(spanStart, span, n);
 }
 
 /*
@@ -972,6 +1532,19 @@ uint32_t Segment::color_from_palette(uint16_t i, bool mapping, bool wrap, uint8_
   uint8_t paletteIndex = i;
   if (mapping && virtualLength() > 1) paletteIndex = (i*255)/(virtualLength() -1);
   if (!wrap) paletteIndex = scale8(paletteIndex, 240); //cut off blend at palette "end"
+
+  // while rendering use expanded palette (validated in service() before effect is run)
+  if (strip.isServicing()) {
+    if (!_palCache && this == &strip._segments[strip.getCurrSegmentId()]) updatePaletteCache(strip.renderContext().palette, true);
+    if (_palCache) {
+      CRGB c = _palCache->colors[paletteIndex];
+      if (pbri == 255) return RGBW32(c.r, c.g, c.b, 0);
+      if (pbri == 0) return BLACK;
+      pbri++; // same scaling as ColorFromPalette()
+      return RGBW32(scale8(c.r, pbri), scale8(c.g, pbri), scale8(c.b, pbri), 0);
+    }
+  }
+
   CRGB fastled_col;
   CRGBPalette16 curPal;
   if (transitional && _t) curPal = _t->_palT;
@@ -989,6 +1562,11 @@ uint32_t Segment::color_from_palette(uint16_t i, bool mapping, bool wrap, uint8_
 //do not call this method from system context (network callback)
 void WS2812FX::finalizeInit(void)
 {
+  #ifdef ARDUINO_ARCH_ESP32
+  if (!_stripLock) _stripLock = xSemaphoreCreateRecursiveMutex();
+  #endif
+  Segment::initArena(); // before any effect allocates data
+
   //reset segment runtimes
   for (segment &seg : _segments) {
     seg.markForReset();
@@ -1039,6 +1617,7 @@ void WS2812FX::finalizeInit(void)
     if (pins[0] == 3) bd->reinit();
     #endif
   }
+  busses.updateBusMap();
 
   if (isMatrix) setUpMatrix();
   else {
@@ -1046,22 +1625,33 @@ void WS2812FX::finalizeInit(void)
     Segment::maxHeight = 1;
   }
 
-  //initialize leds array. TBD: realloc if nr of leds change
-  if (Segment::_globalLeds) {
-    purgeSegments(true);
-    free(Segment::_globalLeds);
-    Segment::_globalLeds = nullptr;
-  }
+  //(re)allocate frame buffer, if disabled or allocation fails pixels are read back from busses
+  if (_pixels) free(_pixels);
+  _pixels = nullptr;
+  size_t arrSize = sizeof(uint32_t) * _length;
   if (useLedsArray) {
-    size_t arrSize = sizeof(CRGB) * getLengthTotal();
     #if defined(ARDUINO_ARCH_ESP32) && defined(WLED_USE_PSRAM)
     if (psramFound())
-      Segment::_globalLeds = (CRGB*) ps_malloc(arrSize);
+      _pixels = (uint32_t*) ps_malloc(arrSize);
     else
     #endif
-      Segment::_globalLeds = (CRGB*) malloc(arrSize);
-    memset(Segment::_globalLeds, 0, arrSize);
+      _pixels = (uint32_t*) malloc(arrSize);
+    if (_pixels) memset(_pixels, 0, arrSize);
+    else DEBUG_PRINTLN(F("Frame buffer alloc error."));
+  }
+
+  // crossfade pool is allocated by the first transition, give back frames claimed for previous strip length
+  if (_tPool) {
+    for (segment &seg : _segments) { seg.markForReset(); seg.resetIfRequired(); }
+    SEGDATA_LOCK();
+    memset(_tPoolClaims, 0, sizeof(_tPoolClaims));
+    freeUnusedTransitionPool();
+    SEGDATA_UNLOCK();
   }
+  // new busses need to be shown and have their power usage calculated
+  _pixelsDirtyStart = 0;
+  _pixelsDirtyEnd   = _length;
+  _busPowerValid    = false;
 
   //segments are created in makeAutoSegments();
   DEBUG_PRINTLN(F("Loading custom palettes"));
@@ -1070,15 +1660,93 @@ void WS2812FX::finalizeInit(void)
   deserializeMap();     // (re)load default ledmap
 }
 
+// runs effect function of a segment (on the core calling it), returns time spent in effect function (us)
+uint32_t WS2812FX::renderSegment(uint8_t id, uint32_t nowUp) {
+  segment &seg = _segments[id];
+  render_context_t &ctx = renderContext();
+  ctx.segIndex = id;
+  ctx.randSeed = seg.randSeed;
+  seg.updatePixelMap();
+  ctx.virtualLength = seg.virtualLength();
+  ctx.colors[0] = seg.currentColor(0, seg.colors[0]);
+  ctx.colors[1] = seg.currentColor(1, seg.colors[1]);
+  ctx.colors[2] = seg.currentColor(2, seg.colors[2]);
+  seg.currentPalette(ctx.palette, seg.palette);
+  seg.updatePaletteCache(ctx.palette);
+
+  if (!cctFromRgb || correctWB) busses.setSegmentCCT(seg.currentBri(seg.cct, true), correctWB);
+  for (uint8_t c = 0; c < NUM_COLORS; c++) ctx.colors[c] = gamma32(ctx.colors[c]);
+
+  uint32_t renderStart = micros();
+  uint16_t delay = seg.runEffect(); // cross-fades previous and new effect during transition
+  uint32_t renderTime = micros() - renderStart;
+  if (seg.mode != FX_MODE_HALLOWEEN_EYES) seg.call++;
+  if (seg.transitional && delay > FRAMETIME) delay = FRAMETIME; // force faster updates during transition
+
+  seg.handleTransition();
+  seg.randSeed  = ctx.randSeed;
+  seg.next_time = nowUp + delay;
+  return renderTime;
+}
+
+#ifdef WLED_ENABLE_PARALLEL_RENDER
+// returns index of next segment to be rendered or -1 if there are none left
+int WS2812FX::nextRenderJob() {
+  int id = -1;
+  portENTER_CRITICAL(&renderMux);
+  if (_renderJobNext < _renderJobCount) id = _renderJobs[_renderJobNext++];
+  portEXIT_CRITICAL(&renderMux);
+  return id;
+}
+
+// segments can be rendered concurrently if they do not share pixels and do not need per segment bus state
+// (CCT of white balance correction or CCT busses, set by renderSegment())
+bool WS2812FX::canRenderInParallel() {
+  if (_renderJobCount < 2 || correctWB || hasCCTBus() || busses.hasOverlappingBusses()) return false;
+  for (int a = 1; a < _renderJobCount; a++) {
+    const segment &sa = _segments[_renderJobs[a]];
+    for (int b = 0; b < a; b++) {
+      const segment &sb = _segments[_renderJobs[b]];
+      if (sa.start < sb.stop && sb.start < sa.stop && sa.startY < sb.stopY && sb.startY < sa.stopY) return false;
+    }
+  }
+  return true;
+}
+
+// takes segments from the job list until it is empty (also run by service() itself)
+uint32_t WS2812FX::renderJobs(uint32_t nowUp) {
+  uint32_t renderTime = 0;
+  for (int id = nextRenderJob(); id >= 0; id = nextRenderJob()) renderTime += renderSegment(id, nowUp);
+  return renderTime;
+}
+
+void WS2812FX::renderHelperTask(void *parameter) {
+  WS2812FX *instance = (WS2812FX*)parameter;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // wait for service() to fill the job list
+    instance->_renderHelperTime = instance->renderJobs(instance->_renderHelperNow);
+    xTaskNotifyGive(instance->_renderMain);
+  }
+}
+#else
+uint32_t WS2812FX::renderJobs(uint32_t nowUp) {
+  uint32_t renderTime = 0;
+  for (int j = 0; j < _renderJobCount; j++) renderTime += renderSegment(_renderJobs[j], nowUp);
+  return renderTime;
+}
+#endif
+
 void WS2812FX::service() {
   uint32_t nowUp = millis(); // Be aware, millis() rolls over every 49 days
   now = nowUp + timebase;
   if (nowUp - _lastShow < MIN_SHOW_DELAY) return;
   bool doShow = false;
+  uint32_t renderTime = 0;
 
   _isServicing = true;
-  _segment_index = 0;
-  for (segment &seg : _segments) {
+  _renderJobCount = 0;
+  for (size_t id = 0; id < _segments.size(); id++) {
+    segment &seg = _segments[id];
     // reset the segment runtime data if needed
     seg.resetIfRequired();
 
@@ -1089,35 +1757,44 @@ void WS2812FX::service() {
     {
       if (seg.grouping == 0) seg.grouping = 1; //sanity check
       doShow = true;
-      uint16_t delay = FRAMETIME;
-
-      if (!seg.freeze) { //only run effect function if not frozen
-        _virtualSegmentLength = seg.virtualLength();
-        _colors_t[0] = seg.currentColor(0, seg.colors[0]);
-        _colors_t[1] = seg.currentColor(1, seg.colors[1]);
-        _colors_t[2] = seg.currentColor(2, seg.colors[2]);
-        seg.currentPalette(_currentPalette, seg.palette);
-
-        if (!cctFromRgb || correctWB) busses.setSegmentCCT(seg.currentBri(seg.cct, true), correctWB);
-        for (uint8_t c = 0; c < NUM_COLORS; c++) _colors_t[c] = gamma32(_colors_t[c]);
-
-        // effect blending (execute previous effect)
-        // actual code may be a bit more involved as effects have runtime data including allocated memory
-        //if (seg.transitional && seg._modeP) (*_mode[seg._modeP])(progress());
-        delay = (*_mode[seg.currentMode(seg.mode)])();
-        if (seg.mode != FX_MODE_HALLOWEEN_EYES) seg.call++;
-        if (seg.transitional && delay > FRAMETIME) delay = FRAMETIME; // force faster updates during transition
-
-        seg.handleTransition();
-      }
 
-      seg.next_time = nowUp + delay;
+      if (!seg.freeze) _renderJobs[_renderJobCount++] = id; //only run effect function if not frozen
+      else             seg.next_time = nowUp + FRAMETIME;
     }
-    _segment_index++;
   }
-  _virtualSegmentLength = 0;
+  Segment::compactArena(); // remove holes left by segment resets and effect changes (no effect is running)
+
+#ifdef WLED_ENABLE_PARALLEL_RENDER
+  // split segments between both cores
+  bool parallel = canRenderInParallel();
+  if (parallel && !_renderHelper) {
+    xTaskCreatePinnedToCore(renderHelperTask, "render2", WLED_RENDER_TASK_STACK, this, uxTaskPriorityGet(NULL), &_renderHelper, xPortGetCoreID() ? 0 : 1);
+    if (!_renderHelper) DEBUG_PRINTLN(F("Render helper task creation failed."));
+  }
+  if (parallel && _renderHelper) {
+    // pixel writes from both cores must not update shared state: mark whole strip as changed
+    // and let estimateCurrentAndLimitBri() recalculate power of all busses
+    _pixelsDirtyStart = 0;
+    _pixelsDirtyEnd   = _length;
+    _renderJobNext    = 0;
+    _renderHelperNow  = nowUp;
+    _renderMain       = xTaskGetCurrentTaskHandle();
+    xTaskNotifyGive(_renderHelper);
+    renderTime += renderJobs(nowUp);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY); // wait for helper to finish its last segment
+    renderTime += _renderHelperTime;
+  } else {
+    _renderJobNext = 0;
+    renderTime += renderJobs(nowUp);
+  }
+#else
+  renderTime += renderJobs(nowUp);
+#endif
+
+  renderContext().virtualLength = 0;
   busses.setSegmentCCT(-1);
   if(doShow) {
+    _renderTime = (3 * _renderTime + renderTime) >> 2;
     yield();
     show();
   }
@@ -1129,16 +1806,129 @@ void IRAM_ATTR WS2812FX::setPixelColor(int i, uint32_t col)
 {
   if (i < customMappingSize) i = customMappingTable[i];
   if (i >= _length) return;
+  if (_pixels) _pixels[i] = col;
+  markDirty(i);
   busses.setPixelColor(i, col);
 }
 
+// sets a run of count physical pixels starting at i
+void IRAM_ATTR WS2812FX::setPixelColors(int i, const uint32_t *c, uint16_t count)
+{
+  if (i < customMappingSize) { // ledmap may scatter the run across the strip
+    for (uint16_t j = 0; j < count; j++) setPixelColor(i + j, c[j]);
+    return;
+  }
+  if (i >= _length || !count) return;
+  if (i + count > _length) count = _length - i;
+  if (_pixels) memcpy(_pixels + i, c, count * sizeof(uint32_t));
+  markDirty(i);
+  markDirty(i + count - 1);
+  busses.setPixelColors(i, c, count);
+}
+
+void WS2812FX::readPixels(int i, uint32_t *c, uint16_t count)
+{
+  for (uint16_t j = 0; j < count; j++) c[j] = getPixelColor(i + j);
+}
+
+// busses are updated when cross-faded result is set by setPixelColors()
+void WS2812FX::loadPixels(int i, const uint32_t *c, uint16_t count)
+{
+  if (!_pixels) return;
+  for (uint16_t j = 0; j < count; j++) {
+    int p = i + j;
+    if (p < customMappingSize) p = customMappingTable[p];
+    if (p >= _length) continue;
+    _pixels[p] = c[j];
+  }
+}
+
+// first fit: block may start at beginning of pool or right after any claimed block
+// pool is allocated when the first block is claimed (large enough for all segments of the strip) and freed with the last
+uint32_t *WS2812FX::claimTransitionFrames(uint16_t len)
+{
+  if (!_pixels || !len) return nullptr;
+  uint32_t *frames = nullptr;
+  SEGDATA_LOCK();
+  if (!_tPool) {
+    uint16_t poolLen = MIN(MAX_TRANSITION_DATA / sizeof(uint32_t), 2U * _length + TRANSITION_MASK_LEN(_length));
+    _tPool = (uint32_t*) malloc(poolLen * sizeof(uint32_t));
+    _tPoolLen = _tPool ? poolLen : 0;
+    memset(_tPoolClaims, 0, sizeof(_tPoolClaims));
+    if (!_tPool) DEBUG_PRINTLN(F("Crossfade pool alloc error."));
+  }
+  for (int c = -1; c < MAX_NUM_SEGMENTS && !frames && len <= _tPoolLen; c++) {
+    uint16_t pos = 0;
+    if (c >= 0) {
+      if (!_tPoolClaims[c].len) continue;
+      pos = _tPoolClaims[c].start + _tPoolClaims[c].len;
+    }
+    if (pos + len > _tPoolLen) continue;
+    int slot = -1;
+    bool fits = true;
+    for (int o = 0; o < MAX_NUM_SEGMENTS && fits; o++) {
+      if (!_tPoolClaims[o].len) { if (slot < 0) slot = o; }
+      else fits = pos + len <= _tPoolClaims[o].start || pos >= _tPoolClaims[o].start + _tPoolClaims[o].len;
+    }
+    if (fits && slot >= 0) {
+      _tPoolClaims[slot].start = pos;
+      _tPoolClaims[slot].len   = len;
+      frames = _tPool + pos;
+    }
+  }
+  if (!frames) freeUnusedTransitionPool();
+  SEGDATA_UNLOCK();
+  return frames;
+}
+
+void WS2812FX::releaseTransitionFrames(uint32_t *frames)
+{
+  if (!_tPool || frames < _tPool || frames >= _tPool + _tPoolLen) return;
+  SEGDATA_LOCK();
+  for (int c = 0; c < MAX_NUM_SEGMENTS; c++) {
+    if (_tPoolClaims[c].len && _tPool + _tPoolClaims[c].start == frames) { _tPoolClaims[c].len = 0; break; }
+  }
+  freeUnusedTransitionPool();
+  SEGDATA_UNLOCK();
+}
+
+// frees the crossfade pool if no transition uses it (called with SEGDATA_LOCK held)
+void WS2812FX::freeUnusedTransitionPool()
+{
+  for (int c = 0; c < MAX_NUM_SEGMENTS; c++) if (_tPoolClaims[c].len) return;
+  free(_tPool);
+  _tPool = nullptr;
+  _tPoolLen = 0;
+}
+
 uint32_t WS2812FX::getPixelColor(uint16_t i)
 {
   if (i < customMappingSize) i = customMappingTable[i];
   if (i >= _length) return 0;
+  if (_pixels) return _pixels[i];
   return busses.getPixelColor(i);
 }
 
+// average color of a block of w*h pixels starting at i (rows are maxWidth apart), with white added
+// to RGB channels as a simple RGBW -> RGB map; used to downsample live previews
+uint32_t WS2812FX::getPixelColorAvg(uint16_t i, uint16_t w, uint16_t h)
+{
+  uint32_t r = 0, g = 0, b = 0, n = 0;
+  uint16_t totalLen = getLengthTotal();
+  for (uint16_t y = 0; y < h; y++) {
+    uint32_t row = i + y * Segment::maxWidth;
+    for (uint16_t x = 0; x < w && row + x < totalLen; x++) {
+      uint32_t c = getPixelColor(row + x);
+      r += qadd8(W(c), R(c));
+      g += qadd8(W(c), G(c));
+      b += qadd8(W(c), B(c));
+      n++;
+    }
+  }
+  if (n > 1) { r /= n; g /= n; b /= n; }
+  return RGBW32(r, g, b, 0);
+}
+
 
 //DISCLAIMER
 //The following function attemps to calculate the current LED power usage,
@@ -1151,6 +1941,35 @@ uint32_t WS2812FX::getPixelColor(uint16_t i)
 #define MA_FOR_ESP        100 //how much mA does the ESP use (Wemos D1 about 80mA, ESP32 about 120mA)
                               //you can set it to 0 if the ESP is powered by USB and the LEDs by external
 
+// power usage of a single pixel in "power units", see estimateCurrentAndLimitBri()
+static inline uint32_t pixelPower(uint32_t c, bool ws2815) {
+  byte r = R(c), g = G(c), b = B(c), w = W(c);
+  if (ws2815) return (MAX(MAX(r,g),b)) * 3; //ignore white component on WS2815 power calculation
+  return r + g + b + w;
+}
+
+// sums up power usage of all LEDs of a physical bus (without RGBW correction)
+// white balance correction is only applied by busses, so colors are read back from the bus if it is enabled
+uint32_t WS2812FX::calcBusPower(uint8_t bNum) {
+  Bus *bus = busses.getBus(bNum);
+  uint16_t start = bus->getStart();
+  uint16_t len = bus->getLength();
+  uint32_t busPowerSum = 0;
+  if (!_pixels || correctWB) {
+    for (uint_fast16_t i = 0; i < len; i++) busPowerSum += pixelPower(bus->getPixelColor(i), _ws2815PowerModel);
+    return busPowerSum;
+  }
+  if (start >= _length) return 0;
+  if (start + len > _length) len = _length - start;
+  const uint32_t *c = _pixels + start;
+  if (bus->hasWhite()) { // frame buffer holds colors before auto white calculation
+    for (uint_fast16_t i = 0; i < len; i++) busPowerSum += pixelPower(bus->autoWhiteCalc(c[i]), _ws2815PowerModel);
+  } else {
+    for (uint_fast16_t i = 0; i < len; i++) busPowerSum += pixelPower(c[i], _ws2815PowerModel);
+  }
+  return busPowerSum;
+}
+
 void WS2812FX::estimateCurrentAndLimitBri() {
   //power limit calculation
   //each LED can draw up 195075 "power units" (approx. 53mA)
@@ -1166,6 +1985,7 @@ void WS2812FX::estimateCurrentAndLimitBri() {
 
   if (ablMilliampsMax < 150 || actualMilliampsPerLed == 0) { //0 mA per LED and too low numbers turn off calculation
     currentMilliamps = 0;
+    _busPowerValid = false; // pixels changed while disabled are not tracked
     busses.setBrightness(_brightness);
     return;
   }
@@ -1179,25 +1999,31 @@ void WS2812FX::estimateCurrentAndLimitBri() {
     powerBudget = 0;
   }
 
-  uint32_t powerSum = 0;
-
+  // channel sums are cached per bus and only recalculated for busses with pixels changed since last show()
+  // all busses are recalculated if the cache is invalid (new busses, ABL was off) or the power model changed
+  bool all = !_busPowerValid || _ws2815PowerModel != useWackyWS2815PowerModel || _busPowerAWM != Bus::getGlobalAWMode();
+  _ws2815PowerModel = useWackyWS2815PowerModel;
+  _busPowerAWM = Bus::getGlobalAWMode();
+  if (all) _busPowerMask = _busPowerAWMask = 0;
   for (uint_fast8_t bNum = 0; bNum < busses.getNumBusses(); bNum++) {
     Bus *bus = busses.getBus(bNum);
-    if (bus->getType() >= TYPE_NET_DDP_RGB) continue; //exclude non-physical network busses
-    uint16_t len = bus->getLength();
-    uint32_t busPowerSum = 0;
-    for (uint_fast16_t i = 0; i < len; i++) { //sum up the usage of each LED
-      uint32_t c = bus->getPixelColor(i);
-      byte r = R(c), g = G(c), b = B(c), w = W(c);
-
-      if(useWackyWS2815PowerModel) { //ignore white component on WS2815 power calculation
-        busPowerSum += (MAX(MAX(r,g),b)) * 3;
-      } else {
-        busPowerSum += (r + g + b + w);
-      }
+    if (all) {
+      if (bus->getType() >= TYPE_NET_DDP_RGB) continue; //exclude non-physical network busses
+      _busPowerMask |= 1 << bNum;
+      if (bus->hasWhite()) _busPowerAWMask |= 1 << bNum;
+    } else {
+      if (!(_busPowerMask & (1 << bNum))) continue;
+      if (_pixelsDirtyEnd <= bus->getStart() || _pixelsDirtyStart >= bus->getStart() + bus->getLength()) continue; //unchanged bus
     }
+    _busPowerSum[bNum] = calcBusPower(bNum);
+  }
+  _busPowerValid = true;
 
-    if (bus->hasWhite()) { //RGBW led total output with white LEDs enabled is still 50mA, so each channel uses less
+  uint32_t powerSum = 0;
+  for (uint_fast8_t bNum = 0; bNum < busses.getNumBusses(); bNum++) {
+    if (!(_busPowerMask & (1 << bNum))) continue;
+    uint32_t busPowerSum = _busPowerSum[bNum];
+    if (_busPowerAWMask & (1 << bNum)) { //RGBW led total output with white LEDs enabled is still 50mA, so each channel uses less
       busPowerSum *= 3;
       busPowerSum = busPowerSum >> 2; //same as /= 4
     }
@@ -1229,12 +2055,17 @@ void WS2812FX::show(void) {
   show_callback callback = _callback;
   if (callback) callback();
 
+  uint32_t showStart = micros();
   estimateCurrentAndLimitBri();
 
   // some buses send asynchronously and this method will return before
   // all of the data has been sent.
   // See https://github.com/Makuna/NeoPixelBus/wiki/ESP32-NeoMethods#neoesp32rmt-methods
-  busses.show();
+  // busses without changed pixels (and unchanged brightness) are skipped
+  busses.show(_pixelsDirtyStart, _pixelsDirtyEnd);
+  _pixelsDirtyStart = UINT16_MAX;
+  _pixelsDirtyEnd   = 0;
+  _showTime = (3 * _showTime + (micros() - showStart)) >> 2;
   unsigned long now = millis();
   unsigned long diff = now - _lastShow;
   uint16_t fpsCurr = 200;
@@ -1394,6 +2225,7 @@ void WS2812FX::purgeSegments(bool force) {
   // remove all inactive segments (from the back)
   int deleted = 0;
   if (_segments.size() <= 1) return;
+  lock(); // also called from handleConnection()
   for (size_t i = _segments.size()-1; i > 0; i--)
     if (_segments[i].stop == 0 || force) {
       deleted++;
@@ -1403,6 +2235,7 @@ void WS2812FX::purgeSegments(bool force) {
     _segments.shrink_to_fit();
     if (_mainSegment >= _segments.size()) setMainSegmentId(0);
   }
+  unlock();
 }
 
 Segment& WS2812FX::getSegment(uint8_t id) {
@@ -1419,6 +2252,7 @@ void WS2812FX::restartRuntime() {
 }
 
 void WS2812FX::resetSegments() {
+  lock();
   _segments.clear(); // destructs all Segment as part of clearing
   #ifndef WLED_DISABLE_2D
   segment seg = isMatrix ? Segment(0, Segment::maxWidth, 0, Segment::maxHeight) : Segment(0, _length);
@@ -1427,6 +2261,7 @@ void WS2812FX::resetSegments() {
   #endif
   _segments.push_back(seg);
   _mainSegment = 0;
+  unlock();
 }
 
 void WS2812FX::makeAutoSegments(bool forceReset) {
@@ -1467,6 +2302,7 @@ void WS2812FX::makeAutoSegments(bool forceReset) {
       s++;
     }
 
+    lock();
     _segments.clear();
     _segments.reserve(s); // prevent reallocations
     // there is always at least one segment (but we need to differentiate between 1D and 2D)
@@ -1479,6 +2315,7 @@ void WS2812FX::makeAutoSegments(bool forceReset) {
     for (size_t i = 1; i < s; i++) {
       _segments.push_back(Segment(segStarts[i], segStops[i]));
     }
+    unlock();
 
   } else {
 
@@ -1505,6 +2342,7 @@ void WS2812FX::makeAutoSegments(bool forceReset) {
 }
 
 void WS2812FX::fixInvalidSegments() {
+  lock();
   //make sure no segment is longer than total (sanity check)
   for (size_t i = getSegmentsNum()-1; i > 0; i--) {
     if (isMatrix) {
@@ -1527,6 +2365,7 @@ void WS2812FX::fixInvalidSegments() {
   // this is always called as the last step after finalizeInit(), update covered bus types
   for (segment &seg : _segments)
     seg.refreshLightCapabilities();
+  unlock();
 }
 
 //true if all segments align with a bus, or if a segment covers the total length
@@ -1548,10 +2387,11 @@ bool WS2812FX::checkSegmentAlignment() {
 //Note: If called in an interrupt (e.g. JSON API), original segment must be restored,
 //otherwise it can lead to a crash on ESP32 because _segment_index is modified while in use by the main thread
 uint8_t WS2812FX::setPixelSegment(uint8_t n) {
-  uint8_t prevSegId = _segment_index;
+  render_context_t &ctx = renderContext();
+  uint8_t prevSegId = ctx.segIndex;
   if (n < _segments.size()) {
-    _segment_index = n;
-    _virtualSegmentLength = _segments[_segment_index].virtualLength();
+    ctx.segIndex = n;
+    ctx.virtualLength = _segments[n].virtualLength();
   }
   return prevSegId;
 }
@@ -1578,8 +2418,8 @@ void WS2812FX::printSize() {
   DEBUG_PRINTF("Modes: %d*%d=%uB\n", sizeof(mode_ptr), _mode.size(), (_mode.capacity()*sizeof(mode_ptr)));
   DEBUG_PRINTF("Data: %d*%d=%uB\n", sizeof(const char *), _modeData.size(), (_modeData.capacity()*sizeof(const char *)));
   DEBUG_PRINTF("Map: %d*%d=%uB\n", sizeof(uint16_t), (int)customMappingSize, customMappingSize*sizeof(uint16_t));
-  size = getLengthTotal();
-  if (useLedsArray) DEBUG_PRINTF("Buffer: %d*%u=%uB\n", sizeof(CRGB), size, size*sizeof(CRGB));
+  size = _length;
+  if (_pixels) DEBUG_PRINTF("Buffer: %d*%u=%uB\n", sizeof(uint32_t), size, size*sizeof(uint32_t));
 }
 #endif
 
@@ -15,7 +15,9 @@ uint16_t approximateKelvinFromRGB(uint32_t rgb);
 void colorRGBtoRGBW(byte* rgb);
 
 //udp.cpp
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, byte *packet, uint8_t bri=255, bool isRGBW=false);
+size_t realtimePacketSize(uint8_t type);
+void realtimePacketInit(uint8_t type, byte *packet);
 
 // enable additional debug output
 #if defined(WLED_DEBUG_HOST)
@@ -163,6 +165,25 @@ void IRAM_ATTR BusDigital::setPixelColor(uint16_t pix, uint32_t c) {
   PolyBus::setPixelColor(_busPtr, _iType, pix, c, co);
 }
 
+void IRAM_ATTR BusDigital::setPixelColors(uint16_t pix, const uint32_t* c, uint16_t count) {
+  if (_type == TYPE_WS2812_1CH_X3) { // each IC is shared by 3 pixels, use read-modify-write path
+    Bus::setPixelColors(pix, c, count);
+    return;
+  }
+  bool aw = (_type == TYPE_SK6812_RGBW || _type == TYPE_TM1814);
+  bool wb = (_cct >= 1900);
+  bool useMap = _colorOrderMap.count() > 0;
+  uint8_t co = _colorOrder;
+  for (uint16_t i = 0; i < count; i++) {
+    uint32_t col = c[i];
+    if (aw) col = autoWhiteCalc(col);
+    if (wb) col = colorBalanceFromKelvin(_cct, col); //color correction from CCT
+    uint16_t p = reversed ? _len - (pix + i) - 1 : pix + i + _skip;
+    if (useMap) co = _colorOrderMap.getPixelColorOrder(p+_start, _colorOrder);
+    PolyBus::setPixelColor(_busPtr, _iType, p, col, co);
+  }
+}
+
 uint32_t BusDigital::getPixelColor(uint16_t pix) {
   if (reversed) pix = _len - pix -1;
   else pix += _skip;
@@ -401,6 +422,9 @@ BusNetwork::BusNetwork(BusConfig &bc) : Bus(bc.type, bc.start, bc.autoWhite) {
   _data = (byte *)malloc(bc.count * _UDPchannels);
   if (_data == nullptr) return;
   memset(_data, 0, bc.count * _UDPchannels);
+  _packet = (byte *)malloc(realtimePacketSize(_UDPtype)); // header is built once, channel data is copied in per packet
+  if (_packet == nullptr) { cleanup(); return; }
+  realtimePacketInit(_UDPtype, _packet);
   _len = bc.count;
   _client = IPAddress(bc.pins[0],bc.pins[1],bc.pins[2],bc.pins[3]);
   _broadcastLock = false;
@@ -418,6 +442,24 @@ void BusNetwork::setPixelColor(uint16_t pix, uint32_t c) {
   if (_rgbw) _data[offset+3] = W(c);
 }
 
+void BusNetwork::setPixelColors(uint16_t pix, const uint32_t* c, uint16_t count) {
+  if (!_valid || pix >= _len) return;
+  if (pix + count > _len) count = _len - pix;
+  bool aw = hasWhite();
+  bool wb = (_cct >= 1900);
+  byte *d = _data + pix * _UDPchannels;
+  for (uint16_t i = 0; i < count; i++) {
+    uint32_t col = c[i];
+    if (aw) col = autoWhiteCalc(col);
+    if (wb) col = colorBalanceFromKelvin(_cct, col); //color correction from CCT
+    d[0] = R(col);
+    d[1] = G(col);
+    d[2] = B(col);
+    if (_rgbw) d[3] = W(col);
+    d += _UDPchannels;
+  }
+}
+
 uint32_t BusNetwork::getPixelColor(uint16_t pix) {
   if (!_valid || pix >= _len) return 0;
   uint16_t offset = pix * _UDPchannels;
@@ -427,7 +469,7 @@ uint32_t BusNetwork::getPixelColor(uint16_t pix) {
 void BusNetwork::show() {
   if (!_valid || !canShow()) return;
   _broadcastLock = true;
-  realtimeBroadcast(_UDPtype, _client, _len, _data, _bri, _rgbw);
+  realtimeBroadcast(_UDPtype, _client, _len, _data, _packet, _bri, _rgbw);
   _broadcastLock = false;
 }
 
@@ -443,6 +485,8 @@ void BusNetwork::cleanup() {
   _valid = false;
   if (_data != nullptr) free(_data);
   _data = nullptr;
+  if (_packet != nullptr) free(_packet);
+  _packet = nullptr;
 }
 
 
@@ -479,7 +523,10 @@ int BusManager::add(BusConfig &bc) {
   } else {
     busses[numBusses] = new BusPwm(bc);
   }
-  return numBusses++;
+  numBusses++;
+  briChanged = true;
+  updateBusMap();
+  return numBusses - 1;
 }
 
 //do not call this method from system context (network callback)
@@ -489,12 +536,52 @@ void BusManager::removeAll() {
   while (!canAllShow()) yield();
   for (uint8_t i = 0; i < numBusses; i++) delete busses[i];
   numBusses = 0;
+  updateBusMap();
+}
+
+void BusManager::updateBusMap() {
+  busMapLen = 0;
+  busMapLast = 0;
+  busMapOverlap = false;
+  for (uint8_t i = 0; i < numBusses; i++) {
+    uint16_t len = busses[i]->getLength();
+    if (!len) continue;
+    BusMapEntry e = {busses[i]->getStart(), uint16_t(busses[i]->getStart() + len), busses[i], i};
+    //insertion sort by start address
+    uint8_t j = busMapLen++;
+    for (; j > 0 && busMap[j-1].start > e.start; j--) busMap[j] = busMap[j-1];
+    busMap[j] = e;
+  }
+  for (uint8_t i = 1; i < busMapLen; i++) {
+    if (busMap[i].start < busMap[i-1].end) busMapOverlap = true;
+  }
+  DEBUG_PRINTF("Bus map: %u entries%s\n", busMapLen, busMapOverlap ? " (overlapping)" : "");
+}
+
+//returns index of first bus map entry that ends after pix (busMapLen if none)
+uint8_t IRAM_ATTR BusManager::findBusMapEntry(uint16_t pix) {
+  uint8_t last = busMapLast;
+  if (last < busMapLen && pix >= busMap[last].start && pix < busMap[last].end) return last;
+  uint8_t lo = 0, hi = busMapLen;
+  while (lo < hi) {
+    uint8_t mid = (lo + hi) >> 1;
+    if (pix >= busMap[mid].end) lo = mid + 1;
+    else                        hi = mid;
+  }
+  if (lo < busMapLen) busMapLast = lo;
+  return lo;
 }
 
-void BusManager::show() {
+void BusManager::show(uint16_t dirtyStart, uint16_t dirtyEnd) {
   for (uint8_t i = 0; i < numBusses; i++) {
-    busses[i]->show();
+    Bus* b = busses[i];
+    if (!briChanged && b->getType() < TYPE_NET_DDP_RGB && !b->isOffRefreshRequired()) {
+      uint16_t bstart = b->getStart();
+      if (dirtyEnd <= bstart || dirtyStart >= bstart + b->getLength()) continue; //unchanged bus
+    }
+    b->show();
   }
+  briChanged = false;
 }
 
 void BusManager::setStatusPixel(uint32_t c) {
@@ -503,7 +590,22 @@ void BusManager::setStatusPixel(uint32_t c) {
   }
 }
 
+int8_t IRAM_ATTR BusManager::getBusIndex(uint16_t pix) {
+  if (busMapOverlap) {
+    for (uint8_t i = 0; i < numBusses; i++) if (busses[i]->containsPixel(pix)) return i;
+    return -1;
+  }
+  uint8_t i = findBusMapEntry(pix);
+  if (i < busMapLen && pix >= busMap[i].start) return busMap[i].idx;
+  return -1;
+}
+
 void IRAM_ATTR BusManager::setPixelColor(uint16_t pix, uint32_t c, int16_t cct) {
+  if (!busMapOverlap) {
+    uint8_t i = findBusMapEntry(pix);
+    if (i < busMapLen && pix >= busMap[i].start) busMap[i].bus->setPixelColor(pix - busMap[i].start, c);
+    return;
+  }
   for (uint8_t i = 0; i < numBusses; i++) {
     Bus* b = busses[i];
     uint16_t bstart = b->getStart();
@@ -512,7 +614,31 @@ void IRAM_ATTR BusManager::setPixelColor(uint16_t pix, uint32_t c, int16_t cct)
   }
 }
 
+void IRAM_ATTR BusManager::setPixelColors(uint16_t pix, const uint32_t* c, uint16_t count) {
+  uint32_t end = pix + count;
+  if (!busMapOverlap) {
+    for (uint8_t i = findBusMapEntry(pix); i < busMapLen && busMap[i].start < end; i++) {
+      uint16_t bstart = busMap[i].start;
+      uint16_t first = pix > bstart ? pix : bstart;
+      uint16_t last  = end < busMap[i].end ? end : busMap[i].end;
+      busMap[i].bus->setPixelColors(first - bstart, c + (first - pix), last - first);
+    }
+    return;
+  }
+  for (uint8_t i = 0; i < numBusses; i++) {
+    Bus* b = busses[i];
+    uint16_t bstart = b->getStart();
+    uint32_t bend = bstart + b->getLength();
+    if (end <= bstart || pix >= bend) continue;
+    uint16_t first = pix > bstart ? pix : bstart;
+    uint16_t last  = end < bend ? end : bend;
+    b->setPixelColors(first - bstart, c + (first - pix), last - first);
+  }
+}
+
 void BusManager::setBrightness(uint8_t b) {
+  if (b != lastBri) briChanged = true;
+  lastBri = b;
   for (uint8_t i = 0; i < numBusses; i++) {
     busses[i]->setBrightness(b);
   }
@@ -528,6 +654,11 @@ void BusManager::setSegmentCCT(int16_t cct, bool allowWBCorrection) {
 }
 
 uint32_t BusManager::getPixelColor(uint16_t pix) {
+  if (!busMapOverlap) {
+    uint8_t i = findBusMapEntry(pix);
+    if (i < busMapLen && pix >= busMap[i].start) return busMap[i].bus->getPixelColor(pix - busMap[i].start);
+    return 0;
+  }
   for (uint8_t i = 0; i < numBusses; i++) {
     Bus* b = busses[i];
     uint16_t bstart = b->getStart();
@@ -106,6 +106,7 @@ class Bus {
     virtual bool     canShow() { return true; }
     virtual void     setStatusPixel(uint32_t c) {}
     virtual void     setPixelColor(uint16_t pix, uint32_t c) = 0;
+    virtual void     setPixelColors(uint16_t pix, const uint32_t* c, uint16_t count) { for (uint16_t i = 0; i < count; i++) setPixelColor(pix + i, c[i]); }
     virtual uint32_t getPixelColor(uint16_t pix) { return 0; }
     virtual void     setBrightness(uint8_t b) { _bri = b; };
     virtual void     cleanup() = 0;
@@ -153,6 +154,8 @@ class Bus {
     inline static void    setGlobalAWMode(uint8_t m)  { if (m < 5) _gAWM = m; else _gAWM = AW_GLOBAL_DISABLED; }
     inline static uint8_t getGlobalAWMode()           { return _gAWM; }
 
+    uint32_t autoWhiteCalc(uint32_t c);
+
     bool reversed = false;
 
   protected:
@@ -166,8 +169,6 @@ class Bus {
     static uint8_t _gAWM;
     static int16_t _cct;
     static uint8_t _cctBlend;
-
-    uint32_t autoWhiteCalc(uint32_t c);
 };
 
 
@@ -185,6 +186,8 @@ class BusDigital : public Bus {
 
     void setPixelColor(uint16_t pix, uint32_t c);
 
+    void setPixelColors(uint16_t pix, const uint32_t* c, uint16_t count);
+
     uint32_t getPixelColor(uint16_t pix);
 
     uint8_t getColorOrder() {
@@ -288,6 +291,8 @@ class BusNetwork : public Bus {
 
     void setPixelColor(uint16_t pix, uint32_t c);
 
+    void setPixelColors(uint16_t pix, const uint32_t* c, uint16_t count);
+
     uint32_t getPixelColor(uint16_t pix);
 
     void show();
@@ -316,6 +321,7 @@ class BusNetwork : public Bus {
     bool      _rgbw;
     bool      _broadcastLock;
     byte     *_data;
+    byte     *_packet = nullptr; // preallocated UDP packet (header + one packet of channel data)
 };
 
 
@@ -331,12 +337,17 @@ class BusManager {
     //do not call this method from system context (network callback)
     void removeAll();
 
-    void show();
+    //shows busses containing pixels in range dirtyStart to dirtyEnd-1, all busses if brightness changed
+    //network busses and busses requiring refresh are always shown
+    void show(uint16_t dirtyStart = 0, uint16_t dirtyEnd = UINT16_MAX);
 
     void setStatusPixel(uint32_t c);
 
     void IRAM_ATTR setPixelColor(uint16_t pix, uint32_t c, int16_t cct=-1);
 
+    //sets a contiguous run of pixels, each bus is resolved only once for the whole run
+    void IRAM_ATTR setPixelColors(uint16_t pix, const uint32_t* c, uint16_t count);
+
     void setBrightness(uint8_t b);
 
     void setSegmentCCT(int16_t cct, bool allowWBCorrection = false);
@@ -362,10 +373,35 @@ class BusManager {
       return numBusses;
     }
 
+    //rebuilds pixel to bus lookup table, needs to be called if bus start or length changes
+    void updateBusMap();
+
+    //returns index of the bus containing pixel (-1 if none)
+    int8_t IRAM_ATTR getBusIndex(uint16_t pix);
+
+    inline bool hasOverlappingBusses() const {
+      return busMapOverlap;
+    }
+
   private:
     uint8_t numBusses = 0;
     Bus* busses[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
     ColorOrderMap colorOrderMap;
+    uint8_t lastBri = 0;
+    bool    briChanged = true; // all busses need to be shown
+
+    //pixel to bus lookup table, sorted by start address
+    struct BusMapEntry {
+      uint16_t start;
+      uint16_t end;   // first pixel after the bus
+      Bus*     bus;
+      uint8_t  idx;   // index in busses[]
+    } busMap[WLED_MAX_BUSSES+WLED_MIN_VIRTUAL_BUSSES];
+    uint8_t busMapLen = 0;
+    uint8_t busMapLast = 0;      // entry used by last lookup (consecutive pixels are usually on the same bus)
+    bool    busMapOverlap = false; // overlapping busses need every bus to be visited (linear scan)
+
+    uint8_t findBusMapEntry(uint16_t pix);
 
     inline uint8_t getNumVirtualBusses() {
       int j = 0;
@@ -232,7 +232,7 @@
 #define TYPE_LPD6803             54
 //Network types (master broadcast) (80-95)
 #define TYPE_NET_DDP_RGB         80            //network DDP RGB bus (master broadcast bus)
-#define TYPE_NET_E131_RGB        81            //network E131 RGB bus (master broadcast bus, unused)
+#define TYPE_NET_E131_RGB        81            //network E131 RGB bus (master broadcast bus)
 #define TYPE_NET_ARTNET_RGB      82            //network ArtNet RGB bus (master broadcast bus, unused)
 #define TYPE_NET_DDP_RGBW        88            //network DDP RGBW bus (master broadcast bus)
 
@@ -404,6 +404,16 @@
   #define JSON_BUFFER_SIZE 24576
 #endif
 
+// Size of temporary JSON document for usermod state/info when streaming JSON responses
+#ifdef ESP8266
+  #define JSON_STREAM_USERMOD_SIZE 2048
+#else
+  #define JSON_STREAM_USERMOD_SIZE 4096
+#endif
+
+// JSON buffer lock wait time histogram: no wait, <10ms, <100ms, <1s, timed out
+#define JSON_LOCK_WAIT_BUCKETS 5
+
 //#define MIN_HEAP_SIZE (8k for AsyncWebServer)
 #define MIN_HEAP_SIZE 8192
 
@@ -414,6 +424,18 @@
   #define WLED_MAX_NODES 150
 #endif
 
+// Maximum number of UDP packets and time (ms) spent receiving them per loop() (remaining ones are handled in next loop)
+#ifndef WLED_UDP_RX_MAX_PACKETS
+  #ifdef ESP8266
+    #define WLED_UDP_RX_MAX_PACKETS 8
+  #else
+    #define WLED_UDP_RX_MAX_PACKETS 24
+  #endif
+#endif
+#ifndef WLED_UDP_RX_MAX_MS
+  #define WLED_UDP_RX_MAX_MS 8
+#endif
+
 //this is merely a default now and can be changed at runtime
 #ifndef LEDPIN
 #if defined(ESP8266) || (defined(ARDUINO_ARCH_ESP32) && defined(WLED_USE_PSRAM)) || defined(CONFIG_IDF_TARGET_ESP32C3)
@@ -23,6 +23,7 @@ var pmt = 1, pmtLS = 0, pmtLast = 0;
 var lastinfo = {};
 var isM = false, mw = 0, mh=0;
 var ws, cpick, ranges;
+var wsState = null, wsSv = 0; // last state received via WS (base for delta updates) and its sequence number
 var cfg = {
 	theme:{base:"dark", bg:{url:""}, alpha:{bg:0.6,tab:0.8}, color:{bg:""}},
 	comp :{colors:{picker: true, rgb: false, quick: true, hex: false},
@@ -1267,6 +1268,18 @@ function cmpP(a, b)
 	return n.localeCompare((b[1].playlist ? '<' : y) + b[1].n, undefined, {numeric: true});
 }
 
+// applies WS delta d (changed segments only, removed segment IDs in rm) to state b
+function mergeState(b, d, rm=[]) {
+	var s = Object.assign({}, b, d);
+	var segs = (b.seg||[]).filter((x)=>!rm.includes(x.id));
+	for (let sg of (d.seg||[])) {
+		let i = segs.findIndex((x)=>x.id==sg.id);
+		if (i<0) segs.push(sg); else segs[i] = sg;
+	}
+	s.seg = segs.sort((a,c)=>a.id-c.id);
+	return s;
+}
+
 function makeWS() {
 	if (ws || lastinfo.ws < 0) return;
 	ws = new WebSocket((window.location.protocol == "https:"?"wss":"ws")+'://'+(loc?locip:window.location.hostname)+'/ws');
@@ -1288,6 +1301,15 @@ function makeWS() {
 		} else
 			i = lastinfo;
 		var s = json.state ? json.state : json;
+		if (json.sv !== undefined) {
+			if (json.delta) {
+				// delta only contains changed segments, request full state if one was missed
+				if (!wsState || json.sv != wsSv+1) { wsState = null; ws.send('{"v":true}'); return; }
+				s = mergeState(wsState, s, json.rm);
+			}
+			wsState = s;
+			wsSv = json.sv;
+		}
 		displayRover(i, s);
 		readState(s);
 	};
@@ -1298,6 +1320,7 @@ function makeWS() {
 	}
 	ws.onopen = (e)=>{
 		//ws.send("{'v':true}"); // unnecessary (https://github.com/Aircoookie/WLED/blob/master/wled00/ws.cpp#L18)
+		ws.send('{"delta":true}'); // we can apply state deltas (see mergeState())
 		reqsLegal = true;
 	}
 }
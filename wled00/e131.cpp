@@ -37,10 +37,7 @@ void handleDDPPacket(e131_packet_t* p) {
   realtimeLock(realtimeTimeoutMs, REALTIME_MODE_DDP);
 
   if (!realtimeOverride || (realtimeMode && useMainSegmentOnly)) {
-    for (uint16_t i = start; i < stop; i++) {
-      setRealtimePixel(i, data[c], data[c+1], data[c+2], ddpChannelsPerLed >3 ? data[c+3] : 0);
-      c += ddpChannelsPerLed;
-    }
+    if (stop > start) setRealtimePixels(start, data + c, stop - start, ddpChannelsPerLed);
   }
 
   bool push = p->flags & DDP_PUSH_FLAG;
@@ -51,25 +48,221 @@ void handleDDPPacket(e131_packet_t* p) {
   }
 }
 
+//writes pixels of one universe in DMX_MODE_MULTIPLE_* modes, returns false if nothing was written
+static bool setUniversePixels(uint8_t previousUniverses, const uint8_t* e131_data, uint16_t dmxChannels, byte protocol) {
+  const bool is4Chan = (DMXMode == DMX_MODE_MULTIPLE_RGBW);
+  const uint16_t dmxChannelsPerLed = is4Chan ? 4 : 3;
+  const uint16_t ledsPerUniverse = is4Chan ? MAX_4_CH_LEDS_PER_UNIVERSE : MAX_3_CH_LEDS_PER_UNIVERSE;
+  const uint16_t totalLen = strip.getLengthTotal();
+  // For legacy DMX start address 0 the available DMX length offset is 0
+  const uint16_t dmxLenOffset = (DMXAddress == 0) ? 0 : 1;
+  uint16_t availDMXLen = 0;
+  uint16_t dataOffset = DMXAddress;
+  uint8_t stripBrightness = bri;
+  uint16_t previousLeds, dmxOffset, ledsTotal;
+
+  // Check if DMX start address fits in available channels
+  if (dmxChannels >= DMXAddress) {
+    availDMXLen = (dmxChannels - DMXAddress) + dmxLenOffset;
+  }
+
+  // DMX data in Art-Net packet starts at index 0, for E1.31 at index 1
+  if (protocol == P_ARTNET && dataOffset > 0) {
+    dataOffset--;
+  }
+
+  if (previousUniverses == 0) {
+    if (availDMXLen < 1) return false;
+    dmxOffset = dataOffset;
+    previousLeds = 0;
+    // First DMX address is dimmer in DMX_MODE_MULTIPLE_DRGB mode.
+    if (DMXMode == DMX_MODE_MULTIPLE_DRGB) {
+      stripBrightness = e131_data[dmxOffset++];
+      ledsTotal = (availDMXLen - 1) / dmxChannelsPerLed;
+    } else {
+      ledsTotal = availDMXLen / dmxChannelsPerLed;
+    }
+  } else {
+    // All subsequent universes start at the first channel.
+    dmxOffset = (protocol == P_ARTNET) ? 0 : 1;
+    const uint16_t dimmerOffset = (DMXMode == DMX_MODE_MULTIPLE_DRGB) ? 1 : 0;
+    uint16_t ledsInFirstUniverse = (((MAX_CHANNELS_PER_UNIVERSE - DMXAddress) + dmxLenOffset) - dimmerOffset) / dmxChannelsPerLed;
+    previousLeds = ledsInFirstUniverse + (previousUniverses - 1) * ledsPerUniverse;
+    ledsTotal = previousLeds + (dmxChannels / dmxChannelsPerLed);
+  }
+
+  // All LEDs already have values
+  if (previousLeds >= totalLen) {
+    return false;
+  }
+
+  realtimeLock(realtimeTimeoutMs, protocol == P_ARTNET ? REALTIME_MODE_ARTNET : REALTIME_MODE_E131);
+  if (realtimeOverride && !(realtimeMode && useMainSegmentOnly)) return false;
+
+  if (ledsTotal > totalLen) {
+    ledsTotal = totalLen;
+  }
+
+  if (DMXMode == DMX_MODE_MULTIPLE_DRGB && previousUniverses == 0) {
+    if (bri != stripBrightness) {
+      bri = stripBrightness;
+      strip.setBrightness(bri, true);
+    }
+  }
+
+  if (ledsTotal > previousLeds) setRealtimePixels(previousLeds, e131_data + dmxOffset, ledsTotal - previousLeds, dmxChannelsPerLed);
+  return true;
+}
+
+/*
+ * Frame synchronisation (DMX_MODE_MULTIPLE_* only)
+ * Universes are staged and written to the strip together when an ArtSync or E1.31 synchronization packet
+ * arrives. Without sync source the frame is committed as soon as all universes of a frame arrived: at first
+ * the universes covering the strip, once a universe repeats (next frame started) as many as the source sent.
+ * Universes are held for sync packets as soon as E1.31 data announces a synchronization address.
+ */
+#define E131_SYNC_TIMEOUT 2500 // ms without sync packet before falling back to committing complete frames (E1.31: 6.2.4.1)
+
+typedef struct StagedUniverse {
+  uint16_t dmxChannels;
+  uint8_t  seq;
+  byte     protocol;
+  uint8_t  data[MAX_CHANNELS_PER_UNIVERSE+1]; // E1.31 data includes start code
+} staged_universe_t;
+
+static staged_universe_t* stagedUniverses = nullptr;
+static uint8_t  stagedCount = 0;       // number of universes covering the strip (allocated)
+static uint8_t  frameUniverses = 0;    // number of universes making up a complete frame (sent by source)
+static uint8_t  sourceUniverses = 0;   // highest universe received since staging started + 1
+static uint32_t stagedMask = 0;        // universes received for the current frame
+static uint8_t  committedSeq[E131_MAX_UNIVERSE_COUNT] = {0}; // sequence number of each universe last shown
+static uint16_t syncUniverse = 0;      // synchronization address announced in E1.31 data packets
+static unsigned long lastSyncTime = 0;
+
+//number of universes needed to cover the whole strip
+static uint8_t frameUniverseCount() {
+  const bool is4Chan = (DMXMode == DMX_MODE_MULTIPLE_RGBW);
+  const uint16_t dmxChannelsPerLed = is4Chan ? 4 : 3;
+  const uint16_t ledsPerUniverse = is4Chan ? MAX_4_CH_LEDS_PER_UNIVERSE : MAX_3_CH_LEDS_PER_UNIVERSE;
+  const uint16_t dmxLenOffset = (DMXAddress == 0) ? 0 : 1;
+  const uint16_t dimmerOffset = (DMXMode == DMX_MODE_MULTIPLE_DRGB) ? 1 : 0;
+  const uint16_t ledsInFirstUniverse = (((MAX_CHANNELS_PER_UNIVERSE - DMXAddress) + dmxLenOffset) - dimmerOffset) / dmxChannelsPerLed;
+  const uint16_t totalLen = strip.getLengthTotal();
+  uint16_t n = 1;
+  if (totalLen > ledsInFirstUniverse) n += (totalLen - ledsInFirstUniverse + ledsPerUniverse - 1) / ledsPerUniverse;
+  return MIN(n, E131_MAX_UNIVERSE_COUNT);
+}
+
+static void releaseStagedUniverses() {
+  free(stagedUniverses);
+  stagedUniverses = nullptr;
+  stagedCount = 0;
+  frameUniverses = 0;
+  sourceUniverses = 0;
+  stagedMask = 0;
+}
+
+//writes all staged universes to the strip at once
+static void commitStagedFrame() {
+  if (!stagedMask) return;
+  bool shown = false;
+  for (uint8_t i = 0; i < stagedCount; i++) {
+    if (!(stagedMask & (1UL << i))) continue;
+    staged_universe_t &u = stagedUniverses[i];
+    shown |= setUniversePixels(i, u.data, u.dmxChannels, u.protocol);
+    committedSeq[i] = u.seq;
+  }
+  stagedMask = 0;
+  if (!shown) return;
+  e131FramesCommitted++;
+  e131NewData = true;
+}
+
+//returns false if universe could not be staged (no memory), it then needs to be written directly
+static bool stageUniverse(uint8_t idx, const uint8_t* e131_data, uint16_t dmxChannels, byte protocol, uint8_t seq) {
+  uint8_t needed = frameUniverseCount();
+  if (needed != stagedCount) { // LED count or DMX settings changed
+    releaseStagedUniverses();
+    stagedUniverses = (staged_universe_t*)malloc(needed * sizeof(staged_universe_t));
+    if (stagedUniverses == nullptr) {
+      DEBUG_PRINTLN(F("E1.31 frame sync: no memory for staging."));
+      return false;
+    }
+    stagedCount = needed;
+    frameUniverses = needed;
+  }
+  if (idx >= stagedCount) return true; // beyond strip length, nothing to show
+
+  // reordered or repeated universe of a frame that has already been shown (sequence 0 means unused in Art-Net)
+  // only differences in (-20, 0] are late (E1.31 6.7.2), anything further back is a restarted or new source
+  int8_t seqDiff = seq - committedSeq[idx];
+  if (seq && committedSeq[idx] && seqDiff <= 0 && seqDiff > -20) {
+    e131LateUniverses++;
+    return true;
+  }
+
+  const uint32_t bit = 1UL << idx;
+  const bool syncActive = lastSyncTime && (millis() - lastSyncTime < E131_SYNC_TIMEOUT);
+  if ((stagedMask & bit) && !syncActive) {
+    // next frame started before the current one was complete: a universe got lost or the source sends fewer
+    // universes than the strip needs, show what was received and expect as many universes as the source sent
+    e131FramesDropped++;
+    frameUniverses = sourceUniverses;
+    commitStagedFrame();
+  }
+  if (idx >= sourceUniverses) sourceUniverses = idx + 1;
+  if (idx >= frameUniverses)  frameUniverses  = idx + 1; // source sends more universes than expected
+
+  staged_universe_t &u = stagedUniverses[idx];
+  uint16_t len = dmxChannels + (protocol == P_ARTNET ? 0 : 1);
+  if (len > sizeof(u.data)) len = sizeof(u.data);
+  memcpy(u.data, e131_data, len);
+  u.dmxChannels = dmxChannels;
+  u.protocol = protocol;
+  u.seq = seq;
+  stagedMask |= bit;
+
+  if (!syncActive && stagedMask == (0xFFFFFFFFUL >> (32 - frameUniverses))) commitStagedFrame();
+  return true;
+}
+
+//ArtSync or E1.31 synchronization packet received
+static void handleSyncPacket(uint16_t universe) {
+  if (!e131FrameSync) return;
+  if (universe && syncUniverse && universe != syncUniverse) return; // not the address our data refers to
+  lastSyncTime = millis();
+  commitStagedFrame();
+}
+
 //E1.31 and Art-Net protocol support
-void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
+static void processE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
 
   uint16_t uni = 0, dmxChannels = 0;
   uint8_t* e131_data = nullptr;
   uint8_t seq = 0, mde = REALTIME_MODE_E131;
 
+  if (!e131FrameSync && stagedUniverses) releaseStagedUniverses();
+
   if (protocol == P_ARTNET)
   {
     if (p->art_opcode == ARTNET_OPCODE_OPPOLL) {
       handleArtnetPollReply(clientIP);
       return;
     }
+    if (p->art_opcode == ARTNET_OPCODE_OPSYNC) {
+      handleSyncPacket(0);
+      return;
+    }
     uni = p->art_universe;
     dmxChannels = htons(p->art_length);
     e131_data = p->art_data;
     seq = p->art_sequence_number;
     mde = REALTIME_MODE_ARTNET;
   } else if (protocol == P_E131) {
+    if (htonl(p->root_vector) == E131_VECTOR_ROOT_EXTENDED) {
+      handleSyncPacket(htons(p->sync_universe));
+      return;
+    }
     // Ignore PREVIEW data (E1.31: 6.2.6)
     if ((p->options & 0x80) != 0) return;
     dmxChannels = htons(p->property_value_count) - 1;
@@ -78,6 +271,10 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
     uni = htons(p->universe);
     e131_data = p->property_values;
     seq = p->sequence_number;
+    uint16_t syncAddress = htons(p->sync_address);
+    // source announces sync packets: hold universes for them from the first frame on (until E131_SYNC_TIMEOUT)
+    if (syncAddress && syncAddress != syncUniverse && e131FrameSync) lastSyncTime = millis();
+    syncUniverse = syncAddress;
     if (e131Priority != 0) {
       if (p->priority < e131Priority ) return;
       // track highest priority & skip all lower priorities
@@ -246,65 +443,9 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
     case DMX_MODE_MULTIPLE_DRGB:
     case DMX_MODE_MULTIPLE_RGB:
     case DMX_MODE_MULTIPLE_RGBW:
-      {
-        bool is4Chan = (DMXMode == DMX_MODE_MULTIPLE_RGBW);
-        const uint16_t dmxChannelsPerLed = is4Chan ? 4 : 3;
-        const uint16_t ledsPerUniverse = is4Chan ? MAX_4_CH_LEDS_PER_UNIVERSE : MAX_3_CH_LEDS_PER_UNIVERSE;
-        uint8_t stripBrightness = bri;
-        uint16_t previousLeds, dmxOffset, ledsTotal;
-
-        if (previousUniverses == 0) {
-          if (availDMXLen < 1) return;
-          dmxOffset = dataOffset;
-          previousLeds = 0;
-          // First DMX address is dimmer in DMX_MODE_MULTIPLE_DRGB mode.
-          if (DMXMode == DMX_MODE_MULTIPLE_DRGB) {
-            stripBrightness = e131_data[dmxOffset++];
-            ledsTotal = (availDMXLen - 1) / dmxChannelsPerLed;
-          } else {
-            ledsTotal = availDMXLen / dmxChannelsPerLed;
-          }
-        } else {
-          // All subsequent universes start at the first channel.
-          dmxOffset = (protocol == P_ARTNET) ? 0 : 1;
-          const uint16_t dimmerOffset = (DMXMode == DMX_MODE_MULTIPLE_DRGB) ? 1 : 0;
-          uint16_t ledsInFirstUniverse = (((MAX_CHANNELS_PER_UNIVERSE - DMXAddress) + dmxLenOffset) - dimmerOffset) / dmxChannelsPerLed;
-          previousLeds = ledsInFirstUniverse + (previousUniverses - 1) * ledsPerUniverse;
-          ledsTotal = previousLeds + (dmxChannels / dmxChannelsPerLed);
-        }
-
-        // All LEDs already have values
-        if (previousLeds >= totalLen) {
-          return;
-        }
-
-        realtimeLock(realtimeTimeoutMs, mde);
-        if (realtimeOverride && !(realtimeMode && useMainSegmentOnly)) return;
-
-        if (ledsTotal > totalLen) {
-          ledsTotal = totalLen;
-        }
-
-        if (DMXMode == DMX_MODE_MULTIPLE_DRGB && previousUniverses == 0) {
-          if (bri != stripBrightness) {
-            bri = stripBrightness;
-            strip.setBrightness(bri, true);
-          }
-        }
-
-        if (!is4Chan) {
-          for (uint16_t i = previousLeds; i < ledsTotal; i++) {
-            setRealtimePixel(i, e131_data[dmxOffset], e131_data[dmxOffset+1], e131_data[dmxOffset+2], 0);
-            dmxOffset+=3;
-          }
-        } else {
-          for (uint16_t i = previousLeds; i < ledsTotal; i++) {
-            setRealtimePixel(i, e131_data[dmxOffset], e131_data[dmxOffset+1], e131_data[dmxOffset+2], e131_data[dmxOffset+3]);
-            dmxOffset+=4;
-          }
-        }
-        break;
-      }
+      if (e131FrameSync && stageUniverse(previousUniverses, e131_data, dmxChannels, protocol, seq)) return; // shown when frame is committed
+      if (!setUniversePixels(previousUniverses, e131_data, dmxChannels, protocol)) return;
+      break;
     default:
       DEBUG_PRINTLN(F("unknown E1.31 DMX mode"));
       return;  // nothing to do
@@ -314,6 +455,13 @@ void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
   e131NewData = true;
 }
 
+//network callback (on ESP32 it runs in async UDP task)
+void handleE131Packet(e131_packet_t* p, IPAddress clientIP, byte protocol){
+  strip.lock();
+  processE131Packet(p, clientIP, protocol);
+  strip.unlock();
+}
+
 void handleArtnetPollReply(IPAddress ipAddress) {
   ArtPollReply artnetPollReply;
   prepareArtnetPollReply(&artnetPollReply);
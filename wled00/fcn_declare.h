@@ -84,6 +84,7 @@ bool writeObjectToFileUsingId(const char* file, uint16_t id, JsonDocument* conte
 bool writeObjectToFile(const char* file, const char* key, JsonDocument* content);
 bool readObjectFromFileUsingId(const char* file, uint16_t id, JsonDocument* dest);
 bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest);
+void invalidateObjectIndex();
 void updateFSInfo();
 void closeFile();
 
@@ -203,11 +204,14 @@ bool handleSet(AsyncWebServerRequest *request, const String& req, bool apply=tru
 
 //udp.cpp
 void notify(byte callMode, bool followUp=false);
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, uint8_t bri=255, bool isRGBW=false);
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, byte *buffer, byte *packet, uint8_t bri=255, bool isRGBW=false);
+size_t realtimePacketSize(uint8_t type);
+void realtimePacketInit(uint8_t type, byte *packet);
 void realtimeLock(uint32_t timeoutMs, byte md = REALTIME_MODE_GENERIC);
 void exitRealtime();
 void handleNotifications();
 void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w);
+void setRealtimePixels(uint16_t i, const uint8_t *data, uint16_t count, uint8_t channels);
 void refreshNodeList();
 void sendSysInfoUDP();
 
@@ -376,6 +380,8 @@ String settingsProcessor(const String& var);
 String dmxProcessor(const String& var);
 void serveSettings(AsyncWebServerRequest* request, bool post = false);
 void serveSettingsJS(AsyncWebServerRequest* request);
+bool handleIfNoneMatchCacheHeader(AsyncWebServerRequest* request, uint32_t eTagSuffix = 0);
+void setStaticContentCacheHeaders(AsyncWebServerResponse *response, uint32_t eTagSuffix = 0);
 
 //ws.cpp
 void handleWs();
@@ -11,6 +11,9 @@
 #endif
 
 #define FS_BUFSIZE 256
+#define FS_INDEX_SIZE 251   // indexed object IDs 0-250 (presets)
+#define FS_NO_INDEX UINT16_MAX
+#define FS_INDEX_UNKNOWN UINT32_MAX // index entry does not match file, key is searched
 
 /*
  * Structural requirements for files managed by writeObjectToFile() and readObjectFromFile() utilities:
@@ -160,6 +163,107 @@ bool bufferedFindObjectEnd() {
   return false;
 }
 
+/*
+ * Index of the root-level objects in presets.json ("<id>":{...}), so a preset is read with a single seek.
+ * Holds the file offset of each object's key (opening quote, 0 if the ID is not in the file). It is built by scanning
+ * the file once and kept up to date by writes. Other writers of the file (upload, file editor) call invalidateObjectIndex(),
+ * it is also rebuilt if the file size changed. Offsets are verified against the key before use, if that fails only
+ * the entry is re-learned by scanning as before.
+ */
+static uint32_t *objIndex = nullptr;
+static uint32_t  objIndexFileSize = 0; // size of the file the index is valid for, 0 if invalid
+
+static bool isIndexedFile(const char *file) {
+  return !strcmp_P(file, PSTR("/presets.json"));
+}
+
+static bool buildObjectIndex() {
+  #ifdef WLED_DEBUG_FS
+    DEBUGFS_PRINTLN(F("Build index"));
+    uint32_t s = millis();
+  #endif
+
+  objIndexFileSize = 0;
+  if (!f || !f.size()) return false;
+  if (!objIndex) objIndex = (uint32_t*)malloc(FS_INDEX_SIZE * sizeof(uint32_t));
+  if (!objIndex) return false;
+  memset(objIndex, 0, FS_INDEX_SIZE * sizeof(uint32_t));
+
+  byte buf[FS_BUFSIZE];
+  uint32_t pos = 0;
+  uint16_t depth = 0;
+  bool inString = false, escape = false, isKey = false;
+  int id = -1; // numeric root-level key preceding the current position, -1 if none
+  uint32_t keyPos = 0; // position of its opening quote
+  f.seek(0);
+
+  while (f.position() < f.size()) {
+    uint16_t bufsize = f.read(buf, FS_BUFSIZE);
+    if (!bufsize) break;
+    for (uint16_t count = 0; count < bufsize; count++, pos++) {
+      char c = buf[count];
+      if (inString) {
+        if (escape)           escape = false;
+        else if (c == '\\')  escape = true;
+        else if (c == '"')    inString = false;
+        else if (isKey)       id = (id >= 0 && id < FS_INDEX_SIZE && c >= '0' && c <= '9') ? id * 10 + c - '0' : -1;
+        continue;
+      }
+      switch (c) {
+        case '"':
+          inString = true;
+          isKey = (depth == 1);
+          if (isKey) { id = 0; keyPos = pos; }
+          break;
+        case '{':
+        case '[':
+          if (++depth == 2 && c == '{' && id > 0 && id < FS_INDEX_SIZE && !objIndex[id]) objIndex[id] = keyPos;
+          id = -1;
+          break;
+        case '}':
+        case ']':
+          if (depth) depth--;
+          break;
+      }
+    }
+  }
+  objIndexFileSize = f.size();
+  DEBUGFS_PRINTF("Indexed, took %d ms\n", millis() - s);
+  return true;
+}
+
+// file was changed without writeObjectToFileUsingId(), index is rebuilt when the file is read next
+void invalidateObjectIndex() {
+  objIndexFileSize = 0;
+}
+
+static void updateObjectIndex(uint16_t id, uint32_t pos) {
+  if (id >= FS_INDEX_SIZE || !objIndex) return;
+  objIndex[id] = pos;
+  objIndexFileSize = f.size();
+}
+
+//positions file stream after key (at the start of its object), uses the index if file and ID are indexed
+static bool findObject(const char *file, const char *key, uint16_t id) {
+  size_t keyLen = strlen(key);
+  if (id < FS_INDEX_SIZE && isIndexedFile(file)) {
+    if ((objIndex && objIndexFileSize == f.size()) || buildObjectIndex()) {
+      uint32_t pos = objIndex[id];
+      if (!pos) return false; // not in file
+      char buf[10];
+      if (pos != FS_INDEX_UNKNOWN && keyLen <= sizeof(buf) && f.seek(pos) && (size_t)f.read((uint8_t*)buf, keyLen) == keyLen && !strncmp(buf, key, keyLen)) {
+        DEBUGFS_PRINTF("Indexed at pos %d\n", pos);
+        return true;
+      }
+      // entry does not match file content, search and remember where the key is
+      bool found = bufferedFind(key);
+      objIndex[id] = found ? f.position() - keyLen : FS_INDEX_UNKNOWN;
+      return found;
+    }
+  }
+  return bufferedFind(key);
+}
+
 //fills n bytes from current file pos with ' ' characters
 void writeSpace(uint16_t l)
 {
@@ -175,7 +279,7 @@ void writeSpace(uint16_t l)
   if (knownLargestSpace < l) knownLargestSpace = l;
 }
 
-bool appendObjectToFile(const char* key, JsonDocument* content, uint32_t s, uint32_t contentLen = 0)
+bool appendObjectToFile(const char* key, JsonDocument* content, uint32_t s, uint32_t contentLen = 0, uint16_t id = FS_NO_INDEX)
 {
   #ifdef WLED_DEBUG_FS
     DEBUGFS_PRINTLN(F("Append"));
@@ -200,8 +304,10 @@ bool appendObjectToFile(const char* key, JsonDocument* content, uint32_t s, uint
   DEBUGFS_PRINTF("CLen %d\n", contentLen);
   if (bufferedFindSpace(contentLen + strlen(key) + 1)) {
     if (f.position() > 2) f.write(','); //add comma if not first object
+    pos = f.position();
     f.print(key);
     serializeJson(*content, f);
+    updateObjectIndex(id, pos);
     DEBUGFS_PRINTF("Inserted, took %d ms (total %d)", millis() - s1, millis() - s);
     doCloseFile = true;
     return true;
@@ -243,25 +349,20 @@ bool appendObjectToFile(const char* key, JsonDocument* content, uint32_t s, uint
     f.print('{'); //start JSON
   }
 
+  pos = f.position();
   f.print(key);
 
   //Append object
   serializeJson(*content, f);
   f.write('}');
+  updateObjectIndex(id, pos);
 
   doCloseFile = true;
   DEBUGFS_PRINTF("Appended, took %d ms (total %d)", millis() - s1, millis() - s);
   return true;
 }
 
-bool writeObjectToFileUsingId(const char* file, uint16_t id, JsonDocument* content)
-{
-  char objKey[10];
-  sprintf(objKey, "\"%d\":", id);
-  return writeObjectToFile(file, objKey, content);
-}
-
-bool writeObjectToFile(const char* file, const char* key, JsonDocument* content)
+static bool writeObject(const char* file, const char* key, uint16_t id, JsonDocument* content)
 {
   uint32_t s = 0; //timing
   #ifdef WLED_DEBUG_FS
@@ -278,9 +379,11 @@ bool writeObjectToFile(const char* file, const char* key, JsonDocument* content)
     return false;
   }
 
-  if (!bufferedFind(key)) //key does not exist in file
+  bool found = findObject(file, key, id);
+  if (id >= FS_INDEX_SIZE || !objIndex || objIndexFileSize != f.size()) id = FS_NO_INDEX; // index not in sync, leave it invalid
+  if (!found) //key does not exist in file
   {
-    return appendObjectToFile(key, content, s);
+    return appendObjectToFile(key, content, s, 0, id);
   }
 
   //an object with this key already exists, replace or delete it
@@ -306,17 +409,20 @@ bool writeObjectToFile(const char* file, const char* key, JsonDocument* content)
     f.seek(pos);
     serializeJson(*content, f);
     writeSpace(pos2 - f.position());
+    updateObjectIndex(id, pos - strlen(key));
   } else if (contentLen && bufferedFindSpace(contentLen - oldLen, false)) { //enough leading spaces to replace
     DEBUGFS_PRINTLN(F("replace (trailing)"));
     f.seek(pos);
     serializeJson(*content, f);
+    updateObjectIndex(id, pos - strlen(key));
   } else {
     DEBUGFS_PRINTLN(F("delete"));
     pos -= strlen(key);
     if (pos > 3) pos--; //also delete leading comma if not first object
     f.seek(pos);
     writeSpace(pos2 - pos);
-    if (contentLen) return appendObjectToFile(key, content, s, contentLen);
+    updateObjectIndex(id, 0);
+    if (contentLen) return appendObjectToFile(key, content, s, contentLen, id);
   }
 
   doCloseFile = true;
@@ -324,15 +430,20 @@ bool writeObjectToFile(const char* file, const char* key, JsonDocument* content)
   return true;
 }
 
-bool readObjectFromFileUsingId(const char* file, uint16_t id, JsonDocument* dest)
+bool writeObjectToFileUsingId(const char* file, uint16_t id, JsonDocument* content)
 {
   char objKey[10];
   sprintf(objKey, "\"%d\":", id);
-  return readObjectFromFile(file, objKey, dest);
+  return writeObject(file, objKey, id, content);
+}
+
+bool writeObjectToFile(const char* file, const char* key, JsonDocument* content)
+{
+  return writeObject(file, key, FS_NO_INDEX, content);
 }
 
 //if the key is a nullptr, deserialize entire object
-bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest)
+static bool readObject(const char* file, const char* key, uint16_t id, JsonDocument* dest)
 {
   if (doCloseFile) closeFile();
   #ifdef WLED_DEBUG_FS
@@ -342,7 +453,7 @@ bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest)
   f = WLED_FS.open(file, "r");
   if (!f) return false;
 
-  if (key != nullptr && !bufferedFind(key)) //key does not exist in file
+  if (key != nullptr && !findObject(file, key, id)) //key does not exist in file
   {
     f.close();
     dest->clear();
@@ -357,6 +468,18 @@ bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest)
   return true;
 }
 
+bool readObjectFromFileUsingId(const char* file, uint16_t id, JsonDocument* dest)
+{
+  char objKey[10];
+  sprintf(objKey, "\"%d\":", id);
+  return readObject(file, objKey, id, dest);
+}
+
+bool readObjectFromFile(const char* file, const char* key, JsonDocument* dest)
+{
+  return readObject(file, key, FS_NO_INDEX, dest);
+}
+
 void updateFSInfo() {
   #ifdef ARDUINO_ARCH_ESP32
     #if WLED_FS == LITTLEFS || ESP_IDF_VERSION_MAJOR >= 4
@@ -229,111 +229,138 @@ const uint8_t PAGE_liveview[] PROGMEM = {
 
 
 // Autogenerated from wled00/data/liveviewws.htm, do not edit!!
-const uint16_t PAGE_liveviewws_length = 711;
+const uint16_t PAGE_liveviewws_length = 916;
 const uint8_t PAGE_liveviewws[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x6d, 0x54, 0x5d, 0x8f, 0x9b, 0x3a,
-  0x10, 0x7d, 0xcf, 0xaf, 0xa0, 0xde, 0xdb, 0x2d, 0x56, 0x08, 0x24, 0xdb, 0xdb, 0x2f, 0xc0, 0x59,
-  0xb5, 0xb7, 0x79, 0xa8, 0xb4, 0x6a, 0x57, 0xda, 0x5e, 0xad, 0xaa, 0x55, 0xa4, 0x1a, 0x98, 0x80,
-  0xef, 0x82, 0x1d, 0xd9, 0x43, 0x50, 0x84, 0xf8, 0xef, 0x77, 0x20, 0xdb, 0xac, 0x2a, 0x95, 0x07,
-  0xdb, 0xc3, 0x9c, 0x99, 0x33, 0x33, 0x3e, 0x90, 0xbe, 0xf8, 0xfc, 0xed, 0x9f, 0xef, 0x3f, 0x6e,
-  0x37, 0x5e, 0x85, 0x4d, 0xbd, 0x4e, 0x9f, 0x56, 0x90, 0xc5, 0x3a, 0x6d, 0x00, 0xa5, 0xa7, 0x65,
-  0x03, 0x82, 0x1d, 0x14, 0x74, 0x7b, 0x63, 0x91, 0x79, 0xb3, 0xdc, 0x68, 0x04, 0x8d, 0x82, 0x75,
-  0xaa, 0xc0, 0x4a, 0x14, 0x70, 0x50, 0x39, 0x2c, 0x26, 0x23, 0x50, 0x5a, 0xa1, 0x92, 0xf5, 0xc2,
-  0xe5, 0xb2, 0x06, 0xb1, 0x0a, 0x1a, 0x7a, 0xd1, 0xb4, 0xcd, 0x2f, 0x9b, 0x3d, 0xe5, 0x9c, 0xe5,
-  0x95, 0xb4, 0x0e, 0x28, 0x47, 0x8b, 0xbb, 0xc5, 0x7b, 0xf6, 0x1b, 0x15, 0x56, 0xd0, 0xc0, 0x22,
-  0x37, 0xb5, 0xb1, 0xcc, 0x3b, 0x93, 0x5d, 0x5c, 0x4d, 0x0f, 0x41, 0x51, 0x61, 0x0d, 0xeb, 0xd9,
-  0xfd, 0xcd, 0xe6, 0xb3, 0x77, 0xa3, 0x0e, 0xe0, 0xdd, 0x5a, 0x18, 0xcb, 0x4b, 0xa3, 0x93, 0x27,
-  0x75, 0x78, 0x1c, 0x01, 0x99, 0x29, 0x8e, 0x7d, 0x23, 0x6d, 0xa9, 0x74, 0xbc, 0x1c, 0x2e, 0x72,
-  0xa9, 0x0f, 0x7d, 0x26, 0xf3, 0xc7, 0xd2, 0x9a, 0x56, 0x17, 0xf1, 0xc5, 0x72, 0xb9, 0x4c, 0x76,
-  0xaa, 0x46, 0xb0, 0x71, 0x66, 0x55, 0x59, 0xa1, 0x06, 0xe7, 0xfc, 0xd5, 0xbb, 0x37, 0x2f, 0x79,
-  0x32, 0x75, 0x13, 0xaf, 0x96, 0xcb, 0x97, 0x49, 0x05, 0xa3, 0xef, 0x74, 0xde, 0x1b, 0x47, 0xfd,
-  0x19, 0x1d, 0xcb, 0xcc, 0x99, 0xba, 0x45, 0x18, 0x66, 0x69, 0x74, 0xa2, 0x4b, 0xa3, 0xd3, 0xcc,
-  0x46, 0xd6, 0x75, 0x5a, 0xa8, 0x83, 0xa7, 0x0a, 0xc1, 0x46, 0x52, 0x2a, 0x39, 0x22, 0x9b, 0xea,
-  0xca, 0xad, 0xda, 0xe3, 0x7a, 0x76, 0x90, 0xd6, 0xeb, 0x5c, 0x82, 0xf6, 0xd8, 0x77, 0x4e, 0xa0,
-  0xd9, 0x87, 0x9d, 0xd2, 0x85, 0xe9, 0xc2, 0xce, 0x0d, 0xb9, 0xc4, 0xbc, 0xf2, 0x81, 0xf7, 0x43,
-  0xe7, 0x2e, 0x2f, 0x3b, 0x17, 0x5a, 0xca, 0x7a, 0xbc, 0x43, 0x89, 0x20, 0x84, 0xb8, 0x87, 0xec,
-  0xce, 0xe4, 0x8f, 0x80, 0xe1, 0xb7, 0xdb, 0xcd, 0xd7, 0x6b, 0x72, 0x3b, 0xd0, 0x85, 0xcf, 0xfa,
-  0x57, 0xf5, 0xe1, 0x55, 0x8c, 0xb6, 0x85, 0x81, 0xf1, 0xd8, 0xa7, 0xa1, 0x51, 0x79, 0x10, 0x2a,
-  0xbd, 0x33, 0x3e, 0xbb, 0x05, 0x78, 0xf4, 0xee, 0xef, 0x3c, 0xb3, 0x07, 0xad, 0x74, 0xc9, 0x78,
-  0xe0, 0x13, 0xad, 0x86, 0xce, 0x3b, 0xa7, 0xf3, 0x7d, 0x56, 0x21, 0xee, 0x5d, 0xcc, 0x84, 0x78,
-  0xaa, 0xa5, 0x36, 0x54, 0x0a, 0xb5, 0x1a, 0xee, 0xad, 0x41, 0x43, 0xb7, 0x71, 0xcd, 0x3a, 0xe7,
-  0x58, 0x4c, 0x2b, 0xe3, 0x73, 0x16, 0x47, 0x11, 0x9b, 0x17, 0x26, 0x6f, 0x1b, 0xba, 0x9d, 0x67,
-  0x70, 0x65, 0x1c, 0xce, 0x59, 0x34, 0x62, 0x78, 0x68, 0xf4, 0x48, 0x29, 0x76, 0xad, 0xce, 0x47,
-  0xa7, 0xcf, 0xfb, 0x3f, 0x17, 0x3c, 0xf0, 0x80, 0x1c, 0x99, 0xd2, 0xd2, 0x1e, 0xbf, 0x1f, 0xf7,
-  0x24, 0x01, 0x69, 0xad, 0x3c, 0x66, 0xed, 0x6e, 0x07, 0x96, 0x8d, 0x3e, 0x59, 0x14, 0x9b, 0x03,
-  0x11, 0xdd, 0x28, 0x47, 0x6a, 0x00, 0xeb, 0xb3, 0x86, 0xee, 0x4a, 0x96, 0xc0, 0x02, 0x10, 0xeb,
-  0x7e, 0x9c, 0xa4, 0xda, 0xf9, 0xec, 0xc1, 0x64, 0xff, 0x41, 0x8e, 0xde, 0xc7, 0x31, 0xfc, 0xd3,
-  0x14, 0xbe, 0xa5, 0x8e, 0x68, 0xc4, 0x77, 0x68, 0xa9, 0xf5, 0x90, 0x54, 0x58, 0xfb, 0x10, 0x16,
-  0x12, 0x25, 0xe7, 0x7d, 0x0d, 0xe8, 0xc1, 0x34, 0x88, 0x7f, 0x95, 0xc6, 0xf7, 0x53, 0x94, 0x0f,
-  0x23, 0xcf, 0x09, 0x91, 0x50, 0xce, 0x77, 0x6f, 0x5f, 0x08, 0x78, 0x58, 0x6e, 0xb9, 0x05, 0x6c,
-  0xad, 0x4e, 0xc6, 0x18, 0x52, 0x63, 0xad, 0x34, 0x48, 0xbb, 0x28, 0xad, 0x2c, 0x14, 0xe1, 0xfd,
-  0x0f, 0xcb, 0x02, 0xca, 0x80, 0x05, 0x5a, 0x40, 0x58, 0x83, 0x2e, 0xe9, 0x53, 0xb0, 0xe2, 0x4a,
-  0x50, 0xe8, 0x6a, 0x7b, 0xfd, 0x77, 0x7c, 0x95, 0xec, 0x8c, 0xf5, 0x95, 0xb0, 0x89, 0x4a, 0x75,
-  0xa2, 0xe6, 0xe2, 0x35, 0xc7, 0xb9, 0xf8, 0x69, 0xcb, 0xcc, 0xff, 0xab, 0x87, 0x07, 0xb5, 0x1d,
-  0x82, 0x69, 0x9f, 0xaf, 0xce, 0xa7, 0xab, 0xed, 0xc0, 0x7f, 0x06, 0x04, 0x5f, 0xbc, 0xbe, 0xbc,
-  0xf4, 0x09, 0xcd, 0x02, 0xc6, 0x93, 0x71, 0xe7, 0x2c, 0x38, 0x0f, 0xbe, 0x04, 0xdc, 0xd4, 0x30,
-  0x1e, 0x3f, 0x1d, 0xbf, 0xd0, 0x5c, 0x27, 0xbd, 0xf1, 0x70, 0x92, 0x64, 0xf8, 0x2c, 0x76, 0x81,
-  0xc3, 0xb3, 0xb2, 0x7e, 0xa9, 0x03, 0xac, 0xa5, 0xa2, 0xce, 0xf2, 0x98, 0xcc, 0x98, 0x06, 0xca,
-  0x87, 0x81, 0x8f, 0xb2, 0x3e, 0xa9, 0x35, 0x8d, 0x4e, 0x8a, 0x8e, 0xa6, 0x1f, 0xc3, 0xff, 0x16,
-  0x7e, 0x9e, 0x8e, 0x2e, 0x04, 0x00, 0x00
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x85, 0x54, 0x6d, 0x6f, 0xdb, 0x36,
+  0x10, 0xfe, 0xee, 0x5f, 0xa1, 0x32, 0xab, 0x4b, 0x56, 0xb2, 0xfc, 0x96, 0x26, 0x99, 0x24, 0x3a,
+  0x58, 0xd7, 0x0c, 0x18, 0x10, 0xac, 0x01, 0xd2, 0x21, 0x18, 0x0c, 0x03, 0xa5, 0xc5, 0x93, 0xcd,
+  0x45, 0x26, 0x0d, 0x8a, 0xb6, 0xe0, 0xba, 0xfa, 0xef, 0x3b, 0x4a, 0x8e, 0xb3, 0x0d, 0x03, 0x66,
+  0x18, 0xd4, 0x91, 0xbc, 0x7b, 0xee, 0xe1, 0xbd, 0x65, 0x6f, 0x3e, 0x7d, 0xfe, 0xf9, 0xcb, 0x1f,
+  0x0f, 0x77, 0xc1, 0xda, 0x6d, 0xca, 0x59, 0x76, 0x5a, 0x41, 0xc8, 0x59, 0xb6, 0x01, 0x27, 0x02,
+  0x2d, 0x36, 0xc0, 0xc9, 0x5e, 0x41, 0xbd, 0x35, 0xd6, 0x91, 0xa0, 0x97, 0x1b, 0xed, 0x40, 0x3b,
+  0x4e, 0x6a, 0x25, 0xdd, 0x9a, 0x4b, 0xd8, 0xab, 0x1c, 0x06, 0xed, 0x26, 0x52, 0x5a, 0x39, 0x25,
+  0xca, 0x41, 0x95, 0x8b, 0x12, 0xf8, 0x38, 0xda, 0xe0, 0xc1, 0x66, 0xb7, 0x79, 0xd9, 0x93, 0x13,
+  0x66, 0x2f, 0x5f, 0x0b, 0x5b, 0x01, 0x62, 0xec, 0x5c, 0x31, 0xb8, 0x21, 0xff, 0x70, 0xe5, 0xd6,
+  0xb0, 0x81, 0x41, 0x6e, 0x4a, 0x63, 0x49, 0x70, 0x76, 0x76, 0x31, 0x69, 0x7f, 0xa8, 0xea, 0x94,
+  0x2b, 0x61, 0xd6, 0x7b, 0xba, 0xbf, 0xfb, 0x14, 0xdc, 0xab, 0x3d, 0x04, 0x0f, 0x16, 0x3c, 0xbd,
+  0x6c, 0xd8, 0xdd, 0x64, 0x95, 0x3b, 0x78, 0x85, 0xa5, 0x91, 0x87, 0xe3, 0x46, 0xd8, 0x95, 0xd2,
+  0xc9, 0xa8, 0xb9, 0xc8, 0x85, 0xde, 0x1f, 0x97, 0x22, 0x7f, 0x5e, 0x59, 0xb3, 0xd3, 0x32, 0xb9,
+  0x18, 0x8d, 0x46, 0x69, 0xa1, 0x4a, 0x07, 0x36, 0x59, 0x5a, 0xb5, 0x5a, 0x3b, 0x0d, 0x55, 0x45,
+  0xc7, 0xd7, 0x1f, 0xde, 0xb2, 0xb4, 0x7d, 0x4d, 0x32, 0x1e, 0x8d, 0xde, 0xa6, 0x6b, 0xf0, 0x77,
+  0x9d, 0xbc, 0x35, 0x15, 0xbe, 0xcf, 0xe8, 0x44, 0x2c, 0x2b, 0x53, 0xee, 0x1c, 0x34, 0xbd, 0x6c,
+  0xd8, 0xb9, 0xcb, 0x86, 0x5d, 0xcc, 0xbc, 0xd7, 0x59, 0x26, 0xd5, 0x3e, 0x50, 0x92, 0x13, 0xef,
+  0x14, 0x29, 0x0f, 0x71, 0x8f, 0xbc, 0x72, 0xab, 0xb6, 0x6e, 0xd6, 0xdb, 0x0b, 0x1b, 0x94, 0xfb,
+  0x5f, 0xd2, 0x62, 0xa7, 0x73, 0x8f, 0x16, 0x48, 0xc8, 0x8d, 0x04, 0x2a, 0xd9, 0xb1, 0x04, 0x17,
+  0x14, 0x5c, 0x43, 0x1d, 0xfc, 0xae, 0xb4, 0xbb, 0xf9, 0xc9, 0x5a, 0x71, 0xa0, 0x54, 0xce, 0xa7,
+  0x8b, 0x2c, 0xbb, 0xf9, 0x2e, 0xe7, 0x97, 0x0b, 0xf6, 0x1e, 0xb7, 0x1f, 0x4e, 0xdb, 0x2b, 0xdc,
+  0x4e, 0x59, 0x64, 0x38, 0xbe, 0xc4, 0x58, 0xea, 0xad, 0x15, 0xbf, 0x4e, 0x55, 0x26, 0xe3, 0x12,
+  0xf4, 0xca, 0xad, 0xfb, 0x7d, 0x93, 0x15, 0x27, 0x39, 0xed, 0xe0, 0xb7, 0x5c, 0xce, 0x55, 0x18,
+  0x2e, 0x52, 0x55, 0xd0, 0xf1, 0xe4, 0xa6, 0xbf, 0xed, 0x8e, 0x73, 0x3e, 0x7d, 0x4f, 0xf1, 0xe0,
+  0x1a, 0x0f, 0xc2, 0x31, 0x4b, 0x91, 0x60, 0xbf, 0x8f, 0xcb, 0xc9, 0x98, 0xf3, 0xe2, 0x0c, 0x59,
+  0xc4, 0x98, 0x3a, 0xea, 0xef, 0xaa, 0xdd, 0x52, 0xb4, 0x14, 0x4d, 0x64, 0xc2, 0x1c, 0x89, 0xe0,
+  0x3f, 0xe4, 0x79, 0x03, 0x65, 0x05, 0x01, 0xe2, 0x5f, 0x5d, 0x7a, 0xf8, 0x17, 0x6a, 0x39, 0xa7,
+  0x57, 0xd3, 0x16, 0x3e, 0xcd, 0x07, 0x83, 0x14, 0x35, 0xa7, 0xac, 0xc3, 0x92, 0xaf, 0x48, 0x2a,
+  0x52, 0xa1, 0x7f, 0x12, 0x4b, 0x15, 0xde, 0xb7, 0x48, 0x7f, 0xe3, 0x77, 0xb2, 0x67, 0xe9, 0x7f,
+  0xda, 0x75, 0x0c, 0xd0, 0x2e, 0xef, 0x68, 0x34, 0x16, 0xdc, 0xce, 0x6a, 0x1f, 0x6c, 0x5e, 0x34,
+  0x3e, 0xec, 0x75, 0x95, 0x3a, 0x7b, 0x38, 0xd6, 0x15, 0x77, 0x66, 0x1b, 0xd7, 0x4a, 0x4b, 0x53,
+  0xc7, 0x75, 0xd5, 0xe4, 0xc2, 0xe5, 0x6b, 0x0a, 0xec, 0xd8, 0xd4, 0x55, 0xbf, 0x5f, 0x57, 0xb1,
+  0xc5, 0x64, 0x1e, 0x1e, 0x9d, 0x70, 0xc0, 0x39, 0x7f, 0x82, 0xe5, 0xa3, 0xc9, 0x9f, 0xc1, 0xc5,
+  0x9f, 0x1f, 0xee, 0x7e, 0xbb, 0xc5, 0xeb, 0x0a, 0xb4, 0xa4, 0xe4, 0xf8, 0xae, 0xdc, 0xbf, 0x4b,
+  0x9c, 0xdd, 0x41, 0x84, 0xd2, 0xb7, 0x4e, 0x6c, 0x08, 0x4b, 0x28, 0x96, 0x2d, 0x16, 0x08, 0xc4,
+  0x4a, 0x17, 0x86, 0x92, 0x07, 0x80, 0xe7, 0xe0, 0xe9, 0x31, 0x30, 0x5b, 0xd0, 0x4a, 0xaf, 0x08,
+  0x8b, 0x28, 0x32, 0xf0, 0x59, 0x3e, 0x23, 0x53, 0x4a, 0xd6, 0xce, 0x6d, 0xab, 0x84, 0x70, 0x7e,
+  0xa2, 0x55, 0x1a, 0x64, 0x85, 0xe5, 0x11, 0x6f, 0xad, 0x71, 0x06, 0xfb, 0xe1, 0x96, 0xd4, 0x55,
+  0x45, 0x12, 0x5c, 0x09, 0x0b, 0x49, 0x32, 0x1c, 0x92, 0x50, 0x9a, 0x7c, 0xb7, 0xc1, 0xfe, 0x78,
+  0x55, 0x5e, 0x9b, 0xca, 0x85, 0x64, 0xe8, 0x75, 0x58, 0x6c, 0xb4, 0x77, 0xc9, 0x5f, 0x0a, 0x8d,
+  0xb2, 0xe3, 0xff, 0x72, 0x6f, 0x58, 0x84, 0x3a, 0x4b, 0xa5, 0x85, 0x3d, 0x7c, 0x39, 0x6c, 0xb1,
+  0x1f, 0xdb, 0xf8, 0x2e, 0x77, 0x45, 0x01, 0x96, 0xf8, 0x3b, 0x21, 0xe5, 0xdd, 0x1e, 0x7d, 0xde,
+  0xab, 0x0a, 0x5b, 0x13, 0x2c, 0x25, 0x1b, 0x6c, 0x1c, 0xb1, 0x02, 0x12, 0x01, 0x9f, 0x1d, 0x7d,
+  0x7c, 0x31, 0xf5, 0x64, 0x6e, 0x96, 0x7f, 0x42, 0xee, 0x82, 0xb6, 0x86, 0x3f, 0xb6, 0xe6, 0x0b,
+  0x7c, 0x1c, 0x06, 0xfe, 0xd1, 0x59, 0x8c, 0x42, 0x8c, 0x23, 0xa1, 0xa4, 0x10, 0x4b, 0xe1, 0x04,
+  0xeb, 0x6a, 0x10, 0xfe, 0x5d, 0xf9, 0xe0, 0xfd, 0x74, 0x1a, 0xbe, 0x5c, 0xaf, 0xaf, 0xde, 0x70,
+  0x98, 0x8f, 0x16, 0xac, 0xcb, 0x6b, 0xea, 0x6d, 0x70, 0x34, 0x94, 0x4a, 0x83, 0xb0, 0x83, 0x95,
+  0x15, 0x52, 0xa1, 0x3e, 0xfd, 0x71, 0x24, 0x61, 0x15, 0x91, 0xc8, 0xf2, 0x09, 0x47, 0xfd, 0xf1,
+  0xe2, 0xf6, 0x32, 0x99, 0xa4, 0xd3, 0x4e, 0xee, 0xf7, 0x29, 0xf0, 0x53, 0xc3, 0x01, 0x43, 0x9d,
+  0x11, 0x6b, 0x71, 0x34, 0x87, 0x97, 0x3e, 0xf1, 0xf5, 0xaa, 0xb8, 0xc5, 0x36, 0xd2, 0x6d, 0x11,
+  0x32, 0x17, 0xf2, 0xaf, 0x76, 0xb5, 0xa4, 0x3f, 0x1c, 0x61, 0xae, 0x16, 0x4d, 0xd4, 0x7e, 0xc3,
+  0xf1, 0x59, 0x9a, 0x2c, 0x1a, 0xf6, 0x35, 0x42, 0xf5, 0xc1, 0x14, 0xe1, 0x51, 0x9b, 0x44, 0x84,
+  0xa5, 0xfe, 0xcb, 0x48, 0x74, 0x4e, 0xd1, 0x0a, 0xdc, 0x5d, 0x09, 0x5e, 0xfc, 0x78, 0xf8, 0x15,
+  0x33, 0xd0, 0xce, 0x06, 0x16, 0xb7, 0xe3, 0x23, 0x7e, 0x1d, 0x4c, 0xdc, 0x35, 0xaf, 0xe5, 0xf8,
+  0x52, 0x47, 0x60, 0x2d, 0x92, 0x3a, 0x17, 0x52, 0xbb, 0x4d, 0x30, 0xde, 0xac, 0x69, 0x98, 0x1f,
+  0x41, 0xdd, 0x64, 0xc9, 0x86, 0xdd, 0xf4, 0x19, 0xb6, 0x43, 0xfc, 0x2f, 0x81, 0xb3, 0xdb, 0x05,
+  0xda, 0x05, 0x00, 0x00
 };
 
 
 // Autogenerated from wled00/data/liveviewws2D.htm, do not edit!!
-const uint16_t PAGE_liveviewws2D_length = 818;
+const uint16_t PAGE_liveviewws2D_length = 1053;
 const uint8_t PAGE_liveviewws2D[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x6d, 0x54, 0x6d, 0x6f, 0xdb, 0x36,
-  0x10, 0xfe, 0xee, 0x5f, 0xa1, 0x70, 0x43, 0x2b, 0xda, 0xb2, 0xe4, 0xb8, 0xed, 0x96, 0xd9, 0xa2,
-  0x8b, 0x36, 0x35, 0xb0, 0x02, 0xd9, 0x6a, 0xc0, 0x19, 0x82, 0x21, 0x30, 0x50, 0x5a, 0x3a, 0x5b,
-  0x5c, 0x25, 0xd2, 0xa0, 0xce, 0x96, 0x35, 0x47, 0xff, 0x7d, 0x47, 0xc9, 0xf1, 0x32, 0x74, 0xfa,
-  0x40, 0x91, 0xf7, 0xf2, 0xdc, 0xf1, 0xb9, 0x3b, 0xc6, 0x57, 0x9f, 0xbe, 0xdc, 0xde, 0xff, 0xb9,
-  0x98, 0x7b, 0x19, 0x16, 0xf9, 0x2c, 0x3e, 0xaf, 0x20, 0xd3, 0x59, 0x5c, 0x00, 0x4a, 0x4f, 0xcb,
-  0x02, 0x04, 0x3b, 0x28, 0xa8, 0x76, 0xc6, 0x22, 0xf3, 0x7a, 0x89, 0xd1, 0x08, 0x1a, 0x05, 0xab,
-  0x54, 0x8a, 0x99, 0x48, 0xe1, 0xa0, 0x12, 0x18, 0xb6, 0x87, 0x40, 0x69, 0x85, 0x4a, 0xe6, 0xc3,
-  0x32, 0x91, 0x39, 0x88, 0xeb, 0xa0, 0x20, 0x41, 0xb1, 0x2f, 0x9e, 0xcf, 0xec, 0x8c, 0xd9, 0x4b,
-  0x32, 0x69, 0x4b, 0x20, 0x8c, 0x3d, 0x6e, 0x86, 0x37, 0xec, 0x3f, 0xa1, 0x30, 0x83, 0x02, 0x86,
-  0x89, 0xc9, 0x8d, 0x65, 0xde, 0x25, 0xd8, 0x0f, 0xe3, 0xf6, 0x23, 0x53, 0x54, 0x98, 0xc3, 0xac,
-  0xf7, 0x70, 0x37, 0xff, 0xe4, 0xdd, 0xa9, 0x03, 0x78, 0x0b, 0x0b, 0x2e, 0xbd, 0x38, 0xea, 0x34,
-  0x71, 0x89, 0x35, 0xfd, 0xd6, 0x26, 0xad, 0x4f, 0x85, 0xb4, 0x5b, 0xa5, 0x27, 0xa3, 0x26, 0x8e,
-  0x3a, 0x69, 0x1c, 0x75, 0x57, 0x73, 0xda, 0x59, 0x9c, 0x48, 0x7d, 0x90, 0xa5, 0xd7, 0x53, 0xa9,
-  0x60, 0x6e, 0x4f, 0xe8, 0x51, 0x27, 0x23, 0x94, 0xc4, 0xaa, 0x1d, 0xce, 0x7a, 0x07, 0x69, 0xbd,
-  0x44, 0xa4, 0x26, 0xd9, 0x17, 0x94, 0x48, 0xb8, 0x05, 0x9c, 0xe7, 0xe0, 0xb6, 0x1f, 0xeb, 0xcf,
-  0xa9, 0xdf, 0xb9, 0xf1, 0x20, 0x87, 0xb4, 0x14, 0x8c, 0x05, 0x98, 0x59, 0x83, 0x94, 0x45, 0x2a,
-  0xae, 0xae, 0xa7, 0x9b, 0xbd, 0x4e, 0x50, 0x19, 0xed, 0xd1, 0x55, 0x6f, 0x5b, 0x58, 0x9f, 0x9f,
-  0x92, 0xb0, 0xe3, 0x2d, 0xfc, 0xe5, 0xa6, 0x5f, 0x29, 0x9d, 0x9a, 0x2a, 0x54, 0x5a, 0x83, 0x7d,
-  0x68, 0x09, 0x4c, 0xc2, 0x0c, 0xd4, 0x36, 0xc3, 0xef, 0xd4, 0xbf, 0xb6, 0xe2, 0xe6, 0x05, 0xd2,
-  0xb4, 0xcd, 0x0c, 0x8f, 0x22, 0x71, 0x49, 0xdd, 0x3a, 0xa2, 0x8e, 0xe8, 0xb3, 0x71, 0xca, 0xf8,
-  0x54, 0x6d, 0x7c, 0xd2, 0xf0, 0x93, 0x33, 0xa9, 0xca, 0x29, 0xda, 0xfa, 0x54, 0x95, 0x02, 0xcd,
-  0x2e, 0x3c, 0x63, 0x56, 0x65, 0x93, 0x48, 0x4c, 0x32, 0x1f, 0xf9, 0xa9, 0xa9, 0xca, 0x57, 0xaf,
-  0xaa, 0x32, 0xb4, 0xc4, 0x4c, 0xbd, 0x44, 0x89, 0x20, 0x84, 0x78, 0x80, 0xf5, 0xd2, 0x24, 0xdf,
-  0x00, 0xc3, 0x2f, 0x8b, 0xf9, 0xef, 0xef, 0x49, 0x5d, 0x82, 0xa6, 0xfb, 0x9e, 0x5e, 0xe7, 0x87,
-  0xd7, 0x13, 0xb4, 0x7b, 0x68, 0x18, 0x9f, 0xf8, 0x84, 0xaa, 0xa1, 0xf2, 0x2e, 0xd6, 0xbe, 0xcf,
-  0x32, 0xc4, 0x5d, 0x39, 0x61, 0x42, 0x9c, 0x43, 0xe5, 0x86, 0x22, 0x11, 0x0b, 0xe1, 0x8e, 0xa8,
-  0x31, 0x54, 0xd7, 0xf7, 0xac, 0x2a, 0x4b, 0x36, 0xa1, 0x95, 0xf1, 0x01, 0x9b, 0x44, 0x11, 0x1b,
-  0x5c, 0xe8, 0xbd, 0x18, 0x67, 0xa6, 0xc4, 0x01, 0x8b, 0x9c, 0x0d, 0x0f, 0x8d, 0x36, 0x3b, 0xd0,
-  0xc2, 0xe7, 0x62, 0x76, 0xfa, 0xff, 0x4c, 0x9a, 0x80, 0xe4, 0x6b, 0xa5, 0xa5, 0xad, 0xef, 0xeb,
-  0x1d, 0x75, 0x91, 0xb4, 0x56, 0xd6, 0xeb, 0xfd, 0x66, 0x03, 0x96, 0x39, 0x9d, 0x4c, 0xd3, 0xf9,
-  0x81, 0x22, 0xdc, 0xa9, 0x92, 0x1a, 0x0a, 0xac, 0xcf, 0x0a, 0x28, 0x4b, 0xb9, 0x05, 0xaa, 0x19,
-  0xa1, 0x3a, 0x86, 0x88, 0x34, 0xf6, 0x68, 0xd6, 0x7f, 0x41, 0x82, 0xde, 0x07, 0xe7, 0xfe, 0xb1,
-  0x75, 0x5f, 0xd1, 0x55, 0x88, 0xba, 0x25, 0x5a, 0xa5, 0xb7, 0x21, 0x35, 0x72, 0xee, 0x63, 0x98,
-  0x4a, 0x94, 0x9c, 0x9f, 0x72, 0x40, 0x0f, 0x5b, 0x06, 0xfe, 0x50, 0x1a, 0x6f, 0x5a, 0x2f, 0x1f,
-  0x5c, 0x9c, 0xce, 0xc2, 0x15, 0xe2, 0xe7, 0x9f, 0xae, 0x04, 0x3e, 0x8e, 0x56, 0x4f, 0x4f, 0x63,
-  0xb7, 0xb9, 0xa6, 0xcd, 0x95, 0x2b, 0x8e, 0x05, 0xdc, 0x5b, 0x3d, 0x75, 0x10, 0x96, 0xe4, 0xe3,
-  0x55, 0xa0, 0xe9, 0xf7, 0x66, 0x15, 0x18, 0xf1, 0x9b, 0xc4, 0x2c, 0xa4, 0xd9, 0xf1, 0xcf, 0xcd,
-  0x12, 0xd9, 0x4b, 0x63, 0x44, 0x9a, 0x07, 0xb2, 0x33, 0xd8, 0xe4, 0xc6, 0x58, 0xff, 0xd9, 0x66,
-  0x68, 0xfa, 0x96, 0x47, 0xe3, 0xae, 0x2d, 0x40, 0xbc, 0x9d, 0x6e, 0x48, 0x59, 0x8b, 0xf0, 0xdd,
-  0xb4, 0x8e, 0xf5, 0xb4, 0x1e, 0x0c, 0xb8, 0x13, 0x1c, 0x9d, 0xe0, 0x18, 0xdb, 0xe9, 0x91, 0x04,
-  0x94, 0x45, 0xb8, 0x51, 0x79, 0xbe, 0x74, 0xa3, 0x21, 0xbe, 0xda, 0xed, 0xda, 0xff, 0xf1, 0x84,
-  0x8f, 0xb0, 0x6a, 0x82, 0xf6, 0x3f, 0xb8, 0xbe, 0xec, 0xc6, 0xab, 0x86, 0x7f, 0x0d, 0x9c, 0xc3,
-  0x1a, 0x68, 0xa2, 0x16, 0x14, 0xdf, 0xe7, 0xed, 0x59, 0xda, 0xc4, 0x3f, 0xf6, 0xcd, 0x40, 0x06,
-  0x75, 0xdf, 0x04, 0xe1, 0x5b, 0x5a, 0x46, 0xc1, 0xb8, 0xdf, 0x66, 0xb8, 0xf8, 0xdc, 0xd9, 0xb8,
-  0x20, 0x64, 0x0e, 0x03, 0xf1, 0xa6, 0xf9, 0xb7, 0xef, 0x68, 0xb6, 0x4b, 0x93, 0x43, 0x08, 0xd6,
-  0x52, 0x66, 0x6c, 0x01, 0xf0, 0xcd, 0x7b, 0x58, 0x7a, 0xed, 0x71, 0x42, 0x65, 0xe1, 0x4d, 0xc3,
-  0x9b, 0x73, 0x13, 0x7d, 0x5f, 0x3e, 0x0b, 0xa5, 0xfa, 0xfb, 0xb9, 0x7a, 0xcf, 0x53, 0xf7, 0xf4,
-  0xe4, 0xbf, 0x98, 0x90, 0x97, 0xd3, 0x38, 0x0a, 0x48, 0x71, 0xaf, 0x0a, 0x30, 0x7b, 0x6a, 0x52,
-  0xfe, 0xd2, 0x89, 0x46, 0xb5, 0x09, 0xc6, 0xef, 0x46, 0x9c, 0x37, 0xbc, 0x47, 0x0f, 0x45, 0x37,
-  0xf8, 0x71, 0xd4, 0xbd, 0x11, 0x51, 0xfb, 0x22, 0xfe, 0x03, 0x69, 0xb3, 0xce, 0x95, 0x27, 0x05,
-  0x00, 0x00
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0x85, 0x55, 0xfb, 0x6f, 0xdb, 0x36,
+  0x10, 0xfe, 0xdd, 0x7f, 0x85, 0xc2, 0x0d, 0xae, 0x68, 0xc9, 0x92, 0x1f, 0x79, 0xcd, 0x12, 0x53,
+  0xac, 0x69, 0x86, 0x15, 0xc8, 0x56, 0x03, 0xe9, 0x10, 0x0c, 0x86, 0x81, 0xca, 0xd4, 0xc9, 0xe6,
+  0x2a, 0x93, 0x06, 0x45, 0x3f, 0x54, 0x47, 0xff, 0xfb, 0x8e, 0x92, 0xec, 0x66, 0xeb, 0x80, 0x19,
+  0x86, 0xc4, 0x7b, 0x7d, 0x77, 0x24, 0xbf, 0x3b, 0xc5, 0x17, 0xef, 0x3f, 0xde, 0x7f, 0xfa, 0x73,
+  0xfa, 0xe0, 0xac, 0xcc, 0x3a, 0xbf, 0x8b, 0xdb, 0x27, 0x24, 0xe9, 0x5d, 0xbc, 0x06, 0x93, 0x38,
+  0x32, 0x59, 0x03, 0x23, 0x3b, 0x01, 0xfb, 0x8d, 0xd2, 0x86, 0x38, 0x1d, 0xae, 0xa4, 0x01, 0x69,
+  0x18, 0xd9, 0x8b, 0xd4, 0xac, 0x58, 0x0a, 0x3b, 0xc1, 0xa1, 0x5f, 0x0b, 0xbe, 0x90, 0xc2, 0x88,
+  0x24, 0xef, 0x17, 0x3c, 0xc9, 0x81, 0x0d, 0xfd, 0x35, 0x2a, 0xd6, 0xdb, 0xf5, 0x49, 0x26, 0x2d,
+  0x66, 0x87, 0xaf, 0x12, 0x5d, 0x00, 0x62, 0x6c, 0x4d, 0xd6, 0xbf, 0x25, 0xff, 0x48, 0x65, 0x56,
+  0xb0, 0x86, 0x3e, 0x57, 0xb9, 0xd2, 0xc4, 0x39, 0x27, 0xfb, 0x61, 0x54, 0xff, 0xd0, 0xd5, 0x08,
+  0x93, 0xc3, 0x5d, 0xe7, 0xf9, 0xf1, 0xe1, 0xbd, 0xf3, 0x28, 0x76, 0xe0, 0x4c, 0x35, 0xd8, 0xf2,
+  0xe2, 0xb0, 0xb1, 0xc4, 0x85, 0x29, 0xf1, 0xb5, 0x50, 0x69, 0x79, 0x5c, 0x27, 0x7a, 0x29, 0xe4,
+  0x64, 0x50, 0xc5, 0x61, 0xa3, 0x8d, 0xc3, 0x66, 0x6b, 0xd6, 0x7a, 0x17, 0xf3, 0x44, 0xee, 0x92,
+  0xc2, 0xe9, 0x88, 0x94, 0x11, 0xbb, 0x46, 0xf4, 0xb0, 0xd1, 0x21, 0x0a, 0xd7, 0x62, 0x63, 0xee,
+  0x3a, 0xbb, 0x44, 0x3b, 0x9c, 0xa5, 0x8a, 0x6f, 0xd7, 0x58, 0x48, 0xb0, 0x04, 0xf3, 0x90, 0x83,
+  0x5d, 0xbe, 0x2b, 0x3f, 0xa4, 0x6e, 0x13, 0x46, 0xfd, 0x1c, 0xd2, 0x82, 0x11, 0xe2, 0x9b, 0x95,
+  0x56, 0x06, 0xab, 0x48, 0xd9, 0xc5, 0x30, 0xb2, 0xa1, 0xf9, 0xee, 0x97, 0x28, 0xdb, 0x4a, 0x6e,
+  0x84, 0x92, 0x4e, 0x0a, 0x5c, 0xa5, 0xe0, 0xa6, 0xf4, 0x98, 0x83, 0x71, 0x32, 0x26, 0x61, 0xef,
+  0xfc, 0x21, 0xa4, 0xb9, 0xfd, 0x59, 0xeb, 0xa4, 0x74, 0xdd, 0x74, 0x36, 0x9e, 0xc7, 0xf1, 0xed,
+  0x4b, 0x3a, 0xbb, 0x9c, 0xd3, 0x1e, 0x8a, 0x57, 0xad, 0x78, 0x8d, 0xe2, 0x98, 0xfa, 0x8a, 0x0d,
+  0xa2, 0x4c, 0x69, 0xd7, 0x46, 0x0b, 0x76, 0x13, 0x89, 0x38, 0x0d, 0x72, 0x90, 0x4b, 0xb3, 0xea,
+  0x76, 0x55, 0x9c, 0xb5, 0xeb, 0xa8, 0x81, 0xdf, 0xb0, 0x74, 0x26, 0x3c, 0x6f, 0x1e, 0x89, 0xcc,
+  0x1d, 0x8e, 0x6e, 0xbb, 0x9b, 0x46, 0xcd, 0xd9, 0xb8, 0xe7, 0xa2, 0xe2, 0x06, 0x15, 0xde, 0x90,
+  0x46, 0x58, 0x60, 0xb7, 0x8b, 0x8f, 0x36, 0x98, 0xb1, 0xec, 0x0c, 0x99, 0x05, 0x78, 0x47, 0xae,
+  0xb5, 0x15, 0xdb, 0x45, 0x52, 0x97, 0xa8, 0x7c, 0xe5, 0x71, 0x2c, 0x04, 0xff, 0x1e, 0xe3, 0x15,
+  0xe4, 0x05, 0x38, 0x88, 0x7f, 0x7d, 0x69, 0xe1, 0x4f, 0xa5, 0x71, 0xe6, 0x5e, 0x8f, 0x6b, 0xf8,
+  0x88, 0xf7, 0xfb, 0x11, 0x7a, 0x8e, 0x69, 0x83, 0x95, 0x7e, 0x43, 0x12, 0xbe, 0xf0, 0xec, 0x96,
+  0x68, 0x24, 0xd0, 0x5e, 0x23, 0xbd, 0xaa, 0xaf, 0x8d, 0xa7, 0xd1, 0x7f, 0xc6, 0x35, 0x15, 0x60,
+  0x1c, 0x6f, 0xca, 0xa8, 0x34, 0x98, 0xad, 0x96, 0xf6, 0xb0, 0x59, 0x56, 0x9d, 0x8f, 0x1b, 0x23,
+  0xef, 0xeb, 0xdb, 0x74, 0xe9, 0x91, 0x07, 0x0d, 0x5d, 0x83, 0x9f, 0x6e, 0x7b, 0x7b, 0x21, 0x53,
+  0xb5, 0x0f, 0x84, 0x94, 0xa0, 0x9f, 0x6b, 0xde, 0xf2, 0x60, 0x05, 0x62, 0xb9, 0x32, 0xdf, 0x99,
+  0x7f, 0xad, 0xd5, 0xd5, 0x2b, 0xa4, 0xfa, 0x56, 0xb9, 0x39, 0x30, 0x6e, 0xb9, 0x70, 0x6f, 0xf9,
+  0x79, 0x30, 0x2e, 0x19, 0xa5, 0x84, 0xda, 0x93, 0x46, 0x0b, 0x3d, 0x5a, 0x97, 0x7d, 0x11, 0x19,
+  0x5d, 0x1e, 0xf7, 0x05, 0x33, 0x6a, 0x13, 0xb4, 0x98, 0xfb, 0xa2, 0xe2, 0x89, 0xe1, 0x2b, 0xd7,
+  0xd0, 0x63, 0xb5, 0x2f, 0xba, 0xdd, 0x7d, 0x11, 0x68, 0x24, 0x64, 0xf9, 0x64, 0x12, 0x03, 0x8c,
+  0xb1, 0x67, 0x58, 0x3c, 0x29, 0xfe, 0x05, 0x4c, 0xf0, 0x71, 0xfa, 0xf0, 0xfb, 0x5b, 0x34, 0x17,
+  0x20, 0x91, 0x66, 0xc7, 0x37, 0xf9, 0xee, 0xcd, 0xc4, 0xe8, 0x2d, 0xf8, 0xb8, 0xfa, 0xda, 0x2c,
+  0x2b, 0x42, 0x27, 0x2e, 0x26, 0xb0, 0x34, 0x3a, 0x07, 0xba, 0x2e, 0x59, 0x19, 0xb3, 0x29, 0x26,
+  0x84, 0xb1, 0x36, 0x6b, 0xae, 0x30, 0x29, 0x1e, 0x48, 0xb0, 0x41, 0x72, 0x2a, 0xec, 0xac, 0xb7,
+  0x64, 0x5f, 0x14, 0x64, 0x82, 0x4f, 0x42, 0x3d, 0x32, 0x09, 0x43, 0xe2, 0x9d, 0x09, 0x7e, 0x76,
+  0x5e, 0xa9, 0xc2, 0x78, 0x24, 0xb4, 0x3e, 0x34, 0x50, 0x52, 0x6d, 0x40, 0x32, 0x97, 0xb2, 0xbb,
+  0xe3, 0xff, 0x16, 0x55, 0xf9, 0xe8, 0xb2, 0x10, 0x32, 0xd1, 0xe5, 0xa7, 0x72, 0x83, 0x2d, 0x5d,
+  0xdf, 0xdc, 0x62, 0x9b, 0x65, 0xa0, 0x89, 0xb5, 0x25, 0x69, 0xfa, 0xb0, 0xc3, 0x64, 0x8f, 0xa2,
+  0xc0, 0xee, 0x06, 0xed, 0x92, 0x35, 0x14, 0x45, 0xb2, 0x04, 0x6c, 0x20, 0x4c, 0x60, 0xcf, 0x0d,
+  0x8f, 0x92, 0xcc, 0xd4, 0xe2, 0x2f, 0xe0, 0xc6, 0xa9, 0xbb, 0xe3, 0x5d, 0x1d, 0x3e, 0xc7, 0x5d,
+  0xe1, 0x81, 0x3e, 0x19, 0x2d, 0xe4, 0x32, 0xc0, 0xa9, 0x92, 0xbb, 0x26, 0x48, 0x13, 0x93, 0xd0,
+  0x86, 0xdd, 0xe6, 0xdf, 0x3d, 0x05, 0x36, 0x4f, 0xe3, 0x61, 0xaf, 0xe7, 0xe6, 0xfa, 0x82, 0x99,
+  0xd9, 0x60, 0xfe, 0xf2, 0x72, 0x61, 0x6f, 0xaa, 0xe1, 0x4d, 0x64, 0x23, 0xb5, 0x2f, 0x7d, 0xb0,
+  0x2e, 0x63, 0x4c, 0x30, 0x1b, 0xce, 0xbb, 0xdd, 0x51, 0xd7, 0xcc, 0x46, 0x73, 0xaa, 0x51, 0x6c,
+  0xda, 0xd2, 0x60, 0x5b, 0xfa, 0x12, 0xc5, 0xab, 0x56, 0xbc, 0x9e, 0x63, 0xbd, 0x6d, 0x53, 0x1b,
+  0xea, 0x03, 0xb6, 0x67, 0xcd, 0x63, 0x44, 0x19, 0x5d, 0xd4, 0x28, 0xa7, 0x0c, 0x16, 0x64, 0xd4,
+  0x04, 0x8f, 0xe7, 0xe8, 0x78, 0x59, 0xd9, 0x9c, 0x8a, 0xfd, 0x96, 0x98, 0x55, 0x80, 0x53, 0xd2,
+  0x6d, 0xf9, 0x19, 0xea, 0x33, 0x17, 0x43, 0x49, 0xfd, 0xa4, 0x71, 0xc8, 0x72, 0x85, 0xad, 0x75,
+  0xf2, 0xe9, 0xab, 0x9e, 0xa6, 0xe1, 0x88, 0xd6, 0xa3, 0xa0, 0x64, 0xc1, 0x55, 0x54, 0xc6, 0x32,
+  0x2a, 0x3d, 0x8f, 0x5a, 0xc5, 0xc1, 0x2a, 0x0e, 0xb1, 0x8e, 0x0e, 0xa8, 0xc0, 0x3d, 0x06, 0x99,
+  0xc8, 0xf3, 0x27, 0x3b, 0xfc, 0xd8, 0x67, 0xbd, 0x5c, 0xb8, 0x3f, 0x1e, 0xcd, 0x0c, 0xe6, 0x95,
+  0x5f, 0xbf, 0xbd, 0xe1, 0x79, 0x35, 0x9a, 0x57, 0xf4, 0xb3, 0x6f, 0x03, 0x16, 0x80, 0x33, 0x73,
+  0x8a, 0x79, 0x5d, 0x5a, 0xcb, 0x89, 0xe6, 0xee, 0xa1, 0xa7, 0xbc, 0xc4, 0x2f, 0x7b, 0xca, 0x0f,
+  0x2e, 0xf1, 0x31, 0xf0, 0x47, 0xbd, 0xba, 0xb2, 0xe9, 0x87, 0xc6, 0xc7, 0x26, 0x41, 0x77, 0xb0,
+  0xad, 0xfc, 0x8d, 0xe2, 0x38, 0xbd, 0x0b, 0x95, 0x43, 0x00, 0x5a, 0x63, 0x65, 0x64, 0x0a, 0xf0,
+  0xc5, 0x79, 0x7e, 0x72, 0x6a, 0x71, 0x82, 0x77, 0x4d, 0xab, 0x8a, 0x56, 0x2d, 0x49, 0xbf, 0xe7,
+  0x84, 0x86, 0x42, 0x7c, 0x3d, 0x51, 0xe2, 0x34, 0x57, 0x5f, 0x5e, 0xdc, 0x57, 0xcd, 0xf8, 0x7a,
+  0xde, 0x0e, 0x7c, 0x34, 0x7c, 0x12, 0x6b, 0x50, 0x5b, 0x6c, 0x02, 0xfa, 0x3a, 0x08, 0x87, 0x71,
+  0xe5, 0x8f, 0xae, 0x06, 0x94, 0x56, 0xb4, 0x83, 0x9f, 0x82, 0x66, 0xb4, 0xc7, 0x61, 0xf3, 0x15,
+  0x08, 0xeb, 0x6f, 0xde, 0xdf, 0xcd, 0x68, 0xdd, 0x0c, 0x09, 0x07, 0x00, 0x00
 };
 
 
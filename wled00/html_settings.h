@@ -271,479 +271,478 @@ const uint8_t PAGE_settings_wifi[] PROGMEM = {
 
 
 // Autogenerated from wled00/data/settings_leds.htm, do not edit!!
-const uint16_t PAGE_settings_leds_length = 7521;
+const uint16_t PAGE_settings_leds_length = 7514;
 const uint8_t PAGE_settings_leds[] PROGMEM = {
   0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0xdd, 0x3c, 0x6b, 0x77, 0xda, 0xc8,
-  0x92, 0xdf, 0xf9, 0x15, 0x6d, 0xcd, 0x8c, 0x23, 0x5d, 0x04, 0x48, 0x3c, 0x32, 0x04, 0x10, 0x5e,
-  0xe3, 0x3c, 0xc6, 0x77, 0xec, 0xb1, 0x0f, 0x78, 0x92, 0x7b, 0x4f, 0x26, 0x27, 0x11, 0x52, 0x03,
-  0x8a, 0x85, 0xc4, 0x95, 0x84, 0x1f, 0x6b, 0xb3, 0xbf, 0x69, 0x7f, 0xc3, 0xfe, 0xb2, 0xad, 0xea,
-  0x6e, 0xbd, 0x40, 0x02, 0x67, 0xcf, 0xfd, 0xb4, 0x73, 0xce, 0xc4, 0x20, 0x55, 0x57, 0x57, 0x57,
-  0xd7, 0xbb, 0xab, 0x19, 0x1c, 0xbd, 0xbd, 0x3a, 0xbb, 0xf9, 0xe7, 0xf5, 0x3b, 0xb2, 0x88, 0x96,
-  0xee, 0x70, 0x80, 0xff, 0x12, 0xd7, 0xf4, 0xe6, 0x86, 0x44, 0x3d, 0x09, 0xbe, 0x53, 0xd3, 0x1e,
-  0x0e, 0x96, 0x34, 0x32, 0x89, 0xb5, 0x30, 0x83, 0x90, 0x46, 0x86, 0xb4, 0x8e, 0x66, 0xb5, 0xae,
-  0x24, 0x9e, 0x56, 0x3c, 0x73, 0x49, 0x0d, 0xe9, 0xce, 0xa1, 0xf7, 0x2b, 0x3f, 0x88, 0x24, 0x62,
-  0xf9, 0x5e, 0x44, 0x3d, 0x00, 0xbb, 0x77, 0xec, 0x68, 0x61, 0x74, 0x34, 0x2d, 0x01, 0xdd, 0x7a,
-  0x65, 0xd3, 0x3b, 0xc7, 0xa2, 0x35, 0xf6, 0x45, 0x75, 0x3c, 0x27, 0x72, 0x4c, 0xb7, 0x16, 0x5a,
-  0xa6, 0x4b, 0x0d, 0x5d, 0x5d, 0x9a, 0x0f, 0xce, 0x72, 0xbd, 0x4c, 0xbe, 0xaf, 0x43, 0x1a, 0xb0,
-  0x2f, 0xe6, 0x14, 0xbe, 0x7b, 0xbe, 0xb4, 0x33, 0xf3, 0x70, 0x10, 0x39, 0x91, 0x4b, 0x87, 0x17,
-  0xef, 0xde, 0x92, 0x09, 0x8d, 0x22, 0xc7, 0x9b, 0x87, 0x83, 0x06, 0x7f, 0x36, 0x08, 0xad, 0xc0,
-  0x59, 0x45, 0xc3, 0xca, 0x9d, 0x19, 0x10, 0xdb, 0xb0, 0x7d, 0x6b, 0xbd, 0x04, 0x4a, 0x54, 0xd7,
-  0x5c, 0x05, 0xf4, 0xce, 0xe8, 0x74, 0x70, 0xbe, 0x11, 0x9f, 0xf6, 0xa3, 0xa1, 0xe1, 0x9f, 0x4b,
-  0xa3, 0x4d, 0x5b, 0xf8, 0xe1, 0x7a, 0x64, 0xb4, 0xb5, 0x37, 0xaf, 0xf1, 0xe3, 0x85, 0xa1, 0xb7,
-  0x5a, 0xec, 0xe1, 0xc5, 0xf4, 0x5f, 0x6b, 0x3f, 0x32, 0xb4, 0xbe, 0x5d, 0x5f, 0x2f, 0xbf, 0xae,
-  0x8c, 0xcf, 0x5f, 0x54, 0xbb, 0x1e, 0x84, 0x77, 0xb6, 0xf8, 0xe4, 0x7f, 0x9d, 0xaf, 0x1c, 0x9f,
-  0x7f, 0x01, 0x70, 0xfe, 0xad, 0xf5, 0xa6, 0x8f, 0xf3, 0xbb, 0xbe, 0xe5, 0xac, 0xd4, 0xc8, 0x59,
-  0x52, 0x7f, 0x1d, 0xa9, 0xd6, 0x3a, 0x8c, 0xfc, 0xe5, 0x24, 0x32, 0x83, 0x28, 0x34, 0x8e, 0x74,
-  0x35, 0x64, 0x9f, 0xde, 0x3a, 0x41, 0xf4, 0x88, 0xc3, 0x61, 0xf0, 0xd9, 0xd5, 0xd5, 0x1d, 0x0d,
-  0x02, 0xc7, 0xa6, 0xa1, 0xd1, 0x51, 0x61, 0x34, 0x80, 0xf5, 0x67, 0x6b, 0xcf, 0x8a, 0x1c, 0xdf,
-  0x23, 0xbf, 0xc9, 0xca, 0xd3, 0xbd, 0xe3, 0xd9, 0xfe, 0x7d, 0xdd, 0x5f, 0x51, 0x4f, 0x96, 0x16,
-  0x51, 0xb4, 0x0a, 0x7b, 0x8d, 0xc6, 0xad, 0xe7, 0xd7, 0xef, 0x5d, 0x6a, 0xd7, 0xe7, 0xb4, 0x31,
-  0xa3, 0x66, 0xb4, 0x0e, 0x68, 0xd8, 0x08, 0x05, 0x63, 0x1a, 0x3f, 0xc1, 0x9b, 0x5a, 0xfc, 0x4d,
-  0x52, 0x36, 0x09, 0xbe, 0xd1, 0x36, 0xbe, 0x64, 0x8c, 0xa4, 0x4a, 0x5f, 0x43, 0xea, 0xce, 0xb2,
-  0xd0, 0xf3, 0x73, 0x5b, 0xa6, 0xca, 0x53, 0x40, 0x01, 0xbd, 0x47, 0x70, 0xae, 0xe8, 0x9d, 0x4b,
-  0x91, 0xb7, 0xa3, 0x47, 0xf6, 0x2a, 0x05, 0xf5, 0x67, 0x33, 0x04, 0xcd, 0xc2, 0x84, 0xa3, 0xc7,
-  0x3f, 0x60, 0x13, 0xe1, 0xf1, 0x67, 0xed, 0x4b, 0xfd, 0xce, 0x74, 0xd7, 0xd4, 0xa8, 0xe9, 0xe9,
-  0x10, 0xd7, 0x37, 0xed, 0xbf, 0x4f, 0x64, 0xaa, 0x7a, 0xc6, 0x91, 0xa6, 0x3c, 0xb9, 0x34, 0x22,
-  0x91, 0x61, 0xd7, 0xad, 0x00, 0x96, 0x43, 0x05, 0x0e, 0x59, 0xe2, 0x7b, 0x2b, 0x29, 0xfd, 0xa8,
-  0x0e, 0xa4, 0x9e, 0x46, 0x51, 0xe0, 0x4c, 0xd7, 0x11, 0x85, 0x17, 0x81, 0x25, 0xa9, 0x54, 0x51,
-  0xb7, 0x9f, 0x47, 0x8f, 0x2b, 0x0a, 0x8b, 0x89, 0xe8, 0x43, 0xd4, 0xf8, 0x6e, 0xde, 0x99, 0x31,
-  0x82, 0x1d, 0x40, 0x33, 0x7c, 0xf4, 0x00, 0x85, 0xa7, 0xc0, 0x2e, 0x4e, 0x7d, 0xfb, 0xb1, 0x6e,
-  0xae, 0x80, 0x25, 0xf6, 0xd9, 0xc2, 0x71, 0x6d, 0x39, 0x42, 0x78, 0xd3, 0xb6, 0xdf, 0xdd, 0x01,
-  0x15, 0x17, 0x4e, 0x08, 0xa2, 0x4d, 0x03, 0x59, 0x42, 0x9a, 0x25, 0x55, 0x56, 0x8c, 0xe1, 0xd3,
-  0x07, 0x1a, 0x7d, 0x94, 0x15, 0xd5, 0x5a, 0x50, 0xeb, 0x76, 0xe2, 0xc0, 0x27, 0xc4, 0x3e, 0xba,
-  0x80, 0x0f, 0x35, 0xdd, 0x30, 0xb8, 0xe4, 0xc0, 0xc2, 0x8f, 0x8f, 0xf9, 0xc7, 0x7a, 0xb8, 0x70,
-  0x66, 0x91, 0xac, 0x6c, 0x8a, 0x11, 0x83, 0x08, 0xf8, 0x01, 0xac, 0x07, 0x10, 0x83, 0x22, 0x85,
-  0xbe, 0x4b, 0xeb, 0xae, 0x3f, 0x97, 0xa5, 0x77, 0xf8, 0x9c, 0x08, 0x6e, 0xc1, 0x3e, 0x91, 0x99,
-  0xe3, 0x52, 0xb6, 0x6e, 0xd0, 0x9c, 0x00, 0xf8, 0x73, 0x21, 0x9e, 0xfb, 0x33, 0x54, 0xce, 0x99,
-  0x33, 0x5f, 0x07, 0x26, 0x63, 0x2f, 0x5f, 0x37, 0x99, 0x99, 0x0e, 0x8a, 0xc9, 0x5f, 0xde, 0xb9,
-  0x67, 0xf9, 0xcb, 0x15, 0x70, 0x99, 0x92, 0x95, 0x39, 0xa7, 0xc4, 0x36, 0x23, 0xf3, 0x08, 0x76,
-  0x3b, 0xb3, 0x89, 0xe1, 0xc2, 0xbf, 0xbf, 0xf1, 0xcd, 0x30, 0xe2, 0x9b, 0xa2, 0x2b, 0x4f, 0x28,
-  0xd1, 0x91, 0x81, 0x72, 0x20, 0x45, 0xf8, 0x82, 0xed, 0x83, 0xe3, 0x01, 0xc9, 0xbf, 0xdd, 0x5c,
-  0x5e, 0x18, 0x14, 0xd6, 0x62, 0xb9, 0x66, 0x18, 0xe2, 0x46, 0x1b, 0xde, 0x89, 0x58, 0x46, 0x4f,
-  0x42, 0x4c, 0x92, 0x6a, 0xb9, 0xd4, 0x0c, 0x6e, 0xb8, 0x2a, 0xc8, 0x42, 0x25, 0xd8, 0x3e, 0x44,
-  0x8f, 0xb0, 0x3e, 0xd3, 0x73, 0x96, 0x8c, 0x54, 0x43, 0xf2, 0x7c, 0x0f, 0x16, 0x25, 0x20, 0x0c,
-  0x60, 0x64, 0x3c, 0x48, 0x8e, 0x69, 0x03, 0xb9, 0xcd, 0x4e, 0x95, 0xf9, 0x5c, 0x0f, 0xe8, 0xca,
-  0x35, 0x2d, 0x94, 0x08, 0x36, 0xa9, 0x84, 0x6b, 0x52, 0x9b, 0x6f, 0x34, 0x2d, 0xb3, 0xb2, 0xe9,
-  0x85, 0xb3, 0x74, 0xa2, 0x10, 0xd7, 0xa5, 0x46, 0xaa, 0xa9, 0x3a, 0xca, 0x13, 0xb3, 0x09, 0x94,
-  0xdb, 0x04, 0x8f, 0xdb, 0x04, 0x53, 0x58, 0x84, 0x88, 0x9b, 0x03, 0x27, 0x1d, 0xbf, 0x72, 0xbc,
-  0xf0, 0xea, 0x77, 0x99, 0x33, 0x84, 0x1a, 0x5b, 0x62, 0x7e, 0x63, 0xce, 0x99, 0xa4, 0x4b, 0x8e,
-  0xb7, 0x5a, 0x23, 0x8f, 0x66, 0x7e, 0x20, 0x3b, 0x60, 0x3f, 0x9c, 0x01, 0x6c, 0x23, 0xf5, 0xe6,
-  0xd1, 0xa2, 0xef, 0x54, 0xab, 0x7c, 0xb4, 0x67, 0xd0, 0xcf, 0xce, 0x97, 0x3a, 0xda, 0xb7, 0x7a,
-  0xb8, 0x9e, 0x86, 0x20, 0x8f, 0xde, 0x5c, 0xd6, 0xd4, 0xa6, 0xd2, 0x77, 0x66, 0xb0, 0x9f, 0x9a,
-  0x64, 0x18, 0xde, 0xf3, 0xb3, 0x74, 0xa1, 0xc7, 0x1f, 0x9a, 0xf1, 0x87, 0x16, 0x7e, 0x88, 0x37,
-  0xa5, 0x08, 0x0b, 0xc7, 0xb1, 0x42, 0x53, 0x7e, 0x0e, 0xca, 0x53, 0xa4, 0x8d, 0xd2, 0xc5, 0x8d,
-  0x54, 0x8d, 0x52, 0x95, 0x54, 0x75, 0x4d, 0x19, 0x1a, 0x5d, 0x4d, 0x41, 0xfb, 0xed, 0x78, 0x6b,
-  0xba, 0x01, 0x0c, 0x2f, 0x20, 0x03, 0x3f, 0xb4, 0xc5, 0x87, 0xf1, 0x85, 0xf8, 0x30, 0xba, 0x11,
-  0x1f, 0xce, 0xc7, 0x8c, 0xd4, 0xe3, 0x63, 0x49, 0x3a, 0xe2, 0x94, 0xb2, 0xc9, 0xe0, 0x7b, 0x4d,
-  0xcf, 0x3d, 0xe1, 0xab, 0x31, 0xc1, 0x18, 0x32, 0xa6, 0xdd, 0x02, 0xd3, 0x6e, 0x07, 0xdc, 0xd8,
-  0xc6, 0x9c, 0xbb, 0x05, 0xce, 0x99, 0xf5, 0xd5, 0x3a, 0x5c, 0xc8, 0xfc, 0xc5, 0xe7, 0xdb, 0x2f,
-  0x4a, 0x0e, 0x9a, 0xe9, 0x57, 0x11, 0x34, 0xd3, 0x41, 0x84, 0x86, 0x35, 0x99, 0xf5, 0xd0, 0x87,
-  0xf5, 0x7b, 0xc6, 0xd0, 0x33, 0x8c, 0x84, 0x45, 0x29, 0x25, 0xc8, 0x08, 0x45, 0x11, 0xb6, 0x8e,
-  0x2b, 0xd7, 0xb7, 0x89, 0x1f, 0x04, 0x8f, 0x2a, 0xdb, 0x7d, 0xf2, 0xf3, 0xd3, 0xdf, 0x27, 0x57,
-  0x7f, 0xd4, 0x39, 0xa7, 0x9d, 0xd9, 0xa3, 0x6c, 0x2a, 0x1b, 0x62, 0x99, 0xde, 0xab, 0x88, 0x4c,
-  0x29, 0x01, 0x0f, 0x66, 0xd7, 0xbf, 0x29, 0x6a, 0x8a, 0xcf, 0x90, 0x24, 0xfe, 0x6d, 0x06, 0xfe,
-  0x28, 0x04, 0xb3, 0x00, 0x76, 0x1d, 0x37, 0x18, 0x58, 0x73, 0x64, 0x78, 0xc0, 0x09, 0x60, 0x16,
-  0xfb, 0x90, 0x38, 0x94, 0x7f, 0x37, 0x81, 0x09, 0x62, 0x20, 0xd4, 0x0c, 0x28, 0x61, 0xd2, 0x09,
-  0xb6, 0xc4, 0x7d, 0x3c, 0x4c, 0x29, 0xb2, 0xf7, 0xbb, 0xe1, 0x54, 0xf5, 0xfe, 0xf7, 0x54, 0x86,
-  0xbf, 0xc7, 0x32, 0xec, 0xc3, 0x0e, 0x7e, 0x3f, 0x20, 0xc3, 0x7e, 0x2c, 0x3c, 0x7e, 0x2c, 0x3c,
-  0x7e, 0x2c, 0x3c, 0x7e, 0x2c, 0x3c, 0x7e, 0x2c, 0x3c, 0x7e, 0x2c, 0x3c, 0x7e, 0x2c, 0x3c, 0xbe,
-  0xf2, 0xc4, 0x50, 0xc1, 0x47, 0xc3, 0xcf, 0x4d, 0xa2, 0x2b, 0x9c, 0x08, 0xb7, 0x90, 0x88, 0x97,
-  0xaa, 0x80, 0x7b, 0x40, 0x05, 0xb8, 0xe0, 0x7e, 0x4f, 0x04, 0x37, 0xc3, 0xae, 0xcc, 0xf3, 0xad,
-  0xed, 0xb8, 0x76, 0x3c, 0x66, 0x85, 0x5d, 0xc7, 0x42, 0xa9, 0x88, 0xee, 0x29, 0xf5, 0x60, 0x5f,
-  0x12, 0x55, 0xdd, 0x34, 0xf0, 0x8b, 0x20, 0x7a, 0x73, 0xc4, 0x76, 0xe1, 0x7b, 0x6e, 0x17, 0xbe,
-  0x67, 0x77, 0x61, 0x03, 0xff, 0xf1, 0x09, 0x8e, 0xb4, 0xd4, 0x16, 0x45, 0xc1, 0xe3, 0x64, 0x3d,
-  0x05, 0x73, 0x86, 0x0e, 0x17, 0x28, 0xb5, 0xeb, 0x93, 0x59, 0x1d, 0xad, 0x79, 0x06, 0x4f, 0x1d,
-  0x23, 0x1f, 0x58, 0xf2, 0x5b, 0x3a, 0x33, 0xd7, 0x6e, 0x84, 0xd8, 0x62, 0x13, 0x16, 0x93, 0x0c,
-  0x4c, 0x8b, 0xfc, 0xd5, 0x75, 0xe0, 0x83, 0x37, 0x30, 0xb9, 0x89, 0x15, 0x22, 0xca, 0xa2, 0x9f,
-  0xa1, 0x0e, 0x06, 0x54, 0x18, 0x2c, 0xe9, 0xc6, 0xf7, 0xc9, 0xd2, 0xf4, 0x1e, 0x09, 0x84, 0x5f,
-  0x21, 0x01, 0xd9, 0x20, 0x4b, 0x4a, 0x22, 0x9f, 0x2c, 0x4c, 0xcf, 0x76, 0xe9, 0x91, 0xd4, 0x47,
-  0xf3, 0x39, 0xd0, 0x69, 0xfb, 0xf8, 0x58, 0xf6, 0xaa, 0x86, 0xf4, 0x97, 0xf7, 0x57, 0x70, 0x06,
-  0x6e, 0x0c, 0xa2, 0x9a, 0x00, 0x54, 0x03, 0xfd, 0x93, 0xe9, 0x91, 0x77, 0x93, 0xeb, 0x56, 0xb3,
-  0x2e, 0xc5, 0xae, 0xcb, 0x53, 0x36, 0x8c, 0x74, 0xe6, 0x41, 0x3f, 0x9a, 0xae, 0x63, 0x3b, 0xd1,
-  0xa3, 0xac, 0xa0, 0x42, 0xc0, 0xd3, 0x90, 0x2f, 0x31, 0x63, 0xc3, 0xa9, 0xc7, 0xdc, 0xab, 0x30,
-  0xc1, 0xcc, 0x27, 0x61, 0xb8, 0x28, 0x29, 0x1c, 0x03, 0xb5, 0xfb, 0x6c, 0xe0, 0xc5, 0xa9, 0xe0,
-  0x03, 0x3d, 0xe1, 0x01, 0x60, 0x4f, 0x53, 0x63, 0x60, 0x80, 0xe5, 0xbe, 0xc7, 0x76, 0x42, 0x70,
-  0x1a, 0x8f, 0x00, 0x03, 0x36, 0xdb, 0x75, 0xc0, 0xfb, 0xf4, 0x84, 0x13, 0x62, 0xa0, 0xab, 0x70,
-  0xdd, 0x7c, 0x01, 0x6c, 0x6e, 0xbe, 0xa1, 0x76, 0x7c, 0x1c, 0x87, 0x00, 0x59, 0xa2, 0x2f, 0x4e,
-  0x33, 0x6e, 0x83, 0xc1, 0x43, 0x98, 0xc5, 0x87, 0x6c, 0x13, 0xcc, 0x27, 0xbf, 0x38, 0x85, 0x19,
-  0x77, 0x66, 0xef, 0x68, 0x46, 0x01, 0x05, 0x7f, 0x9e, 0x67, 0x27, 0x8b, 0xa7, 0x7f, 0x0a, 0xef,
-  0x9d, 0xc8, 0x5a, 0xc8, 0x05, 0x3c, 0x82, 0x50, 0x4b, 0xdd, 0x26, 0x03, 0x70, 0xab, 0x19, 0x85,
-  0xc9, 0x90, 0x04, 0x9a, 0x66, 0x99, 0x21, 0x25, 0x5a, 0xaf, 0x10, 0x95, 0xae, 0x8a, 0x3d, 0xe9,
-  0x4f, 0x21, 0x68, 0xbb, 0xed, 0x33, 0xd8, 0x96, 0xd6, 0xdb, 0x99, 0xa0, 0xa5, 0xe5, 0x20, 0x3a,
-  0x05, 0x10, 0x9d, 0x2c, 0x44, 0xa7, 0x00, 0xa2, 0x93, 0x83, 0x68, 0x16, 0x81, 0x34, 0x13, 0x18,
-  0x9b, 0xcb, 0x7d, 0x6f, 0x0f, 0x43, 0x63, 0x56, 0x6e, 0x18, 0xcc, 0x52, 0x07, 0x80, 0x34, 0xb0,
-  0x41, 0x79, 0x56, 0x0b, 0x6d, 0xc7, 0x04, 0x22, 0x64, 0xb4, 0x1c, 0xbb, 0x21, 0x1c, 0x97, 0x58,
-  0x08, 0x63, 0x62, 0xfd, 0x54, 0xb6, 0xb6, 0x07, 0xb0, 0x5d, 0xd2, 0x25, 0xc6, 0x20, 0x71, 0xb4,
-  0x7b, 0xc0, 0x4c, 0x9d, 0x49, 0x55, 0x2f, 0x35, 0x53, 0x4a, 0x5f, 0x68, 0x6e, 0x54, 0x3d, 0x30,
-  0x70, 0x72, 0x91, 0x1f, 0xa8, 0xd2, 0x41, 0xab, 0x79, 0x92, 0xea, 0x68, 0xcb, 0x30, 0x8a, 0x27,
-  0xd4, 0x72, 0xe3, 0x4e, 0xe8, 0xb0, 0xf9, 0xe6, 0xa4, 0xa9, 0xfd, 0x2d, 0xea, 0xe9, 0x1d, 0xf8,
-  0x07, 0x11, 0x0c, 0x0d, 0xc0, 0xc0, 0x5f, 0x74, 0xe1, 0xd1, 0x6b, 0xf8, 0x9f, 0x7d, 0x69, 0xc3,
-  0x87, 0x16, 0xfb, 0xd2, 0xd2, 0xc1, 0x58, 0x0e, 0xda, 0xdd, 0x93, 0x4e, 0xaf, 0xdd, 0x06, 0x99,
-  0x7d, 0x7e, 0x6e, 0x77, 0x50, 0x74, 0x05, 0x44, 0xca, 0x0e, 0x60, 0x0e, 0x65, 0x41, 0x26, 0xf2,
-  0x02, 0xc3, 0x4d, 0x35, 0xc2, 0x7f, 0x4c, 0x70, 0xea, 0x5c, 0xda, 0x96, 0xab, 0x7b, 0x33, 0xf0,
-  0xc0, 0x78, 0xec, 0xec, 0x1d, 0xdb, 0xf9, 0xcb, 0x58, 0xf1, 0x7e, 0x6d, 0x6a, 0xda, 0x8e, 0x66,
-  0x80, 0x2c, 0x18, 0x46, 0x4e, 0x98, 0x85, 0x39, 0x30, 0xf4, 0x66, 0x6f, 0x47, 0x71, 0x65, 0xf1,
-  0x2e, 0x2f, 0xfd, 0x7d, 0xee, 0xeb, 0xca, 0xa2, 0x3d, 0x10, 0x3c, 0x6a, 0xe5, 0xc3, 0x3d, 0x3f,
-  0x1b, 0xee, 0x31, 0xff, 0xc5, 0x9c, 0x5a, 0x49, 0xc0, 0x17, 0xfb, 0x31, 0xbf, 0x30, 0x94, 0x53,
-  0xc3, 0x74, 0x9b, 0xfd, 0x5c, 0x14, 0xc0, 0xf9, 0xb3, 0xd2, 0x6c, 0x74, 0x63, 0x19, 0xa9, 0x0d,
-  0xd1, 0x8b, 0x81, 0x15, 0x1a, 0xbc, 0x79, 0x7d, 0x22, 0x9d, 0x5f, 0x13, 0x90, 0x51, 0x48, 0x0b,
-  0xc3, 0x9e, 0xd4, 0x0b, 0x87, 0xed, 0x37, 0x27, 0xd2, 0x5b, 0x70, 0x12, 0xe4, 0xc3, 0xf5, 0xf9,
-  0x15, 0x7f, 0xa2, 0x9f, 0x48, 0xf8, 0x05, 0xdf, 0x4b, 0xfc, 0xa9, 0xb0, 0x7e, 0xfa, 0x2e, 0xe2,
-  0xf6, 0x1b, 0xc4, 0xfb, 0xba, 0x7d, 0x22, 0x9d, 0xb9, 0xb7, 0x31, 0x0e, 0x49, 0x62, 0x1c, 0x0a,
-  0x4a, 0xa4, 0x49, 0x17, 0x5e, 0x96, 0xf1, 0xc7, 0xac, 0x1a, 0x42, 0xfe, 0x43, 0xd5, 0x55, 0xd4,
-  0xb9, 0xa1, 0xf7, 0xe7, 0x83, 0x4e, 0x7f, 0x8e, 0x21, 0x85, 0x5c, 0x86, 0x41, 0xaa, 0xce, 0x39,
-  0x0a, 0xf0, 0x0a, 0x72, 0x66, 0x75, 0xc7, 0xc7, 0xf3, 0x41, 0xfb, 0xf9, 0x99, 0x93, 0x05, 0xd9,
-  0xd6, 0x9c, 0x7d, 0xd6, 0xf1, 0x65, 0x07, 0x40, 0xe6, 0xd5, 0xb6, 0x36, 0x08, 0x4f, 0xe4, 0xa0,
-  0x44, 0xe5, 0xd5, 0x00, 0x92, 0x86, 0x7f, 0xad, 0x9d, 0x80, 0xd9, 0x43, 0xa5, 0xb7, 0x0b, 0xc8,
-  0x65, 0x28, 0x0b, 0xa6, 0xc3, 0xb7, 0xd8, 0xbf, 0x2a, 0xca, 0x06, 0x22, 0x02, 0x6e, 0x5e, 0x83,
-  0x19, 0xe3, 0x55, 0x6c, 0x13, 0x0b, 0x9e, 0x3d, 0x3f, 0xb7, 0x80, 0xc4, 0x50, 0x0d, 0x99, 0x6a,
-  0x84, 0xa0, 0x1a, 0x30, 0xb6, 0x54, 0xe1, 0x33, 0x71, 0x89, 0x01, 0x91, 0x8e, 0x9a, 0x45, 0xe8,
-  0x7b, 0x16, 0x44, 0x16, 0xb7, 0x06, 0xc3, 0x77, 0x82, 0x59, 0xe8, 0x91, 0xde, 0x63, 0xc9, 0xe8,
-  0x46, 0x8d, 0x9e, 0x0d, 0x0f, 0xf6, 0x49, 0xff, 0x15, 0xa7, 0x68, 0x36, 0x61, 0x52, 0x70, 0x18,
-  0xa1, 0x98, 0x9b, 0xb1, 0x87, 0xf1, 0xae, 0x0d, 0xbc, 0x6b, 0xb7, 0x8e, 0xf0, 0x51, 0xb7, 0x8b,
-  0x54, 0x31, 0xfc, 0x96, 0xcf, 0xf0, 0xe7, 0x99, 0x90, 0xe1, 0x37, 0x8e, 0x37, 0x04, 0x82, 0xee,
-  0x09, 0xe7, 0x4e, 0x2f, 0xe1, 0x26, 0x43, 0x61, 0x3b, 0x73, 0xc0, 0x51, 0x95, 0xee, 0x77, 0x94,
-  0x35, 0x4b, 0xc8, 0x8e, 0x9a, 0xb6, 0x34, 0xa0, 0x05, 0x2c, 0x92, 0xce, 0xfe, 0x14, 0xb3, 0xe5,
-  0xd3, 0x55, 0x9e, 0x2d, 0x9a, 0x92, 0x9f, 0xd2, 0x92, 0x0a, 0x48, 0x7f, 0x19, 0xb5, 0x81, 0xb4,
-  0x67, 0xd5, 0xfb, 0x87, 0x86, 0xd2, 0xbf, 0x87, 0x61, 0xb3, 0x22, 0x3c, 0xfa, 0x6b, 0x1c, 0xda,
-  0x6a, 0x32, 0x3c, 0x1d, 0x2d, 0xd6, 0xbd, 0xa2, 0x58, 0x25, 0xc6, 0x63, 0xee, 0xe0, 0x81, 0xdc,
-  0xa2, 0x8d, 0xec, 0x2d, 0x1e, 0x07, 0xe6, 0x6e, 0xd7, 0x7c, 0xa4, 0x24, 0x9f, 0x7b, 0x77, 0x10,
-  0xa4, 0x51, 0x9b, 0x40, 0x1a, 0x8e, 0x49, 0x6d, 0x4f, 0x1a, 0x43, 0x44, 0x09, 0xe6, 0xc8, 0x26,
-  0x72, 0xe0, 0x47, 0x26, 0xbe, 0xd2, 0xbb, 0xda, 0xff, 0xfc, 0xb7, 0x92, 0xc4, 0x4c, 0xf6, 0x7e,
-  0x7c, 0x36, 0x7d, 0x40, 0x9b, 0xc1, 0x8a, 0x61, 0x3d, 0xe1, 0x76, 0xef, 0x77, 0xf7, 0x2e, 0xda,
-  0x21, 0x37, 0x7a, 0x7e, 0xe6, 0x61, 0xc9, 0xe9, 0xa7, 0x3a, 0xb7, 0xb9, 0xd4, 0x66, 0xe8, 0x0c,
-  0x11, 0xcb, 0x9c, 0x8d, 0x33, 0x31, 0x09, 0xb7, 0xda, 0xab, 0x43, 0x39, 0xba, 0xba, 0xc6, 0x4a,
-  0x20, 0xfc, 0x7f, 0x07, 0x86, 0x3b, 0x35, 0xe0, 0xab, 0x9d, 0x7c, 0xdd, 0x32, 0x56, 0x65, 0xf9,
-  0xba, 0x5b, 0xf8, 0x2a, 0x4e, 0x82, 0xce, 0x20, 0x83, 0xb0, 0x44, 0x16, 0x83, 0x09, 0x91, 0x15,
-  0x27, 0x44, 0x96, 0x72, 0x40, 0xfb, 0xc1, 0xd1, 0x1a, 0xac, 0x12, 0xd1, 0x2f, 0x18, 0x1c, 0x67,
-  0x53, 0x56, 0x9c, 0x4d, 0xf1, 0x39, 0xe4, 0xd0, 0xf8, 0xa1, 0xa4, 0x47, 0xe1, 0x29, 0xcf, 0x13,
-  0x5b, 0x01, 0x4e, 0x08, 0x0e, 0x53, 0xe5, 0x5f, 0x1c, 0x0f, 0xd8, 0xc2, 0x3e, 0xf2, 0x9d, 0xb1,
-  0x7c, 0xd7, 0x0f, 0x0c, 0xe9, 0xa7, 0xd9, 0x6c, 0x26, 0xf5, 0x93, 0x1c, 0x29, 0x19, 0x98, 0xd6,
-  0x40, 0xd3, 0xf1, 0x35, 0x3d, 0x53, 0x46, 0xd8, 0x47, 0x7b, 0x9c, 0x09, 0x5a, 0x71, 0x26, 0x68,
-  0xc5, 0x99, 0xa0, 0x15, 0x67, 0x82, 0x96, 0x28, 0x23, 0xac, 0x76, 0xca, 0x08, 0xab, 0xad, 0x32,
-  0xc2, 0xfc, 0x50, 0x19, 0x61, 0xfe, 0x43, 0x65, 0x84, 0xf9, 0x4e, 0x19, 0x81, 0x67, 0xc5, 0x1a,
-  0xe4, 0xc4, 0xab, 0x6c, 0x4e, 0x0c, 0x4b, 0x75, 0x8e, 0x8c, 0xef, 0x9c, 0x88, 0x19, 0x90, 0x75,
-  0x28, 0x37, 0x9e, 0xc5, 0x1c, 0x99, 0xc5, 0x1c, 0x99, 0xc5, 0x1c, 0x99, 0xc5, 0x1c, 0x99, 0xc5,
-  0x1c, 0x99, 0xc5, 0x1c, 0x99, 0xc5, 0x1c, 0x99, 0x65, 0x72, 0xe3, 0x59, 0x61, 0x6e, 0xfc, 0x58,
-  0x48, 0xc4, 0x4b, 0x73, 0xe3, 0xc7, 0x7d, 0xb9, 0x31, 0xdf, 0x8a, 0xef, 0x3b, 0x5b, 0x91, 0x3e,
-  0x11, 0x7c, 0x4b, 0xe6, 0x49, 0xdf, 0xb1, 0x12, 0xc6, 0x66, 0x33, 0xe7, 0x95, 0x0e, 0x6a, 0x0c,
-  0x69, 0xa6, 0xd2, 0xb1, 0xca, 0x57, 0x3a, 0x4e, 0x76, 0x25, 0x10, 0x1c, 0xb1, 0xd4, 0xdb, 0x79,
-  0xbc, 0x55, 0x3f, 0x39, 0x80, 0x55, 0xf2, 0x03, 0xd3, 0x9b, 0xa3, 0x71, 0x61, 0xf2, 0xbc, 0xe1,
-  0xf5, 0x18, 0x2b, 0xae, 0xc7, 0xe0, 0x07, 0xe0, 0xfa, 0x11, 0x8a, 0x9f, 0x7c, 0x40, 0xc4, 0x21,
-  0x0a, 0x70, 0x43, 0xca, 0xf8, 0x7d, 0x51, 0x36, 0x61, 0x3f, 0x7b, 0x02, 0x00, 0xb6, 0x30, 0xad,
-  0xff, 0x7f, 0x76, 0xbf, 0xc0, 0x14, 0xcc, 0x0a, 0xba, 0x21, 0xb3, 0x9c, 0xdc, 0xbb, 0xad, 0x85,
-  0x77, 0x13, 0x0f, 0xc1, 0x2c, 0x62, 0xda, 0x05, 0x96, 0x2d, 0x8b, 0x49, 0xbd, 0x00, 0x67, 0x29,
-  0xfb, 0xe9, 0xac, 0x3b, 0x78, 0x14, 0xa5, 0x7a, 0x31, 0x5c, 0x03, 0xd4, 0xda, 0xf0, 0xab, 0x17,
-  0x8a, 0x7a, 0x31, 0xbc, 0x83, 0x2f, 0x77, 0x06, 0x7c, 0xfc, 0x71, 0x53, 0x31, 0x40, 0xbf, 0x26,
-  0x2f, 0xab, 0x30, 0x1a, 0xb7, 0x8f, 0xcd, 0x85, 0x96, 0x1b, 0x8b, 0xec, 0x67, 0xe2, 0xdc, 0x67,
-  0x2d, 0xdc, 0xc0, 0xce, 0x73, 0xc3, 0x58, 0x9e, 0x48, 0xc0, 0x6f, 0x59, 0xaa, 0x2e, 0xab, 0x12,
-  0x59, 0x2d, 0x1e, 0x43, 0xc7, 0x32, 0xdd, 0xd8, 0x6f, 0x2c, 0xb5, 0x5c, 0xe6, 0x65, 0xaa, 0xfc,
-  0xf0, 0xc5, 0x6c, 0x60, 0xba, 0xf1, 0x37, 0x5d, 0x13, 0xd9, 0xbb, 0x3d, 0x35, 0x53, 0x67, 0x3d,
-  0x35, 0xad, 0xdb, 0x79, 0xe0, 0xaf, 0x3d, 0xdb, 0xf8, 0x86, 0xae, 0xc2, 0x0c, 0x6a, 0xf3, 0xc0,
-  0xb4, 0x1d, 0x3c, 0x31, 0x78, 0xa3, 0xd9, 0x74, 0xae, 0x92, 0x9f, 0x9f, 0x78, 0x19, 0xe3, 0xb5,
-  0x76, 0xc2, 0x3f, 0xbc, 0x81, 0x1c, 0x81, 0x09, 0x50, 0x46, 0x02, 0x2c, 0xcb, 0x92, 0x36, 0x44,
-  0x8b, 0x81, 0x37, 0xbf, 0xa8, 0xe4, 0xa7, 0x76, 0xbb, 0x9d, 0x7e, 0x27, 0x30, 0xff, 0x2f, 0xca,
-  0x37, 0xb1, 0x23, 0xd4, 0x2e, 0x4b, 0x48, 0xee, 0x86, 0x97, 0x66, 0xb4, 0x40, 0xb9, 0x90, 0x99,
-  0xe1, 0x56, 0xbb, 0x9a, 0xa6, 0x3c, 0x3f, 0xf3, 0x99, 0xbb, 0x5a, 0xb1, 0x07, 0x2e, 0xc0, 0xc7,
-  0x25, 0x3a, 0xc6, 0x66, 0x3e, 0x14, 0x60, 0xd3, 0xb5, 0xed, 0x85, 0x70, 0x6c, 0xf7, 0x90, 0xf8,
-  0x86, 0xbe, 0x97, 0x63, 0x66, 0x3a, 0x7f, 0x57, 0xfb, 0x05, 0x8f, 0x08, 0x00, 0x5d, 0x1d, 0x8b,
-  0x38, 0x64, 0x49, 0x97, 0x7e, 0xf0, 0x28, 0x55, 0xd3, 0x62, 0xcf, 0xc9, 0x37, 0x22, 0x0f, 0xa6,
-  0xc3, 0x77, 0xe3, 0xf1, 0xd5, 0xb8, 0x47, 0xfe, 0x64, 0x45, 0x1b, 0x1f, 0x3c, 0x3e, 0x30, 0x03,
-  0x77, 0x62, 0x33, 0x3a, 0x1a, 0x34, 0xa6, 0x43, 0xe5, 0x1b, 0x44, 0xfd, 0x4a, 0x0f, 0xf0, 0x69,
-  0xbc, 0x18, 0xb4, 0x02, 0x08, 0x11, 0x22, 0x30, 0xc7, 0x7b, 0x6e, 0x30, 0xda, 0x2d, 0xea, 0xb8,
-  0xb2, 0x0c, 0x68, 0xab, 0xcb, 0xbf, 0xf1, 0xdc, 0x4a, 0x69, 0x74, 0x60, 0x15, 0x8d, 0x66, 0xff,
-  0xdc, 0x38, 0x1f, 0x76, 0x4e, 0x52, 0xa8, 0x73, 0xa5, 0x77, 0xde, 0xf7, 0x0d, 0x91, 0x4c, 0x2c,
-  0x58, 0xbc, 0xb8, 0x9d, 0xda, 0xab, 0x23, 0x23, 0x9b, 0xd0, 0xa5, 0x15, 0x94, 0xf3, 0x81, 0x5e,
-  0xd7, 0x9a, 0xc7, 0xc7, 0x47, 0x0b, 0xf8, 0x7f, 0x74, 0x02, 0x68, 0xde, 0x4d, 0xae, 0x49, 0xe7,
-  0x23, 0x96, 0x44, 0xc9, 0xbd, 0x13, 0x2d, 0x88, 0x7e, 0x4a, 0xfe, 0x9c, 0x8c, 0x48, 0xb8, 0x5e,
-  0xad, 0xdc, 0x47, 0xa9, 0x27, 0xfb, 0x55, 0x63, 0x71, 0x22, 0xe9, 0xcd, 0x8f, 0x44, 0xea, 0x8d,
-  0x4e, 0xa4, 0x4f, 0x93, 0x66, 0x57, 0xef, 0x10, 0xfe, 0x5d, 0x82, 0x81, 0x92, 0x0a, 0x10, 0xe7,
-  0xf8, 0x8f, 0x74, 0x2a, 0x46, 0x61, 0x4d, 0xcf, 0x63, 0x61, 0x07, 0x16, 0xbd, 0x70, 0xd9, 0x12,
-  0x8f, 0x32, 0xa6, 0xe5, 0x8b, 0xd5, 0xf9, 0x6a, 0xd5, 0x89, 0x21, 0xc9, 0xac, 0x60, 0xe6, 0x87,
-  0x11, 0xa1, 0xb3, 0x19, 0xa0, 0x09, 0x55, 0xf2, 0x5f, 0x52, 0x7f, 0x52, 0x35, 0xa6, 0xc6, 0x34,
-  0xc7, 0x89, 0xa9, 0xd2, 0x9b, 0xaa, 0x13, 0x36, 0xb1, 0x13, 0x12, 0xea, 0xf9, 0xeb, 0xf9, 0x42,
-  0x19, 0x4c, 0x83, 0x61, 0x5a, 0x96, 0xca, 0x6d, 0xaf, 0x9f, 0xab, 0x56, 0xa5, 0xcf, 0x47, 0xa8,
-  0x6f, 0x13, 0xfe, 0xf2, 0x3b, 0x97, 0x89, 0xbc, 0xb8, 0x76, 0x05, 0x27, 0xcf, 0x6f, 0x44, 0x6a,
-  0x2c, 0xc5, 0x92, 0x99, 0x39, 0x9e, 0x33, 0xc3, 0xe8, 0x9d, 0x67, 0x8b, 0x22, 0x23, 0x1d, 0xe8,
-  0x71, 0xe1, 0x50, 0xeb, 0xdf, 0x1d, 0xb2, 0x1f, 0x13, 0x10, 0x2c, 0x0a, 0x06, 0x32, 0x63, 0x43,
-  0xaa, 0x87, 0x6b, 0x1d, 0xdb, 0x43, 0xfa, 0xbc, 0xfa, 0x78, 0xd8, 0x56, 0xed, 0x0c, 0x14, 0x94,
-  0x7a, 0x2c, 0xe3, 0xf2, 0x78, 0xc6, 0x05, 0x89, 0xbf, 0xa2, 0x3a, 0xe1, 0x1f, 0xe6, 0x1f, 0xf2,
-  0x9d, 0x72, 0xa2, 0xf5, 0xee, 0xd2, 0xa5, 0x42, 0x9e, 0x8c, 0x9b, 0x9a, 0x1c, 0x45, 0xf2, 0x03,
-  0x96, 0xad, 0xe9, 0xce, 0xe2, 0x03, 0x27, 0x08, 0x21, 0x27, 0x37, 0x58, 0xc5, 0x34, 0xa2, 0x24,
-  0x58, 0x9c, 0xc9, 0x47, 0x32, 0xe4, 0x37, 0xe0, 0xfc, 0xcc, 0x21, 0x86, 0x6e, 0xa3, 0x2a, 0x9e,
-  0x2b, 0x3d, 0x3f, 0xd7, 0xf8, 0x43, 0x90, 0x68, 0x53, 0x78, 0x66, 0x87, 0xa7, 0x88, 0x4b, 0x58,
-  0x30, 0xf3, 0xc6, 0x08, 0x10, 0x17, 0xd5, 0xbf, 0x0d, 0x6c, 0xe7, 0x8e, 0xb0, 0x93, 0x2d, 0x83,
-  0x4d, 0x32, 0xfc, 0xcb, 0x1b, 0x2c, 0x82, 0xf8, 0x49, 0xb8, 0x74, 0xf1, 0xc9, 0xcf, 0x4f, 0x66,
-  0x55, 0xdf, 0xf4, 0xe0, 0x15, 0x0f, 0x86, 0x09, 0x3f, 0x2a, 0xbf, 0xb8, 0x81, 0x17, 0x1b, 0x89,
-  0x40, 0x92, 0xb8, 0x40, 0xb3, 0x60, 0x48, 0x7f, 0x9e, 0xcb, 0x51, 0x00, 0xec, 0x90, 0x86, 0xf0,
-  0x86, 0x93, 0x85, 0x1b, 0xfd, 0x6a, 0xe0, 0xaf, 0xd8, 0xb2, 0x45, 0x3a, 0xdb, 0x6c, 0x4a, 0x24,
-  0x0e, 0xab, 0x87, 0x4c, 0x1d, 0x1e, 0x06, 0x0d, 0x0e, 0x32, 0xdc, 0x02, 0x6d, 0x69, 0xd2, 0x70,
-  0xf2, 0xfb, 0xeb, 0xae, 0xde, 0x24, 0xe3, 0x0f, 0xa3, 0x4f, 0xa5, 0x60, 0xba, 0x34, 0xbc, 0xb9,
-  0xd4, 0xbb, 0x7a, 0xbb, 0x0c, 0xa2, 0xd9, 0x96, 0x20, 0x21, 0xd5, 0x6e, 0x7f, 0xfb, 0xcf, 0x52,
-  0x88, 0x0e, 0xc7, 0xd1, 0x7c, 0x53, 0x06, 0xd1, 0x01, 0x62, 0x90, 0x5c, 0x4d, 0x2f, 0x85, 0x00,
-  0x3a, 0x4e, 0xaf, 0x4f, 0x75, 0xad, 0x59, 0x0a, 0xd1, 0x94, 0x86, 0x17, 0xd7, 0x6f, 0xbb, 0x5d,
-  0xed, 0x75, 0x29, 0x48, 0x9b, 0x81, 0xbc, 0xee, 0x6a, 0xad, 0x52, 0x90, 0x96, 0x34, 0xbc, 0x7e,
-  0xd3, 0xd5, 0x4b, 0x01, 0xf4, 0x37, 0x9c, 0x54, 0x5d, 0x27, 0x9f, 0x16, 0x4e, 0x44, 0xcb, 0xe0,
-  0xda, 0xb0, 0xa4, 0x2b, 0xaf, 0x71, 0x35, 0x9b, 0x95, 0x42, 0xc0, 0x92, 0xae, 0x3f, 0x5d, 0x1e,
-  0x40, 0xd3, 0xe4, 0x40, 0x67, 0x67, 0x37, 0xa5, 0x20, 0x2d, 0x0e, 0x02, 0xdb, 0x58, 0x0a, 0xd2,
-  0x4e, 0x40, 0x4a, 0x77, 0xba, 0xdd, 0x49, 0x60, 0xaa, 0xd9, 0xd9, 0xfe, 0x7a, 0x68, 0x59, 0x47,
-  0xb5, 0xda, 0x16, 0xf0, 0xeb, 0x14, 0xf8, 0x6d, 0x06, 0xba, 0x56, 0x03, 0x70, 0xfa, 0x6a, 0x03,
-  0x12, 0x9d, 0x1f, 0xd0, 0x05, 0x76, 0xbc, 0x7d, 0x7b, 0x8d, 0x03, 0x88, 0xec, 0xd1, 0xe8, 0xde,
-  0x0f, 0x6e, 0x95, 0x74, 0x0e, 0xaf, 0x70, 0x96, 0x2e, 0x70, 0xe8, 0x9d, 0x5e, 0x6f, 0xe9, 0xc5,
-  0xc3, 0xf8, 0x64, 0xbb, 0x53, 0x01, 0xcb, 0x4e, 0x83, 0xa8, 0xf6, 0x07, 0x8d, 0x4a, 0xa7, 0xdb,
-  0x1e, 0xd2, 0x4d, 0xa8, 0xfb, 0x54, 0x0c, 0xdf, 0xe0, 0x6a, 0x35, 0x44, 0x13, 0x0e, 0x5f, 0x51,
-  0xb9, 0x1d, 0xdb, 0x90, 0x2c, 0x9f, 0x6b, 0x2a, 0xb3, 0xc9, 0x86, 0x24, 0x8c, 0x72, 0x4f, 0x84,
-  0x08, 0xc3, 0x33, 0x8c, 0x01, 0xc8, 0x55, 0x60, 0xd3, 0x60, 0x47, 0xc9, 0xcf, 0xae, 0xd8, 0xd0,
-  0x5d, 0x62, 0x80, 0x53, 0x1f, 0xc6, 0xa3, 0x72, 0x62, 0x81, 0x29, 0xd9, 0xad, 0xde, 0x79, 0x0f,
-  0xcb, 0x1f, 0x8d, 0x3f, 0x94, 0xbf, 0x07, 0x71, 0x19, 0x8f, 0xf6, 0xbc, 0x07, 0x59, 0x19, 0x7d,
-  0x18, 0x97, 0xbf, 0x07, 0x39, 0xf9, 0x30, 0x1a, 0x17, 0x32, 0xa7, 0x01, 0x7c, 0xc9, 0xb2, 0xc7,
-  0x76, 0xe6, 0xb8, 0xc8, 0xfb, 0x1d, 0x06, 0x31, 0x07, 0x35, 0x9c, 0xdc, 0x9b, 0xab, 0x1e, 0xc9,
-  0xb3, 0xe5, 0x93, 0x60, 0xcb, 0x2e, 0x53, 0xfe, 0x80, 0x31, 0xa5, 0x5a, 0x09, 0x4a, 0x49, 0x8e,
-  0x49, 0xa9, 0x02, 0x34, 0xf9, 0xfb, 0x0f, 0xa5, 0x66, 0x8e, 0xbf, 0x4f, 0x57, 0x55, 0xb8, 0x26,
-  0xfc, 0x13, 0xae, 0x4c, 0x8f, 0xad, 0x6d, 0x15, 0xda, 0x9c, 0x52, 0x5e, 0x05, 0x81, 0x01, 0xf0,
-  0x66, 0x48, 0x06, 0xfc, 0x68, 0x16, 0x5b, 0x57, 0x0c, 0xc9, 0x5b, 0x2f, 0xa7, 0x34, 0x90, 0x62,
-  0xb3, 0x3e, 0xe1, 0xc2, 0x82, 0xa3, 0xdd, 0x90, 0x7f, 0x16, 0xfe, 0xc0, 0x25, 0x3c, 0x9d, 0x90,
-  0x08, 0xe6, 0x23, 0xb0, 0x5a, 0x0c, 0xef, 0x50, 0x01, 0xde, 0xe8, 0x52, 0x4c, 0xe3, 0xcf, 0x4f,
-  0xb1, 0x1f, 0x37, 0x15, 0xe6, 0x1c, 0xd8, 0x4c, 0xe0, 0x4b, 0x32, 0x89, 0x08, 0x22, 0xfd, 0x62,
-  0xa0, 0xab, 0xe8, 0xe3, 0x81, 0x45, 0x5f, 0x22, 0x71, 0xd9, 0x93, 0x34, 0x86, 0xc7, 0xde, 0x34,
-  0x5c, 0xf5, 0x77, 0xb7, 0xc7, 0x2a, 0x95, 0xdf, 0x0b, 0xe6, 0x13, 0x7b, 0x7b, 0x17, 0x75, 0x96,
-  0x5f, 0x88, 0x58, 0x81, 0x2e, 0x56, 0xc0, 0x22, 0xce, 0xeb, 0xd1, 0x46, 0x4a, 0x77, 0x2a, 0x25,
-  0x29, 0x59, 0x02, 0xd2, 0x2a, 0x01, 0x85, 0x9c, 0xd9, 0x42, 0xc7, 0x1a, 0x3b, 0x1c, 0xd7, 0x04,
-  0xc7, 0x59, 0xcd, 0xfa, 0x25, 0x0c, 0xd7, 0x38, 0x6d, 0xc9, 0x84, 0xb1, 0xf7, 0xdd, 0x72, 0xad,
-  0x8a, 0xd4, 0xc8, 0x4f, 0xa4, 0x8b, 0x89, 0xc4, 0x1c, 0xfb, 0xa6, 0xd0, 0x73, 0xcb, 0x3f, 0x88,
-  0xb9, 0xf9, 0x72, 0xcc, 0xcd, 0x1f, 0xc3, 0xdc, 0x7a, 0x39, 0xe6, 0xd6, 0x8f, 0x61, 0x6e, 0xbf,
-  0x1c, 0x73, 0xfb, 0x25, 0x98, 0xb7, 0xc4, 0x2f, 0x28, 0x15, 0x3f, 0x14, 0x84, 0x94, 0x0e, 0x88,
-  0xc5, 0x39, 0x1d, 0x71, 0xf5, 0x52, 0xd0, 0xb3, 0x25, 0x9e, 0xac, 0x7c, 0x38, 0xf5, 0x1f, 0x62,
-  0x9a, 0xce, 0x3e, 0xc6, 0xd4, 0x17, 0x1b, 0xa7, 0x70, 0xef, 0xf4, 0x93, 0x5b, 0x67, 0x45, 0x66,
-  0x4e, 0x00, 0x11, 0x3f, 0xc6, 0x95, 0x7b, 0x55, 0x61, 0x72, 0xc1, 0x57, 0x9f, 0x53, 0x61, 0xc8,
-  0x75, 0xa4, 0xd4, 0x88, 0x6d, 0x89, 0x7c, 0x29, 0x51, 0xb3, 0xbd, 0x44, 0x41, 0x50, 0x41, 0xc6,
-  0x74, 0x16, 0xd0, 0x30, 0xd5, 0x4d, 0xc6, 0xa1, 0x19, 0x27, 0xa0, 0x98, 0x11, 0xe3, 0xf7, 0xfb,
-  0x19, 0x61, 0xee, 0x9d, 0xf3, 0x74, 0x1d, 0xf9, 0x35, 0xc8, 0xf5, 0xad, 0xb5, 0x6b, 0x46, 0x94,
-  0xdc, 0x63, 0xd0, 0x82, 0xad, 0xa6, 0x90, 0xa9, 0xb8, 0x64, 0x16, 0xf8, 0x4b, 0x74, 0x9e, 0x3d,
-  0xbe, 0x63, 0x59, 0x7b, 0x7e, 0xfa, 0xa9, 0xc8, 0x9e, 0x6b, 0xfb, 0xac, 0xb9, 0x3e, 0x1c, 0x05,
-  0xce, 0x7c, 0x11, 0xd1, 0xa0, 0x04, 0xa0, 0x39, 0x3c, 0xb5, 0x2c, 0x6c, 0x8e, 0x2b, 0xc3, 0xd0,
-  0x1a, 0xbe, 0x5d, 0x9b, 0x6e, 0xc9, 0xcb, 0x36, 0xa4, 0xe4, 0x0f, 0xbb, 0x86, 0x9e, 0x5b, 0xc7,
-  0x84, 0x39, 0xec, 0xef, 0xb7, 0xbe, 0x03, 0xb9, 0x58, 0x48, 0x83, 0xe8, 0xd4, 0xfe, 0x6e, 0x5a,
-  0x90, 0x3d, 0x60, 0x52, 0x26, 0x4b, 0x53, 0x0a, 0x79, 0x20, 0xa5, 0x9e, 0x0d, 0x19, 0xa6, 0xb2,
-  0x11, 0x99, 0x81, 0x1c, 0x7d, 0xae, 0xd5, 0xcc, 0x2f, 0xf5, 0x00, 0xf2, 0xf1, 0x3b, 0x8a, 0xcd,
-  0x83, 0x35, 0x53, 0x14, 0x80, 0xaa, 0x3b, 0x69, 0x9b, 0x39, 0x48, 0x52, 0x8b, 0x9a, 0x5e, 0x5c,
-  0x53, 0xa8, 0xed, 0x0e, 0x1a, 0xee, 0x96, 0x1f, 0xbc, 0xe7, 0x67, 0x76, 0x34, 0x9d, 0x4b, 0x81,
-  0xce, 0xae, 0x2e, 0x65, 0x60, 0x32, 0xe4, 0x40, 0x78, 0x12, 0xab, 0xc5, 0x9d, 0x59, 0xe5, 0x69,
-  0x90, 0xe5, 0x2f, 0xbf, 0xc2, 0xc3, 0xe0, 0x11, 0xe6, 0xcc, 0x26, 0x42, 0x90, 0x6b, 0x60, 0xa9,
-  0x4d, 0xa4, 0x3b, 0xb9, 0xa4, 0x26, 0x1d, 0xb2, 0x2f, 0xb5, 0x21, 0xdc, 0x3b, 0xee, 0x53, 0x9b,
-  0x7f, 0x64, 0xdc, 0xe2, 0xc3, 0x8b, 0xdc, 0xe2, 0xeb, 0x4e, 0xa7, 0xd5, 0xc9, 0xf8, 0x45, 0xba,
-  0xd9, 0x52, 0xac, 0x8c, 0xdf, 0x33, 0x24, 0x29, 0x71, 0x7c, 0x2f, 0x70, 0x67, 0xff, 0x38, 0xcb,
-  0x10, 0x63, 0xed, 0x75, 0x6d, 0xdb, 0x54, 0x78, 0x9b, 0xdc, 0xac, 0xdb, 0xaa, 0x2e, 0x14, 0xee,
-  0x87, 0x22, 0x45, 0x46, 0x85, 0x08, 0x31, 0x05, 0x7d, 0xff, 0xff, 0xa2, 0xc6, 0x58, 0xd9, 0x98,
-  0xed, 0x10, 0x6a, 0x27, 0x8e, 0x32, 0xb9, 0x84, 0x39, 0x34, 0x64, 0x35, 0x91, 0xbd, 0x7a, 0xe8,
-  0x08, 0x55, 0x7b, 0xf0, 0xa5, 0xaa, 0x19, 0x17, 0x60, 0x23, 0x75, 0x1a, 0x79, 0xa8, 0x0c, 0x20,
-  0x8b, 0xa2, 0x85, 0x23, 0xd5, 0x13, 0xd0, 0x53, 0x7c, 0x55, 0xd2, 0x08, 0x5a, 0xac, 0x1c, 0xa0,
-  0x51, 0x49, 0x0b, 0x9d, 0x76, 0x64, 0xe0, 0xb9, 0x9c, 0x4c, 0x3f, 0x7b, 0x35, 0x3d, 0xa3, 0xf6,
-  0x62, 0x4a, 0x78, 0xc8, 0xa7, 0x54, 0xb2, 0x53, 0x86, 0x34, 0x62, 0xca, 0xa9, 0x3c, 0xa1, 0xc5,
-  0xd8, 0x6a, 0x1a, 0xa7, 0xfc, 0x58, 0x02, 0x9b, 0x28, 0x28, 0x96, 0xf8, 0x5e, 0x44, 0x92, 0x42,
-  0x93, 0xa9, 0xfb, 0x62, 0xea, 0x5c, 0xbb, 0x2c, 0x7f, 0x04, 0x13, 0x26, 0x3c, 0x05, 0x03, 0xb1,
-  0xdb, 0x11, 0x35, 0xc8, 0xd3, 0x52, 0x6c, 0x92, 0x70, 0x34, 0x4c, 0xb6, 0x3b, 0x7a, 0xd7, 0x30,
-  0xe5, 0xec, 0xd1, 0x28, 0xf2, 0x78, 0xbf, 0x6e, 0x6c, 0x89, 0x18, 0x36, 0x20, 0x2d, 0xcc, 0x16,
-  0xbb, 0x54, 0xc7, 0xc0, 0xca, 0x7d, 0x75, 0xc2, 0x8e, 0x38, 0xea, 0xe8, 0x54, 0xce, 0x16, 0x66,
-  0x70, 0xe6, 0xdb, 0x54, 0xc6, 0xaa, 0x95, 0x76, 0xd2, 0xee, 0xf6, 0x3a, 0x1d, 0xa5, 0x0a, 0x7c,
-  0x32, 0xab, 0xc6, 0xb7, 0xd1, 0x3a, 0x8a, 0x7c, 0xd6, 0x94, 0xb7, 0xe1, 0x6d, 0x0c, 0xfb, 0x14,
-  0xfb, 0xe7, 0x27, 0x67, 0xb3, 0x13, 0x8e, 0xc4, 0xaa, 0xfd, 0x10, 0xe6, 0xf5, 0x78, 0xf8, 0x4d,
-  0xc5, 0x09, 0x84, 0x4b, 0xc8, 0xf9, 0xb3, 0x9f, 0x9f, 0xa4, 0xd1, 0xbb, 0x17, 0xd1, 0x98, 0xa0,
-  0xd9, 0xd1, 0x54, 0x20, 0x59, 0x33, 0xf0, 0x74, 0x34, 0xae, 0xd5, 0x60, 0xff, 0xc5, 0x66, 0xf8,
-  0x56, 0x9c, 0x0f, 0x24, 0x4a, 0x52, 0x38, 0xbc, 0x89, 0xc3, 0x9b, 0x05, 0xc3, 0xaf, 0xd7, 0xe1,
-  0x62, 0xca, 0x58, 0xb2, 0x1f, 0x41, 0x0b, 0x11, 0xb4, 0x4a, 0x10, 0x10, 0x47, 0x1c, 0x16, 0xef,
-  0xc7, 0xd1, 0x46, 0x1c, 0xed, 0x02, 0x1c, 0x13, 0xd6, 0xae, 0xb6, 0x7f, 0x70, 0x07, 0x07, 0x77,
-  0x8a, 0x08, 0x38, 0x1f, 0x93, 0x90, 0x7a, 0xa1, 0x1f, 0xec, 0x47, 0xf0, 0x1a, 0x11, 0xbc, 0x2e,
-  0x40, 0x70, 0xe3, 0xaf, 0x0f, 0x4d, 0xfe, 0x2b, 0x8e, 0xfd, 0xb5, 0x60, 0xec, 0xa9, 0x67, 0xba,
-  0xfe, 0x7c, 0xff, 0xe0, 0x2e, 0x0e, 0xee, 0x96, 0x0e, 0x2e, 0x61, 0x9e, 0x94, 0x98, 0x3a, 0x89,
-  0x23, 0x65, 0x21, 0xad, 0x70, 0x04, 0x10, 0xc7, 0xc0, 0x7a, 0x7b, 0x64, 0xe5, 0x3b, 0x1e, 0x44,
-  0x3c, 0x7d, 0x26, 0xa3, 0xac, 0x35, 0x44, 0xc2, 0x8b, 0x18, 0xaf, 0x50, 0x6e, 0x5f, 0x29, 0xb1,
-  0x0f, 0x3b, 0xfe, 0xe9, 0xa1, 0xf9, 0xab, 0xde, 0xe9, 0xc7, 0xa1, 0x38, 0x98, 0x4c, 0x71, 0xa2,
-  0xb1, 0xad, 0x4c, 0x86, 0x99, 0x69, 0x33, 0x9d, 0xbb, 0x13, 0x07, 0x4d, 0x80, 0x9c, 0xbb, 0xc4,
-  0x42, 0x95, 0xe7, 0x67, 0x39, 0x7f, 0x8d, 0x65, 0xbb, 0xcf, 0x2d, 0xb9, 0x12, 0xf1, 0x84, 0x86,
-  0x89, 0x1b, 0xca, 0x23, 0x1d, 0xe3, 0x8a, 0x3e, 0xb8, 0xb3, 0xfd, 0x55, 0xd5, 0xd8, 0x4e, 0x7a,
-  0x78, 0xfc, 0xbe, 0x7b, 0xba, 0xc5, 0x0c, 0xa4, 0xf2, 0x03, 0x25, 0x65, 0x2f, 0x5f, 0x19, 0x3e,
-  0x2a, 0x38, 0x31, 0xf3, 0x62, 0x7c, 0x68, 0x96, 0xb1, 0x3f, 0x32, 0x9b, 0x1b, 0x7b, 0x5f, 0xb0,
-  0x22, 0x2c, 0x8e, 0xbc, 0x42, 0x4d, 0x02, 0x20, 0x6d, 0x17, 0x09, 0x1e, 0x61, 0x95, 0xe3, 0xd0,
-  0x18, 0x0e, 0xce, 0xf1, 0xd0, 0xc9, 0x34, 0x50, 0x52, 0x35, 0x66, 0x72, 0xca, 0xbc, 0xf5, 0x0a,
-  0x6f, 0x7a, 0xbc, 0x77, 0x5c, 0xbc, 0x38, 0x23, 0xfa, 0x6f, 0x3d, 0x7a, 0x4f, 0xfe, 0x71, 0x79,
-  0xf1, 0x5b, 0x14, 0xad, 0xc6, 0x10, 0x2b, 0xd0, 0x30, 0xea, 0x7b, 0xe5, 0x97, 0x53, 0x32, 0x57,
-  0x26, 0xd2, 0x0b, 0x1d, 0xd1, 0xc2, 0x09, 0xc1, 0xe4, 0x87, 0x2b, 0x1f, 0x3c, 0xe2, 0x0d, 0x7d,
-  0x88, 0x54, 0xf6, 0x04, 0xc8, 0x8c, 0xd6, 0xac, 0x4f, 0x03, 0x16, 0xa9, 0x80, 0xa7, 0x2a, 0xbf,
-  0x9a, 0x92, 0xe2, 0xa5, 0x59, 0xc4, 0xd8, 0x46, 0x6c, 0x5a, 0xb7, 0xea, 0x51, 0x8c, 0x80, 0xdf,
-  0x2b, 0xba, 0xbe, 0x82, 0xdd, 0x54, 0xa5, 0x06, 0x5f, 0x8e, 0x38, 0x2e, 0x89, 0xd8, 0x4a, 0xde,
-  0xfb, 0xc1, 0x12, 0x3b, 0xd1, 0x92, 0x76, 0x46, 0x71, 0xf1, 0x46, 0x96, 0xb0, 0x89, 0x59, 0x74,
-  0xd5, 0xb2, 0x7e, 0x66, 0xbc, 0xeb, 0x12, 0x02, 0xfb, 0xf0, 0xba, 0x8b, 0x57, 0x0f, 0x11, 0x26,
-  0x52, 0xd4, 0x82, 0x7e, 0xe7, 0xa3, 0xad, 0x6b, 0x45, 0x67, 0xb3, 0x79, 0xc2, 0x3d, 0x35, 0xea,
-  0x4b, 0xf1, 0x4b, 0x09, 0xb4, 0x10, 0xcc, 0x3c, 0x78, 0x49, 0x71, 0x09, 0x0a, 0xf9, 0x3c, 0xa6,
-  0x26, 0x04, 0x50, 0x27, 0xb0, 0x12, 0x36, 0xdf, 0x09, 0x4d, 0xe6, 0x3d, 0x91, 0xd1, 0x73, 0x27,
-  0x54, 0xc8, 0x82, 0xfe, 0x64, 0x0c, 0x76, 0x64, 0xe1, 0x74, 0x46, 0x96, 0x35, 0xbc, 0x9b, 0x91,
-  0xd6, 0x41, 0x00, 0x40, 0x28, 0x91, 0xe7, 0x6b, 0x37, 0x12, 0xcb, 0x67, 0x0d, 0xfa, 0x4c, 0x78,
-  0x64, 0x8f, 0x55, 0xff, 0xa3, 0xfa, 0xe2, 0x9e, 0x9d, 0xaf, 0xe0, 0x07, 0x90, 0x7d, 0x3b, 0xd5,
-  0x19, 0xec, 0x83, 0x34, 0xc1, 0x37, 0x80, 0xd7, 0xaa, 0x2a, 0xf1, 0x09, 0x05, 0x48, 0x73, 0x3f,
-  0x06, 0xc5, 0xe0, 0xa6, 0x0e, 0xd0, 0xef, 0x4c, 0x6b, 0x21, 0x0b, 0x4f, 0x69, 0x0c, 0x9f, 0x62,
-  0x50, 0x9d, 0xc7, 0x05, 0x29, 0x2a, 0x5a, 0x5f, 0x39, 0x5e, 0xac, 0x5f, 0x88, 0xb4, 0x48, 0x6b,
-  0xbe, 0xb1, 0x74, 0x14, 0xfd, 0xd9, 0xb7, 0x4c, 0xc7, 0x15, 0x1b, 0xfa, 0xd9, 0xfc, 0xd2, 0x2f,
-  0x3d, 0x82, 0xf1, 0x72, 0xd0, 0xc8, 0x64, 0xb5, 0xf4, 0x68, 0x28, 0x0f, 0xcb, 0x34, 0x45, 0x7d,
-  0x49, 0x03, 0x2c, 0x8f, 0xa2, 0x8a, 0x41, 0xcf, 0xae, 0xb6, 0x41, 0x7d, 0x0c, 0x8b, 0xd5, 0x97,
-  0xf4, 0xc7, 0x22, 0x11, 0x90, 0xb1, 0x17, 0xc3, 0x8e, 0xdf, 0xc7, 0xb0, 0x89, 0xd6, 0xc2, 0x9e,
-  0xce, 0x4a, 0xa8, 0xf8, 0x58, 0x04, 0x7c, 0xb7, 0x51, 0x36, 0xf1, 0x16, 0x43, 0x30, 0x04, 0x26,
-  0x22, 0x09, 0xe9, 0xf0, 0x36, 0x14, 0x7f, 0x9a, 0xec, 0x24, 0xe5, 0x7b, 0xc8, 0xe2, 0x2f, 0xc1,
-  0x1c, 0xbe, 0x6e, 0xb1, 0x24, 0xa6, 0x66, 0x6c, 0x14, 0x58, 0xef, 0x38, 0xc9, 0x8a, 0xbf, 0xf7,
-  0x4f, 0x83, 0xc0, 0x7c, 0xac, 0x3b, 0x21, 0xfb, 0x2b, 0xb3, 0x44, 0x54, 0x89, 0x5b, 0x15, 0x77,
-  0xac, 0xbd, 0x04, 0xb1, 0xa9, 0x53, 0x2e, 0x46, 0x18, 0x80, 0xe1, 0xb4, 0xb8, 0xf7, 0xa8, 0x84,
-  0x6c, 0x5b, 0xf1, 0x72, 0x55, 0xe1, 0xda, 0x6f, 0x6e, 0xa4, 0x0c, 0x4b, 0x9d, 0x7a, 0x14, 0x6d,
-  0x18, 0x55, 0x4e, 0x50, 0xd6, 0xd7, 0x77, 0x3e, 0xce, 0x8e, 0x10, 0xc0, 0x38, 0x5b, 0xf1, 0x04,
-  0xe7, 0x37, 0x45, 0xe0, 0x8c, 0x26, 0xce, 0x8f, 0x80, 0x42, 0x58, 0x59, 0x36, 0xd9, 0xf8, 0x62,
-  0x67, 0x34, 0x83, 0x2f, 0x9f, 0x6f, 0x7c, 0x29, 0xe5, 0xb6, 0x32, 0x33, 0x06, 0x5c, 0x76, 0x9c,
-  0x19, 0xa8, 0xa8, 0xe2, 0xa6, 0x7d, 0x1a, 0xa2, 0x51, 0x05, 0xad, 0x56, 0x7a, 0xe2, 0x62, 0xde,
-  0xb5, 0x4b, 0xb1, 0x51, 0x5d, 0xc4, 0x81, 0x26, 0x41, 0xdd, 0x67, 0xb7, 0xf7, 0x78, 0x65, 0xe8,
-  0x48, 0x4a, 0x20, 0x6f, 0xc0, 0x12, 0x93, 0x69, 0xe0, 0xdf, 0x43, 0xae, 0x42, 0x6c, 0x9f, 0x86,
-  0x78, 0xa7, 0x08, 0x4f, 0x9e, 0xfd, 0x00, 0xc2, 0xd2, 0x05, 0x25, 0xdf, 0x98, 0x09, 0xfa, 0x46,
-  0x56, 0x01, 0x18, 0x57, 0xf0, 0x28, 0x18, 0xe6, 0x33, 0x4c, 0x2c, 0x72, 0x0d, 0xf1, 0x4a, 0x05,
-  0x4d, 0x9b, 0x53, 0x53, 0xb4, 0x94, 0x43, 0x9d, 0x5e, 0x9f, 0x13, 0x27, 0x8b, 0x94, 0x55, 0x51,
-  0x49, 0x94, 0x9d, 0xf6, 0x11, 0x4c, 0x55, 0xf6, 0xea, 0xe7, 0x04, 0xbc, 0x87, 0x84, 0xa3, 0x7b,
-  0x60, 0x33, 0x85, 0xb1, 0x74, 0x7d, 0x8b, 0x5d, 0x14, 0xa9, 0x03, 0x1d, 0x91, 0x6f, 0xf9, 0x2e,
-  0xf6, 0x4d, 0xe3, 0x85, 0x55, 0x4d, 0x95, 0xd9, 0xb5, 0x57, 0x03, 0x21, 0xdc, 0x49, 0xe4, 0x07,
-  0xe6, 0x9c, 0x22, 0x4b, 0xcf, 0x23, 0xba, 0x44, 0xbf, 0x64, 0x9d, 0xaf, 0x20, 0xe7, 0x80, 0xc0,
-  0x81, 0x83, 0xc1, 0xf8, 0xe5, 0x0a, 0x28, 0x44, 0x4b, 0x4a, 0x2e, 0x21, 0x0a, 0xae, 0x13, 0xc1,
-  0x2d, 0x8a, 0xe1, 0x0c, 0xf9, 0x84, 0x1d, 0x0a, 0xe7, 0xd7, 0xc0, 0x22, 0x35, 0x87, 0x31, 0xcc,
-  0x63, 0x54, 0x19, 0x36, 0x45, 0x41, 0x28, 0x76, 0x95, 0x14, 0xd1, 0x9f, 0xb0, 0x2b, 0xb2, 0xbd,
-  0x46, 0x43, 0xaa, 0xb2, 0xd7, 0xd8, 0xae, 0x50, 0x4d, 0xaf, 0xb9, 0x36, 0xc2, 0xfa, 0xf7, 0xf0,
-  0x64, 0x65, 0x34, 0xd1, 0x69, 0x28, 0x9b, 0x0a, 0xc4, 0x44, 0xfc, 0xf2, 0xf0, 0x80, 0x85, 0x56,
-  0xc3, 0xff, 0x70, 0x96, 0x8c, 0xed, 0xeb, 0xc0, 0x05, 0x67, 0xcd, 0x7b, 0x32, 0x42, 0x3c, 0xee,
-  0x07, 0x40, 0x06, 0x30, 0x68, 0xf0, 0x5b, 0xd3, 0x78, 0x63, 0x94, 0x08, 0xf3, 0x2f, 0x4d, 0x58,
-  0x59, 0x0e, 0x94, 0x68, 0x59, 0x61, 0xe9, 0x37, 0x7e, 0xfa, 0x1a, 0x26, 0x25, 0xbe, 0x19, 0x24,
-  0xff, 0x34, 0x5a, 0xf8, 0x58, 0x17, 0xf5, 0x43, 0xbc, 0xcc, 0x9c, 0x29, 0x89, 0x44, 0x3e, 0xb0,
-  0xe3, 0x3e, 0xff, 0x6c, 0x41, 0xdd, 0xd5, 0x48, 0x1a, 0x56, 0x06, 0x3c, 0x34, 0x17, 0xb9, 0x09,
-  0xff, 0x92, 0x89, 0xf5, 0x7e, 0xc3, 0x69, 0x4f, 0x06, 0x0d, 0xfe, 0x22, 0x29, 0x84, 0x17, 0x8d,
-  0xa9, 0x24, 0x83, 0x46, 0x38, 0x68, 0x04, 0x2e, 0x3b, 0x1d, 0x97, 0x1b, 0x21, 0xae, 0x31, 0x0c,
-  0x27, 0xe6, 0x1d, 0x4d, 0x41, 0x16, 0x71, 0x9a, 0x3d, 0x58, 0x34, 0x87, 0x15, 0xdc, 0x9f, 0x63,
-  0x73, 0xb9, 0xea, 0x93, 0xdf, 0xcc, 0x00, 0x9b, 0x58, 0x50, 0xce, 0xa3, 0xf5, 0x0a, 0x98, 0xd3,
-  0x84, 0x78, 0x3a, 0x32, 0xdd, 0xb8, 0xf0, 0x99, 0x14, 0x62, 0x5d, 0x8b, 0x91, 0x2a, 0xca, 0xef,
-  0x69, 0x9d, 0xd8, 0xc2, 0x65, 0xa6, 0x81, 0xe9, 0xc0, 0x19, 0x8e, 0x29, 0x98, 0x43, 0xd0, 0x44,
-  0x1b, 0xc4, 0x74, 0xe5, 0xdf, 0x83, 0x3c, 0x88, 0x2e, 0x0c, 0x6c, 0xa3, 0x98, 0xf2, 0x22, 0x5f,
-  0x18, 0xf1, 0x62, 0x62, 0x6f, 0xd0, 0x70, 0xf8, 0xb8, 0xa9, 0x28, 0xfa, 0x56, 0xf8, 0x31, 0xcb,
-  0x3a, 0x9d, 0x0d, 0xdb, 0x56, 0xf2, 0x45, 0x61, 0xd6, 0x30, 0x21, 0x4a, 0x07, 0xc9, 0xcc, 0x95,
-  0x77, 0x1e, 0x26, 0x52, 0xc4, 0x5c, 0x43, 0xb0, 0x0b, 0x72, 0x6e, 0x89, 0xb9, 0x3c, 0x1a, 0x86,
-  0xc4, 0xc5, 0xeb, 0xa3, 0x34, 0x38, 0x50, 0x35, 0x3e, 0x1d, 0x51, 0xc1, 0x6a, 0x91, 0x2f, 0x8a,
-  0xeb, 0x31, 0xbc, 0x32, 0xc4, 0x6e, 0xcf, 0xf0, 0x59, 0xe3, 0x22, 0x2a, 0x5e, 0x49, 0xc2, 0xc2,
-  0x22, 0x5e, 0x86, 0x27, 0x67, 0xeb, 0x20, 0x00, 0xf9, 0x4f, 0xe6, 0x10, 0x57, 0xe0, 0x2f, 0x4f,
-  0xa5, 0xad, 0xdc, 0x74, 0xab, 0xb4, 0xd4, 0xec, 0xa4, 0x25, 0x2e, 0x4d, 0xdb, 0x29, 0x17, 0x27,
-  0xe5, 0xa5, 0x61, 0x85, 0x2c, 0x4f, 0xf3, 0xd3, 0xa7, 0x37, 0x2c, 0x92, 0xcc, 0x02, 0x4b, 0x4a,
-  0x3d, 0xde, 0x58, 0xd4, 0xcf, 0x1f, 0xbc, 0x55, 0x8e, 0x7f, 0x7a, 0xd3, 0xed, 0x76, 0xfb, 0xe4,
-  0x9f, 0xfe, 0x3a, 0xc8, 0xef, 0x0c, 0x48, 0xf0, 0x1d, 0x16, 0x00, 0xc8, 0x02, 0x38, 0x46, 0x2c,
-  0xbe, 0x90, 0x3a, 0xe3, 0xea, 0x8d, 0x4f, 0x40, 0xa5, 0xe0, 0x3d, 0x65, 0xa6, 0x2c, 0x34, 0x67,
-  0x94, 0x1b, 0xb0, 0x47, 0xc4, 0xc2, 0xa4, 0x46, 0x45, 0xc0, 0x15, 0x37, 0x00, 0xeb, 0x10, 0xe1,
-  0x40, 0x50, 0x89, 0x85, 0xfc, 0x0a, 0xd9, 0xbb, 0xca, 0x12, 0x42, 0x28, 0x07, 0x20, 0xc4, 0xac,
-  0x8e, 0xf7, 0x9d, 0x8a, 0x7b, 0xb9, 0x98, 0x00, 0x85, 0xc4, 0xf4, 0x6c, 0xb0, 0xb0, 0x33, 0x18,
-  0x7c, 0x94, 0x16, 0x84, 0x40, 0x94, 0x2a, 0xa7, 0xf1, 0x66, 0x9a, 0x2e, 0x90, 0xc9, 0x76, 0x31,
-  0xcc, 0xee, 0x6b, 0xe4, 0x63, 0xb1, 0xf0, 0x11, 0x58, 0xea, 0x87, 0xec, 0x46, 0x1b, 0xd2, 0xc8,
-  0xc0, 0x38, 0xf5, 0xbf, 0x53, 0xba, 0x22, 0x66, 0x44, 0x8e, 0x21, 0x84, 0xd3, 0x4f, 0x89, 0x33,
-  0xe3, 0x14, 0x60, 0x6f, 0x14, 0xeb, 0x7e, 0xb2, 0x81, 0xb1, 0x56, 0x84, 0xb2, 0x89, 0xc5, 0x6c,
-  0x1c, 0x9c, 0xb6, 0x1f, 0x31, 0x52, 0x2a, 0xe7, 0x6c, 0xa5, 0xec, 0xfe, 0x65, 0x72, 0x11, 0x0e,
-  0x3c, 0x05, 0x0d, 0x20, 0xf9, 0xcb, 0x31, 0x51, 0x15, 0xc6, 0x0f, 0x29, 0xc4, 0x2b, 0xdc, 0xde,
-  0x9c, 0x93, 0x20, 0x0b, 0xb9, 0x20, 0x20, 0xf4, 0x78, 0x61, 0x1a, 0xb4, 0x62, 0x1d, 0x82, 0x35,
-  0x8c, 0x95, 0x4b, 0x48, 0xc3, 0x0a, 0x6d, 0xc8, 0xda, 0xbb, 0xf5, 0xfc, 0x7b, 0x4f, 0x48, 0xb5,
-  0x92, 0x2a, 0x47, 0xc0, 0x75, 0xf6, 0xce, 0x77, 0x23, 0xbc, 0xfb, 0x2d, 0x5f, 0x62, 0x1f, 0x98,
-  0xd8, 0x27, 0xa6, 0x57, 0x26, 0x41, 0xe2, 0x80, 0xc3, 0x00, 0xa6, 0x14, 0x54, 0xe4, 0x59, 0xcf,
-  0xd5, 0x96, 0x6c, 0xe3, 0xcd, 0xb6, 0x9d, 0x33, 0x57, 0x3c, 0xb9, 0x88, 0xd3, 0x5c, 0x23, 0x4d,
-  0x78, 0x87, 0xc0, 0x13, 0x71, 0x29, 0x8b, 0xc8, 0x9d, 0xce, 0xf2, 0x54, 0xa9, 0x94, 0x1e, 0xab,
-  0x76, 0x18, 0x34, 0x9d, 0xcd, 0x1c, 0x0b, 0x3b, 0xfa, 0x88, 0xdc, 0x42, 0xf8, 0x7d, 0x3d, 0x29,
-  0x15, 0x6c, 0xdf, 0x92, 0x5b, 0xda, 0x1e, 0x30, 0x3c, 0x52, 0x19, 0x8a, 0x66, 0x2f, 0x59, 0x6f,
-  0xee, 0x81, 0xc4, 0xbe, 0x92, 0xca, 0x19, 0xcb, 0x79, 0x0b, 0x4e, 0x76, 0x73, 0x86, 0x84, 0xdf,
-  0x2c, 0x2b, 0x3e, 0xa7, 0x16, 0x28, 0x78, 0xcb, 0x5d, 0xcc, 0x6a, 0xec, 0x96, 0x03, 0x0e, 0x27,
-  0x3a, 0x1e, 0x33, 0x77, 0x5b, 0xc5, 0x77, 0x4f, 0x83, 0x98, 0x5d, 0x73, 0xcd, 0x72, 0xed, 0x8e,
-  0x95, 0x3b, 0x3e, 0x6f, 0x4b, 0x85, 0x37, 0xe6, 0xbb, 0x93, 0x11, 0x45, 0x2f, 0x5c, 0xc3, 0x1f,
-  0x73, 0xea, 0x03, 0x11, 0x4c, 0x13, 0x71, 0x7e, 0x54, 0x4b, 0x14, 0xeb, 0x7a, 0x22, 0x38, 0xc2,
-  0xe4, 0xb7, 0x86, 0x95, 0x1d, 0x43, 0xdf, 0x4a, 0xed, 0x08, 0x36, 0x33, 0xb1, 0x5f, 0xe6, 0xe0,
-  0x8d, 0x80, 0x61, 0x2f, 0x1e, 0x97, 0xaf, 0xef, 0xc7, 0x7e, 0xa6, 0x92, 0x77, 0x4d, 0x88, 0xa1,
-  0x9a, 0xf1, 0x6a, 0x49, 0x02, 0x83, 0x1e, 0x5a, 0x1a, 0x56, 0x13, 0x27, 0x44, 0x4a, 0x5c, 0x1b,
-  0x22, 0xa8, 0x15, 0x20, 0xa8, 0x09, 0x0c, 0xb5, 0x8c, 0xa7, 0x0b, 0x18, 0x9d, 0x97, 0xac, 0xfb,
-  0x91, 0xfc, 0x99, 0xd5, 0x23, 0xb6, 0x10, 0xd8, 0x7a, 0x2d, 0x76, 0x47, 0xa4, 0x91, 0x7d, 0xa3,
-  0x67, 0xdc, 0xd7, 0x28, 0x67, 0x45, 0x59, 0x67, 0x2a, 0xa9, 0x14, 0xd6, 0xe8, 0x6b, 0x53, 0x08,
-  0x42, 0x6e, 0xfb, 0xec, 0x57, 0x50, 0x7a, 0xba, 0xa6, 0xad, 0x1e, 0xfa, 0x0b, 0x8a, 0xd6, 0x07,
-  0xbe, 0xc0, 0xe7, 0x29, 0x8b, 0xe8, 0x6b, 0xd8, 0xba, 0xba, 0x0e, 0x7b, 0x4d, 0x78, 0x14, 0x9f,
-  0xb4, 0x55, 0x72, 0x53, 0x64, 0x3a, 0x45, 0x7f, 0xd0, 0x50, 0x83, 0x24, 0xc1, 0x6c, 0x24, 0x58,
-  0xc3, 0x32, 0x3c, 0x6e, 0xed, 0xa6, 0x8e, 0xeb, 0xa0, 0x09, 0x0e, 0x88, 0x6b, 0xce, 0x21, 0x30,
-  0x0c, 0xd7, 0x34, 0x64, 0xa6, 0xe6, 0x4f, 0x30, 0x81, 0x2e, 0xb3, 0x8a, 0xa0, 0xe2, 0x24, 0xe3,
-  0x4e, 0xe3, 0xd6, 0xd2, 0x61, 0x41, 0xd7, 0x67, 0xcc, 0x13, 0x34, 0x22, 0x68, 0xff, 0xa6, 0xe8,
-  0x9b, 0xe9, 0x03, 0x00, 0x80, 0xee, 0x5a, 0x39, 0x7b, 0x0c, 0xe2, 0x50, 0xc9, 0xca, 0xc3, 0xa5,
-  0x79, 0x4b, 0xd1, 0xf0, 0xd0, 0xf9, 0x32, 0x36, 0x43, 0x14, 0x92, 0x10, 0x81, 0xf8, 0x80, 0xaf,
-  0xbd, 0x9c, 0x48, 0x9c, 0x49, 0x42, 0xcd, 0xa6, 0xeb, 0x90, 0x9f, 0xfb, 0xc0, 0x3a, 0x6d, 0xc7,
-  0xa2, 0x61, 0xe9, 0xf8, 0x8c, 0x0d, 0xe3, 0xe5, 0x17, 0x56, 0x09, 0x11, 0x51, 0xbe, 0xf0, 0xd5,
-  0xa1, 0xc3, 0x3d, 0x35, 0xb2, 0x64, 0xee, 0xfa, 0x53, 0x1e, 0xd0, 0xc0, 0x24, 0xb3, 0x59, 0x26,
-  0x0a, 0xa8, 0x14, 0x93, 0x76, 0xf1, 0x56, 0xb8, 0xf9, 0x6d, 0xf9, 0x4f, 0x1b, 0x80, 0x60, 0xef,
-  0xbe, 0xb2, 0xbd, 0xff, 0xba, 0x34, 0x57, 0x2b, 0xdc, 0x57, 0xb0, 0x17, 0xe9, 0x69, 0x0e, 0x89,
-  0x4b, 0xea, 0xbd, 0xcc, 0x98, 0xf4, 0x5c, 0x63, 0xf8, 0xc3, 0xfa, 0x15, 0x57, 0xf0, 0x73, 0x4a,
-  0xc2, 0x12, 0xd0, 0x97, 0x2a, 0x58, 0x5c, 0xc5, 0x4f, 0x31, 0xc4, 0x47, 0x21, 0xdb, 0x0a, 0x56,
-  0x42, 0x1c, 0x2e, 0x84, 0x61, 0x62, 0x69, 0xa8, 0x80, 0x12, 0xd5, 0x6b, 0xc2, 0xca, 0x98, 0xcc,
-  0x23, 0xae, 0x5d, 0xb7, 0xb6, 0x5e, 0x35, 0x20, 0xdf, 0xf0, 0x0e, 0x48, 0xc0, 0xf9, 0xb5, 0x90,
-  0x00, 0x56, 0xc0, 0x05, 0xe1, 0xc3, 0xa3, 0x6d, 0xdf, 0xb5, 0x4b, 0x2a, 0xfa, 0x69, 0x7b, 0x41,
-  0xce, 0xb8, 0xea, 0x18, 0x31, 0x71, 0x84, 0x90, 0xc1, 0x92, 0x4a, 0x62, 0x4f, 0x11, 0xf3, 0xf9,
-  0x78, 0xdf, 0x19, 0x01, 0xc3, 0x53, 0x8b, 0x4f, 0xf6, 0xda, 0xdd, 0x84, 0xb0, 0x71, 0x4e, 0xc8,
-  0xb6, 0x0f, 0x0d, 0xb6, 0x3c, 0x2b, 0xa4, 0xb5, 0xdb, 0x27, 0x0c, 0x05, 0x7d, 0x4c, 0x95, 0x31,
-  0x98, 0xac, 0x88, 0x12, 0x7b, 0xbb, 0xdc, 0xbf, 0x7b, 0x62, 0xd7, 0x6c, 0xd7, 0x6e, 0xe9, 0xe3,
-  0xbe, 0xce, 0x3e, 0x08, 0x7e, 0x2b, 0x02, 0x8a, 0xb5, 0x48, 0x97, 0xb7, 0x09, 0xb6, 0xb0, 0x4d,
-  0x93, 0x01, 0x4e, 0xe1, 0x7b, 0x69, 0x17, 0x20, 0xe0, 0x6b, 0x1f, 0x9c, 0x15, 0xfc, 0x6f, 0x53,
-  0x3f, 0x04, 0xf4, 0x1a, 0x50, 0xbd, 0x16, 0x13, 0xb2, 0x1c, 0xa5, 0x18, 0xec, 0x57, 0x69, 0xf8,
-  0x86, 0x41, 0x05, 0xe5, 0xac, 0xe8, 0x02, 0x2a, 0x96, 0x74, 0x07, 0x8c, 0x75, 0x05, 0xbe, 0xbc,
-  0xa0, 0xa4, 0x2e, 0x2a, 0xea, 0xa9, 0x98, 0xbf, 0xc2, 0x82, 0x3a, 0x2b, 0x55, 0xbc, 0x02, 0xc3,
-  0x5a, 0x56, 0x4f, 0x3f, 0x65, 0x61, 0x30, 0x88, 0x0b, 0xdf, 0x47, 0x8c, 0x24, 0x97, 0xa6, 0xe3,
-  0x25, 0xb6, 0x0d, 0x7f, 0x74, 0xe3, 0x90, 0xd9, 0xb8, 0x9c, 0x5c, 0x6d, 0xa5, 0x07, 0xac, 0x77,
-  0xbb, 0x38, 0xba, 0x48, 0xaa, 0x09, 0x3d, 0x52, 0xc9, 0x09, 0x27, 0xfb, 0x7d, 0x20, 0x81, 0x91,
-  0xd5, 0x53, 0x89, 0x69, 0x59, 0x74, 0x05, 0xf1, 0x42, 0x9d, 0xa1, 0x2b, 0xc9, 0x0f, 0x33, 0xaa,
-  0x9a, 0xe6, 0x8a, 0xaf, 0x32, 0xc5, 0x68, 0xa9, 0xe1, 0x04, 0x1c, 0x03, 0x30, 0xe2, 0x4f, 0xf6,
-  0xbc, 0x48, 0xeb, 0x4d, 0x52, 0x01, 0x3d, 0x9c, 0x19, 0x85, 0x3f, 0x54, 0xc5, 0x58, 0x3b, 0x33,
-  0xc1, 0x38, 0xc3, 0xc7, 0x59, 0x00, 0xd1, 0x84, 0xdd, 0x80, 0xc8, 0x87, 0x15, 0x4a, 0x0d, 0xe9,
-  0x2b, 0xec, 0xb8, 0x77, 0x2b, 0xa1, 0xd2, 0xc1, 0x5b, 0x7f, 0xd0, 0x30, 0x79, 0xe0, 0x3a, 0xc6,
-  0x92, 0xcb, 0xff, 0x45, 0x0f, 0xc7, 0x17, 0xbb, 0x67, 0x77, 0x95, 0x8c, 0x1e, 0x12, 0x7e, 0xc7,
-  0x71, 0xbf, 0x95, 0x19, 0x5f, 0x4a, 0x71, 0x66, 0xf9, 0x22, 0x49, 0xc1, 0x3a, 0xd3, 0xab, 0xf2,
-  0x83, 0x97, 0x1d, 0x27, 0x88, 0xc1, 0x95, 0xf8, 0x95, 0x8e, 0x90, 0x45, 0x55, 0x37, 0x58, 0x13,
-  0x67, 0x4e, 0x16, 0x8f, 0x41, 0x67, 0x98, 0x12, 0xf0, 0x34, 0x01, 0xac, 0x22, 0xab, 0x1b, 0x1e,
-  0x92, 0xa3, 0x91, 0x10, 0x23, 0x81, 0x35, 0x93, 0xee, 0x6c, 0x85, 0x9d, 0x67, 0x10, 0x76, 0x56,
-  0x0a, 0x8d, 0xe4, 0xb2, 0x28, 0x02, 0x4d, 0x23, 0x4d, 0x59, 0xab, 0xc1, 0x13, 0x25, 0x4e, 0x2d,
-  0x4e, 0x45, 0x0e, 0x88, 0xc4, 0x25, 0xd2, 0x28, 0x68, 0xb9, 0x2e, 0x49, 0x5e, 0x77, 0x67, 0xd0,
-  0x72, 0x99, 0x2a, 0x84, 0xad, 0x53, 0xdf, 0x87, 0xd8, 0x5f, 0xc3, 0x94, 0x30, 0x8c, 0x63, 0xd8,
-  0x30, 0x99, 0x14, 0x3d, 0xf3, 0x07, 0x73, 0xb9, 0x34, 0x89, 0xe5, 0x07, 0x81, 0x48, 0x07, 0x31,
-  0x84, 0xe0, 0x81, 0xd1, 0x01, 0x1e, 0x7d, 0x80, 0x80, 0x95, 0xc8, 0x61, 0x14, 0xf8, 0x90, 0xf4,
-  0xa0, 0x15, 0x49, 0x4a, 0x0e, 0x6c, 0x82, 0x4a, 0x29, 0xf6, 0x02, 0x66, 0x96, 0xcc, 0x80, 0xf5,
-  0x1b, 0x22, 0x7b, 0xb0, 0x86, 0x6d, 0xec, 0x29, 0x72, 0x66, 0xa9, 0xb6, 0x76, 0xe5, 0xc3, 0xc7,
-  0x72, 0x96, 0x55, 0xd8, 0x2f, 0x5d, 0xa1, 0x93, 0xa3, 0x01, 0xf0, 0xac, 0xde, 0xdd, 0xea, 0x2e,
-  0x69, 0xa1, 0xb5, 0xa0, 0x2b, 0x60, 0x6b, 0x3d, 0xd3, 0x32, 0x99, 0xe6, 0x80, 0xa3, 0x34, 0xf3,
-  0x05, 0x35, 0x8c, 0x32, 0x7c, 0x12, 0xdb, 0xf5, 0xfe, 0xc0, 0x76, 0xe9, 0xb9, 0x94, 0x24, 0x95,
-  0x88, 0x5f, 0x50, 0x8c, 0x6f, 0x20, 0x18, 0x0d, 0x1d, 0x64, 0x15, 0x97, 0xe4, 0xb3, 0xc0, 0x0f,
-  0xc3, 0x99, 0x69, 0xd3, 0x03, 0xac, 0xba, 0x79, 0xcf, 0x05, 0xb6, 0x92, 0x22, 0x20, 0xf8, 0x03,
-  0x60, 0x5b, 0xc4, 0xdd, 0xbc, 0x2d, 0x21, 0xee, 0xc1, 0xdd, 0x6d, 0xf5, 0xc1, 0x1f, 0x26, 0xac,
-  0x90, 0x65, 0x88, 0x78, 0x45, 0x61, 0xe7, 0xda, 0x74, 0x69, 0x04, 0x2e, 0x34, 0x4a, 0xc9, 0x3c,
-  0x40, 0xd8, 0xb5, 0x20, 0x0c, 0x93, 0xa9, 0xb1, 0xe9, 0xd9, 0x10, 0x66, 0x9e, 0x3d, 0x5a, 0x2e,
-  0xc5, 0xf4, 0x28, 0x41, 0x57, 0x44, 0xe9, 0xf5, 0x61, 0x36, 0x56, 0x12, 0x3e, 0x0e, 0x49, 0xc8,
-  0x2d, 0x03, 0x70, 0x10, 0x70, 0xd9, 0xc4, 0xc5, 0x4d, 0x62, 0x1c, 0x8c, 0x55, 0xf8, 0xad, 0xf8,
-  0x51, 0xb7, 0xed, 0x79, 0x2e, 0x0e, 0x29, 0xb0, 0x5e, 0xac, 0xc0, 0xf0, 0x8e, 0x31, 0x3c, 0xc6,
-  0x7f, 0xc3, 0x4c, 0x70, 0xb9, 0xa5, 0xb8, 0x19, 0x1d, 0x56, 0xe3, 0x4a, 0xc1, 0x44, 0x38, 0x09,
-  0xd6, 0x77, 0xb7, 0xfb, 0xb5, 0x6f, 0x3e, 0x15, 0xc5, 0x38, 0x9f, 0x4c, 0x27, 0x62, 0xa5, 0x1c,
-  0xb0, 0x23, 0x95, 0x3d, 0x01, 0xce, 0x7b, 0x10, 0xa9, 0x3d, 0xa1, 0x0d, 0xbe, 0x26, 0x2c, 0x98,
-  0x4e, 0x80, 0x2a, 0xbb, 0x61, 0xcd, 0x64, 0xed, 0x05, 0x4e, 0x58, 0x14, 0x15, 0x00, 0xdf, 0xd9,
-  0xed, 0x0a, 0xfc, 0xc5, 0x23, 0xc8, 0x0f, 0xd1, 0x7f, 0xb3, 0xcd, 0xa8, 0xf0, 0xa7, 0x23, 0x13,
-  0xdc, 0x94, 0x45, 0x33, 0x86, 0xe1, 0x50, 0x2f, 0xe9, 0xd9, 0xcd, 0x96, 0x5f, 0xbf, 0xc7, 0xa2,
-  0xe7, 0x07, 0x9e, 0x56, 0xf8, 0x22, 0xd2, 0x67, 0xd6, 0xa5, 0xa8, 0x5f, 0xb2, 0xb0, 0x3d, 0x32,
-  0x65, 0x5f, 0x25, 0x5b, 0xdf, 0x78, 0x7b, 0x20, 0x3a, 0x3c, 0xdc, 0x10, 0x5f, 0x39, 0xd0, 0x45,
-  0x89, 0x0c, 0x3e, 0xd0, 0x47, 0x89, 0xdc, 0xc5, 0x4e, 0xca, 0xca, 0x9e, 0x70, 0xb1, 0xb0, 0x99,
-  0x92, 0x65, 0x73, 0xc9, 0xe2, 0x81, 0x6d, 0x69, 0x8b, 0xe8, 0x56, 0x90, 0xb3, 0xc3, 0xe2, 0x31,
-  0xe7, 0x30, 0x8e, 0x81, 0xc4, 0x06, 0x94, 0xfb, 0x0e, 0x32, 0x51, 0x17, 0x4c, 0x2e, 0xa4, 0x56,
-  0xdb, 0xbe, 0xe0, 0xe5, 0x09, 0xc1, 0xd9, 0x28, 0xab, 0x34, 0xbf, 0x64, 0xaa, 0x21, 0xa7, 0xf6,
-  0x1d, 0x0a, 0x81, 0xcd, 0x04, 0x23, 0xb6, 0x04, 0x99, 0x09, 0x73, 0xdb, 0x75, 0x3d, 0x2a, 0x8c,
-  0xe8, 0x2f, 0xd8, 0xc5, 0x55, 0x22, 0xdf, 0x07, 0xe6, 0x0a, 0x6b, 0x33, 0x4b, 0xff, 0x0e, 0x06,
-  0x2b, 0x7b, 0x36, 0x27, 0x1e, 0x61, 0xba, 0xf7, 0xe6, 0x63, 0x48, 0x70, 0xa0, 0x52, 0x2a, 0xe3,
-  0xcd, 0x14, 0xde, 0xc3, 0xde, 0xe7, 0x2d, 0xf0, 0xdd, 0x3d, 0xab, 0xa0, 0x68, 0x14, 0x78, 0xac,
-  0xc2, 0x7d, 0x12, 0x16, 0x23, 0xe0, 0x0d, 0xc5, 0x58, 0xb0, 0xa4, 0x2f, 0xe4, 0x73, 0x6c, 0x92,
-  0xf4, 0x66, 0xc2, 0xe7, 0xf7, 0xe3, 0x2c, 0x9f, 0xdf, 0x5f, 0x4f, 0x76, 0xa3, 0xa4, 0x24, 0x0d,
-  0x9e, 0xcd, 0xb1, 0xef, 0x11, 0x7f, 0xe8, 0x92, 0x44, 0x74, 0xb9, 0x72, 0xb3, 0x13, 0x17, 0x47,
-  0xc0, 0x4d, 0xb0, 0x4d, 0x3f, 0x1c, 0x03, 0x27, 0x59, 0x6e, 0xdc, 0x4e, 0x90, 0x74, 0x1d, 0x34,
-  0x21, 0x3f, 0xab, 0xb0, 0x90, 0xa7, 0x38, 0xeb, 0x1d, 0x1e, 0x38, 0xb4, 0xd9, 0x3d, 0x7f, 0xa9,
-  0xbc, 0xe4, 0x00, 0xa6, 0x81, 0x67, 0x4a, 0x29, 0x1f, 0xf8, 0xaf, 0x71, 0xc6, 0xb3, 0x36, 0xf0,
-  0x34, 0x0a, 0x8f, 0xa6, 0xf0, 0x67, 0x7e, 0xff, 0x17, 0xa9, 0x64, 0xc2, 0x8f, 0xf6, 0x57, 0x00,
-  0x00
+  0x92, 0xdf, 0xf9, 0x15, 0x6d, 0xcd, 0x8c, 0x23, 0x5d, 0x64, 0x90, 0x78, 0x64, 0x1c, 0x40, 0x78,
+  0x8d, 0xf3, 0x18, 0xdf, 0xb1, 0xc7, 0x3e, 0xe0, 0x49, 0xee, 0x3d, 0x99, 0x9c, 0x44, 0x48, 0x0d,
+  0x28, 0x16, 0x92, 0xae, 0x24, 0xfc, 0x58, 0x9b, 0xfd, 0x4d, 0xfb, 0x1b, 0xf6, 0x97, 0x6d, 0x55,
+  0x77, 0xeb, 0x05, 0x12, 0x38, 0x7b, 0xee, 0xa7, 0x9d, 0x73, 0x26, 0x06, 0xa9, 0xba, 0xba, 0xba,
+  0xba, 0xde, 0x5d, 0xcd, 0xe0, 0xe0, 0xed, 0xd5, 0xd9, 0xcd, 0x3f, 0xaf, 0xdf, 0x91, 0x45, 0xbc,
+  0x74, 0x87, 0x03, 0xfc, 0x97, 0xb8, 0xa6, 0x37, 0x37, 0x24, 0xea, 0x49, 0xf0, 0x9d, 0x9a, 0xf6,
+  0x70, 0xb0, 0xa4, 0xb1, 0x49, 0xac, 0x85, 0x19, 0x46, 0x34, 0x36, 0xa4, 0x55, 0x3c, 0x3b, 0x3a,
+  0x96, 0xc4, 0xd3, 0x9a, 0x67, 0x2e, 0xa9, 0x21, 0xdd, 0x39, 0xf4, 0x3e, 0xf0, 0xc3, 0x58, 0x22,
+  0x96, 0xef, 0xc5, 0xd4, 0x03, 0xb0, 0x7b, 0xc7, 0x8e, 0x17, 0x46, 0x57, 0xd3, 0x52, 0xd0, 0x8d,
+  0x57, 0x36, 0xbd, 0x73, 0x2c, 0x7a, 0xc4, 0xbe, 0xa8, 0x8e, 0xe7, 0xc4, 0x8e, 0xe9, 0x1e, 0x45,
+  0x96, 0xe9, 0x52, 0x43, 0x57, 0x97, 0xe6, 0x83, 0xb3, 0x5c, 0x2d, 0xd3, 0xef, 0xab, 0x88, 0x86,
+  0xec, 0x8b, 0x39, 0x85, 0xef, 0x9e, 0x2f, 0x6d, 0xcd, 0x3c, 0x1c, 0xc4, 0x4e, 0xec, 0xd2, 0xe1,
+  0xc5, 0xbb, 0xb7, 0x64, 0x42, 0xe3, 0xd8, 0xf1, 0xe6, 0xd1, 0xa0, 0xc9, 0x9f, 0x0d, 0x22, 0x2b,
+  0x74, 0x82, 0x78, 0x58, 0xbb, 0x33, 0x43, 0x62, 0x1b, 0xb6, 0x6f, 0xad, 0x96, 0x40, 0x89, 0xea,
+  0x9a, 0x41, 0x48, 0xef, 0x8c, 0x6e, 0x17, 0xe7, 0x1b, 0xf1, 0x69, 0x3f, 0x1a, 0x1a, 0xfe, 0xb9,
+  0x34, 0x3a, 0xb4, 0x8d, 0x1f, 0xae, 0x47, 0x46, 0x47, 0x7b, 0xf3, 0x1a, 0x3f, 0x5e, 0x18, 0x7a,
+  0xbb, 0xcd, 0x1e, 0x5e, 0x4c, 0xff, 0xb5, 0xf2, 0x63, 0x43, 0xeb, 0xdb, 0x8d, 0xd5, 0xf2, 0x6b,
+  0x60, 0x7c, 0xfe, 0xa2, 0xda, 0x8d, 0x30, 0xba, 0xb3, 0xc5, 0x27, 0xff, 0xeb, 0x3c, 0x70, 0x7c,
+  0xfe, 0x05, 0xc0, 0xf9, 0xb7, 0xf6, 0x9b, 0x3e, 0xce, 0xef, 0xfa, 0x96, 0x13, 0xa8, 0xb1, 0xb3,
+  0xa4, 0xfe, 0x2a, 0x56, 0xad, 0x55, 0x14, 0xfb, 0xcb, 0x49, 0x6c, 0x86, 0x71, 0x64, 0x1c, 0xe8,
+  0x6a, 0xc4, 0x3e, 0xbd, 0x75, 0xc2, 0xf8, 0x11, 0x87, 0xc3, 0xe0, 0xb3, 0xab, 0xab, 0x3b, 0x1a,
+  0x86, 0x8e, 0x4d, 0x23, 0xa3, 0xab, 0xc2, 0x68, 0x00, 0xeb, 0xcf, 0x56, 0x9e, 0x15, 0x3b, 0xbe,
+  0x47, 0x7e, 0x93, 0x95, 0xa7, 0x7b, 0xc7, 0xb3, 0xfd, 0xfb, 0x86, 0x1f, 0x50, 0x4f, 0x96, 0x16,
+  0x71, 0x1c, 0x44, 0xbd, 0x66, 0xf3, 0xd6, 0xf3, 0x1b, 0xf7, 0x2e, 0xb5, 0x1b, 0x73, 0xda, 0x9c,
+  0x51, 0x33, 0x5e, 0x85, 0x34, 0x6a, 0x46, 0x82, 0x31, 0xcd, 0x9f, 0xe0, 0xcd, 0x51, 0xf2, 0x4d,
+  0x52, 0xd6, 0x29, 0xbe, 0xd1, 0x26, 0xbe, 0x74, 0x8c, 0xa4, 0x4a, 0x5f, 0x23, 0xea, 0xce, 0xf2,
+  0xd0, 0xf3, 0x73, 0x5b, 0xa6, 0xca, 0x53, 0x48, 0x01, 0xbd, 0x47, 0x70, 0xae, 0xf8, 0x9d, 0x4b,
+  0x91, 0xb7, 0xa3, 0x47, 0xf6, 0x2a, 0x03, 0xf5, 0x67, 0x33, 0x04, 0xcd, 0xc3, 0x44, 0xa3, 0xc7,
+  0x3f, 0x60, 0x13, 0xe1, 0xf1, 0x67, 0xed, 0x4b, 0xe3, 0xce, 0x74, 0x57, 0xd4, 0x38, 0xd2, 0xb3,
+  0x21, 0xae, 0x6f, 0xda, 0x7f, 0x9f, 0xc8, 0x54, 0xf5, 0x8c, 0x03, 0x4d, 0x79, 0x72, 0x69, 0x4c,
+  0x62, 0xc3, 0x6e, 0x58, 0x21, 0x2c, 0x87, 0x0a, 0x1c, 0xb2, 0xc4, 0xf7, 0x56, 0x52, 0xfa, 0x71,
+  0x03, 0x48, 0x3d, 0x8d, 0xe3, 0xd0, 0x99, 0xae, 0x62, 0x0a, 0x2f, 0x42, 0x4b, 0x52, 0xa9, 0xa2,
+  0x6e, 0x3e, 0x8f, 0x1f, 0x03, 0x0a, 0x8b, 0x89, 0xe9, 0x43, 0xdc, 0xfc, 0x6e, 0xde, 0x99, 0x09,
+  0x82, 0x2d, 0x40, 0x33, 0x7a, 0xf4, 0x00, 0x85, 0xa7, 0xc0, 0x2e, 0x4e, 0x7d, 0xfb, 0xb1, 0x61,
+  0x06, 0xc0, 0x12, 0xfb, 0x6c, 0xe1, 0xb8, 0xb6, 0x1c, 0x23, 0xbc, 0x69, 0xdb, 0xef, 0xee, 0x80,
+  0x8a, 0x0b, 0x27, 0x02, 0xd1, 0xa6, 0xa1, 0x2c, 0x21, 0xcd, 0x92, 0x2a, 0x2b, 0xc6, 0xf0, 0xe9,
+  0x03, 0x8d, 0x3f, 0xca, 0x8a, 0x6a, 0x2d, 0xa8, 0x75, 0x3b, 0x71, 0xe0, 0x13, 0x62, 0x1f, 0x5d,
+  0xc0, 0x87, 0x23, 0xdd, 0x30, 0xb8, 0xe4, 0xc0, 0xc2, 0x0f, 0x0f, 0xf9, 0xc7, 0x46, 0xb4, 0x70,
+  0x66, 0xb1, 0xac, 0xac, 0xcb, 0x11, 0x83, 0x08, 0xf8, 0x21, 0xac, 0x07, 0x10, 0x83, 0x22, 0x45,
+  0xbe, 0x4b, 0x1b, 0xae, 0x3f, 0x97, 0xa5, 0x77, 0xf8, 0x9c, 0x08, 0x6e, 0xc1, 0x3e, 0x91, 0x99,
+  0xe3, 0x52, 0xb6, 0x6e, 0xd0, 0x9c, 0x10, 0xf8, 0x73, 0x21, 0x9e, 0xfb, 0x33, 0x54, 0xce, 0x99,
+  0x33, 0x5f, 0x85, 0x26, 0x63, 0x2f, 0x5f, 0x37, 0x99, 0x99, 0x0e, 0x8a, 0xc9, 0x5f, 0xde, 0xb9,
+  0x67, 0xf9, 0xcb, 0x00, 0xb8, 0x4c, 0x49, 0x60, 0xce, 0x29, 0xb1, 0xcd, 0xd8, 0x3c, 0x80, 0xdd,
+  0xce, 0x6d, 0x62, 0xb4, 0xf0, 0xef, 0x6f, 0x7c, 0x33, 0x8a, 0xf9, 0xa6, 0xe8, 0xca, 0x13, 0x4a,
+  0x74, 0x6c, 0xa0, 0x1c, 0x48, 0x31, 0xbe, 0x60, 0xfb, 0xe0, 0x78, 0x40, 0xf2, 0x6f, 0x37, 0x97,
+  0x17, 0x06, 0x85, 0xb5, 0x58, 0xae, 0x19, 0x45, 0xb8, 0xd1, 0x86, 0x77, 0x22, 0x96, 0xd1, 0x93,
+  0x10, 0x93, 0xa4, 0x5a, 0x2e, 0x35, 0xc3, 0x1b, 0xae, 0x0a, 0xb2, 0x50, 0x09, 0xb6, 0x0f, 0xf1,
+  0x23, 0xac, 0xcf, 0xf4, 0x9c, 0x25, 0x23, 0xd5, 0x90, 0x3c, 0xdf, 0x83, 0x45, 0x09, 0x08, 0x03,
+  0x18, 0x99, 0x0c, 0x92, 0x13, 0xda, 0x40, 0x6e, 0xf3, 0x53, 0xe5, 0x3e, 0x37, 0x42, 0x1a, 0xb8,
+  0xa6, 0x85, 0x12, 0xc1, 0x26, 0x95, 0x70, 0x4d, 0x6a, 0xeb, 0x8d, 0xa6, 0xe5, 0x56, 0x36, 0xbd,
+  0x70, 0x96, 0x4e, 0x1c, 0xe1, 0xba, 0xd4, 0x58, 0x35, 0x55, 0x47, 0x79, 0x62, 0x36, 0x81, 0x72,
+  0x9b, 0xe0, 0x71, 0x9b, 0x60, 0x0a, 0x8b, 0x10, 0x73, 0x73, 0xe0, 0x64, 0xe3, 0x03, 0xc7, 0x8b,
+  0xae, 0x7e, 0x97, 0x39, 0x43, 0xa8, 0xb1, 0x21, 0xe6, 0x37, 0xe6, 0x9c, 0x49, 0xba, 0xe4, 0x78,
+  0xc1, 0x0a, 0x79, 0x34, 0xf3, 0x43, 0xd9, 0x01, 0xfb, 0xe1, 0x0c, 0x60, 0x1b, 0xa9, 0x37, 0x8f,
+  0x17, 0x7d, 0xa7, 0x5e, 0xe7, 0xa3, 0x3d, 0x83, 0x7e, 0x76, 0xbe, 0x34, 0xd0, 0xbe, 0x35, 0xa2,
+  0xd5, 0x34, 0x02, 0x79, 0xf4, 0xe6, 0xb2, 0xa6, 0xb6, 0x94, 0xbe, 0x33, 0x83, 0xfd, 0xd4, 0x24,
+  0xc3, 0xf0, 0x9e, 0x9f, 0xa5, 0x0b, 0x3d, 0xf9, 0xd0, 0x4a, 0x3e, 0xb4, 0xf1, 0x43, 0xb2, 0x29,
+  0x65, 0x58, 0x38, 0x8e, 0x00, 0x4d, 0xf9, 0x39, 0x28, 0x4f, 0x99, 0x36, 0x4a, 0x17, 0x37, 0x52,
+  0x3d, 0xce, 0x54, 0x52, 0xd5, 0x35, 0x65, 0x68, 0x1c, 0x6b, 0x0a, 0xda, 0x6f, 0xc7, 0x5b, 0xd1,
+  0x35, 0x60, 0x78, 0x01, 0x19, 0xf8, 0xa1, 0x23, 0x3e, 0x8c, 0x2f, 0xc4, 0x87, 0xd1, 0x8d, 0xf8,
+  0x70, 0x3e, 0x66, 0xa4, 0x1e, 0x1e, 0x4a, 0xd2, 0x01, 0xa7, 0x94, 0x4d, 0x06, 0xdf, 0x8f, 0xf4,
+  0xc2, 0x13, 0xbe, 0x1a, 0x13, 0x8c, 0x21, 0x63, 0xda, 0x2d, 0x30, 0xed, 0x76, 0xc0, 0x8d, 0x6d,
+  0xc2, 0xb9, 0x5b, 0xe0, 0x9c, 0xd9, 0x08, 0x56, 0xd1, 0x42, 0xe6, 0x2f, 0x3e, 0xdf, 0x7e, 0x51,
+  0x0a, 0xd0, 0x4c, 0xbf, 0xca, 0xa0, 0x99, 0x0e, 0x22, 0x34, 0xac, 0xc9, 0x6c, 0x44, 0x3e, 0xac,
+  0xdf, 0x33, 0x86, 0x9e, 0x61, 0xa4, 0x2c, 0xca, 0x28, 0x41, 0x46, 0x28, 0x8a, 0xb0, 0x75, 0x5c,
+  0xb9, 0xbe, 0x4d, 0xfc, 0x30, 0x7c, 0x54, 0xd9, 0xee, 0x93, 0x9f, 0x9f, 0xfe, 0x3e, 0xb9, 0xfa,
+  0xa3, 0xc1, 0x39, 0xed, 0xcc, 0x1e, 0x65, 0x53, 0x59, 0x13, 0xcb, 0xf4, 0x5e, 0xc5, 0x64, 0x4a,
+  0x09, 0x78, 0x30, 0xbb, 0xf1, 0x4d, 0x51, 0x33, 0x7c, 0x86, 0x24, 0xf1, 0x6f, 0x33, 0xf0, 0x47,
+  0x11, 0x98, 0x05, 0xb0, 0xeb, 0xb8, 0xc1, 0xc0, 0x9a, 0x03, 0xc3, 0x03, 0x4e, 0x00, 0xb3, 0xd8,
+  0x87, 0xd4, 0xa1, 0xfc, 0xbb, 0x09, 0x4c, 0x11, 0x03, 0xa1, 0x66, 0x48, 0x09, 0x93, 0x4e, 0xb0,
+  0x25, 0xee, 0xe3, 0x7e, 0x4a, 0x91, 0xbd, 0xdf, 0x0d, 0xa7, 0xae, 0xf7, 0xbf, 0x67, 0x32, 0xfc,
+  0x3d, 0x91, 0x61, 0x1f, 0x76, 0xf0, 0xfb, 0x1e, 0x19, 0xf6, 0x13, 0xe1, 0xf1, 0x13, 0xe1, 0xf1,
+  0x13, 0xe1, 0xf1, 0x13, 0xe1, 0xf1, 0x13, 0xe1, 0xf1, 0x13, 0xe1, 0xf1, 0x13, 0xe1, 0xf1, 0x95,
+  0x27, 0x86, 0x0a, 0x3e, 0x1a, 0x7e, 0x61, 0x12, 0x5d, 0xe1, 0x44, 0xb8, 0xa5, 0x44, 0xbc, 0x54,
+  0x05, 0xdc, 0x3d, 0x2a, 0xc0, 0x05, 0xf7, 0x7b, 0x2a, 0xb8, 0x39, 0x76, 0xe5, 0x9e, 0x6f, 0x6c,
+  0xc7, 0xb5, 0xe3, 0x31, 0x2b, 0xec, 0x3a, 0x16, 0x4a, 0x45, 0x7c, 0x4f, 0xa9, 0x07, 0xfb, 0x92,
+  0xaa, 0xea, 0xba, 0x89, 0x5f, 0x04, 0xd1, 0xeb, 0x03, 0xb6, 0x0b, 0xdf, 0x0b, 0xbb, 0xf0, 0x3d,
+  0xbf, 0x0b, 0x6b, 0xf8, 0x8f, 0x4f, 0x70, 0xa0, 0x65, 0xb6, 0x28, 0x0e, 0x1f, 0x27, 0xab, 0x29,
+  0x98, 0x33, 0x74, 0xb8, 0x40, 0xa9, 0xdd, 0x98, 0xcc, 0x1a, 0x68, 0xcd, 0x73, 0x78, 0x1a, 0x18,
+  0xf9, 0xc0, 0x92, 0xdf, 0xd2, 0x99, 0xb9, 0x72, 0x63, 0xc4, 0x96, 0x98, 0xb0, 0x84, 0x64, 0x60,
+  0x5a, 0xec, 0x07, 0xd7, 0xa1, 0x0f, 0xde, 0xc0, 0xe4, 0x26, 0x56, 0x88, 0x28, 0x8b, 0x7e, 0x86,
+  0x3a, 0x18, 0x50, 0x61, 0xb0, 0xa4, 0x1b, 0xdf, 0x27, 0x4b, 0xd3, 0x7b, 0x24, 0x10, 0x7e, 0x45,
+  0x04, 0x64, 0x83, 0x2c, 0x29, 0x89, 0x7d, 0xb2, 0x30, 0x3d, 0xdb, 0xa5, 0x07, 0x52, 0x1f, 0xcd,
+  0xe7, 0x40, 0xa7, 0x9d, 0xc3, 0x43, 0xd9, 0xab, 0x1b, 0xd2, 0x5f, 0xde, 0x5f, 0xe1, 0x19, 0xb8,
+  0x31, 0x88, 0x6a, 0x42, 0x50, 0x0d, 0xf4, 0x4f, 0xa6, 0x47, 0xde, 0x4d, 0xae, 0xdb, 0xad, 0x86,
+  0x94, 0xb8, 0x2e, 0x4f, 0x59, 0x33, 0xd2, 0x99, 0x07, 0xfd, 0x68, 0xba, 0x8e, 0xed, 0xc4, 0x8f,
+  0xb2, 0x82, 0x0a, 0x01, 0x4f, 0x23, 0xbe, 0xc4, 0x9c, 0x0d, 0xa7, 0x1e, 0x73, 0xaf, 0xc2, 0x04,
+  0x33, 0x9f, 0x84, 0xe1, 0xa2, 0xa4, 0x70, 0x0c, 0xd4, 0xee, 0xb3, 0x81, 0x17, 0xa7, 0x82, 0x0f,
+  0xf4, 0x84, 0x07, 0x80, 0x3d, 0x4d, 0x4d, 0x80, 0x01, 0x96, 0xfb, 0x1e, 0xdb, 0x89, 0xc0, 0x69,
+  0x3c, 0x02, 0x0c, 0xd8, 0x6c, 0xd7, 0x01, 0xef, 0xd3, 0x13, 0x4e, 0x88, 0x81, 0x06, 0xd1, 0xaa,
+  0xf5, 0x02, 0xd8, 0xc2, 0x7c, 0x43, 0xed, 0xf0, 0x30, 0x09, 0x01, 0xf2, 0x44, 0x5f, 0x9c, 0xe6,
+  0xdc, 0x06, 0x83, 0x87, 0x30, 0x8b, 0x0f, 0xd9, 0x24, 0x98, 0x4f, 0x7e, 0x71, 0x0a, 0x33, 0x6e,
+  0xcd, 0xde, 0xd5, 0x8c, 0x12, 0x0a, 0xfe, 0x3c, 0xcf, 0x4f, 0x96, 0x4c, 0xff, 0x14, 0xdd, 0x3b,
+  0xb1, 0xb5, 0x90, 0x4b, 0x78, 0x04, 0xa1, 0x96, 0xba, 0x49, 0x06, 0xe0, 0x56, 0x73, 0x0a, 0x93,
+  0x23, 0x09, 0x34, 0xcd, 0x32, 0x23, 0x4a, 0xb4, 0x5e, 0x29, 0x2a, 0x5d, 0x15, 0x7b, 0xd2, 0x9f,
+  0x42, 0xd0, 0x76, 0xdb, 0x67, 0xb0, 0x6d, 0xad, 0xb7, 0x35, 0x41, 0x5b, 0x2b, 0x40, 0x74, 0x4b,
+  0x20, 0xba, 0x79, 0x88, 0x6e, 0x09, 0x44, 0xb7, 0x00, 0xd1, 0x2a, 0x03, 0x69, 0xa5, 0x30, 0x36,
+  0x97, 0xfb, 0xde, 0x0e, 0x86, 0x26, 0xac, 0x5c, 0x33, 0x98, 0xa5, 0x0e, 0x00, 0x59, 0x60, 0x83,
+  0xf2, 0xac, 0x96, 0xda, 0x8e, 0x09, 0x44, 0xc8, 0x68, 0x39, 0xb6, 0x43, 0x38, 0x2e, 0xb1, 0x10,
+  0xc6, 0x24, 0xfa, 0xa9, 0x6c, 0x6c, 0x0f, 0x60, 0xbb, 0xa4, 0x4b, 0x8c, 0x41, 0x92, 0x68, 0x77,
+  0x8f, 0x99, 0x3a, 0x93, 0xea, 0x5e, 0x66, 0xa6, 0x94, 0xbe, 0xd0, 0xdc, 0xb8, 0xbe, 0x67, 0xe0,
+  0xe4, 0xa2, 0x38, 0x50, 0xa5, 0x83, 0x76, 0xeb, 0x24, 0xd3, 0xd1, 0xb6, 0x61, 0x94, 0x4f, 0xa8,
+  0x15, 0xc6, 0x9d, 0xd0, 0x61, 0xeb, 0xcd, 0x49, 0x4b, 0xfb, 0x5b, 0xdc, 0xd3, 0xbb, 0xf0, 0x0f,
+  0x22, 0x18, 0x1a, 0x80, 0x81, 0xbf, 0x38, 0x86, 0x47, 0xaf, 0xe1, 0x7f, 0xf6, 0xa5, 0x03, 0x1f,
+  0xda, 0xec, 0x4b, 0x5b, 0x07, 0x63, 0x39, 0xe8, 0x1c, 0x9f, 0x74, 0x7b, 0x9d, 0x0e, 0xc8, 0xec,
+  0xf3, 0x73, 0xa7, 0x8b, 0xa2, 0x2b, 0x20, 0x32, 0x76, 0x00, 0x73, 0x28, 0x0b, 0x32, 0x91, 0x17,
+  0x18, 0x6e, 0xaa, 0x31, 0xfe, 0x63, 0x82, 0x53, 0xe7, 0xd2, 0xb6, 0x0c, 0xee, 0xcd, 0xd0, 0x03,
+  0xe3, 0xb1, 0xb5, 0x77, 0x6c, 0xe7, 0x2f, 0x13, 0xc5, 0xfb, 0xb5, 0xa5, 0x69, 0x5b, 0x9a, 0x01,
+  0xb2, 0x60, 0x18, 0x05, 0x61, 0x16, 0xe6, 0xc0, 0xd0, 0x5b, 0xbd, 0x2d, 0xc5, 0x95, 0xc5, 0xbb,
+  0xa2, 0xf4, 0xf7, 0xb9, 0xaf, 0xab, 0x8a, 0xf6, 0x40, 0xf0, 0xa8, 0x55, 0x0c, 0xf7, 0xfc, 0x7c,
+  0xb8, 0xc7, 0xfc, 0x17, 0x73, 0x6a, 0x15, 0x01, 0x5f, 0xe2, 0xc7, 0xfc, 0xd2, 0x50, 0x4e, 0x8d,
+  0xb2, 0x6d, 0xf6, 0x0b, 0x51, 0x00, 0xe7, 0x4f, 0xa0, 0xd9, 0xe8, 0xc6, 0x72, 0x52, 0x1b, 0xa1,
+  0x17, 0x03, 0x2b, 0x34, 0x78, 0xf3, 0xfa, 0x44, 0x3a, 0xbf, 0x26, 0x20, 0xa3, 0x90, 0x16, 0x46,
+  0x3d, 0xa9, 0x17, 0x0d, 0x3b, 0x6f, 0x4e, 0xa4, 0xb7, 0xe0, 0x24, 0xc8, 0x87, 0xeb, 0xf3, 0x2b,
+  0xfe, 0x44, 0x3f, 0x91, 0xf0, 0x0b, 0xbe, 0x97, 0xf8, 0x53, 0x61, 0xfd, 0xf4, 0x6d, 0xc4, 0x9d,
+  0x37, 0x88, 0xf7, 0x75, 0xe7, 0x44, 0x3a, 0x73, 0x6f, 0x13, 0x1c, 0x92, 0xc4, 0x38, 0x14, 0x56,
+  0x48, 0x93, 0x2e, 0xbc, 0x2c, 0xe3, 0x8f, 0x59, 0x37, 0x84, 0xfc, 0x47, 0xaa, 0xab, 0xa8, 0x73,
+  0x43, 0xef, 0xcf, 0x07, 0xdd, 0xfe, 0x1c, 0x43, 0x0a, 0xb9, 0x0a, 0x83, 0x54, 0x9f, 0x73, 0x14,
+  0xe0, 0x15, 0xe4, 0xdc, 0xea, 0x0e, 0x0f, 0xe7, 0x83, 0xce, 0xf3, 0x33, 0x27, 0x0b, 0xb2, 0xad,
+  0x39, 0xfb, 0xac, 0xe3, 0xcb, 0x2e, 0x80, 0xcc, 0xeb, 0x1d, 0x6d, 0x10, 0x9d, 0xc8, 0x61, 0x85,
+  0xca, 0xab, 0x21, 0x24, 0x0d, 0xff, 0x5a, 0x39, 0x21, 0xb3, 0x87, 0x4a, 0x6f, 0x1b, 0x90, 0xcb,
+  0x50, 0x1e, 0x4c, 0x87, 0x6f, 0x89, 0x7f, 0x55, 0x94, 0x35, 0x44, 0x04, 0xdc, 0xbc, 0x86, 0x33,
+  0xc6, 0xab, 0xc4, 0x26, 0x96, 0x3c, 0x7b, 0x7e, 0x6e, 0x03, 0x89, 0x91, 0x1a, 0x31, 0xd5, 0x88,
+  0x40, 0x35, 0x60, 0x6c, 0xa5, 0xc2, 0xe7, 0xe2, 0x12, 0x03, 0x22, 0x1d, 0x35, 0x8f, 0xd0, 0xf7,
+  0x2c, 0x88, 0x2c, 0x6e, 0x0d, 0x86, 0xef, 0x04, 0xb3, 0xd0, 0x03, 0xbd, 0xc7, 0x92, 0xd1, 0xb5,
+  0x1a, 0x3f, 0x1b, 0x1e, 0xec, 0x93, 0xfe, 0x2b, 0x4e, 0xd1, 0x6a, 0xc1, 0xa4, 0xe0, 0x30, 0x22,
+  0x31, 0x37, 0x63, 0x0f, 0xe3, 0x5d, 0x07, 0x78, 0xd7, 0x69, 0x1f, 0xe0, 0xa3, 0xe3, 0x63, 0xa4,
+  0x8a, 0xe1, 0xb7, 0x7c, 0x86, 0xbf, 0xc8, 0x84, 0x1c, 0xbf, 0x71, 0xbc, 0x21, 0x10, 0x1c, 0x9f,
+  0x70, 0xee, 0xf4, 0x52, 0x6e, 0x32, 0x14, 0xb6, 0x33, 0x07, 0x1c, 0x75, 0xe9, 0x7e, 0x4b, 0x59,
+  0xf3, 0x84, 0x6c, 0xa9, 0x69, 0x5b, 0x03, 0x5a, 0xc0, 0x22, 0xe9, 0xec, 0x4f, 0x39, 0x5b, 0x3e,
+  0x5d, 0x15, 0xd9, 0xa2, 0x29, 0xc5, 0x29, 0x2d, 0xa9, 0x84, 0xf4, 0x97, 0x51, 0x1b, 0x4a, 0x3b,
+  0x56, 0xbd, 0x7b, 0x68, 0x24, 0xfd, 0x7b, 0x18, 0x36, 0x2b, 0xc3, 0xa3, 0xbf, 0xc6, 0xa1, 0xed,
+  0x16, 0xc3, 0xd3, 0xd5, 0x12, 0xdd, 0x2b, 0x8b, 0x55, 0x12, 0x3c, 0xe6, 0x16, 0x1e, 0xc8, 0x2d,
+  0x3a, 0xc8, 0xde, 0xf2, 0x71, 0x60, 0xee, 0xb6, 0xcd, 0x47, 0x46, 0xf2, 0xb9, 0x77, 0x07, 0x41,
+  0x1a, 0xb5, 0x09, 0xa4, 0xe1, 0x98, 0xd4, 0xf6, 0xa4, 0x31, 0x44, 0x94, 0x60, 0x8e, 0x6c, 0x22,
+  0x87, 0x7e, 0x6c, 0xe2, 0x2b, 0xfd, 0x58, 0xfb, 0x9f, 0xff, 0x56, 0xd2, 0x98, 0xc9, 0xde, 0x8d,
+  0xcf, 0xa6, 0x0f, 0x68, 0x33, 0x58, 0x31, 0xac, 0x27, 0xdc, 0xee, 0xfd, 0xf6, 0xde, 0xc5, 0x5b,
+  0xe4, 0xc6, 0xcf, 0xcf, 0x3c, 0x2c, 0x39, 0xfd, 0xd4, 0xe0, 0x36, 0x97, 0xda, 0x0c, 0x9d, 0x21,
+  0x62, 0x99, 0xb3, 0x71, 0x2e, 0x26, 0xe1, 0x56, 0x3b, 0xd8, 0x97, 0xa3, 0xab, 0x2b, 0xac, 0x04,
+  0xc2, 0xff, 0x77, 0x60, 0xb8, 0x33, 0x03, 0x1e, 0x6c, 0xe5, 0xeb, 0x96, 0x11, 0x54, 0xe5, 0xeb,
+  0x6e, 0xe9, 0xab, 0x24, 0x09, 0x3a, 0x83, 0x0c, 0xc2, 0x12, 0x59, 0x0c, 0x26, 0x44, 0x56, 0x92,
+  0x10, 0x59, 0xca, 0x1e, 0xed, 0x07, 0x47, 0x6b, 0xb0, 0x4a, 0x44, 0xbf, 0x64, 0x70, 0x92, 0x4d,
+  0x59, 0x49, 0x36, 0xc5, 0xe7, 0x90, 0x23, 0xe3, 0x87, 0x92, 0x1e, 0x85, 0xa7, 0x3c, 0x4f, 0x6c,
+  0x05, 0x38, 0x21, 0x38, 0x4c, 0x95, 0x7f, 0x71, 0x3c, 0x60, 0x0b, 0xfb, 0xc8, 0x77, 0xc6, 0xf2,
+  0x5d, 0x3f, 0x34, 0xa4, 0x9f, 0x66, 0xb3, 0x99, 0xd4, 0x4f, 0x73, 0xa4, 0x74, 0x60, 0x56, 0x03,
+  0xcd, 0xc6, 0x1f, 0xe9, 0xb9, 0x32, 0xc2, 0x2e, 0xda, 0x93, 0x4c, 0xd0, 0x4a, 0x32, 0x41, 0x2b,
+  0xc9, 0x04, 0xad, 0x24, 0x13, 0xb4, 0x44, 0x19, 0x21, 0xd8, 0x2a, 0x23, 0x04, 0x1b, 0x65, 0x84,
+  0xf9, 0xbe, 0x32, 0xc2, 0xfc, 0x87, 0xca, 0x08, 0xf3, 0xad, 0x32, 0x02, 0xcf, 0x8a, 0x35, 0xc8,
+  0x89, 0x83, 0x7c, 0x4e, 0x0c, 0x4b, 0x75, 0x0e, 0x8c, 0xef, 0x9c, 0x88, 0x19, 0x90, 0xb5, 0x2f,
+  0x37, 0x9e, 0x25, 0x1c, 0x99, 0x25, 0x1c, 0x99, 0x25, 0x1c, 0x99, 0x25, 0x1c, 0x99, 0x25, 0x1c,
+  0x99, 0x25, 0x1c, 0x99, 0x25, 0x1c, 0x99, 0xe5, 0x72, 0xe3, 0x59, 0x69, 0x6e, 0xfc, 0x58, 0x4a,
+  0xc4, 0x4b, 0x73, 0xe3, 0xc7, 0x5d, 0xb9, 0x31, 0xdf, 0x8a, 0xef, 0x5b, 0x5b, 0x91, 0x3d, 0x11,
+  0x7c, 0x4b, 0xe7, 0xc9, 0xde, 0xb1, 0x12, 0xc6, 0x7a, 0x3d, 0xe7, 0x95, 0x0e, 0x6a, 0x0c, 0x69,
+  0xae, 0xd2, 0x11, 0x14, 0x2b, 0x1d, 0x27, 0xdb, 0x12, 0x08, 0x8e, 0x58, 0xea, 0x6d, 0x3d, 0xde,
+  0xa8, 0x9f, 0xec, 0xc1, 0x2a, 0xf9, 0xa1, 0xe9, 0xcd, 0xd1, 0xb8, 0x30, 0x79, 0x5e, 0xf3, 0x7a,
+  0x8c, 0x95, 0xd4, 0x63, 0xf0, 0x03, 0x70, 0xfd, 0x00, 0xc5, 0x4f, 0xde, 0x23, 0xe2, 0x10, 0x05,
+  0xb8, 0x11, 0x65, 0xfc, 0xbe, 0xa8, 0x9a, 0xb0, 0x9f, 0x3f, 0x01, 0x00, 0x5b, 0x98, 0xd5, 0xff,
+  0x3f, 0xbb, 0x5f, 0x60, 0x0a, 0x66, 0x05, 0xdd, 0x88, 0x59, 0x4e, 0xee, 0xdd, 0x56, 0xc2, 0xbb,
+  0x89, 0x87, 0x60, 0x16, 0x31, 0xed, 0x02, 0xcb, 0x96, 0xc7, 0xa4, 0x5e, 0x80, 0xb3, 0x94, 0xfd,
+  0x6c, 0xd6, 0x2d, 0x3c, 0x8a, 0x52, 0xbf, 0x18, 0xae, 0x00, 0x6a, 0x65, 0xf8, 0xf5, 0x0b, 0x45,
+  0xbd, 0x18, 0xde, 0xc1, 0x97, 0x3b, 0x03, 0x3e, 0xfe, 0xb8, 0xa9, 0x18, 0xa0, 0x5f, 0x93, 0x97,
+  0x75, 0x18, 0x8d, 0xdb, 0xc7, 0xe6, 0x42, 0xcb, 0x8d, 0x45, 0xf6, 0x33, 0x71, 0xee, 0xb3, 0x12,
+  0x6e, 0x60, 0xeb, 0xb9, 0x61, 0x2c, 0x4f, 0x24, 0xe0, 0xb7, 0x2c, 0xd5, 0x97, 0x75, 0x89, 0x04,
+  0x8b, 0xc7, 0xc8, 0xb1, 0x4c, 0x37, 0xf1, 0x1b, 0x4b, 0xad, 0x90, 0x79, 0x99, 0x2a, 0x3f, 0x7c,
+  0x31, 0x9b, 0x98, 0x6e, 0xfc, 0x4d, 0xd7, 0x44, 0xf6, 0x6e, 0x4f, 0xcd, 0xcc, 0x59, 0x4f, 0x4d,
+  0xeb, 0x76, 0x1e, 0xfa, 0x2b, 0xcf, 0x36, 0xbe, 0xa1, 0xab, 0x30, 0xc3, 0xa3, 0x79, 0x68, 0xda,
+  0x0e, 0x9e, 0x18, 0xbc, 0xd1, 0x6c, 0x3a, 0x57, 0xc9, 0xcf, 0x4f, 0xbc, 0x8c, 0xf1, 0x5a, 0x3b,
+  0xe1, 0x1f, 0xde, 0x40, 0x8e, 0xc0, 0x04, 0x28, 0x27, 0x01, 0x96, 0x65, 0x49, 0x6b, 0xa2, 0x25,
+  0xc0, 0xeb, 0x5f, 0x54, 0xf2, 0x53, 0xa7, 0xd3, 0xc9, 0xbe, 0x13, 0x98, 0xff, 0x17, 0xe5, 0x9b,
+  0xd8, 0x11, 0x6a, 0x57, 0x25, 0x24, 0x77, 0xc3, 0x4b, 0x33, 0x5e, 0xa0, 0x5c, 0xc8, 0xcc, 0x70,
+  0xab, 0xc7, 0x9a, 0xa6, 0x3c, 0x3f, 0xf3, 0x99, 0x8f, 0xb5, 0x72, 0x0f, 0x5c, 0x82, 0x8f, 0x4b,
+  0x74, 0x82, 0xcd, 0x7c, 0x28, 0xc1, 0xa6, 0x6b, 0x9b, 0x0b, 0xe1, 0xd8, 0xee, 0x21, 0xf1, 0x8d,
+  0x7c, 0xaf, 0xc0, 0xcc, 0x6c, 0xfe, 0x63, 0xed, 0x17, 0x3c, 0x22, 0x00, 0x74, 0x0d, 0x2c, 0xe2,
+  0x90, 0x25, 0x5d, 0xfa, 0xe1, 0xa3, 0x54, 0xcf, 0x8a, 0x3d, 0x27, 0xdf, 0x88, 0x3c, 0x98, 0x0e,
+  0xdf, 0x8d, 0xc7, 0x57, 0xe3, 0x1e, 0xf9, 0x93, 0x15, 0x6d, 0x7c, 0xf0, 0xf8, 0xc0, 0x0c, 0xdc,
+  0x89, 0xf5, 0xe8, 0x60, 0xd0, 0x9c, 0x0e, 0x95, 0x6f, 0x10, 0xf5, 0x2b, 0x3d, 0xc0, 0xa7, 0xf1,
+  0x62, 0x50, 0x00, 0x10, 0x22, 0x44, 0x60, 0x8e, 0xf7, 0xdc, 0x60, 0xb4, 0x5b, 0xd4, 0x71, 0x65,
+  0x19, 0xd0, 0xd6, 0x97, 0x7f, 0xe3, 0xb9, 0x95, 0xd2, 0xec, 0xc2, 0x2a, 0x9a, 0xad, 0xfe, 0xb9,
+  0x71, 0x3e, 0xec, 0x9e, 0x64, 0x50, 0xe7, 0x4a, 0xef, 0xbc, 0xef, 0x1b, 0x22, 0x99, 0x58, 0xb0,
+  0x78, 0x71, 0x33, 0xb5, 0x57, 0x47, 0x46, 0x3e, 0xa1, 0xcb, 0x2a, 0x28, 0xe7, 0x03, 0xbd, 0xa1,
+  0xb5, 0x0e, 0x0f, 0x0f, 0x16, 0xf0, 0xff, 0xe8, 0x04, 0xd0, 0xbc, 0x9b, 0x5c, 0x93, 0xee, 0x47,
+  0x2c, 0x89, 0x92, 0x7b, 0x27, 0x5e, 0x10, 0xfd, 0x94, 0xfc, 0x39, 0x19, 0x91, 0x68, 0x15, 0x04,
+  0xee, 0xa3, 0xd4, 0x93, 0xfd, 0xba, 0xb1, 0x38, 0x91, 0xf4, 0xd6, 0x47, 0x22, 0xf5, 0x46, 0x27,
+  0xd2, 0xa7, 0x49, 0xeb, 0x58, 0xef, 0x12, 0xfe, 0x5d, 0x82, 0x81, 0x92, 0x0a, 0x10, 0xe7, 0xf8,
+  0x8f, 0x74, 0x2a, 0x46, 0x61, 0x4d, 0xcf, 0x63, 0x61, 0x07, 0x16, 0xbd, 0x70, 0xd9, 0x12, 0x8f,
+  0x32, 0xa6, 0xd5, 0x8b, 0xd5, 0xf9, 0x6a, 0xd5, 0x89, 0x21, 0xc9, 0xac, 0x60, 0xe6, 0x47, 0x31,
+  0xa1, 0xb3, 0x19, 0xa0, 0x89, 0x54, 0xf2, 0x5f, 0x52, 0x7f, 0x52, 0x37, 0xa6, 0xc6, 0xb4, 0xc0,
+  0x89, 0xa9, 0xd2, 0x9b, 0xaa, 0x13, 0x36, 0xb1, 0x13, 0x11, 0xea, 0xf9, 0xab, 0xf9, 0x42, 0x19,
+  0x4c, 0xc3, 0x61, 0x56, 0x96, 0x2a, 0x6c, 0xaf, 0x5f, 0xa8, 0x56, 0x65, 0xcf, 0x47, 0xa8, 0x6f,
+  0x13, 0xfe, 0xf2, 0x3b, 0x97, 0x89, 0xa2, 0xb8, 0x1e, 0x0b, 0x4e, 0x9e, 0xdf, 0x88, 0xd4, 0x58,
+  0x4a, 0x24, 0x33, 0x77, 0x3c, 0x67, 0x46, 0xf1, 0x3b, 0xcf, 0x16, 0x45, 0x46, 0x3a, 0xd0, 0x93,
+  0xc2, 0xa1, 0xd6, 0xbf, 0xdb, 0x67, 0x3f, 0x26, 0x20, 0x58, 0x14, 0x0c, 0x64, 0xce, 0x86, 0xd4,
+  0xf7, 0xd7, 0x3a, 0x36, 0x87, 0xf4, 0x79, 0xf5, 0x71, 0xbf, 0xad, 0xda, 0x1a, 0x28, 0x28, 0xf5,
+  0x58, 0xc6, 0xe5, 0xf1, 0x8c, 0x0b, 0x12, 0x7f, 0x45, 0x75, 0xa2, 0x3f, 0xcc, 0x3f, 0xe4, 0x3b,
+  0xe5, 0x44, 0xeb, 0xdd, 0x65, 0x4b, 0x85, 0x3c, 0x19, 0x37, 0x35, 0x3d, 0x8a, 0xe4, 0x07, 0x2c,
+  0x1b, 0xd3, 0x9d, 0x25, 0x07, 0x4e, 0x10, 0x42, 0x4e, 0x6e, 0xb0, 0x8a, 0x69, 0xc4, 0x69, 0xb0,
+  0x38, 0x93, 0x0f, 0x64, 0xc8, 0x6f, 0xc0, 0xf9, 0x99, 0x43, 0x0c, 0xdd, 0x46, 0x75, 0x3c, 0x57,
+  0x7a, 0x7e, 0x3e, 0xe2, 0x0f, 0x41, 0xa2, 0x4d, 0xe1, 0x99, 0x1d, 0x9e, 0x22, 0x2e, 0x61, 0xc1,
+  0xcc, 0x1b, 0x23, 0x40, 0x52, 0x54, 0xff, 0x36, 0xb0, 0x9d, 0x3b, 0xc2, 0x4e, 0xb6, 0x0c, 0x36,
+  0xc9, 0xf0, 0x2f, 0x6f, 0xb0, 0x08, 0x93, 0x27, 0xd1, 0xd2, 0xc5, 0x27, 0x3f, 0x3f, 0x99, 0x75,
+  0x7d, 0xdd, 0x83, 0x57, 0x3c, 0x18, 0x26, 0xfc, 0xa8, 0xfc, 0xe2, 0x06, 0x5e, 0xac, 0x25, 0x02,
+  0x49, 0xe2, 0x02, 0xcd, 0x82, 0x21, 0xfd, 0x79, 0x2e, 0xc7, 0x21, 0xb0, 0x43, 0x1a, 0xc2, 0x1b,
+  0x4e, 0x16, 0x6e, 0xf4, 0xab, 0x81, 0x1f, 0xb0, 0x65, 0x8b, 0x74, 0xb6, 0xd5, 0x92, 0x48, 0x12,
+  0x56, 0x0f, 0x99, 0x3a, 0x3c, 0x0c, 0x9a, 0x1c, 0x64, 0xb8, 0x01, 0xda, 0xd6, 0xa4, 0xe1, 0xe4,
+  0xf7, 0xd7, 0xc7, 0x7a, 0x8b, 0x8c, 0x3f, 0x8c, 0x3e, 0x55, 0x82, 0xe9, 0xd2, 0xf0, 0xe6, 0x52,
+  0x3f, 0xd6, 0x3b, 0x55, 0x10, 0xad, 0x8e, 0x04, 0x09, 0xa9, 0x76, 0xfb, 0xdb, 0x7f, 0x56, 0x42,
+  0x74, 0x39, 0x8e, 0xd6, 0x9b, 0x2a, 0x88, 0x2e, 0x10, 0x83, 0xe4, 0x6a, 0x7a, 0x25, 0x04, 0xd0,
+  0x71, 0x7a, 0x7d, 0xaa, 0x6b, 0xad, 0x4a, 0x88, 0x96, 0x34, 0xbc, 0xb8, 0x7e, 0x7b, 0x7c, 0xac,
+  0xbd, 0xae, 0x04, 0xe9, 0x30, 0x90, 0xd7, 0xc7, 0x5a, 0xbb, 0x12, 0xa4, 0x2d, 0x0d, 0xaf, 0xdf,
+  0x1c, 0xeb, 0x95, 0x00, 0xfa, 0x1b, 0x4e, 0xaa, 0xae, 0x93, 0x4f, 0x0b, 0x27, 0xa6, 0x55, 0x70,
+  0x1d, 0x58, 0xd2, 0x95, 0xd7, 0xbc, 0x9a, 0xcd, 0x2a, 0x21, 0x60, 0x49, 0xd7, 0x9f, 0x2e, 0xf7,
+  0xa0, 0x69, 0x71, 0xa0, 0xb3, 0xb3, 0x9b, 0x4a, 0x90, 0x36, 0x07, 0x81, 0x6d, 0xac, 0x04, 0xe9,
+  0xa4, 0x20, 0x95, 0x3b, 0xdd, 0xe9, 0xa6, 0x30, 0xf5, 0xfc, 0x6c, 0x7f, 0x3d, 0xb4, 0xad, 0x83,
+  0xa3, 0xa3, 0x0d, 0xe0, 0xd7, 0x19, 0xf0, 0xdb, 0x1c, 0xf4, 0xd1, 0x11, 0x80, 0xd3, 0x57, 0x6b,
+  0x90, 0xe8, 0xe2, 0x80, 0x63, 0x60, 0xc7, 0xdb, 0xb7, 0xd7, 0x38, 0x80, 0xc8, 0x1e, 0x8d, 0xef,
+  0xfd, 0xf0, 0x56, 0xc9, 0xe6, 0xd8, 0x02, 0x07, 0xde, 0xbc, 0xd3, 0x1b, 0x6d, 0xfd, 0xc5, 0x03,
+  0x80, 0x4f, 0xa7, 0x61, 0x7c, 0xf4, 0x07, 0x8d, 0x5f, 0x3c, 0xe4, 0x38, 0x25, 0xe9, 0x53, 0x39,
+  0x7c, 0x93, 0xeb, 0xd2, 0x10, 0xed, 0x36, 0x7c, 0x45, 0x8d, 0x76, 0x6c, 0x43, 0xb2, 0x7c, 0xae,
+  0x9e, 0xcc, 0x10, 0x1b, 0x92, 0xb0, 0xc4, 0x3d, 0x11, 0x17, 0x0c, 0xcf, 0xd0, 0xf1, 0x93, 0xab,
+  0xd0, 0xa6, 0xe1, 0x96, 0x66, 0x9f, 0x5d, 0xb1, 0xa1, 0xdb, 0xc4, 0x00, 0x7b, 0x3e, 0x8c, 0x47,
+  0xd5, 0xc4, 0x02, 0x3f, 0xf2, 0xfb, 0xbb, 0xf5, 0x1e, 0x96, 0x3f, 0x1a, 0x7f, 0xa8, 0x7e, 0x0f,
+  0x32, 0x32, 0x1e, 0xed, 0x78, 0x0f, 0x02, 0x32, 0xfa, 0x30, 0xae, 0x7e, 0x0f, 0xc2, 0xf1, 0x61,
+  0x34, 0x2e, 0x65, 0x4e, 0x13, 0xf8, 0x92, 0x67, 0x8f, 0xed, 0xcc, 0x71, 0x91, 0xf7, 0x5b, 0x0c,
+  0x62, 0x5e, 0x69, 0x38, 0xb9, 0x37, 0x83, 0x1e, 0x29, 0xb2, 0xe5, 0x93, 0x60, 0xcb, 0x36, 0x53,
+  0xfe, 0x80, 0x31, 0x95, 0xaa, 0x08, 0x9a, 0x48, 0x0e, 0x49, 0xa5, 0xd4, 0xb7, 0xf8, 0xfb, 0x0f,
+  0x95, 0xb6, 0x8d, 0xbf, 0xcf, 0x56, 0x55, 0xba, 0x26, 0xfc, 0x13, 0x05, 0xa6, 0xc7, 0xd6, 0x16,
+  0x44, 0x36, 0xa7, 0x94, 0x97, 0x3e, 0x60, 0x00, 0xbc, 0x19, 0x92, 0x01, 0x3f, 0x8f, 0xc5, 0x7e,
+  0x15, 0x43, 0xf2, 0x56, 0xcb, 0x29, 0x0d, 0xa5, 0xc4, 0x96, 0x4f, 0xb8, 0xb0, 0xe0, 0x68, 0x37,
+  0xe2, 0x9f, 0x85, 0x13, 0x70, 0x09, 0xcf, 0x21, 0x24, 0x82, 0x49, 0x08, 0xac, 0x16, 0x63, 0x3a,
+  0x94, 0xfd, 0x37, 0xba, 0x94, 0xd0, 0xf8, 0xf3, 0x53, 0xe2, 0xbc, 0x4d, 0x85, 0x79, 0x04, 0x36,
+  0x13, 0x38, 0x90, 0x5c, 0xf6, 0x81, 0x48, 0xbf, 0x18, 0xe8, 0x1f, 0xfa, 0x78, 0x4a, 0xd1, 0x97,
+  0x48, 0x52, 0xeb, 0x24, 0xcd, 0xe1, 0xa1, 0x37, 0x8d, 0x82, 0xfe, 0xf6, 0xf6, 0x58, 0x95, 0xf2,
+  0x7b, 0xc1, 0x1c, 0x61, 0x6f, 0xe7, 0xa2, 0xce, 0x8a, 0x0b, 0x11, 0x2b, 0xd0, 0xc5, 0x0a, 0x58,
+  0x98, 0x79, 0x3d, 0x5a, 0x4b, 0xd9, 0x4e, 0x65, 0x24, 0xa5, 0x4b, 0x40, 0x5a, 0x25, 0xa0, 0x90,
+  0x33, 0x5b, 0xe8, 0x58, 0x73, 0x8b, 0xe3, 0x9a, 0xe0, 0x38, 0x2b, 0x54, 0xbf, 0x84, 0xe1, 0x1a,
+  0xa7, 0x2d, 0x9d, 0x30, 0x71, 0xb9, 0x1b, 0xfe, 0x54, 0x91, 0x9a, 0xc5, 0x89, 0x74, 0x31, 0x91,
+  0x98, 0x63, 0xd7, 0x14, 0x7a, 0x61, 0xf9, 0x7b, 0x31, 0xb7, 0x5e, 0x8e, 0xb9, 0xf5, 0x63, 0x98,
+  0xdb, 0x2f, 0xc7, 0xdc, 0xfe, 0x31, 0xcc, 0x9d, 0x97, 0x63, 0xee, 0xbc, 0x04, 0xf3, 0x86, 0xf8,
+  0x85, 0x95, 0xe2, 0x87, 0x82, 0x90, 0xd1, 0x01, 0x01, 0x38, 0xa7, 0x23, 0x29, 0x59, 0x0a, 0x7a,
+  0x36, 0xc4, 0x93, 0xd5, 0x0c, 0xa7, 0xfe, 0x43, 0x42, 0xd3, 0xd9, 0xc7, 0x84, 0xfa, 0x72, 0xe3,
+  0x14, 0xed, 0x9c, 0x7e, 0x72, 0xeb, 0x04, 0x64, 0xe6, 0x84, 0x10, 0xe6, 0x63, 0x30, 0xb9, 0x53,
+  0x15, 0x26, 0x17, 0x7c, 0xf5, 0x05, 0x15, 0x86, 0x04, 0x47, 0xca, 0x8c, 0xd8, 0x86, 0xc8, 0x57,
+  0x12, 0x35, 0xdb, 0x49, 0x14, 0x44, 0x12, 0x64, 0x4c, 0x67, 0x21, 0x8d, 0x32, 0xdd, 0x64, 0x1c,
+  0x9a, 0x71, 0x02, 0xca, 0x19, 0x31, 0x7e, 0xbf, 0x9b, 0x11, 0xe6, 0xce, 0x39, 0x4f, 0x57, 0xb1,
+  0x7f, 0x04, 0x09, 0xbe, 0xb5, 0x72, 0xcd, 0x98, 0x92, 0x7b, 0x8c, 0x54, 0xb0, 0xbf, 0x14, 0xd2,
+  0x13, 0x97, 0xcc, 0x42, 0x7f, 0x89, 0xce, 0xb3, 0xc7, 0x77, 0x2c, 0x6f, 0xcf, 0x4f, 0x3f, 0x95,
+  0xd9, 0x73, 0x6d, 0x97, 0x35, 0xd7, 0x87, 0xa3, 0xd0, 0x99, 0x2f, 0x62, 0x1a, 0x56, 0x00, 0xb4,
+  0x86, 0xa7, 0x96, 0x85, 0x1d, 0x71, 0x55, 0x18, 0xda, 0xc3, 0xb7, 0x2b, 0xd3, 0xad, 0x78, 0xd9,
+  0x81, 0x3c, 0xfc, 0x61, 0xdb, 0xd0, 0x73, 0xeb, 0x98, 0x32, 0x87, 0xfd, 0xfd, 0xd6, 0x77, 0x20,
+  0x01, 0x8b, 0x68, 0x18, 0x9f, 0xda, 0xdf, 0x4d, 0x0b, 0x52, 0x06, 0xcc, 0xc4, 0x64, 0x69, 0x4a,
+  0x21, 0xf9, 0xa3, 0xd4, 0xb3, 0x21, 0xad, 0x54, 0xd6, 0x22, 0x1d, 0x90, 0xe3, 0xcf, 0x47, 0x47,
+  0xe6, 0x97, 0x46, 0x08, 0x49, 0xf8, 0x1d, 0xc5, 0x8e, 0xc1, 0x23, 0x53, 0x54, 0x7d, 0xea, 0x5b,
+  0xb9, 0x9a, 0x39, 0x48, 0xf3, 0x89, 0x23, 0xbd, 0xbc, 0x90, 0x70, 0xb4, 0x3d, 0x68, 0xb8, 0x5d,
+  0x73, 0xf0, 0x9e, 0x9f, 0xd9, 0x79, 0x74, 0x21, 0xef, 0x39, 0xbb, 0xba, 0x94, 0x81, 0xc9, 0x90,
+  0xf8, 0xe0, 0xf1, 0xab, 0x96, 0xb4, 0x63, 0x55, 0xe7, 0x3e, 0x96, 0xbf, 0xfc, 0x0a, 0x0f, 0xc3,
+  0x47, 0x98, 0x33, 0x9f, 0xfd, 0x40, 0x82, 0x81, 0xf5, 0x35, 0x91, 0xe3, 0x14, 0x32, 0x99, 0x6c,
+  0xc8, 0xae, 0x7c, 0x86, 0x70, 0xef, 0xb8, 0x4b, 0x6d, 0xfe, 0x91, 0x73, 0x8b, 0x0f, 0x2f, 0x72,
+  0x8b, 0xaf, 0xbb, 0xdd, 0x76, 0x37, 0xe7, 0x17, 0xe9, 0x7a, 0x43, 0xb1, 0x72, 0x7e, 0xcf, 0x90,
+  0xa4, 0xd4, 0xf1, 0xbd, 0xc0, 0x9d, 0xfd, 0xe3, 0x2c, 0x47, 0x8c, 0xb5, 0xd3, 0xb5, 0x6d, 0x52,
+  0xe1, 0xad, 0x0b, 0xb3, 0x6e, 0xaa, 0xba, 0x50, 0xb8, 0x1f, 0x8a, 0x14, 0x19, 0x15, 0x22, 0xc4,
+  0x14, 0xf4, 0xfd, 0xff, 0x8b, 0x1a, 0x13, 0x65, 0x63, 0xb6, 0x43, 0xa8, 0x9d, 0x38, 0xbf, 0xe4,
+  0x12, 0xe6, 0xd0, 0x88, 0x15, 0x42, 0x76, 0xea, 0xa1, 0x23, 0x54, 0xed, 0xc1, 0x97, 0xea, 0x66,
+  0x52, 0x75, 0x8d, 0xd5, 0x69, 0xec, 0xa1, 0x32, 0x80, 0x2c, 0x8a, 0xbe, 0x8d, 0x4c, 0x4f, 0x40,
+  0x4f, 0xf1, 0x55, 0x45, 0xf7, 0x67, 0xb9, 0x72, 0x80, 0x46, 0xa5, 0x7d, 0x73, 0xda, 0x81, 0x81,
+  0x87, 0x71, 0x32, 0xfd, 0xec, 0x1d, 0xe9, 0x39, 0xb5, 0x17, 0x53, 0xc2, 0x43, 0x3e, 0xa5, 0x92,
+  0x9f, 0x32, 0xa2, 0x31, 0x53, 0x4e, 0xe5, 0x09, 0x2d, 0xc6, 0x46, 0xa7, 0x38, 0xe5, 0x67, 0x11,
+  0xd8, 0x39, 0x41, 0xb1, 0xae, 0xf7, 0x22, 0x92, 0x14, 0x9a, 0x4e, 0xdd, 0x17, 0x53, 0x17, 0x7a,
+  0x64, 0xf9, 0x23, 0x98, 0x30, 0xe5, 0x29, 0x18, 0x88, 0xed, 0x36, 0xa8, 0x41, 0x91, 0x96, 0x72,
+  0x93, 0x84, 0xa3, 0x61, 0xb2, 0xed, 0xd1, 0xdb, 0x86, 0xa9, 0x60, 0x8f, 0x46, 0xb1, 0xc7, 0x9b,
+  0x74, 0x13, 0x4b, 0xc4, 0xb0, 0x01, 0x69, 0x51, 0xbe, 0xc2, 0xa5, 0x3a, 0x06, 0x96, 0xeb, 0xeb,
+  0x13, 0x76, 0xae, 0xd1, 0x40, 0xa7, 0x72, 0xb6, 0x30, 0xc3, 0x33, 0xdf, 0xa6, 0x32, 0x96, 0xaa,
+  0xb4, 0x93, 0xce, 0x71, 0xaf, 0xdb, 0x55, 0xea, 0xc0, 0x27, 0xb3, 0x6e, 0x7c, 0x1b, 0xad, 0xe2,
+  0xd8, 0x67, 0x9d, 0x78, 0x6b, 0xde, 0xbb, 0xb0, 0x4b, 0xb1, 0x7f, 0x7e, 0x72, 0xd6, 0x5b, 0xe1,
+  0x48, 0xa2, 0xda, 0x0f, 0x51, 0x51, 0x8f, 0x87, 0xdf, 0x54, 0x9c, 0x40, 0xb8, 0x84, 0x82, 0x3f,
+  0xfb, 0xf9, 0x49, 0x1a, 0xbd, 0x7b, 0x11, 0x8d, 0x29, 0x9a, 0x2d, 0x4d, 0x05, 0x92, 0x35, 0x03,
+  0x8f, 0x44, 0x93, 0x02, 0x0d, 0x36, 0x5d, 0xac, 0x87, 0x6f, 0xc5, 0xa1, 0x40, 0xaa, 0x24, 0xa5,
+  0xc3, 0x5b, 0x38, 0xbc, 0x55, 0x32, 0xfc, 0x7a, 0x15, 0x2d, 0xa6, 0x8c, 0x25, 0xbb, 0x11, 0xb4,
+  0x11, 0x41, 0xbb, 0x02, 0x01, 0x71, 0xc4, 0x09, 0xf1, 0x6e, 0x1c, 0x1d, 0xc4, 0xd1, 0x29, 0xc1,
+  0x31, 0x61, 0x3d, 0x6a, 0xbb, 0x07, 0x77, 0x71, 0x70, 0xb7, 0x8c, 0x80, 0xf3, 0x31, 0x89, 0xa8,
+  0x17, 0xf9, 0xe1, 0x6e, 0x04, 0xaf, 0x11, 0xc1, 0xeb, 0x12, 0x04, 0x37, 0xfe, 0x6a, 0xdf, 0xe4,
+  0xbf, 0xe2, 0xd8, 0x5f, 0x4b, 0xc6, 0x9e, 0x7a, 0xa6, 0xeb, 0xcf, 0x77, 0x0f, 0x3e, 0xc6, 0xc1,
+  0xc7, 0x95, 0x83, 0x2b, 0x98, 0x27, 0xa5, 0xa6, 0x4e, 0xe2, 0x48, 0x59, 0x48, 0x2b, 0x1c, 0x01,
+  0xc4, 0x31, 0xb0, 0xde, 0x1e, 0x09, 0x7c, 0xc7, 0x83, 0x88, 0xa7, 0xcf, 0x64, 0x94, 0xf5, 0x83,
+  0x48, 0x78, 0xfb, 0xe2, 0x15, 0xca, 0xed, 0x2b, 0x25, 0xf1, 0x61, 0x87, 0x3f, 0x3d, 0xb4, 0x7e,
+  0xd5, 0xbb, 0xfd, 0x24, 0x14, 0x07, 0x93, 0x29, 0x8e, 0x31, 0x36, 0x95, 0xc9, 0x30, 0x73, 0xbd,
+  0xa5, 0x73, 0x77, 0xe2, 0xa0, 0x09, 0x90, 0x0b, 0x37, 0x57, 0xa8, 0xf2, 0xfc, 0x2c, 0x17, 0xef,
+  0xae, 0x6c, 0x36, 0xb7, 0xa5, 0xf7, 0x20, 0x9e, 0xd0, 0x30, 0x71, 0x43, 0x79, 0xa0, 0x63, 0x5c,
+  0xd1, 0x07, 0x77, 0xb6, 0xbb, 0x94, 0x9a, 0xd8, 0x49, 0x0f, 0xcf, 0xdc, 0xb7, 0x8f, 0xb4, 0x98,
+  0x81, 0x54, 0x7e, 0xa0, 0x8e, 0xec, 0x15, 0xcb, 0xc1, 0x07, 0x25, 0xc7, 0x64, 0x5e, 0x82, 0x0f,
+  0xcd, 0x32, 0x36, 0x45, 0xe6, 0x73, 0x63, 0xef, 0x0b, 0x96, 0x81, 0xc5, 0x39, 0x57, 0xa4, 0x49,
+  0x00, 0xa4, 0x6d, 0x23, 0xc1, 0x73, 0xab, 0x6a, 0x1c, 0x1a, 0xc3, 0xc1, 0x39, 0x1e, 0x39, 0xb9,
+  0xae, 0x49, 0xaa, 0x26, 0x4c, 0xce, 0x98, 0xb7, 0x0a, 0xf0, 0x7a, 0xc7, 0x7b, 0xc7, 0xc5, 0xdb,
+  0x32, 0xa2, 0xe9, 0xd6, 0xa3, 0xf7, 0xe4, 0x1f, 0x97, 0x17, 0xbf, 0xc5, 0x71, 0x30, 0x86, 0x58,
+  0x81, 0x46, 0x71, 0xdf, 0xab, 0xbe, 0x91, 0x92, 0xbb, 0x27, 0x91, 0xdd, 0xe2, 0x88, 0x17, 0x4e,
+  0x04, 0x26, 0x3f, 0x0a, 0x7c, 0xf0, 0x88, 0x37, 0xf4, 0x21, 0x56, 0xd9, 0x13, 0x20, 0x33, 0x5e,
+  0xb1, 0xe6, 0x0c, 0x58, 0xa4, 0x02, 0x9e, 0xaa, 0xfa, 0x3e, 0x4a, 0x86, 0x97, 0xe6, 0x11, 0x63,
+  0xef, 0xb0, 0x69, 0xdd, 0xaa, 0x07, 0x09, 0x02, 0x7e, 0x99, 0xe8, 0xfa, 0x0a, 0x76, 0x53, 0x95,
+  0x9a, 0x7c, 0x39, 0xe2, 0x8c, 0x24, 0x66, 0x2b, 0x79, 0xef, 0x87, 0x4b, 0x6c, 0x3f, 0x4b, 0x7b,
+  0x18, 0xc5, 0x6d, 0x1b, 0x59, 0xc2, 0xce, 0x65, 0xd1, 0x4a, 0xcb, 0x9a, 0x98, 0xf1, 0x82, 0x4b,
+  0x04, 0xec, 0xc3, 0x3b, 0x2e, 0x5e, 0x23, 0x42, 0x98, 0x58, 0x51, 0x4b, 0x9a, 0x9c, 0x0f, 0x36,
+  0xee, 0x12, 0x9d, 0xcd, 0xe6, 0x29, 0xf7, 0xd4, 0xb8, 0x2f, 0x25, 0x2f, 0x25, 0xd0, 0x42, 0x30,
+  0xf3, 0xe0, 0x25, 0xc5, 0xcd, 0x27, 0xe4, 0xf3, 0x98, 0x9a, 0x10, 0x40, 0x9d, 0xc0, 0x4a, 0xd8,
+  0x7c, 0x27, 0x34, 0x9d, 0xf7, 0x44, 0x46, 0xcf, 0x9d, 0x52, 0x21, 0x0b, 0xfa, 0xd3, 0x31, 0xd8,
+  0x86, 0x85, 0xd3, 0x19, 0x79, 0xd6, 0xf0, 0x16, 0x46, 0xda, 0x00, 0x01, 0x00, 0xa1, 0x44, 0x9e,
+  0xaf, 0xdc, 0x58, 0x2c, 0x9f, 0x75, 0xe5, 0x33, 0xe1, 0x91, 0x3d, 0x56, 0xf2, 0x8f, 0x1b, 0x8b,
+  0x7b, 0x76, 0xa8, 0x82, 0x1f, 0x40, 0xf6, 0xed, 0x4c, 0x67, 0xb0, 0xf9, 0xd1, 0x04, 0xdf, 0x00,
+  0x5e, 0xab, 0xae, 0x24, 0xc7, 0x12, 0x20, 0xcd, 0xfd, 0x04, 0x14, 0x83, 0x9b, 0x06, 0x40, 0xbf,
+  0x33, 0xad, 0x85, 0x2c, 0x3c, 0xa5, 0x31, 0x7c, 0x4a, 0x40, 0x75, 0x1e, 0x17, 0x64, 0xa8, 0x68,
+  0x23, 0x70, 0xbc, 0x44, 0xbf, 0x10, 0x69, 0x99, 0xd6, 0x7c, 0x63, 0xe9, 0x28, 0xfa, 0xb3, 0x6f,
+  0xb9, 0x36, 0x2b, 0x36, 0xf4, 0xb3, 0xf9, 0xa5, 0x5f, 0x79, 0xee, 0xe2, 0x15, 0xa0, 0x91, 0xc9,
+  0x6a, 0xe5, 0x79, 0x50, 0x11, 0x96, 0x69, 0x8a, 0xfa, 0x92, 0xae, 0x57, 0x1e, 0x45, 0x95, 0x83,
+  0x9e, 0x5d, 0x6d, 0x82, 0xfa, 0x18, 0x16, 0xab, 0x2f, 0x69, 0x8a, 0x45, 0x22, 0x20, 0x63, 0x2f,
+  0x87, 0x1d, 0xbf, 0x4f, 0x60, 0x53, 0xad, 0x85, 0x3d, 0x9d, 0x55, 0x50, 0xf1, 0xb1, 0x0c, 0xf8,
+  0x6e, 0xad, 0xac, 0x93, 0x2d, 0x86, 0x60, 0x08, 0x4c, 0x44, 0x1a, 0xd2, 0xe1, 0x15, 0x28, 0xfe,
+  0x34, 0xdd, 0x49, 0xca, 0xf7, 0x90, 0xc5, 0x5f, 0x82, 0x39, 0x7c, 0xdd, 0x62, 0x49, 0x4c, 0xcd,
+  0xd8, 0x28, 0xb0, 0xde, 0x49, 0x92, 0x95, 0x7c, 0xef, 0x9f, 0x86, 0xa1, 0xf9, 0xd8, 0x70, 0x22,
+  0xf6, 0x57, 0x66, 0x89, 0xa8, 0x92, 0xf4, 0x27, 0x6e, 0x59, 0x7b, 0x09, 0x62, 0x53, 0xa7, 0x5a,
+  0x8c, 0x30, 0x00, 0xc3, 0x69, 0x71, 0xef, 0x51, 0x09, 0xd9, 0xb6, 0xe2, 0x8d, 0xaa, 0xd2, 0xb5,
+  0xdf, 0xdc, 0x48, 0x39, 0x96, 0x3a, 0x8d, 0x38, 0x5e, 0x33, 0xaa, 0x9c, 0xb0, 0xaa, 0x99, 0xef,
+  0x7c, 0x9c, 0x1f, 0x21, 0x80, 0x71, 0xb6, 0xf2, 0x09, 0xce, 0x6f, 0xca, 0xc0, 0x19, 0x4d, 0x9c,
+  0x1f, 0x21, 0x85, 0xb0, 0xb2, 0x6a, 0xb2, 0xf1, 0xc5, 0xd6, 0x68, 0x06, 0x5f, 0x3d, 0xdf, 0xf8,
+  0x52, 0x2a, 0x6c, 0x65, 0x6e, 0x0c, 0xb8, 0xec, 0x24, 0x33, 0x50, 0x51, 0xc5, 0x4d, 0xfb, 0x34,
+  0x42, 0xa3, 0x0a, 0x5a, 0xad, 0xf4, 0xc4, 0x6d, 0xbc, 0x6b, 0x97, 0x62, 0x77, 0xba, 0x88, 0x03,
+  0x4d, 0x82, 0xba, 0xcf, 0xae, 0xec, 0xf1, 0xca, 0xd0, 0x81, 0x94, 0x42, 0xde, 0x80, 0x25, 0x26,
+  0xd3, 0xd0, 0xbf, 0x87, 0x5c, 0x85, 0xd8, 0x3e, 0x8d, 0xf0, 0x22, 0x11, 0x1e, 0x37, 0xfb, 0x21,
+  0x84, 0xa5, 0x0b, 0x4a, 0xbe, 0x31, 0x13, 0xf4, 0x8d, 0x04, 0x21, 0x18, 0x57, 0xf0, 0x28, 0x18,
+  0xe6, 0x33, 0x4c, 0x2c, 0x72, 0x8d, 0xf0, 0x1e, 0x05, 0xcd, 0x3a, 0x52, 0x33, 0xb4, 0x94, 0x43,
+  0x9d, 0x5e, 0x9f, 0x13, 0x27, 0x8f, 0x94, 0x55, 0x51, 0x49, 0x9c, 0x9f, 0xf6, 0x11, 0x4c, 0x55,
+  0xfe, 0xbe, 0xe7, 0x04, 0xbc, 0x87, 0x84, 0xa3, 0x7b, 0x60, 0x33, 0x85, 0xb1, 0x74, 0x7d, 0x8b,
+  0xdd, 0x0e, 0x69, 0x00, 0x1d, 0xb1, 0x6f, 0xf9, 0x2e, 0x36, 0x4b, 0xe3, 0x2d, 0x55, 0x4d, 0x95,
+  0xd9, 0x5d, 0x57, 0x03, 0x21, 0xdc, 0x49, 0xec, 0x87, 0xe6, 0x9c, 0x22, 0x4b, 0xcf, 0x63, 0xba,
+  0x44, 0xbf, 0x64, 0x9d, 0x07, 0x90, 0x73, 0x40, 0xe0, 0xc0, 0xc1, 0x60, 0xfc, 0x32, 0x00, 0x0a,
+  0xd1, 0x92, 0x92, 0x4b, 0x88, 0x82, 0x1b, 0x44, 0x70, 0x8b, 0x62, 0x38, 0x43, 0x3e, 0x61, 0x5b,
+  0xc2, 0xf9, 0x35, 0xb0, 0x48, 0x2d, 0x60, 0x8c, 0x8a, 0x18, 0x55, 0x86, 0x4d, 0x51, 0x10, 0x8a,
+  0xdd, 0x1f, 0x45, 0xf4, 0x27, 0xec, 0x5e, 0x6c, 0xaf, 0xd9, 0x94, 0xea, 0xec, 0x35, 0xf6, 0x28,
+  0xd4, 0xb3, 0xbb, 0xad, 0xcd, 0xa8, 0xf1, 0x3d, 0x3a, 0x09, 0x8c, 0x16, 0x3a, 0x0d, 0x65, 0x5d,
+  0x83, 0x98, 0x88, 0xdf, 0x18, 0x1e, 0xb0, 0xd0, 0x6a, 0xf8, 0x1f, 0xce, 0x92, 0xb1, 0x7d, 0x15,
+  0xba, 0xe0, 0xac, 0x79, 0x23, 0x46, 0x84, 0x67, 0xfc, 0x00, 0xc8, 0x00, 0x06, 0x4d, 0x7e, 0x55,
+  0x1a, 0xaf, 0x89, 0x12, 0x61, 0xfe, 0xa5, 0x09, 0x2b, 0xcb, 0x81, 0x12, 0x2d, 0x6b, 0x2c, 0xfd,
+  0xc6, 0x4f, 0x5f, 0xa3, 0xb4, 0xc4, 0x37, 0x83, 0xe4, 0x9f, 0xc6, 0x0b, 0x1f, 0xeb, 0xa2, 0x7e,
+  0x84, 0x37, 0x98, 0x73, 0x25, 0x91, 0xd8, 0x07, 0x76, 0xdc, 0x17, 0x9f, 0x2d, 0xa8, 0x1b, 0x8c,
+  0xa4, 0x61, 0x6d, 0xc0, 0x43, 0x73, 0x91, 0x9b, 0xf0, 0x2f, 0xb9, 0x58, 0xef, 0x37, 0x9c, 0xf6,
+  0x64, 0xd0, 0xe4, 0x2f, 0xd2, 0x42, 0x78, 0xd9, 0x98, 0x5a, 0x3a, 0x68, 0x84, 0x83, 0x46, 0xe0,
+  0xb2, 0xb3, 0x71, 0x85, 0x11, 0xe2, 0xee, 0xc2, 0x70, 0x62, 0xde, 0xd1, 0x0c, 0x64, 0x91, 0xa4,
+  0xd9, 0x83, 0x45, 0x6b, 0x58, 0xc3, 0xfd, 0x39, 0x34, 0x97, 0x41, 0x9f, 0xfc, 0x66, 0x86, 0xd8,
+  0xb9, 0x82, 0x72, 0x1e, 0xaf, 0x02, 0x60, 0x4e, 0x0b, 0xe2, 0xe9, 0xd8, 0x74, 0x93, 0xc2, 0x67,
+  0x5a, 0x88, 0x75, 0x2d, 0x46, 0xaa, 0x28, 0xbf, 0x67, 0x75, 0x62, 0x0b, 0x97, 0x99, 0x05, 0xa6,
+  0x03, 0x67, 0x38, 0xa6, 0x60, 0x0e, 0x41, 0x13, 0x6d, 0x10, 0xd3, 0xc0, 0xbf, 0x07, 0x79, 0x10,
+  0xad, 0x17, 0xd8, 0x3b, 0x31, 0xe5, 0x45, 0xbe, 0x28, 0xe6, 0xc5, 0xc4, 0xde, 0xa0, 0xe9, 0xf0,
+  0x71, 0x53, 0x51, 0xf4, 0xad, 0xf1, 0x63, 0x96, 0x55, 0x36, 0x1b, 0xf6, 0xaa, 0x14, 0x8b, 0xc2,
+  0xac, 0x4b, 0x42, 0x94, 0x0e, 0xd2, 0x99, 0x6b, 0xef, 0x3c, 0x4c, 0xa4, 0x88, 0xb9, 0x82, 0x60,
+  0x17, 0xe4, 0xdc, 0x12, 0x73, 0x79, 0x34, 0x8a, 0x88, 0x8b, 0x77, 0x46, 0x69, 0xb8, 0xa7, 0x6a,
+  0x7c, 0x3a, 0xa2, 0x82, 0xd5, 0x22, 0x5f, 0x14, 0x77, 0x62, 0x78, 0x65, 0x88, 0x5d, 0x99, 0xe1,
+  0xb3, 0x26, 0x45, 0x54, 0xbc, 0x87, 0x84, 0x85, 0x45, 0xbc, 0x01, 0x4f, 0xce, 0x56, 0x61, 0x08,
+  0xf2, 0x9f, 0xce, 0x21, 0xee, 0xbd, 0x5f, 0x9e, 0x4a, 0x1b, 0xb9, 0xe9, 0x46, 0x69, 0xa9, 0xd5,
+  0xcd, 0x4a, 0x5c, 0x9a, 0xb6, 0x55, 0x2e, 0x4e, 0xcb, 0x4b, 0xc3, 0x1a, 0x59, 0x9e, 0x16, 0xa7,
+  0xcf, 0xae, 0x55, 0xa4, 0x99, 0x05, 0x96, 0x94, 0x7a, 0xbc, 0x9b, 0xa8, 0x5f, 0x3c, 0x78, 0xab,
+  0x1d, 0xfe, 0xf4, 0xe6, 0xf8, 0xf8, 0xb8, 0x4f, 0xfe, 0xe9, 0xaf, 0xc2, 0xe2, 0xce, 0x80, 0x04,
+  0xdf, 0x61, 0x01, 0x80, 0x2c, 0x80, 0x63, 0xc4, 0xe2, 0x0b, 0x69, 0x30, 0xae, 0xde, 0xf8, 0x04,
+  0x54, 0x0a, 0xde, 0x53, 0x66, 0xca, 0x22, 0x73, 0x46, 0xb9, 0x01, 0x7b, 0x44, 0x2c, 0x4c, 0x6a,
+  0x54, 0x04, 0x0c, 0xb8, 0x01, 0x58, 0x45, 0x08, 0x07, 0x82, 0x4a, 0x2c, 0xe4, 0x57, 0xc4, 0xde,
+  0xd5, 0x96, 0x10, 0x42, 0x39, 0x00, 0x21, 0x66, 0x75, 0xbc, 0xef, 0x54, 0x5c, 0xc6, 0xc5, 0x04,
+  0x28, 0x22, 0xa6, 0x67, 0x83, 0x85, 0x9d, 0xc1, 0xe0, 0x83, 0xac, 0x20, 0x04, 0xa2, 0x54, 0x3b,
+  0x4d, 0x36, 0xd3, 0x74, 0x81, 0x4c, 0xb6, 0x8b, 0x51, 0x7e, 0x5f, 0x63, 0x1f, 0x8b, 0x85, 0x8f,
+  0xc0, 0x52, 0x3f, 0x62, 0xd7, 0xd8, 0x90, 0x46, 0x06, 0xc6, 0xa9, 0xff, 0x9d, 0xd2, 0x80, 0x98,
+  0x31, 0x39, 0x84, 0x10, 0x4e, 0x3f, 0x25, 0xce, 0x8c, 0x53, 0x80, 0x0d, 0x51, 0xac, 0xe5, 0xc9,
+  0x06, 0xc6, 0x5a, 0x31, 0xca, 0x26, 0x16, 0xb3, 0x71, 0x70, 0xd6, 0x73, 0xc4, 0x48, 0xa9, 0x9d,
+  0xb3, 0x95, 0xb2, 0x4b, 0x97, 0xe9, 0xed, 0x37, 0xf0, 0x14, 0x34, 0x84, 0xe4, 0xaf, 0xc0, 0x44,
+  0x55, 0x18, 0x3f, 0xa4, 0x10, 0xef, 0x6d, 0x7b, 0x73, 0x4e, 0x82, 0x2c, 0xe4, 0x82, 0x80, 0xd0,
+  0xe3, 0x2d, 0x69, 0xd0, 0x8a, 0x55, 0x04, 0xd6, 0x30, 0x51, 0x2e, 0x21, 0x0d, 0x01, 0xda, 0x90,
+  0x95, 0x77, 0xeb, 0xf9, 0xf7, 0x9e, 0x90, 0x6a, 0x25, 0x53, 0x8e, 0x90, 0xeb, 0xec, 0x9d, 0xef,
+  0xc6, 0x78, 0xe1, 0x5b, 0xbe, 0xc4, 0xe6, 0x2f, 0xb1, 0x4f, 0x4c, 0xaf, 0x4c, 0x82, 0xc4, 0x01,
+  0x87, 0x01, 0x4c, 0x29, 0xa9, 0xc8, 0xb3, 0x46, 0xab, 0x0d, 0xd9, 0xc6, 0xeb, 0x6c, 0x5b, 0x67,
+  0xae, 0x78, 0x72, 0x91, 0xa4, 0xb9, 0x46, 0x96, 0xf0, 0x0e, 0x81, 0x27, 0xe2, 0x26, 0x16, 0x91,
+  0xbb, 0xdd, 0xe5, 0xa9, 0x52, 0xab, 0x3c, 0x56, 0xed, 0x32, 0x68, 0x3a, 0x9b, 0x39, 0x16, 0xb6,
+  0xf1, 0x11, 0xb9, 0x8d, 0xf0, 0xbb, 0x1a, 0x51, 0x6a, 0xd8, 0xb3, 0x25, 0xb7, 0xb5, 0x1d, 0x60,
+  0x78, 0xa4, 0x32, 0x14, 0x1d, 0x5e, 0xb2, 0xde, 0xda, 0x01, 0x89, 0xcd, 0x24, 0xb5, 0x33, 0x96,
+  0xf3, 0x96, 0x9c, 0xec, 0x16, 0x0c, 0x09, 0xbf, 0x4e, 0x56, 0x7e, 0x4e, 0x2d, 0x50, 0xf0, 0x3e,
+  0xbb, 0x84, 0xd5, 0xd8, 0x22, 0x07, 0x1c, 0x4e, 0x75, 0x3c, 0x61, 0xee, 0xa6, 0x8a, 0x6f, 0x9f,
+  0x06, 0x31, 0xbb, 0xe6, 0x9a, 0xd5, 0xda, 0x9d, 0x28, 0x77, 0x72, 0xde, 0x96, 0x09, 0x6f, 0xc2,
+  0x77, 0x27, 0x27, 0x8a, 0x5e, 0xb4, 0x82, 0x3f, 0xe6, 0xd4, 0x07, 0x22, 0x98, 0x26, 0xe2, 0xfc,
+  0xa8, 0x96, 0x28, 0xd6, 0x8d, 0x54, 0x70, 0x84, 0xc9, 0x6f, 0x0f, 0x6b, 0x5b, 0x86, 0xbe, 0x9d,
+  0xd9, 0x11, 0xec, 0x60, 0x62, 0x3f, 0xc7, 0xc1, 0xbb, 0xff, 0xa2, 0x5e, 0x32, 0xae, 0x58, 0xdf,
+  0x4f, 0xfc, 0x4c, 0xad, 0xe8, 0x9a, 0x10, 0x43, 0x3d, 0xe7, 0xd5, 0xd2, 0x04, 0x06, 0x3d, 0xb4,
+  0x34, 0xac, 0xa7, 0x4e, 0x88, 0x54, 0xb8, 0x36, 0x44, 0x70, 0x54, 0x82, 0xe0, 0x48, 0x60, 0x38,
+  0xca, 0x79, 0xba, 0x90, 0xd1, 0x79, 0xc9, 0x5a, 0x1e, 0xc9, 0x9f, 0x79, 0x3d, 0x62, 0x0b, 0x81,
+  0xad, 0xd7, 0x12, 0x77, 0x44, 0x9a, 0xf9, 0x37, 0x7a, 0xce, 0x7d, 0x8d, 0x0a, 0x56, 0x94, 0xb5,
+  0xa3, 0x92, 0x5a, 0x69, 0x8d, 0xfe, 0x68, 0x0a, 0x41, 0xc8, 0x6d, 0x9f, 0xfd, 0xf4, 0x49, 0x4f,
+  0xd7, 0xb4, 0xe0, 0xa1, 0xbf, 0xa0, 0x68, 0x7d, 0xe0, 0x0b, 0x7c, 0x9e, 0xb2, 0x88, 0xfe, 0x08,
+  0xfb, 0x55, 0x57, 0x51, 0xaf, 0x05, 0x8f, 0x92, 0x93, 0xb6, 0x5a, 0x61, 0x8a, 0x5c, 0x7b, 0xe8,
+  0x0f, 0x1a, 0x6a, 0x90, 0x24, 0x98, 0x8d, 0x84, 0x2b, 0x58, 0x86, 0xc7, 0xad, 0xdd, 0xd4, 0x71,
+  0x1d, 0x34, 0xc1, 0x21, 0x71, 0xcd, 0x39, 0x04, 0x86, 0xd1, 0x8a, 0x46, 0xcc, 0xd4, 0xfc, 0x09,
+  0x26, 0xd0, 0x65, 0x56, 0x11, 0x54, 0x9c, 0xe4, 0xdc, 0x69, 0xd2, 0x4f, 0x3a, 0x2c, 0x69, 0xf5,
+  0x4c, 0x78, 0x82, 0x46, 0x04, 0xed, 0xdf, 0x14, 0x7d, 0x33, 0x7d, 0x00, 0x00, 0xd0, 0x5d, 0xab,
+  0x60, 0x8f, 0x41, 0x1c, 0x6a, 0x79, 0x79, 0xb8, 0x34, 0x6f, 0x29, 0x1a, 0x1e, 0x3a, 0x5f, 0x26,
+  0x66, 0x88, 0x42, 0x12, 0x22, 0x10, 0xef, 0xf1, 0xb5, 0x97, 0x13, 0x89, 0x33, 0x49, 0xa8, 0xd9,
+  0x74, 0x15, 0xf1, 0x73, 0x1f, 0x58, 0xa7, 0xed, 0x58, 0x34, 0xaa, 0x1c, 0x9f, 0xb3, 0x61, 0xbc,
+  0xfc, 0xc2, 0x2a, 0x21, 0x22, 0xca, 0x17, 0xbe, 0x3a, 0x72, 0xb8, 0xa7, 0x46, 0x96, 0xcc, 0x5d,
+  0x7f, 0xca, 0x03, 0x1a, 0x98, 0x64, 0x36, 0xcb, 0x45, 0x01, 0xb5, 0x72, 0xd2, 0x2e, 0xde, 0x0a,
+  0x37, 0xbf, 0x29, 0xff, 0x59, 0x03, 0x10, 0xec, 0xdd, 0x57, 0xb6, 0xf7, 0x5f, 0x97, 0x66, 0x10,
+  0xe0, 0xbe, 0x82, 0xbd, 0xc8, 0x4e, 0x73, 0x48, 0x52, 0x52, 0xef, 0xe5, 0xc6, 0x64, 0xe7, 0x1a,
+  0xc3, 0x1f, 0xd6, 0xaf, 0xa4, 0x82, 0x5f, 0x50, 0x12, 0x96, 0x80, 0xbe, 0x54, 0xc1, 0x92, 0x2a,
+  0x7e, 0x86, 0x21, 0x39, 0x0a, 0xd9, 0x54, 0xb0, 0x0a, 0xe2, 0x70, 0x21, 0x0c, 0x13, 0x4b, 0x43,
+  0x05, 0x94, 0xa8, 0x5e, 0x13, 0x56, 0xc6, 0x64, 0x1e, 0x71, 0xe5, 0xba, 0x47, 0xab, 0xa0, 0x09,
+  0xf9, 0x86, 0xb7, 0x47, 0x02, 0xce, 0xaf, 0x85, 0x04, 0xb0, 0x02, 0x2e, 0x08, 0x1f, 0x1e, 0x6d,
+  0xfb, 0xae, 0x5d, 0x51, 0xd1, 0xcf, 0xda, 0x0b, 0x0a, 0xc6, 0x55, 0xc7, 0x88, 0x89, 0x23, 0x84,
+  0x0c, 0x96, 0xd4, 0x52, 0x7b, 0x8a, 0x98, 0xcf, 0xc7, 0xbb, 0xce, 0x08, 0x18, 0x9e, 0xa3, 0xe4,
+  0x64, 0xaf, 0x73, 0x9c, 0x12, 0x36, 0x2e, 0x08, 0xd9, 0xe6, 0xa1, 0xc1, 0x86, 0x67, 0x85, 0xb4,
+  0x76, 0xf3, 0x84, 0xa1, 0xa4, 0x8f, 0xa9, 0x36, 0x06, 0x93, 0x15, 0x53, 0x62, 0x6f, 0x96, 0xfb,
+  0xb7, 0x4f, 0xec, 0x5a, 0x9d, 0xa3, 0x5b, 0xfa, 0xb8, 0xab, 0x9d, 0x0f, 0x82, 0xdf, 0x9a, 0x80,
+  0x62, 0x7d, 0xd1, 0xd5, 0xbd, 0x81, 0x6d, 0xec, 0xcd, 0x64, 0x80, 0x53, 0xf8, 0x5e, 0xd9, 0xfa,
+  0x07, 0xf8, 0x3a, 0x7b, 0x67, 0x05, 0xff, 0xdb, 0xd2, 0xf7, 0x01, 0xbd, 0x06, 0x54, 0xaf, 0xc5,
+  0x84, 0x2c, 0x47, 0x29, 0x07, 0xfb, 0x55, 0x1a, 0xbe, 0x61, 0x50, 0x61, 0x35, 0x2b, 0x8e, 0x01,
+  0x15, 0x4b, 0xba, 0x43, 0xc6, 0xba, 0x12, 0x5f, 0x5e, 0x52, 0x52, 0x17, 0x15, 0xf5, 0x4c, 0xcc,
+  0x5f, 0x61, 0x41, 0x9d, 0x95, 0x2a, 0x5e, 0x81, 0x61, 0xad, 0xaa, 0xa7, 0x9f, 0xb2, 0x30, 0x18,
+  0xc4, 0x85, 0xef, 0x23, 0x46, 0x92, 0x4b, 0xd3, 0xf1, 0x52, 0xdb, 0x86, 0xbf, 0xb4, 0xb1, 0xcf,
+  0x6c, 0x5c, 0x4e, 0xae, 0x36, 0xd2, 0x03, 0xd6, 0xb0, 0x5d, 0x1e, 0x5d, 0xa4, 0xd5, 0x84, 0x1e,
+  0xa9, 0x15, 0x84, 0x93, 0xfd, 0x28, 0x90, 0xc0, 0xc8, 0xea, 0xa9, 0xc4, 0xb4, 0x2c, 0x1a, 0x40,
+  0xbc, 0xd0, 0x60, 0xe8, 0x2a, 0xf2, 0xc3, 0x9c, 0xaa, 0x66, 0xb9, 0xe2, 0xab, 0x5c, 0x31, 0x5a,
+  0x6a, 0x3a, 0x21, 0xc7, 0x00, 0x8c, 0xf8, 0x93, 0x3d, 0x2f, 0xd3, 0x7a, 0x93, 0xd4, 0x40, 0x0f,
+  0x67, 0x46, 0xe9, 0xaf, 0x53, 0x31, 0xd6, 0xce, 0x4c, 0x30, 0xce, 0xf0, 0x71, 0x16, 0x42, 0x34,
+  0x61, 0x37, 0x21, 0xf2, 0x61, 0x85, 0x52, 0x43, 0xfa, 0x0a, 0x3b, 0xee, 0xdd, 0x4a, 0xa8, 0x74,
+  0xf0, 0xd6, 0x1f, 0x34, 0x4d, 0x1e, 0xb8, 0x8e, 0xb1, 0xe4, 0xf2, 0x7f, 0xd1, 0xc3, 0xf1, 0xc5,
+  0xf6, 0xd9, 0x5d, 0x2d, 0xa7, 0x87, 0x84, 0x5f, 0x6c, 0xdc, 0x6d, 0x65, 0xc6, 0x97, 0x52, 0x92,
+  0x59, 0xbe, 0x48, 0x52, 0xb0, 0xce, 0xf4, 0xaa, 0xfa, 0xe0, 0x65, 0xcb, 0x09, 0x62, 0x70, 0x25,
+  0x7e, 0x9a, 0x23, 0x62, 0x51, 0xd5, 0x0d, 0xd6, 0xc4, 0x99, 0x93, 0xc5, 0x63, 0xd0, 0x19, 0xa6,
+  0x04, 0x3c, 0x4d, 0x00, 0xab, 0xc8, 0xea, 0x86, 0xfb, 0xe4, 0x68, 0x24, 0xc4, 0x48, 0x60, 0xcd,
+  0xa5, 0x3b, 0x1b, 0x61, 0xe7, 0x19, 0x84, 0x9d, 0xb5, 0x52, 0x23, 0xb9, 0x2c, 0x8b, 0x40, 0xb3,
+  0x48, 0x53, 0xd6, 0x8e, 0xe0, 0x89, 0x92, 0xa4, 0x16, 0xa7, 0x22, 0x07, 0x44, 0xe2, 0x52, 0x69,
+  0x14, 0xb4, 0x5c, 0x57, 0x24, 0xaf, 0xdb, 0x33, 0x68, 0x85, 0x4c, 0x15, 0xc2, 0xd6, 0xa9, 0xef,
+  0x43, 0xec, 0xaf, 0x61, 0x4a, 0x18, 0x25, 0x31, 0x6c, 0x94, 0x4e, 0x8a, 0x9e, 0xf9, 0x83, 0xb9,
+  0x5c, 0x9a, 0xc4, 0xf2, 0xc3, 0x50, 0xa4, 0x83, 0x18, 0x42, 0xf0, 0xc0, 0x68, 0x0f, 0x8f, 0x3e,
+  0x40, 0xc0, 0x4a, 0xe4, 0x28, 0x0e, 0x7d, 0x48, 0x7a, 0xd0, 0x8a, 0xa4, 0x25, 0x07, 0x36, 0x41,
+  0xad, 0x12, 0x7b, 0x09, 0x33, 0x2b, 0x66, 0xc0, 0xfa, 0x0d, 0x91, 0x3d, 0x58, 0xc3, 0x26, 0xf6,
+  0x0c, 0x39, 0xb3, 0x54, 0x1b, 0xbb, 0xf2, 0xe1, 0x63, 0x35, 0xcb, 0x6a, 0xec, 0xe7, 0xad, 0xd0,
+  0xc9, 0xd1, 0x10, 0x78, 0xd6, 0x38, 0xde, 0xe8, 0x2e, 0x69, 0xa3, 0xb5, 0xa0, 0x01, 0xb0, 0xb5,
+  0x91, 0x6b, 0x99, 0xcc, 0x72, 0xc0, 0x51, 0x96, 0xf9, 0x82, 0x1a, 0xc6, 0x39, 0x3e, 0x89, 0xed,
+  0x7a, 0xbf, 0x67, 0xbb, 0xf4, 0x42, 0x4a, 0x92, 0x49, 0xc4, 0x2f, 0x28, 0xc6, 0x37, 0x10, 0x8c,
+  0x46, 0x0e, 0xb2, 0x8a, 0x4b, 0xf2, 0x59, 0xe8, 0x47, 0xd1, 0xcc, 0xb4, 0xe9, 0x1e, 0x56, 0xdd,
+  0xbc, 0xe7, 0x02, 0x5b, 0xcb, 0x10, 0x10, 0xfc, 0xd5, 0xaf, 0x0d, 0xe2, 0x6e, 0xde, 0x56, 0x10,
+  0xf7, 0xe0, 0x6e, 0xb7, 0xfa, 0xe0, 0xaf, 0x11, 0xd6, 0xc8, 0x32, 0x42, 0xbc, 0xa2, 0xb0, 0x73,
+  0x6d, 0xba, 0x34, 0x06, 0x17, 0x1a, 0x67, 0x64, 0xee, 0x21, 0xec, 0x5a, 0x10, 0x86, 0xc9, 0xd4,
+  0xd8, 0xf4, 0x6c, 0x08, 0x33, 0xcf, 0x1e, 0x2d, 0x97, 0x62, 0x7a, 0x94, 0xa2, 0x2b, 0xa3, 0xf4,
+  0x7a, 0x3f, 0x1b, 0x6b, 0x29, 0x1f, 0x87, 0x24, 0xe2, 0x96, 0x01, 0x38, 0x08, 0xb8, 0x6c, 0xe2,
+  0xe2, 0x26, 0x31, 0x0e, 0x26, 0x2a, 0xfc, 0x56, 0xfc, 0x92, 0xdb, 0xe6, 0x3c, 0x17, 0xfb, 0x14,
+  0x58, 0x2f, 0x57, 0x60, 0x78, 0xc7, 0x18, 0x9e, 0xe0, 0xbf, 0x61, 0x26, 0xb8, 0xda, 0x52, 0xdc,
+  0x8c, 0xf6, 0xab, 0x71, 0xad, 0x64, 0x22, 0x9c, 0x04, 0xeb, 0xbb, 0x9b, 0xfd, 0xda, 0x37, 0x9f,
+  0xca, 0x62, 0x9c, 0x4f, 0xa6, 0x13, 0xb3, 0x52, 0x0e, 0xd8, 0x91, 0xda, 0x8e, 0x00, 0xe7, 0x3d,
+  0x88, 0xd4, 0x8e, 0xd0, 0x06, 0x5f, 0x13, 0x16, 0x4c, 0xa7, 0x40, 0xb5, 0xed, 0xb0, 0x66, 0xb2,
+  0xf2, 0x42, 0x27, 0x2a, 0x8b, 0x0a, 0x80, 0xef, 0xec, 0x4a, 0x05, 0xfe, 0xcc, 0x11, 0xe4, 0x87,
+  0xe8, 0xbf, 0xd9, 0x66, 0xd4, 0xf8, 0xd3, 0x91, 0x09, 0x6e, 0xca, 0xa2, 0x39, 0xc3, 0xb0, 0xaf,
+  0x97, 0xf4, 0xec, 0x66, 0xc3, 0xaf, 0xdf, 0x63, 0xd1, 0xf3, 0x03, 0x4f, 0x2b, 0x7c, 0x11, 0xe9,
+  0x33, 0xeb, 0x52, 0xd6, 0x2f, 0x59, 0xda, 0x1e, 0x99, 0xb1, 0xaf, 0x96, 0xaf, 0x6f, 0xbc, 0xdd,
+  0x13, 0x1d, 0xee, 0x6f, 0x88, 0xaf, 0xed, 0xe9, 0xa2, 0x44, 0x06, 0xef, 0xe9, 0xa3, 0x44, 0xee,
+  0x62, 0x27, 0x65, 0x6d, 0x47, 0xb8, 0x58, 0xda, 0x4c, 0xc9, 0xb2, 0xb9, 0x74, 0xf1, 0xc0, 0xb6,
+  0xac, 0x45, 0x74, 0x23, 0xc8, 0xd9, 0x62, 0xf1, 0x98, 0x73, 0x18, 0xc7, 0x40, 0x62, 0x03, 0xca,
+  0x7d, 0x07, 0x99, 0xa8, 0x0b, 0x26, 0x17, 0x52, 0xab, 0x4d, 0x5f, 0xf0, 0xf2, 0x84, 0xe0, 0x6c,
+  0x94, 0x57, 0x9a, 0x5f, 0x72, 0xd5, 0x90, 0x53, 0xfb, 0x0e, 0x85, 0xc0, 0x66, 0x82, 0x91, 0x58,
+  0x82, 0xdc, 0x84, 0x85, 0xed, 0xba, 0x1e, 0x95, 0x46, 0xf4, 0x17, 0xec, 0xb6, 0x2a, 0x91, 0xef,
+  0x43, 0x33, 0xc0, 0xda, 0xcc, 0xd2, 0xbf, 0x83, 0xc1, 0xca, 0x8e, 0xcd, 0x49, 0x46, 0x98, 0xee,
+  0xbd, 0xf9, 0x18, 0x11, 0x1c, 0xa8, 0x54, 0xca, 0x78, 0x2b, 0x83, 0xf7, 0xb0, 0xf7, 0x79, 0x03,
+  0x7c, 0x7b, 0xcf, 0x6a, 0x28, 0x1a, 0x25, 0x1e, 0xab, 0x74, 0x9f, 0x84, 0xc5, 0x08, 0x79, 0x43,
+  0x31, 0x16, 0x2c, 0xe9, 0x0b, 0xf9, 0x9c, 0x98, 0x24, 0xbd, 0x95, 0xf2, 0xf9, 0xfd, 0x38, 0xcf,
+  0xe7, 0xf7, 0xd7, 0x93, 0xed, 0x28, 0x29, 0x4d, 0x83, 0x67, 0x73, 0xec, 0x7b, 0xc4, 0x5f, 0xb7,
+  0x24, 0x31, 0x5d, 0x06, 0x6e, 0x7e, 0xe2, 0xf2, 0x08, 0xb8, 0x05, 0xb6, 0xe9, 0x87, 0x63, 0xe0,
+  0x34, 0xcb, 0x4d, 0xda, 0x09, 0xd2, 0xae, 0x83, 0x16, 0xe4, 0x67, 0x35, 0x16, 0xf2, 0x94, 0x67,
+  0xbd, 0xc3, 0x3d, 0x87, 0x36, 0xdb, 0xe7, 0x2f, 0xb5, 0x97, 0x1c, 0xc0, 0x34, 0xf1, 0x4c, 0x29,
+  0xe3, 0x03, 0xff, 0x09, 0xce, 0x64, 0xd6, 0x26, 0x9e, 0x46, 0xe1, 0xd1, 0x14, 0xfe, 0xb6, 0xef,
+  0xff, 0x02, 0x54, 0x52, 0xa7, 0x37, 0xeb, 0x57, 0x00, 0x00
 };
 
 
@@ -1060,216 +1059,217 @@ const uint8_t PAGE_settings_ui[] PROGMEM = {
 
 
 // Autogenerated from wled00/data/settings_sync.htm, do not edit!!
-const uint16_t PAGE_settings_sync_length = 3318;
+const uint16_t PAGE_settings_sync_length = 3341;
 const uint8_t PAGE_settings_sync[] PROGMEM = {
-  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0xad, 0x1a, 0x6b, 0x53, 0xdb, 0xb8,
-  0xf6, 0xbb, 0x7f, 0x85, 0xf0, 0xce, 0x74, 0x93, 0x25, 0xe4, 0x01, 0x84, 0x52, 0x88, 0xdd, 0x0b,
-  0x84, 0x42, 0xee, 0x2d, 0x34, 0x4d, 0xe8, 0xb6, 0x3b, 0x73, 0x67, 0x76, 0x14, 0x5b, 0x49, 0x04,
-  0xb6, 0xe5, 0xb5, 0x64, 0x1e, 0xd3, 0xed, 0x7f, 0xbf, 0xe7, 0x48, 0xb6, 0x93, 0x98, 0xbc, 0x7a,
-  0x67, 0x3f, 0x34, 0xd8, 0xd2, 0x39, 0x47, 0xe7, 0xfd, 0x90, 0xdb, 0xd9, 0xe9, 0x7e, 0xba, 0xb8,
-  0xfb, 0xa3, 0x7f, 0x49, 0xa6, 0x2a, 0x0c, 0xdc, 0x0e, 0xfe, 0x92, 0x80, 0x46, 0x13, 0xc7, 0x66,
-  0x91, 0x0d, 0xef, 0x8c, 0xfa, 0x6e, 0x27, 0x64, 0x8a, 0x92, 0x88, 0x86, 0xcc, 0xb1, 0x1f, 0x39,
-  0x7b, 0x8a, 0x45, 0xa2, 0x6c, 0xe2, 0x89, 0x48, 0xb1, 0x48, 0x39, 0xf6, 0x13, 0xf7, 0xd5, 0xd4,
-  0x69, 0x37, 0x9b, 0xb6, 0x6b, 0x19, 0x50, 0xab, 0xb4, 0xe7, 0xb3, 0x47, 0xee, 0xb1, 0x3d, 0xfd,
-  0x52, 0xe3, 0x11, 0x57, 0x9c, 0x06, 0x7b, 0xd2, 0xa3, 0x01, 0x73, 0x5a, 0xb5, 0x90, 0x3e, 0xf3,
-  0x30, 0x0d, 0x8b, 0xf7, 0x54, 0xb2, 0x44, 0xbf, 0xd0, 0x11, 0xbc, 0x47, 0xc2, 0x26, 0x56, 0xe9,
-  0xe8, 0x8c, 0x21, 0x6f, 0x4a, 0x13, 0xc9, 0xe0, 0x90, 0x54, 0x8d, 0xf7, 0x8e, 0x61, 0x55, 0x71,
-  0x15, 0x30, 0x77, 0xf8, 0x12, 0x79, 0x64, 0xc8, 0x94, 0xe2, 0xd1, 0x44, 0x76, 0x1a, 0x66, 0xb1,
-  0x23, 0xbd, 0x84, 0xc7, 0xca, 0xb5, 0x1e, 0x69, 0x42, 0x02, 0xe1, 0xf1, 0xb8, 0xe6, 0x3b, 0xbe,
-  0xf0, 0xd2, 0x10, 0xd8, 0xac, 0xc1, 0x82, 0xb3, 0xd3, 0x3a, 0x1d, 0xa7, 0x91, 0xa7, 0xb8, 0x88,
-  0xc8, 0xa4, 0xe7, 0x57, 0x58, 0xf5, 0x7b, 0xc2, 0x54, 0x9a, 0x44, 0xc4, 0xaf, 0x4f, 0x98, 0xba,
-  0x0c, 0x18, 0x82, 0x9e, 0xbf, 0xe8, 0xad, 0x1f, 0x05, 0xa8, 0x12, 0x93, 0x49, 0xc0, 0x10, 0xda,
-  0x20, 0xd5, 0xbd, 0x80, 0x4a, 0xf9, 0x91, 0x4b, 0x55, 0xcf, 0xb6, 0xec, 0x29, 0xf7, 0x99, 0x5d,
-  0xad, 0xe1, 0xbe, 0x7d, 0x2b, 0xec, 0xdd, 0x35, 0x40, 0x33, 0xba, 0xd7, 0x95, 0xea, 0xf7, 0x27,
-  0x1e, 0xf9, 0xe2, 0xa9, 0x2e, 0x62, 0x16, 0x01, 0x80, 0x52, 0xb1, 0x3c, 0x69, 0x34, 0x1e, 0x22,
-  0x51, 0x7f, 0x0a, 0x18, 0x32, 0xd5, 0xe0, 0xa0, 0xe5, 0x64, 0x4c, 0x3d, 0x26, 0x1b, 0xa9, 0x1f,
-  0xef, 0x45, 0x42, 0xf1, 0x31, 0x67, 0x49, 0x63, 0x9e, 0xd0, 0x79, 0x99, 0x50, 0x43, 0x66, 0xba,
-  0xb1, 0x6b, 0xf6, 0x9f, 0x92, 0x05, 0xe3, 0x79, 0x68, 0xea, 0xdf, 0x03, 0xfc, 0xd1, 0x61, 0xfb,
-  0xd0, 0x71, 0xfc, 0xfa, 0x70, 0x5c, 0xef, 0xf6, 0xea, 0x8f, 0x34, 0x48, 0xd9, 0xfb, 0x56, 0xb6,
-  0x70, 0xf9, 0xc5, 0x2c, 0xbc, 0x79, 0x53, 0x59, 0x78, 0x77, 0x9a, 0xd5, 0x93, 0x76, 0xfb, 0xe8,
-  0xb8, 0x84, 0x07, 0x60, 0xcd, 0x7c, 0xe9, 0x6c, 0x11, 0x33, 0x7f, 0x77, 0x5a, 0xd5, 0x5a, 0x73,
-  0x13, 0xf5, 0x56, 0x75, 0x8e, 0xcb, 0x40, 0x50, 0xff, 0xdf, 0xc3, 0x0a, 0xab, 0x29, 0x67, 0xa7,
-  0x59, 0xfd, 0x1e, 0x30, 0x45, 0x04, 0xe0, 0x7b, 0x09, 0xa3, 0x8a, 0x65, 0x96, 0xaa, 0xd8, 0xc6,
-  0xe4, 0x76, 0xf5, 0x54, 0xd4, 0x41, 0xe4, 0x33, 0xa5, 0x12, 0x3e, 0x4a, 0x15, 0xe8, 0x5a, 0x26,
-  0x9e, 0x5d, 0x63, 0xd5, 0x5a, 0x79, 0x5d, 0xbd, 0xc4, 0x0c, 0x94, 0xa2, 0xd8, 0xb3, 0x6a, 0xdc,
-  0xd3, 0x47, 0x9a, 0x13, 0x78, 0x05, 0x48, 0x25, 0xf8, 0x98, 0x5d, 0x53, 0xd5, 0x9a, 0x5f, 0x1f,
-  0x09, 0xff, 0xa5, 0x4e, 0x63, 0x50, 0xad, 0x7f, 0x31, 0xe5, 0x81, 0x5f, 0x11, 0x08, 0x4f, 0x7d,
-  0xff, 0xf2, 0x11, 0xb8, 0x40, 0x1b, 0xb3, 0x88, 0x25, 0x15, 0x1b, 0x79, 0xb6, 0x6b, 0x95, 0xaa,
-  0xe3, 0x7e, 0xbf, 0x62, 0xea, 0xf7, 0x4a, 0xb5, 0x06, 0x3e, 0xfa, 0x3b, 0x0d, 0x2a, 0xd5, 0x1f,
-  0xcb, 0x11, 0x58, 0x92, 0x88, 0x04, 0xf8, 0x04, 0x04, 0x08, 0x27, 0x29, 0x02, 0x56, 0x0f, 0xc4,
-  0xa4, 0x62, 0x5f, 0xe2, 0x3a, 0xc9, 0xb4, 0x00, 0x76, 0x24, 0x63, 0x1e, 0x30, 0x2d, 0x0f, 0xc4,
-  0x4f, 0x02, 0x72, 0x7f, 0xcc, 0xd6, 0xc5, 0x18, 0x63, 0x74, 0xcc, 0x27, 0x69, 0x42, 0xb5, 0xda,
-  0x8c, 0x3c, 0x64, 0x4c, 0x39, 0xfa, 0xcf, 0x7f, 0xa3, 0x5e, 0xe4, 0x89, 0x30, 0x06, 0xed, 0x31,
-  0x12, 0xd3, 0x09, 0x23, 0x3e, 0x55, 0x74, 0x07, 0xbc, 0x61, 0x4e, 0xd3, 0x1f, 0x2e, 0xc0, 0x1d,
-  0xc6, 0x22, 0xa9, 0xdc, 0x3b, 0xcd, 0xd3, 0xfb, 0xce, 0xf1, 0xe9, 0xfd, 0xee, 0x6e, 0x55, 0x7b,
-  0xf2, 0x95, 0xbd, 0x5b, 0xb9, 0xdf, 0x05, 0xb3, 0xd4, 0xbd, 0x29, 0xf3, 0x1e, 0x98, 0xef, 0x98,
-  0xe5, 0xa1, 0x5d, 0x35, 0x26, 0x73, 0xdd, 0xfb, 0x37, 0x2d, 0xe3, 0xf5, 0x83, 0x15, 0xb0, 0x83,
-  0x05, 0xd8, 0xd9, 0xa9, 0x57, 0x78, 0x2a, 0x46, 0x2a, 0x78, 0x15, 0xd8, 0xb8, 0x59, 0x13, 0x0e,
-  0x44, 0x67, 0x89, 0x0b, 0xb6, 0xeb, 0x2c, 0x67, 0xe4, 0x37, 0x51, 0x53, 0xd9, 0xde, 0x60, 0xc9,
-  0x9e, 0xf8, 0xcd, 0xd9, 0x3f, 0x2d, 0xf1, 0xea, 0xb0, 0x5a, 0x89, 0x23, 0x47, 0xcd, 0xd8, 0x19,
-  0xf6, 0x0b, 0x76, 0x16, 0x7c, 0xdb, 0x50, 0x79, 0x8e, 0x01, 0x47, 0xaa, 0x17, 0xb0, 0x8f, 0xcf,
-  0x65, 0x1c, 0xd0, 0x17, 0x87, 0xb9, 0xcd, 0xf7, 0x76, 0x24, 0x22, 0x66, 0x9f, 0xd8, 0x23, 0x48,
-  0x2e, 0x0f, 0x60, 0x1e, 0xb7, 0x59, 0xf8, 0x74, 0x3f, 0x3f, 0x74, 0x4e, 0xd1, 0xb9, 0x33, 0x7c,
-  0x97, 0x4f, 0x5c, 0x79, 0xd3, 0x4a, 0x8c, 0xb9, 0xad, 0x07, 0x6e, 0xbc, 0x80, 0x52, 0xad, 0x7e,
-  0xf7, 0xa8, 0x64, 0x04, 0x03, 0xed, 0x64, 0x81, 0x17, 0x07, 0x97, 0x4e, 0x47, 0x10, 0x01, 0x0f,
-  0xa7, 0x1a, 0x04, 0x63, 0xb8, 0x04, 0x82, 0x4b, 0xf3, 0x20, 0x87, 0xcd, 0xc3, 0x32, 0x15, 0x5c,
-  0xfa, 0x81, 0xf2, 0xd6, 0xd0, 0xf2, 0x73, 0xec, 0x01, 0x67, 0x36, 0x3a, 0xda, 0x89, 0xed, 0x38,
-  0x59, 0x3a, 0x01, 0xc1, 0xb4, 0x5f, 0xd5, 0xe3, 0x44, 0x28, 0xe1, 0x89, 0x00, 0x04, 0xd4, 0x99,
-  0xb4, 0x59, 0xab, 0xe8, 0x14, 0xeb, 0x20, 0x44, 0x30, 0x54, 0x22, 0x01, 0xef, 0xc2, 0x24, 0xda,
-  0x53, 0x2c, 0xc4, 0x48, 0xf0, 0x7a, 0xa0, 0xb3, 0xea, 0xdf, 0x7f, 0x67, 0x60, 0x80, 0x1f, 0xc6,
-  0xe0, 0xb8, 0x1f, 0x80, 0x3e, 0xb9, 0x11, 0x3e, 0xab, 0x93, 0x7e, 0xc0, 0x90, 0x43, 0x86, 0x09,
-  0x8e, 0x7c, 0xfd, 0x78, 0xd9, 0x25, 0xbd, 0x3e, 0xb8, 0x66, 0x6d, 0x81, 0xa2, 0x5c, 0xa4, 0x58,
-  0xd3, 0xd4, 0xaa, 0x55, 0x84, 0xd2, 0xf9, 0x01, 0xc9, 0xbf, 0xd7, 0x89, 0x13, 0xf2, 0xa6, 0xbd,
-  0xab, 0xb7, 0x4f, 0x6c, 0xbb, 0xba, 0x3b, 0xcb, 0x81, 0x0d, 0x59, 0xbf, 0x97, 0xef, 0x63, 0xe7,
-  0xd0, 0xae, 0xed, 0xb4, 0xaa, 0x3f, 0xac, 0x4e, 0x23, 0x2b, 0x14, 0x1d, 0x6d, 0x51, 0xf7, 0x5f,
-  0x3c, 0xc4, 0x92, 0x43, 0xd2, 0x24, 0x80, 0xbc, 0xa1, 0x8d, 0xec, 0x49, 0x09, 0x39, 0x05, 0x00,
-  0x35, 0x40, 0xa7, 0x61, 0x4a, 0x24, 0xa6, 0x01, 0x08, 0x4a, 0x3c, 0xd9, 0xb1, 0x41, 0x5b, 0x50,
-  0x8e, 0xc0, 0x61, 0x43, 0x8b, 0x70, 0x78, 0xc7, 0xa7, 0x3f, 0xa5, 0x9d, 0x95, 0xd0, 0xe1, 0xd8,
-  0x26, 0x50, 0xc0, 0xa6, 0x02, 0x76, 0x62, 0x21, 0xa1, 0x94, 0x42, 0x78, 0xa7, 0xa3, 0x90, 0x43,
-  0x29, 0x43, 0xcf, 0x07, 0x54, 0x9f, 0x3f, 0x12, 0x5d, 0x23, 0x1c, 0x5b, 0x09, 0x50, 0xcf, 0x53,
-  0xb6, 0x66, 0x65, 0x8b, 0x53, 0x16, 0xc4, 0xe7, 0xb0, 0x06, 0xe9, 0x48, 0x61, 0x11, 0x82, 0xc4,
-  0xe5, 0xd8, 0xe6, 0x05, 0xa9, 0x79, 0x01, 0xf7, 0x1e, 0x1c, 0xfb, 0x1a, 0x69, 0xbd, 0xef, 0x34,
-  0xcc, 0x06, 0xb0, 0x0a, 0x24, 0x0a, 0x1c, 0x6b, 0x05, 0xd2, 0x39, 0x22, 0x9d, 0x53, 0xef, 0x61,
-  0x86, 0xb7, 0x70, 0x8a, 0xe1, 0xd4, 0x76, 0x87, 0xf4, 0x91, 0xcd, 0x40, 0xa6, 0x09, 0xd4, 0x7e,
-  0x43, 0x7f, 0xba, 0x6f, 0x4a, 0x30, 0xa8, 0x38, 0x8d, 0x41, 0x3d, 0xfb, 0xb0, 0x74, 0xe0, 0x6a,
-  0x1b, 0x9e, 0x27, 0xa0, 0x1e, 0x70, 0x3d, 0x05, 0xcb, 0x07, 0xee, 0x97, 0x6e, 0x9f, 0xf4, 0x41,
-  0xb9, 0x27, 0xa4, 0xc3, 0xa3, 0x38, 0x55, 0x99, 0x7a, 0xbe, 0xf4, 0xed, 0x9c, 0xb9, 0x28, 0x0d,
-  0x47, 0x2c, 0x01, 0x6d, 0xf1, 0xc8, 0xb1, 0x5b, 0xf0, 0x97, 0x3e, 0x3b, 0xf6, 0x51, 0xbb, 0x7d,
-  0xd0, 0xb6, 0x73, 0xf5, 0xf8, 0xf0, 0x98, 0xb0, 0xbf, 0x52, 0x9e, 0x30, 0xb4, 0x42, 0xe2, 0xee,
-  0x47, 0xfe, 0x22, 0xd5, 0xac, 0x7b, 0xf8, 0xb2, 0x6f, 0x93, 0xff, 0x9f, 0x2a, 0x8a, 0x60, 0x69,
-  0xb1, 0x26, 0x89, 0x48, 0x63, 0xa9, 0x05, 0x58, 0x60, 0x1b, 0x92, 0x89, 0xb6, 0x35, 0xfe, 0x5d,
-  0x3c, 0x47, 0x3b, 0x0a, 0xd0, 0x34, 0xc9, 0xe1, 0x44, 0xe7, 0x05, 0x97, 0x58, 0x8b, 0xd8, 0x83,
-  0x0c, 0x7b, 0xb0, 0x15, 0x76, 0x47, 0x61, 0x73, 0x44, 0xac, 0x6c, 0x33, 0xa4, 0xc9, 0x84, 0x47,
-  0x27, 0x4d, 0x42, 0x53, 0x25, 0x70, 0x17, 0x18, 0x56, 0xc0, 0x78, 0x03, 0x7f, 0xe0, 0x5f, 0xab,
-  0x78, 0xda, 0x2f, 0x9e, 0x0e, 0x8a, 0xa7, 0xc3, 0xe2, 0xa9, 0x6d, 0x15, 0x8f, 0x47, 0xc5, 0xd3,
-  0xdb, 0xe2, 0xe9, 0xd8, 0x3c, 0x35, 0x34, 0x79, 0x73, 0xc4, 0x10, 0xca, 0xde, 0x49, 0x01, 0x90,
-  0x6b, 0xdc, 0x48, 0xa0, 0x53, 0xee, 0x48, 0x3c, 0x67, 0x92, 0xb5, 0x72, 0xff, 0x87, 0x27, 0xb7,
-  0x8c, 0xb2, 0x14, 0x63, 0xbf, 0x68, 0xfd, 0xe0, 0x71, 0x3b, 0x94, 0x83, 0xe2, 0x90, 0x83, 0xd7,
-  0x18, 0xcb, 0xf9, 0x3a, 0x2c, 0x50, 0x0e, 0xb7, 0x3c, 0xa4, 0x3d, 0xe3, 0xab, 0xbd, 0x25, 0xca,
-  0x51, 0x71, 0xc8, 0xd1, 0xb6, 0x7c, 0xbd, 0x2d, 0x50, 0xde, 0x6e, 0x79, 0xc8, 0xf1, 0x8c, 0xaf,
-  0xe3, 0x1c, 0x65, 0xde, 0x58, 0x03, 0xe6, 0x31, 0xfe, 0xc8, 0x4e, 0xb6, 0x21, 0x36, 0x68, 0x15,
-  0xc4, 0x06, 0x5b, 0xda, 0x6b, 0xb0, 0x9f, 0x73, 0x3c, 0xd8, 0xdf, 0x52, 0xc8, 0x41, 0x61, 0xaf,
-  0xc1, 0xc1, 0x96, 0x87, 0x1c, 0xce, 0xf8, 0xda, 0xd2, 0x5e, 0x83, 0x76, 0x71, 0x48, 0x7b, 0x5b,
-  0xbe, 0x0a, 0x7b, 0x0d, 0x8e, 0xb6, 0x3c, 0xe4, 0xed, 0x8c, 0xaf, 0x2d, 0xed, 0x35, 0x38, 0x2e,
-  0x0e, 0x59, 0x34, 0x57, 0x43, 0x47, 0x37, 0x24, 0x54, 0x48, 0x3c, 0x85, 0xcd, 0x22, 0xf1, 0x94,
-  0xd0, 0x78, 0x15, 0xbd, 0x8c, 0x0e, 0xd4, 0x84, 0xf3, 0x84, 0x4f, 0xa6, 0x2a, 0x62, 0x52, 0xd6,
-  0x3a, 0x8d, 0x0c, 0xc9, 0xda, 0x0e, 0xfb, 0xc2, 0x76, 0x2f, 0x44, 0x20, 0x92, 0x19, 0x62, 0x8e,
-  0x47, 0x21, 0xa9, 0xae, 0xd2, 0x57, 0x86, 0xfc, 0xcd, 0x76, 0x2f, 0xc7, 0x63, 0xe6, 0x29, 0x39,
-  0xc3, 0xc6, 0xc4, 0xb9, 0xee, 0xc4, 0xe1, 0x27, 0x18, 0x19, 0xa1, 0xf5, 0x99, 0x60, 0xc3, 0x4e,
-  0x44, 0x8c, 0xdd, 0x84, 0xac, 0x91, 0xf5, 0x38, 0x57, 0x90, 0x3c, 0x47, 0x22, 0x8d, 0x7c, 0x89,
-  0xf4, 0x2d, 0xcc, 0x40, 0xc4, 0x4c, 0x3e, 0xa6, 0x1d, 0x91, 0xd8, 0x1b, 0xfb, 0x90, 0xb9, 0x3d,
-  0x85, 0x23, 0x62, 0x34, 0x61, 0x27, 0x1b, 0x28, 0x76, 0x6d, 0x77, 0x0d, 0xa9, 0xac, 0xfa, 0xc5,
-  0x09, 0xa8, 0x94, 0x40, 0xe7, 0xdd, 0x1b, 0x6c, 0xa2, 0x77, 0x3e, 0x4f, 0xef, 0x2c, 0x60, 0xcf,
-  0x74, 0x91, 0xea, 0x26, 0xfc, 0xb3, 0x79, 0xfc, 0x3e, 0x0c, 0x15, 0x3c, 0x96, 0xe4, 0x3a, 0x65,
-  0x99, 0x38, 0x3f, 0x47, 0xec, 0x7a, 0x9e, 0xd8, 0x0d, 0xf5, 0x12, 0xf1, 0x73, 0xf8, 0x37, 0x19,
-  0x3e, 0x56, 0xeb, 0x18, 0xda, 0x02, 0x98, 0xb5, 0x60, 0x2e, 0x4e, 0x68, 0x24, 0x43, 0x2e, 0xe5,
-  0x02, 0x85, 0xac, 0xd0, 0x0e, 0x96, 0x16, 0xda, 0x66, 0x56, 0x68, 0x0f, 0xe0, 0xc1, 0x5a, 0x59,
-  0x66, 0xb5, 0xc7, 0x80, 0xd3, 0x8f, 0x84, 0x50, 0xc5, 0x16, 0x0c, 0xd9, 0x04, 0x26, 0xac, 0xe0,
-  0x25, 0x53, 0x80, 0xac, 0x77, 0x1a, 0x1c, 0x7b, 0x8e, 0x82, 0x90, 0x0c, 0x03, 0x5b, 0xd7, 0xe8,
-  0x5e, 0x24, 0x15, 0x8d, 0x3c, 0x46, 0x70, 0x8e, 0xd2, 0x45, 0xfa, 0x32, 0xd2, 0xa5, 0x92, 0xe7,
-  0x1b, 0x01, 0x6c, 0xac, 0x94, 0x39, 0x8b, 0xe0, 0xdb, 0x8f, 0x46, 0xe8, 0x1b, 0xfa, 0xc0, 0x88,
-  0x9a, 0x72, 0x39, 0x43, 0x87, 0x3a, 0xec, 0x89, 0x47, 0x96, 0x20, 0xd1, 0x0d, 0xaa, 0xbb, 0x3d,
-  0xc7, 0x0b, 0x11, 0xe0, 0xb2, 0xcc, 0xe4, 0x80, 0xd1, 0x40, 0xf1, 0x90, 0x69, 0xfe, 0xb2, 0x00,
-  0x27, 0xa8, 0xdf, 0x24, 0xdb, 0xd8, 0xc4, 0xdf, 0x20, 0xf3, 0xd8, 0x2f, 0xd0, 0x22, 0x87, 0x94,
-  0xc3, 0x64, 0x97, 0x87, 0x50, 0x14, 0xbc, 0x6c, 0xe0, 0xea, 0xe6, 0x93, 0x5d, 0xa8, 0x1a, 0x7a,
-  0x10, 0xf7, 0x96, 0xa9, 0x27, 0x91, 0x3c, 0x90, 0xee, 0xcd, 0x37, 0xa2, 0xf1, 0xb4, 0x6e, 0x61,
-  0xf3, 0x0e, 0xd0, 0x81, 0x96, 0x64, 0x01, 0x46, 0x92, 0x41, 0xee, 0xf6, 0x74, 0xa7, 0xa8, 0xad,
-  0x00, 0xbe, 0x81, 0x73, 0x82, 0xbe, 0x31, 0x40, 0x41, 0x4d, 0xf8, 0x12, 0x33, 0x47, 0xd8, 0x38,
-  0x8e, 0x40, 0x46, 0x68, 0xd5, 0x0f, 0x5a, 0xa4, 0x22, 0xcf, 0x2e, 0x6e, 0xab, 0x9d, 0x86, 0x81,
-  0x70, 0x4b, 0x90, 0x38, 0x95, 0xd8, 0xee, 0x59, 0xa2, 0xf6, 0x80, 0x95, 0x02, 0xa8, 0x4c, 0x0f,
-  0xbc, 0xc6, 0x70, 0x02, 0xc3, 0xa3, 0x9d, 0x3f, 0x41, 0xbe, 0x4a, 0xa5, 0x12, 0x21, 0xc1, 0x1e,
-  0x7d, 0x46, 0xbf, 0x61, 0xf6, 0x8d, 0x98, 0xba, 0x6d, 0xc6, 0x74, 0x0b, 0x73, 0x9a, 0xbb, 0xa4,
-  0xdd, 0xbc, 0xec, 0x6f, 0xd3, 0x17, 0xce, 0x4b, 0xb5, 0xc6, 0x7d, 0x75, 0x07, 0x7c, 0x93, 0x82,
-  0x11, 0xb1, 0xcb, 0xdd, 0x60, 0x89, 0xcb, 0x3c, 0xb4, 0x86, 0x8a, 0xe2, 0x88, 0x11, 0x81, 0x1b,
-  0xc0, 0xd0, 0x57, 0xe6, 0xef, 0xcb, 0xda, 0x70, 0x3a, 0x3a, 0x78, 0xf7, 0xee, 0x5d, 0x89, 0x0d,
-  0xeb, 0x75, 0x08, 0xe9, 0x88, 0x21, 0x17, 0xc8, 0x01, 0x11, 0x40, 0xbb, 0x43, 0xc9, 0x34, 0x61,
-  0x63, 0xa7, 0xb8, 0x56, 0x9a, 0x70, 0x35, 0x4d, 0x47, 0x75, 0x4f, 0x84, 0x8d, 0x8f, 0xcc, 0xff,
-  0xf0, 0x6c, 0x7e, 0xb1, 0x13, 0x87, 0xde, 0x12, 0x2f, 0xd9, 0xfe, 0x1c, 0x05, 0x34, 0x7a, 0xb0,
-  0x5d, 0xbd, 0xde, 0x69, 0x50, 0x77, 0x07, 0x8f, 0x1a, 0x3e, 0xf0, 0x18, 0x09, 0xee, 0x89, 0xf1,
-  0x9e, 0x84, 0xb3, 0x18, 0xc6, 0x88, 0x49, 0x13, 0xb3, 0xbc, 0xb0, 0xa2, 0x64, 0x5c, 0x0e, 0x8d,
-  0xfc, 0xe8, 0x79, 0x52, 0xab, 0x80, 0xfa, 0x3e, 0x66, 0xd9, 0x92, 0x06, 0xba, 0x67, 0x65, 0x0d,
-  0x58, 0x0b, 0x26, 0x6a, 0xb7, 0x9a, 0x25, 0x05, 0x68, 0x8a, 0x59, 0x48, 0x48, 0xe0, 0x06, 0x26,
-  0xbd, 0x12, 0xcd, 0x6f, 0xdf, 0x96, 0x0f, 0x19, 0xb9, 0x5a, 0x5b, 0xed, 0x32, 0x4d, 0xe3, 0xca,
-  0x7a, 0x18, 0x8c, 0x13, 0x2e, 0x12, 0xae, 0x5e, 0xca, 0x23, 0x46, 0xff, 0x8f, 0xb5, 0xa6, 0xda,
-  0x6f, 0x2e, 0xe3, 0x33, 0x84, 0x79, 0x77, 0x16, 0x66, 0x19, 0xa5, 0x2e, 0xba, 0x46, 0x39, 0x00,
-  0xdc, 0x2e, 0x97, 0x98, 0x76, 0xfc, 0x55, 0x91, 0x04, 0x7d, 0xda, 0x10, 0x44, 0x85, 0x6c, 0x37,
-  0xb8, 0x3a, 0xb7, 0x56, 0x41, 0xed, 0x17, 0x50, 0x5d, 0x00, 0x5b, 0x05, 0x75, 0x90, 0x97, 0xf3,
-  0x95, 0x11, 0xf9, 0x36, 0x87, 0x20, 0xbb, 0xe4, 0xeb, 0x94, 0x2b, 0xb6, 0x8a, 0xd4, 0x71, 0x01,
-  0x98, 0x55, 0xfa, 0x95, 0xac, 0xbd, 0x2b, 0x43, 0x6e, 0x22, 0x0d, 0x89, 0xc3, 0xd2, 0xe1, 0x46,
-  0xd6, 0x88, 0xd2, 0x46, 0xcd, 0x85, 0x21, 0x4b, 0x80, 0xda, 0x6a, 0x60, 0x2b, 0x4f, 0x47, 0xb6,
-  0x5b, 0x00, 0x7d, 0x5d, 0xa9, 0x69, 0xb0, 0x46, 0x1f, 0x5c, 0x95, 0xad, 0xca, 0x3a, 0x94, 0x58,
-  0x8b, 0xf1, 0xb5, 0xe2, 0xda, 0x96, 0xa1, 0x57, 0xed, 0xf9, 0xe1, 0x73, 0x03, 0x5c, 0xa7, 0x14,
-  0x69, 0xc6, 0xe3, 0x78, 0x34, 0x16, 0x18, 0x6e, 0xba, 0x1b, 0xbc, 0x83, 0xe2, 0x00, 0xd1, 0x56,
-  0x4e, 0x11, 0x77, 0x1b, 0x52, 0x58, 0x73, 0xc1, 0xf3, 0x48, 0x68, 0x3a, 0xa7, 0x0f, 0x22, 0xf1,
-  0xb0, 0x7e, 0x3c, 0x93, 0x51, 0xd1, 0x33, 0x6e, 0x48, 0x59, 0x1f, 0xf2, 0xd6, 0x26, 0x73, 0xc5,
-  0xa2, 0x62, 0x91, 0x09, 0x0d, 0x43, 0x4a, 0x3c, 0x91, 0x60, 0xdf, 0x05, 0xfa, 0xd8, 0x40, 0x68,
-  0x70, 0x95, 0x11, 0xca, 0x6b, 0x21, 0xc1, 0xfb, 0x01, 0x31, 0x1e, 0x83, 0x4a, 0x4b, 0xd2, 0x7d,
-  0xfd, 0xb4, 0x54, 0xba, 0xbd, 0xfd, 0x76, 0x3b, 0x0f, 0x2c, 0x7c, 0xb2, 0x66, 0x91, 0xb5, 0xa4,
-  0xe4, 0x9a, 0x2e, 0xec, 0x77, 0xc1, 0x41, 0xe2, 0x33, 0x68, 0x5b, 0xb0, 0x9a, 0x9b, 0xfe, 0x40,
-  0x17, 0x08, 0xac, 0x0f, 0xb7, 0x42, 0x03, 0xcd, 0xd2, 0xbb, 0xbe, 0x92, 0x77, 0x3b, 0x2c, 0xcc,
-  0x67, 0x70, 0x0f, 0x9b, 0xe3, 0x93, 0x5f, 0xc6, 0x14, 0xbf, 0x74, 0xdc, 0x61, 0x5b, 0x30, 0xe6,
-  0x49, 0xf8, 0x44, 0x13, 0x06, 0x4d, 0x22, 0x0f, 0x7c, 0xe2, 0x0b, 0x26, 0xb1, 0xbb, 0x02, 0xa3,
-  0x79, 0x41, 0xea, 0xb3, 0xac, 0xf9, 0x93, 0x69, 0x8c, 0x79, 0xa3, 0x6e, 0x4a, 0x04, 0x0b, 0xe7,
-  0x6a, 0xc5, 0xac, 0x3c, 0x99, 0xc3, 0xdd, 0xcb, 0x30, 0x0d, 0xa8, 0xca, 0x31, 0xcd, 0x87, 0x93,
-  0x0d, 0xba, 0x3c, 0xcb, 0xba, 0x15, 0xcb, 0xe0, 0xf0, 0xe8, 0x31, 0xbb, 0x98, 0xd3, 0xfb, 0x25,
-  0x64, 0xbc, 0xdc, 0x2e, 0x10, 0x7b, 0x5a, 0x81, 0x01, 0x8b, 0x26, 0x6a, 0x0a, 0x21, 0xbf, 0x5f,
-  0xd0, 0x91, 0x82, 0xb0, 0x8c, 0x11, 0xc3, 0x82, 0xc4, 0x1e, 0xcc, 0xa3, 0x41, 0x00, 0xed, 0x10,
-  0x43, 0xb1, 0xa5, 0x5a, 0xb4, 0xd2, 0xd9, 0xab, 0x32, 0x9a, 0x9b, 0x20, 0x4f, 0xd7, 0x79, 0x1a,
-  0x9c, 0xaf, 0x56, 0xba, 0xab, 0x86, 0x52, 0x51, 0xf4, 0x7e, 0xd9, 0x15, 0x52, 0xc9, 0x80, 0x5a,
-  0x49, 0x4b, 0x8c, 0xf0, 0xe6, 0x97, 0x77, 0xc7, 0xc7, 0xc7, 0xa7, 0xa4, 0x33, 0x72, 0x6f, 0x3e,
-  0xdf, 0xdd, 0x11, 0x1c, 0x53, 0xb0, 0x4f, 0xc6, 0xeb, 0x79, 0x82, 0xcc, 0x7a, 0x22, 0x8a, 0x30,
-  0x9d, 0x00, 0xf3, 0x20, 0x37, 0x4b, 0x22, 0x1a, 0x90, 0xa9, 0x90, 0x4a, 0xee, 0x98, 0x70, 0x42,
-  0x1b, 0x86, 0xf4, 0x85, 0xf0, 0x10, 0xaa, 0x84, 0xd2, 0xb2, 0x01, 0x43, 0x31, 0x34, 0xb5, 0x50,
-  0x8b, 0x23, 0xdd, 0xf0, 0x8f, 0xf5, 0xf5, 0x23, 0xd4, 0xcf, 0xd1, 0x1c, 0x87, 0x18, 0x3b, 0x64,
-  0xc4, 0x24, 0x16, 0x58, 0x09, 0xd9, 0x02, 0x86, 0x16, 0x6c, 0xbd, 0x48, 0x0a, 0x0d, 0x99, 0x88,
-  0x18, 0x62, 0x01, 0x2d, 0x78, 0x91, 0x2c, 0x31, 0xea, 0xa3, 0x50, 0xdd, 0x08, 0x3a, 0xba, 0xf6,
-  0x02, 0xab, 0x02, 0x5e, 0x8f, 0xec, 0x28, 0x38, 0x27, 0x78, 0xa9, 0x15, 0x8c, 0x82, 0xb3, 0x30,
-  0x78, 0xf6, 0xc9, 0xe5, 0xb0, 0x8f, 0x5c, 0x03, 0x95, 0x50, 0x8b, 0x85, 0x94, 0x91, 0x3d, 0x6c,
-  0x13, 0x51, 0xbc, 0xea, 0xd2, 0xf6, 0x17, 0xb5, 0x50, 0xf6, 0x6a, 0x5c, 0x2b, 0xac, 0xf1, 0x0f,
-  0xf8, 0xb4, 0xd6, 0xf4, 0x6b, 0x97, 0x9e, 0xb9, 0x33, 0x1e, 0xab, 0x0f, 0x75, 0xad, 0xac, 0xf9,
-  0xc6, 0xb7, 0x4d, 0x6d, 0xe9, 0x67, 0xe3, 0x7c, 0xe7, 0x89, 0x78, 0x60, 0xc9, 0x52, 0xa7, 0xcd,
-  0x6a, 0xe3, 0xcd, 0xf0, 0x95, 0xd7, 0x2e, 0xbb, 0x46, 0xbc, 0xf9, 0xdc, 0xff, 0x34, 0x58, 0x99,
-  0x18, 0xad, 0xe5, 0x97, 0x7e, 0x59, 0x67, 0x8c, 0x9a, 0xc8, 0x04, 0xf5, 0xc0, 0x4d, 0xa1, 0x10,
-  0x71, 0x1a, 0x80, 0x0d, 0x13, 0x34, 0x28, 0xb6, 0xd9, 0xd0, 0xa8, 0x81, 0x55, 0xa0, 0x65, 0x03,
-  0x6b, 0xa5, 0x38, 0xa1, 0x64, 0xf6, 0xc3, 0xdb, 0x70, 0x6d, 0xdf, 0x5b, 0x86, 0x20, 0xb9, 0xd1,
-  0x34, 0xa5, 0x18, 0x0e, 0x81, 0x4e, 0xdb, 0x27, 0x63, 0x81, 0xc8, 0x02, 0x36, 0x92, 0xdc, 0x3f,
-  0x76, 0x72, 0xf7, 0x82, 0x8e, 0x3e, 0x59, 0x88, 0x5a, 0xeb, 0x75, 0xd8, 0xde, 0x7c, 0xfe, 0x32,
-  0xbc, 0x1c, 0x2c, 0x28, 0xe1, 0xb0, 0x69, 0x58, 0xef, 0x67, 0x67, 0x94, 0xf4, 0x97, 0x1f, 0x3d,
-  0xd3, 0xe1, 0xe7, 0xfe, 0xd9, 0x70, 0x51, 0x8f, 0x47, 0x87, 0x86, 0xc4, 0x45, 0xc0, 0x51, 0xc4,
-  0x5e, 0x77, 0x4d, 0xe2, 0xb8, 0xf9, 0x7c, 0xd1, 0xeb, 0x1a, 0x25, 0x96, 0x39, 0xe8, 0xea, 0x74,
-  0x41, 0xee, 0x44, 0xcc, 0xbd, 0x75, 0x14, 0xba, 0xaf, 0x8c, 0xa8, 0x23, 0xf2, 0x0a, 0x6f, 0x57,
-  0x37, 0x63, 0x5f, 0x2d, 0x4f, 0x5c, 0xfd, 0x74, 0x04, 0xe3, 0xdd, 0xb4, 0x3c, 0xb5, 0x6f, 0x70,
-  0xbd, 0xf3, 0xac, 0x0f, 0x87, 0xae, 0xd9, 0xda, 0x38, 0x79, 0x12, 0x3d, 0x1e, 0x6d, 0x5b, 0xde,
-  0xc3, 0xbf, 0x94, 0x5a, 0x52, 0xd9, 0xb5, 0x3f, 0xe4, 0x85, 0x3d, 0xcb, 0x28, 0x18, 0xbe, 0x73,
-  0xb3, 0x7e, 0x39, 0x8a, 0x61, 0xe9, 0x9f, 0x0c, 0xe2, 0xf9, 0x5b, 0x85, 0x75, 0xb1, 0xac, 0x4b,
-  0x13, 0x9e, 0xad, 0xb5, 0xf3, 0x87, 0x48, 0xa1, 0x08, 0x44, 0x40, 0x1d, 0x32, 0x12, 0x3a, 0x36,
-  0x34, 0x0e, 0xfe, 0x84, 0x91, 0x5e, 0x5f, 0xe7, 0x28, 0x5c, 0x09, 0xb0, 0x93, 0x20, 0x26, 0xdc,
-  0xe0, 0x34, 0xbd, 0xf6, 0xeb, 0xd9, 0x08, 0x9a, 0x96, 0x5f, 0x31, 0xb5, 0xe9, 0xb2, 0x64, 0xb2,
-  0x23, 0x99, 0xc2, 0xd9, 0xa0, 0xdc, 0xba, 0x95, 0x4f, 0x9c, 0x7d, 0x01, 0x29, 0x1b, 0x39, 0x32,
-  0x44, 0x16, 0xc2, 0xf9, 0xfa, 0xe3, 0xda, 0x1e, 0x07, 0x66, 0x20, 0x97, 0x60, 0xcc, 0xbd, 0x94,
-  0x2e, 0xd6, 0xaf, 0x7b, 0xcb, 0xf1, 0x9a, 0xcd, 0x85, 0xee, 0x08, 0x9b, 0xa2, 0x4d, 0xf3, 0xca,
-  0x75, 0xdf, 0xf8, 0x09, 0xe4, 0x86, 0xa8, 0x06, 0x2e, 0x62, 0xe6, 0xf6, 0xb5, 0xae, 0x75, 0xad,
-  0x2f, 0xb8, 0x3e, 0x45, 0x8d, 0x4f, 0xe3, 0xf1, 0x86, 0x7b, 0xad, 0x6b, 0x68, 0xad, 0xc8, 0xdc,
-  0xe5, 0x1d, 0xd9, 0x7c, 0xe7, 0x76, 0x7d, 0x01, 0x28, 0xfa, 0xc6, 0x0e, 0xd9, 0x42, 0xc5, 0x9d,
-  0xe7, 0xf6, 0x38, 0x99, 0xbb, 0x7b, 0xcb, 0x80, 0x9b, 0xaf, 0x26, 0x9e, 0x59, 0x85, 0x5e, 0x9c,
-  0x53, 0xa0, 0x9d, 0x72, 0x49, 0xbd, 0xa4, 0xff, 0xd6, 0xab, 0x21, 0xec, 0xa7, 0xd0, 0xf7, 0x57,
-  0xb7, 0x07, 0x39, 0xb6, 0xb5, 0x06, 0xfd, 0x60, 0x33, 0xfa, 0x0c, 0x3b, 0x4f, 0xe2, 0x7d, 0x7d,
-  0x65, 0x87, 0xae, 0x16, 0xa7, 0x72, 0x1a, 0xf0, 0xe8, 0x21, 0x4f, 0x0b, 0x22, 0x9a, 0x73, 0x5f,
-  0x50, 0xf5, 0x18, 0x3f, 0x33, 0xaa, 0x29, 0x14, 0x69, 0x49, 0x1f, 0xb3, 0x2b, 0x1f, 0xfc, 0x24,
-  0x5e, 0xe4, 0x65, 0xab, 0xf2, 0x04, 0x56, 0xcf, 0x1a, 0x9f, 0x3c, 0xd9, 0x47, 0x93, 0x6a, 0xae,
-  0x78, 0xe8, 0x27, 0x55, 0x8a, 0x1e, 0x04, 0xe3, 0x66, 0x54, 0x30, 0xc7, 0xe3, 0xd9, 0xd0, 0x66,
-  0x82, 0x01, 0xe8, 0xea, 0x88, 0xc4, 0x0f, 0x8d, 0x00, 0x59, 0x34, 0x3c, 0x07, 0xee, 0x90, 0x25,
-  0x50, 0x64, 0x74, 0xd8, 0x9f, 0xd3, 0xd4, 0x27, 0x09, 0x34, 0x5f, 0xe5, 0xeb, 0x97, 0xf3, 0xee,
-  0xab, 0xb1, 0xb0, 0xd5, 0x6a, 0x63, 0xee, 0xc4, 0x3f, 0xcd, 0xe6, 0xca, 0x91, 0xef, 0xa0, 0x09,
-  0xd9, 0x1d, 0x7f, 0x57, 0xc3, 0x1c, 0x1e, 0x35, 0x61, 0x50, 0xc3, 0xdf, 0x66, 0x73, 0xe5, 0x80,
-  0x66, 0x62, 0x05, 0x7f, 0x57, 0x13, 0x6a, 0xbf, 0x3d, 0x42, 0x18, 0xf8, 0x5d, 0x43, 0xe8, 0xdd,
-  0x7e, 0x0b, 0x06, 0x2d, 0xfc, 0x5d, 0x4d, 0xa8, 0xd5, 0xd4, 0xa7, 0xe9, 0x3f, 0x6b, 0x48, 0xb5,
-  0x0c, 0x53, 0xad, 0x32, 0x57, 0x0b, 0xf3, 0x18, 0x24, 0xaf, 0xff, 0x30, 0x16, 0x63, 0x1b, 0x66,
-  0x54, 0x85, 0x99, 0x1d, 0xcb, 0x73, 0x2f, 0x8c, 0x13, 0xf1, 0x58, 0x27, 0x43, 0x01, 0x33, 0xc8,
-  0x48, 0xd0, 0xc4, 0x37, 0x1d, 0x21, 0x26, 0xcb, 0x2c, 0x31, 0x92, 0x29, 0x04, 0xa5, 0xb6, 0x47,
-  0x71, 0xf1, 0x88, 0xc5, 0x6a, 0xed, 0xa7, 0xd7, 0x9f, 0xf9, 0x8a, 0x6a, 0xcd, 0x7d, 0xa1, 0xc5,
-  0x2f, 0xc5, 0xf0, 0x07, 0xbf, 0x26, 0xe3, 0xa7, 0x65, 0xfc, 0x3f, 0x59, 0xff, 0x03, 0x7a, 0xb5,
-  0xbc, 0x3e, 0xa3, 0x25, 0x00, 0x00
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x13, 0xad, 0x5a, 0xeb, 0x53, 0xdb, 0xb8,
+  0x16, 0xff, 0xee, 0xbf, 0x42, 0x78, 0x67, 0xba, 0xc9, 0x12, 0xf2, 0x00, 0x42, 0x29, 0xc4, 0xee,
+  0x05, 0x42, 0x21, 0xf7, 0x16, 0x9a, 0x26, 0x74, 0xdb, 0x9d, 0xb9, 0x33, 0x3b, 0x8a, 0xad, 0x24,
+  0x02, 0xdb, 0xf2, 0x5a, 0x32, 0x8f, 0xe9, 0xf6, 0x7f, 0xbf, 0xe7, 0x48, 0xb6, 0x93, 0x98, 0xbc,
+  0x7a, 0x67, 0x3f, 0x34, 0xd8, 0x92, 0xce, 0xd1, 0xd1, 0x79, 0xfe, 0x8e, 0xdc, 0xce, 0x4e, 0xf7,
+  0xd3, 0xc5, 0xdd, 0x1f, 0xfd, 0x4b, 0x32, 0x55, 0x61, 0xe0, 0x76, 0xf0, 0x97, 0x04, 0x34, 0x9a,
+  0x38, 0x36, 0x8b, 0x6c, 0x78, 0x67, 0xd4, 0x77, 0x3b, 0x21, 0x53, 0x94, 0x44, 0x34, 0x64, 0x8e,
+  0xfd, 0xc8, 0xd9, 0x53, 0x2c, 0x12, 0x65, 0x13, 0x4f, 0x44, 0x8a, 0x45, 0xca, 0xb1, 0x9f, 0xb8,
+  0xaf, 0xa6, 0x4e, 0xbb, 0xd9, 0xb4, 0x5d, 0xcb, 0x2c, 0xb5, 0x4a, 0x73, 0x3e, 0x7b, 0xe4, 0x1e,
+  0xdb, 0xd3, 0x2f, 0x35, 0x1e, 0x71, 0xc5, 0x69, 0xb0, 0x27, 0x3d, 0x1a, 0x30, 0xa7, 0x55, 0x0b,
+  0xe9, 0x33, 0x0f, 0xd3, 0xb0, 0x78, 0x4f, 0x25, 0x4b, 0xf4, 0x0b, 0x1d, 0xc1, 0x7b, 0x24, 0x6c,
+  0x62, 0x95, 0xb6, 0xce, 0x04, 0xf2, 0xa6, 0x34, 0x91, 0x0c, 0x36, 0x49, 0xd5, 0x78, 0xef, 0x18,
+  0x46, 0x15, 0x57, 0x01, 0x73, 0x87, 0x2f, 0x91, 0x47, 0x86, 0x4c, 0x29, 0x1e, 0x4d, 0x64, 0xa7,
+  0x61, 0x06, 0x3b, 0xd2, 0x4b, 0x78, 0xac, 0x5c, 0xeb, 0x91, 0x26, 0x24, 0x10, 0x1e, 0x8f, 0x6b,
+  0xbe, 0xe3, 0x0b, 0x2f, 0x0d, 0x41, 0xcc, 0x1a, 0x0c, 0x38, 0x3b, 0xad, 0xd3, 0x71, 0x1a, 0x79,
+  0x8a, 0x8b, 0x88, 0x4c, 0x7a, 0x7e, 0x85, 0x55, 0xbf, 0x27, 0x4c, 0xa5, 0x49, 0x44, 0xfc, 0xfa,
+  0x84, 0xa9, 0xcb, 0x80, 0xe1, 0xd2, 0xf3, 0x17, 0x3d, 0xf5, 0xa3, 0x58, 0xaa, 0xc4, 0x64, 0x12,
+  0x30, 0x5c, 0x6d, 0x88, 0xea, 0x5e, 0x40, 0xa5, 0xfc, 0xc8, 0xa5, 0xaa, 0x67, 0x53, 0xf6, 0x94,
+  0xfb, 0xcc, 0xae, 0xd6, 0x70, 0xde, 0xbe, 0x15, 0xf6, 0xee, 0x9a, 0x45, 0x33, 0xbe, 0xd7, 0x95,
+  0xea, 0xf7, 0x27, 0x1e, 0xf9, 0xe2, 0xa9, 0x2e, 0x62, 0x16, 0xc1, 0x02, 0xa5, 0x62, 0x79, 0xd2,
+  0x68, 0x3c, 0x44, 0xa2, 0xfe, 0x14, 0x30, 0x14, 0xaa, 0xc1, 0x41, 0xcb, 0xc9, 0x98, 0x7a, 0x4c,
+  0x36, 0x52, 0x3f, 0xde, 0x8b, 0x84, 0xe2, 0x63, 0xce, 0x92, 0xc6, 0x3c, 0xa3, 0xf3, 0x32, 0xa3,
+  0x86, 0xcc, 0x74, 0x63, 0xd7, 0xec, 0x3f, 0x25, 0x0b, 0xc6, 0xf3, 0xab, 0xa9, 0x7f, 0x0f, 0xeb,
+  0x8f, 0x0e, 0xdb, 0x87, 0x8e, 0xe3, 0xd7, 0x87, 0xe3, 0x7a, 0xb7, 0x57, 0x7f, 0xa4, 0x41, 0xca,
+  0xde, 0xb7, 0xb2, 0x81, 0xcb, 0x2f, 0x66, 0xe0, 0xcd, 0x9b, 0xca, 0xc2, 0xbb, 0xd3, 0xac, 0x9e,
+  0xb4, 0xdb, 0x47, 0xc7, 0x25, 0x3a, 0x58, 0xd6, 0xcc, 0x87, 0xce, 0x16, 0x29, 0xf3, 0x77, 0xa7,
+  0x55, 0xad, 0x35, 0x37, 0x71, 0x6f, 0x55, 0xe7, 0xa4, 0x0c, 0x04, 0xf5, 0xff, 0x3d, 0xac, 0xb0,
+  0x9a, 0x72, 0x76, 0x9a, 0xd5, 0xef, 0x01, 0x53, 0x44, 0x00, 0xbd, 0x97, 0x30, 0xaa, 0x58, 0x66,
+  0xa9, 0x8a, 0x6d, 0x4c, 0x6e, 0x57, 0x4f, 0x45, 0x1d, 0x8e, 0x7c, 0xa6, 0x54, 0xc2, 0x47, 0xa9,
+  0x02, 0x5d, 0xcb, 0xc4, 0xb3, 0x6b, 0xac, 0x5a, 0x2b, 0x8f, 0xab, 0x97, 0x98, 0x81, 0x52, 0x14,
+  0x7b, 0x56, 0x8d, 0x7b, 0xfa, 0x48, 0x73, 0x06, 0xaf, 0x16, 0x52, 0x09, 0x3e, 0x66, 0xd7, 0x54,
+  0xb5, 0xe6, 0xd7, 0x47, 0xc2, 0x7f, 0xa9, 0xd3, 0x18, 0x54, 0xeb, 0x5f, 0x4c, 0x79, 0xe0, 0x57,
+  0x04, 0xae, 0xa7, 0xbe, 0x7f, 0xf9, 0x08, 0x52, 0xa0, 0x8d, 0x59, 0xc4, 0x92, 0x8a, 0x8d, 0x32,
+  0xdb, 0xb5, 0x4a, 0xd5, 0x71, 0xbf, 0x5f, 0x31, 0xf5, 0x7b, 0xa5, 0x5a, 0x03, 0x1f, 0xfd, 0x9d,
+  0x06, 0x95, 0xea, 0x8f, 0xe5, 0x04, 0x2c, 0x49, 0x44, 0x02, 0x72, 0x02, 0x01, 0x84, 0x93, 0x14,
+  0x01, 0xab, 0x07, 0x62, 0x52, 0xb1, 0x2f, 0x71, 0x9c, 0x64, 0x5a, 0x00, 0x3b, 0x92, 0x31, 0x0f,
+  0x98, 0x3e, 0x0f, 0xc4, 0x4f, 0x02, 0xe7, 0xfe, 0x98, 0x8d, 0x8b, 0x31, 0xc6, 0xe8, 0x98, 0x4f,
+  0xd2, 0x84, 0x6a, 0xb5, 0x99, 0xf3, 0x90, 0x31, 0xe5, 0xe8, 0x3f, 0xff, 0x8d, 0x7a, 0x91, 0x27,
+  0xc2, 0x18, 0xb4, 0xc7, 0x48, 0x4c, 0x27, 0x8c, 0xf8, 0x54, 0xd1, 0x1d, 0xf0, 0x86, 0x39, 0x4d,
+  0x7f, 0xb8, 0x00, 0x77, 0x18, 0x8b, 0xa4, 0x72, 0xef, 0x34, 0x4f, 0xef, 0x3b, 0xc7, 0xa7, 0xf7,
+  0xbb, 0xbb, 0x55, 0xed, 0xc9, 0x57, 0xf6, 0x6e, 0xe5, 0x7e, 0x17, 0xcc, 0x52, 0xf7, 0xa6, 0xcc,
+  0x7b, 0x60, 0xbe, 0x63, 0x86, 0x87, 0x76, 0xd5, 0x98, 0xcc, 0x75, 0xef, 0xdf, 0xb4, 0x8c, 0xd7,
+  0x0f, 0x56, 0xac, 0x1d, 0x2c, 0xac, 0x9d, 0xed, 0x7a, 0x85, 0xbb, 0x62, 0xa4, 0x82, 0x57, 0x81,
+  0x8d, 0x9b, 0x35, 0xe1, 0x40, 0x74, 0x96, 0xa4, 0x60, 0xbb, 0xce, 0x72, 0x41, 0x7e, 0x13, 0x35,
+  0x95, 0xcd, 0x0d, 0x96, 0xcc, 0x89, 0xdf, 0x9c, 0xfd, 0xd3, 0x92, 0xac, 0x0e, 0xab, 0x95, 0x24,
+  0x72, 0xd4, 0x4c, 0x9c, 0x61, 0xbf, 0x10, 0x67, 0xc1, 0xb7, 0x0d, 0x97, 0xe7, 0x18, 0x68, 0xa4,
+  0x7a, 0x01, 0xfb, 0xf8, 0x5c, 0xc6, 0x01, 0x7d, 0x71, 0x98, 0xdb, 0x7c, 0x6f, 0x47, 0x22, 0x62,
+  0xf6, 0x89, 0x3d, 0x82, 0xe4, 0xf2, 0x00, 0xe6, 0x71, 0x9b, 0x85, 0x4f, 0xf7, 0xf3, 0x4d, 0xe7,
+  0x14, 0x9d, 0x3b, 0xc3, 0x77, 0xf9, 0xc4, 0x95, 0x37, 0xad, 0xc4, 0x98, 0xdb, 0x7a, 0xe0, 0xc6,
+  0x0b, 0x24, 0xd5, 0xea, 0x77, 0x8f, 0x4a, 0x46, 0x30, 0xd0, 0x4e, 0x16, 0x64, 0x71, 0x70, 0xe8,
+  0x74, 0x04, 0x11, 0xf0, 0x70, 0xaa, 0x97, 0x60, 0x0c, 0x97, 0x96, 0xe0, 0xd0, 0xfc, 0x92, 0xc3,
+  0xe6, 0x61, 0x99, 0x0b, 0x0e, 0xfd, 0xc0, 0xf3, 0xd6, 0xd0, 0xf2, 0x73, 0xe2, 0x81, 0x64, 0x36,
+  0x3a, 0xda, 0x89, 0xed, 0x38, 0x59, 0x3a, 0x81, 0x83, 0x69, 0xbf, 0xaa, 0xc7, 0x89, 0x50, 0xc2,
+  0x13, 0x01, 0x1c, 0x50, 0x67, 0xd2, 0x66, 0xad, 0xa2, 0x53, 0xac, 0x83, 0x2b, 0x82, 0xa1, 0x12,
+  0x09, 0x78, 0x17, 0x26, 0xd1, 0x9e, 0x62, 0x21, 0x46, 0x82, 0xd7, 0x03, 0x9d, 0x55, 0xff, 0xfe,
+  0x3b, 0x5b, 0x06, 0xf4, 0x61, 0x0c, 0x8e, 0xfb, 0x01, 0xf8, 0x93, 0x1b, 0xe1, 0xb3, 0x3a, 0xe9,
+  0x07, 0x0c, 0x25, 0x64, 0x98, 0xe0, 0xc8, 0xd7, 0x8f, 0x97, 0x5d, 0xd2, 0xeb, 0x83, 0x6b, 0xd6,
+  0x16, 0x38, 0xca, 0x45, 0x8e, 0x35, 0xcd, 0xad, 0x5a, 0xc5, 0x55, 0x3a, 0x3f, 0x20, 0xfb, 0xf7,
+  0x3a, 0x71, 0x42, 0xde, 0xb4, 0x77, 0xf5, 0xf4, 0x89, 0x6d, 0x57, 0x77, 0x67, 0x39, 0xb0, 0x21,
+  0xeb, 0xf7, 0xf2, 0x7d, 0xec, 0x1c, 0xda, 0xb5, 0x9d, 0x56, 0xf5, 0x87, 0xd5, 0x69, 0x64, 0x85,
+  0xa2, 0xa3, 0x2d, 0xea, 0xfe, 0x8b, 0x87, 0x58, 0x72, 0x48, 0x9a, 0x04, 0x90, 0x37, 0xb4, 0x91,
+  0x3d, 0x29, 0x21, 0xa7, 0xc0, 0x42, 0xbd, 0xa0, 0xd3, 0x30, 0x25, 0x12, 0xd3, 0x00, 0x04, 0x25,
+  0xee, 0xec, 0xd8, 0xa0, 0x2d, 0x28, 0x47, 0xe0, 0xb0, 0xa1, 0x45, 0x38, 0xbc, 0xe3, 0xd3, 0x9f,
+  0xd2, 0xce, 0x4a, 0xe8, 0x70, 0x6c, 0x13, 0x28, 0x60, 0x53, 0x01, 0x33, 0xb1, 0x90, 0x50, 0x4a,
+  0x21, 0xbc, 0xd3, 0x51, 0xc8, 0xa1, 0x94, 0xa1, 0xe7, 0x03, 0xa9, 0xcf, 0x1f, 0x89, 0xae, 0x11,
+  0x8e, 0xad, 0x04, 0xa8, 0xe7, 0x29, 0x1b, 0xb3, 0xb2, 0xc1, 0x29, 0x0b, 0xe2, 0x73, 0x18, 0x83,
+  0x74, 0xa4, 0xb0, 0x08, 0x41, 0xe2, 0x72, 0x6c, 0xf3, 0x82, 0xdc, 0xbc, 0x80, 0x7b, 0x0f, 0x8e,
+  0x7d, 0x8d, 0xbc, 0xde, 0x77, 0x1a, 0x66, 0x02, 0x44, 0x05, 0x16, 0x05, 0x8d, 0xb5, 0x82, 0xe8,
+  0x1c, 0x89, 0xce, 0xa9, 0xf7, 0x30, 0xa3, 0x5b, 0xd8, 0xc5, 0x48, 0x6a, 0xbb, 0x43, 0xfa, 0xc8,
+  0x66, 0x4b, 0xa6, 0x09, 0xd4, 0x7e, 0xc3, 0x7f, 0xba, 0x6f, 0x4a, 0x30, 0xa8, 0x38, 0x8d, 0x41,
+  0x3d, 0xfb, 0x30, 0x74, 0xe0, 0x6a, 0x1b, 0x9e, 0x27, 0xa0, 0x1e, 0x70, 0x3d, 0x05, 0xc3, 0x07,
+  0xee, 0x97, 0x6e, 0x9f, 0xf4, 0x41, 0xb9, 0x27, 0xa4, 0xc3, 0xa3, 0x38, 0x55, 0x99, 0x7a, 0xbe,
+  0xf4, 0xed, 0x5c, 0xb8, 0x28, 0x0d, 0x47, 0x2c, 0x01, 0x6d, 0xf1, 0xc8, 0xb1, 0x5b, 0xf0, 0x97,
+  0x3e, 0x3b, 0xf6, 0x51, 0xbb, 0x7d, 0xd0, 0xb6, 0x73, 0xf5, 0xf8, 0xf0, 0x98, 0xb0, 0xbf, 0x52,
+  0x9e, 0x30, 0xb4, 0x42, 0xe2, 0xee, 0x47, 0xfe, 0x22, 0xd7, 0x0c, 0x3d, 0x7c, 0xd9, 0xb7, 0xc9,
+  0xff, 0xcf, 0x15, 0x8f, 0x60, 0xe9, 0x63, 0x4d, 0x12, 0x91, 0xc6, 0x52, 0x1f, 0x60, 0x41, 0x6c,
+  0x48, 0x26, 0xda, 0xd6, 0xf8, 0x77, 0x71, 0x1f, 0xed, 0x28, 0xc0, 0xd3, 0x24, 0x87, 0x13, 0x9d,
+  0x17, 0x5c, 0x62, 0x2d, 0x52, 0x0f, 0x32, 0xea, 0xc1, 0x56, 0xd4, 0x1d, 0x85, 0xe0, 0x88, 0x58,
+  0xd9, 0x64, 0x48, 0x93, 0x09, 0x8f, 0x4e, 0x9a, 0x84, 0xa6, 0x4a, 0xe0, 0x2c, 0x08, 0xac, 0x40,
+  0xf0, 0x06, 0xfe, 0xc0, 0xbf, 0x56, 0xf1, 0xb4, 0x5f, 0x3c, 0x1d, 0x14, 0x4f, 0x87, 0xc5, 0x53,
+  0xdb, 0x2a, 0x1e, 0x8f, 0x8a, 0xa7, 0xb7, 0xc5, 0xd3, 0xb1, 0x79, 0x6a, 0x68, 0xf6, 0x66, 0x8b,
+  0x21, 0x94, 0xbd, 0x93, 0x62, 0x41, 0xae, 0x71, 0x73, 0x02, 0x9d, 0x72, 0x47, 0xe2, 0x39, 0x3b,
+  0x59, 0x2b, 0xf7, 0x7f, 0x78, 0x72, 0xcb, 0x24, 0x4b, 0x29, 0xf6, 0x0b, 0xe8, 0x07, 0x8f, 0xdb,
+  0x91, 0x1c, 0x14, 0x9b, 0x1c, 0xbc, 0xa6, 0x58, 0x2e, 0xd7, 0x61, 0x41, 0x72, 0xb8, 0xe5, 0x26,
+  0xed, 0x99, 0x5c, 0xed, 0x2d, 0x49, 0x8e, 0x8a, 0x4d, 0x8e, 0xb6, 0x95, 0xeb, 0x6d, 0x41, 0xf2,
+  0x76, 0xcb, 0x4d, 0x8e, 0x67, 0x72, 0x1d, 0xe7, 0x24, 0xf3, 0xc6, 0x1a, 0x30, 0x8f, 0xf1, 0x47,
+  0x76, 0xb2, 0x0d, 0xb3, 0x41, 0xab, 0x60, 0x36, 0xd8, 0xd2, 0x5e, 0x83, 0xfd, 0x5c, 0xe2, 0xc1,
+  0xfe, 0x96, 0x87, 0x1c, 0x14, 0xf6, 0x1a, 0x1c, 0x6c, 0xb9, 0xc9, 0xe1, 0x4c, 0xae, 0x2d, 0xed,
+  0x35, 0x68, 0x17, 0x9b, 0xb4, 0xb7, 0x95, 0xab, 0xb0, 0xd7, 0xe0, 0x68, 0xcb, 0x4d, 0xde, 0xce,
+  0xe4, 0xda, 0xd2, 0x5e, 0x83, 0xe3, 0x62, 0x93, 0x45, 0x73, 0x35, 0x74, 0x74, 0x43, 0x42, 0x85,
+  0xc4, 0x53, 0xd8, 0x2c, 0x12, 0x4f, 0x09, 0x8d, 0x57, 0xf1, 0xcb, 0xf8, 0x40, 0x4d, 0x38, 0x4f,
+  0xf8, 0x64, 0xaa, 0x22, 0x26, 0x65, 0xad, 0xd3, 0xc8, 0x88, 0xac, 0xed, 0xa8, 0x2f, 0x6c, 0xf7,
+  0x42, 0x04, 0x22, 0x99, 0x11, 0xe6, 0x74, 0x14, 0x92, 0xea, 0x2a, 0x7d, 0x65, 0xc4, 0xdf, 0x6c,
+  0xf7, 0x72, 0x3c, 0x66, 0x9e, 0x92, 0x33, 0x6a, 0x4c, 0x9c, 0xeb, 0x76, 0x1c, 0x7e, 0x82, 0x96,
+  0x11, 0xa0, 0xcf, 0x04, 0x01, 0x3b, 0x11, 0x31, 0xa2, 0x09, 0x59, 0x23, 0xeb, 0x69, 0xae, 0x20,
+  0x79, 0x8e, 0x44, 0x1a, 0xf9, 0x12, 0xf9, 0x5b, 0x98, 0x81, 0x88, 0xe9, 0x7c, 0x0c, 0x1c, 0x91,
+  0x88, 0x8d, 0x7d, 0xc8, 0xdc, 0x9e, 0xc2, 0x16, 0x31, 0x9a, 0xb0, 0x93, 0x0d, 0x1c, 0xbb, 0xb6,
+  0xbb, 0x86, 0x55, 0x56, 0xfd, 0xe2, 0x04, 0x54, 0x4a, 0x00, 0x79, 0xf7, 0x06, 0x9b, 0xf8, 0x9d,
+  0xcf, 0xf3, 0x3b, 0x0b, 0xd8, 0x33, 0x5d, 0xe4, 0xba, 0x89, 0xfe, 0x6c, 0x9e, 0xbe, 0x0f, 0x4d,
+  0x05, 0x8f, 0x25, 0xb9, 0x4e, 0x59, 0x76, 0x9c, 0x9f, 0x63, 0x76, 0x3d, 0xcf, 0xec, 0x86, 0x7a,
+  0x89, 0xf8, 0x39, 0xfa, 0x9b, 0x8c, 0x1e, 0xab, 0x75, 0x0c, 0xb0, 0x00, 0x7a, 0x2d, 0xe8, 0x8b,
+  0x13, 0x1a, 0xc9, 0x90, 0x4b, 0xb9, 0xc0, 0x21, 0x2b, 0xb4, 0x83, 0xa5, 0x85, 0xb6, 0x99, 0x15,
+  0xda, 0x03, 0x78, 0xb0, 0x56, 0x96, 0x59, 0xed, 0x31, 0xe0, 0xf4, 0x23, 0x21, 0x54, 0x31, 0x05,
+  0x4d, 0x36, 0x81, 0x0e, 0x2b, 0x78, 0xc9, 0x14, 0x20, 0xeb, 0x9d, 0x06, 0x47, 0xcc, 0x51, 0x30,
+  0x92, 0x61, 0x60, 0xeb, 0x1a, 0xdd, 0x8b, 0xa4, 0xa2, 0x91, 0xc7, 0x08, 0xf6, 0x51, 0xba, 0x48,
+  0x5f, 0x46, 0xba, 0x54, 0xf2, 0x7c, 0x22, 0x80, 0x89, 0x95, 0x67, 0xce, 0x22, 0xf8, 0xf6, 0xa3,
+  0x39, 0xf4, 0x0d, 0x7d, 0x60, 0x44, 0x4d, 0xb9, 0x9c, 0x91, 0x43, 0x1d, 0xf6, 0xc4, 0x23, 0x4b,
+  0x90, 0xe9, 0x06, 0xd5, 0xdd, 0x9e, 0xe3, 0x85, 0x08, 0x48, 0x59, 0x16, 0x72, 0xc0, 0x68, 0xa0,
+  0x78, 0xc8, 0xb4, 0x7c, 0x59, 0x80, 0x13, 0xd4, 0x6f, 0x92, 0x4d, 0x6c, 0x92, 0x6f, 0x90, 0x79,
+  0xec, 0x17, 0x80, 0xc8, 0x21, 0xe5, 0xd0, 0xd9, 0xe5, 0x21, 0x14, 0x05, 0x2f, 0x1b, 0xa4, 0xba,
+  0xf9, 0x64, 0x17, 0xaa, 0x06, 0x0c, 0xe2, 0xde, 0x32, 0xf5, 0x24, 0x92, 0x07, 0xd2, 0xbd, 0xf9,
+  0x46, 0x34, 0x9d, 0xd6, 0x2d, 0x4c, 0xde, 0x01, 0x39, 0xf0, 0x92, 0x2c, 0xc0, 0x48, 0x32, 0xc4,
+  0xdd, 0x9e, 0x46, 0x8a, 0xda, 0x0a, 0xe0, 0x1b, 0xd8, 0x27, 0xe8, 0x1b, 0x03, 0x3c, 0xa8, 0x09,
+  0x5f, 0x62, 0xfa, 0x08, 0x1b, 0xdb, 0x11, 0xc8, 0x08, 0xad, 0xfa, 0x41, 0x8b, 0x54, 0xe4, 0xd9,
+  0xc5, 0x6d, 0xb5, 0xd3, 0x30, 0x2b, 0xdc, 0xd2, 0x4a, 0xec, 0x4a, 0x6c, 0xf7, 0x2c, 0x51, 0x7b,
+  0x20, 0x4a, 0xb1, 0xa8, 0xcc, 0x0f, 0xbc, 0xc6, 0x48, 0x02, 0xcd, 0xa3, 0x9d, 0x3f, 0x41, 0xbe,
+  0x4a, 0xa5, 0x12, 0x21, 0x41, 0x8c, 0x3e, 0xe3, 0xdf, 0x30, 0xf3, 0xe6, 0x98, 0x1a, 0x36, 0x63,
+  0xba, 0x85, 0x3e, 0xcd, 0x5d, 0x02, 0x37, 0x2f, 0xfb, 0xdb, 0xe0, 0xc2, 0xf9, 0x53, 0xad, 0x71,
+  0x5f, 0x8d, 0x80, 0x6f, 0x52, 0x30, 0x22, 0xa2, 0xdc, 0x0d, 0x96, 0xb8, 0xcc, 0x43, 0x6b, 0xa8,
+  0x28, 0xb6, 0x18, 0x11, 0xb8, 0x01, 0x34, 0x7d, 0x65, 0xf9, 0xbe, 0xac, 0x0d, 0xa7, 0xa3, 0x83,
+  0x77, 0xef, 0xde, 0x95, 0xc4, 0xb0, 0x5e, 0x87, 0x90, 0x8e, 0x18, 0x72, 0x81, 0x12, 0x10, 0x01,
+  0xbc, 0x3b, 0x94, 0x4c, 0x13, 0x36, 0x76, 0x8a, 0x6b, 0xa5, 0x09, 0x57, 0xd3, 0x74, 0x54, 0xf7,
+  0x44, 0xd8, 0xf8, 0xc8, 0xfc, 0x0f, 0xcf, 0xe6, 0x17, 0x91, 0x38, 0x60, 0x4b, 0xbc, 0x64, 0xfb,
+  0x73, 0x14, 0xd0, 0xe8, 0xc1, 0x76, 0xf5, 0x78, 0xa7, 0x41, 0xdd, 0x1d, 0xdc, 0x6a, 0xf8, 0xc0,
+  0x63, 0x64, 0xb8, 0x27, 0xc6, 0x7b, 0x12, 0xf6, 0x62, 0x18, 0x23, 0x26, 0x4d, 0xcc, 0xf2, 0xc2,
+  0x8a, 0x92, 0x71, 0x39, 0x34, 0xe7, 0xff, 0x90, 0xc0, 0x2b, 0xc1, 0x2b, 0x15, 0x52, 0x01, 0x37,
+  0x40, 0x94, 0xdd, 0x30, 0x8e, 0x83, 0x63, 0xd5, 0x0d, 0x5a, 0xfc, 0x90, 0x71, 0x41, 0xff, 0x95,
+  0x5a, 0x91, 0xd4, 0xf7, 0x31, 0x57, 0x97, 0xf4, 0xd8, 0x3d, 0x2b, 0xeb, 0xd1, 0x5a, 0x30, 0x74,
+  0xbb, 0xd5, 0x2c, 0xa9, 0x51, 0x73, 0xcc, 0x02, 0x4b, 0xc2, 0x99, 0xa0, 0x5f, 0x2c, 0xf1, 0xfc,
+  0xf6, 0x6d, 0x79, 0xab, 0x92, 0x1b, 0xa7, 0xd5, 0x2e, 0xf3, 0x34, 0xe7, 0xd2, 0x2d, 0x65, 0x9c,
+  0x70, 0x91, 0x70, 0xf5, 0x52, 0x6e, 0x54, 0xfa, 0x7f, 0xac, 0x35, 0xf8, 0x7e, 0x73, 0x99, 0x9c,
+  0x21, 0x74, 0xcd, 0xb3, 0x60, 0xcd, 0x38, 0x75, 0xd1, 0xc1, 0xca, 0x61, 0xe4, 0x76, 0xb9, 0xc4,
+  0xe4, 0xe5, 0xaf, 0x8a, 0x47, 0x40, 0x7b, 0x43, 0x38, 0x2a, 0xe4, 0xcc, 0xc1, 0xd5, 0xb9, 0xb5,
+  0x6a, 0xd5, 0x7e, 0xb1, 0xaa, 0x0b, 0xcb, 0x56, 0xad, 0x3a, 0xc8, 0x41, 0xc1, 0xca, 0xb8, 0x7e,
+  0x9b, 0xaf, 0x20, 0xbb, 0xe4, 0xeb, 0x94, 0x2b, 0xb6, 0x8a, 0xd5, 0x71, 0xb1, 0x30, 0xc3, 0x0b,
+  0x2b, 0x45, 0x7b, 0x57, 0x5e, 0xb9, 0x89, 0x35, 0xa4, 0x1f, 0x4b, 0x07, 0x2d, 0x59, 0x73, 0x94,
+  0x36, 0x6a, 0x2e, 0x0c, 0x59, 0x02, 0xdc, 0x56, 0x2f, 0xb6, 0xf2, 0xa4, 0x66, 0xbb, 0xc5, 0xa2,
+  0xaf, 0x2b, 0x35, 0x0d, 0xd6, 0xe8, 0x83, 0xab, 0xb2, 0x55, 0xb9, 0x8b, 0x12, 0x6b, 0x31, 0x4a,
+  0x57, 0x5c, 0xfe, 0x32, 0xf4, 0xaa, 0x3d, 0x3f, 0x7c, 0x6e, 0x80, 0xeb, 0x94, 0xe2, 0xd5, 0x78,
+  0x1c, 0x8f, 0xc6, 0x02, 0x83, 0x56, 0x63, 0xca, 0x3b, 0x28, 0x31, 0x10, 0xb3, 0xe5, 0x44, 0x73,
+  0xb7, 0x21, 0x11, 0x36, 0x17, 0x3c, 0x8f, 0x84, 0x06, 0x7f, 0x7d, 0x10, 0x89, 0x87, 0x55, 0xe8,
+  0x99, 0x8c, 0x0a, 0xe4, 0xb9, 0x29, 0x64, 0x73, 0x80, 0x94, 0xb9, 0x62, 0x51, 0xf7, 0xc8, 0x84,
+  0x86, 0x21, 0x25, 0x9e, 0x48, 0x10, 0xbd, 0x81, 0x3e, 0x36, 0x30, 0x1a, 0x5c, 0x65, 0x8c, 0xf2,
+  0x8a, 0x4a, 0xf0, 0x96, 0x41, 0x8c, 0xc7, 0xa0, 0xd2, 0xd2, 0xe9, 0xbe, 0x7e, 0x5a, 0x7a, 0xba,
+  0xbd, 0xfd, 0x76, 0x3b, 0x0f, 0x2c, 0x7c, 0xb2, 0x66, 0x91, 0xb5, 0xa4, 0x70, 0x1b, 0x2c, 0xf7,
+  0xbb, 0xe0, 0x70, 0xe2, 0x33, 0x00, 0x3f, 0x88, 0x09, 0x0c, 0xca, 0xd0, 0x65, 0x06, 0xab, 0xcc,
+  0xad, 0xd0, 0x8b, 0x66, 0x45, 0x42, 0x5f, 0xec, 0xbb, 0x1d, 0x16, 0xe6, 0x9d, 0xbc, 0x87, 0x10,
+  0xfb, 0xe4, 0x97, 0x31, 0xc5, 0xef, 0x25, 0x77, 0x08, 0x2e, 0xc6, 0x3c, 0x09, 0x9f, 0x68, 0xc2,
+  0x00, 0x6a, 0xf2, 0xc0, 0x27, 0xbe, 0x60, 0x12, 0x31, 0x1a, 0x18, 0xcd, 0x0b, 0x52, 0x9f, 0x65,
+  0x10, 0x52, 0xa6, 0x31, 0xe6, 0x8d, 0xba, 0x29, 0x34, 0x2c, 0x9c, 0xab, 0x38, 0xb3, 0x22, 0x67,
+  0x36, 0x77, 0x2f, 0xc3, 0x34, 0xa0, 0x2a, 0xa7, 0x34, 0x9f, 0x5f, 0x36, 0xe8, 0xf2, 0x2c, 0xc3,
+  0x3c, 0x96, 0xa1, 0xe1, 0xd1, 0x63, 0x76, 0xbd, 0xa7, 0xe7, 0x4b, 0xc4, 0x78, 0x45, 0x5e, 0x10,
+  0xf6, 0xb4, 0x02, 0x03, 0x16, 0x4d, 0xd4, 0x14, 0x42, 0x7e, 0xbf, 0xe0, 0x23, 0x05, 0x61, 0x99,
+  0x20, 0x46, 0x04, 0x89, 0x48, 0xce, 0xa3, 0x41, 0x00, 0xa0, 0x8a, 0xe1, 0xb1, 0xa5, 0x5a, 0xb4,
+  0xd2, 0xd9, 0xab, 0x62, 0x9c, 0x9b, 0x20, 0x4f, 0xd7, 0x79, 0x1a, 0x9c, 0xaf, 0x79, 0x1a, 0x9b,
+  0x43, 0xc1, 0x29, 0x10, 0x64, 0x76, 0x11, 0x55, 0x32, 0xa0, 0x56, 0xd2, 0x12, 0x23, 0xbc, 0xf9,
+  0xe5, 0xdd, 0xf1, 0xf1, 0xf1, 0x29, 0xe9, 0x8c, 0xdc, 0x9b, 0xcf, 0x77, 0x77, 0x04, 0x9b, 0x1d,
+  0x44, 0xdb, 0xba, 0x22, 0xa1, 0xb0, 0x9e, 0x88, 0x22, 0x4c, 0x27, 0x20, 0x3c, 0x9c, 0x9b, 0x25,
+  0x11, 0x0d, 0xc8, 0x54, 0x48, 0x25, 0x77, 0x4c, 0x38, 0xa1, 0x0d, 0x43, 0xfa, 0x42, 0x78, 0x08,
+  0x55, 0x42, 0xe9, 0xb3, 0x81, 0x40, 0x31, 0x40, 0x63, 0xa8, 0xe8, 0x91, 0x6e, 0x1b, 0xc6, 0xfa,
+  0x12, 0x13, 0xaa, 0xf0, 0x68, 0x4e, 0x42, 0x8c, 0x1d, 0x32, 0x62, 0x12, 0xcb, 0xb4, 0x84, 0x6c,
+  0x01, 0xad, 0x0f, 0x02, 0x38, 0x92, 0x02, 0xac, 0x13, 0x11, 0x43, 0x2a, 0xe0, 0x05, 0x2f, 0x92,
+  0x25, 0x46, 0x7d, 0x14, 0xaa, 0x1b, 0x41, 0x47, 0xd7, 0x5e, 0x60, 0x55, 0xc0, 0xeb, 0x51, 0x1c,
+  0x05, 0xfb, 0x04, 0x2f, 0xb5, 0x42, 0x50, 0x70, 0x16, 0x06, 0xcf, 0x3e, 0xb9, 0x1c, 0xf6, 0x51,
+  0x6a, 0xe0, 0x12, 0xea, 0x63, 0x21, 0x67, 0x14, 0x0f, 0xc1, 0xa6, 0x2e, 0xae, 0x4b, 0x41, 0x34,
+  0x6a, 0xa1, 0xec, 0xd5, 0x38, 0x56, 0x58, 0xe3, 0x1f, 0xf0, 0x69, 0xad, 0xe9, 0xd7, 0x2e, 0x3d,
+  0x73, 0x67, 0xdc, 0x56, 0x6f, 0xea, 0x5a, 0x19, 0x84, 0xc7, 0xb7, 0x4d, 0xe0, 0xf6, 0xb3, 0x71,
+  0xbe, 0xf3, 0x44, 0x3c, 0xb0, 0x64, 0xa9, 0xd3, 0x66, 0xb5, 0xf1, 0x66, 0xf8, 0xca, 0x6b, 0x97,
+  0x5d, 0x46, 0xde, 0x7c, 0xee, 0x7f, 0x1a, 0xac, 0x4c, 0x8c, 0xd6, 0xf2, 0xab, 0xc3, 0x0c, 0x5f,
+  0xa3, 0x26, 0xb2, 0x83, 0x7a, 0xe0, 0xa6, 0x50, 0x88, 0x38, 0x0d, 0xc0, 0x86, 0x09, 0x1a, 0x14,
+  0xc1, 0x3a, 0xc0, 0x3d, 0xb0, 0x0a, 0x00, 0x3f, 0xb0, 0x56, 0x8a, 0x7d, 0x4e, 0x66, 0x3f, 0xbc,
+  0x53, 0xd7, 0xf6, 0xbd, 0x65, 0xb8, 0x24, 0x37, 0x9a, 0xe6, 0x14, 0xc3, 0x26, 0x80, 0xd7, 0x7d,
+  0x32, 0x16, 0x48, 0x2c, 0x60, 0x22, 0xc9, 0xfd, 0x63, 0x27, 0x77, 0x2f, 0xe8, 0x0b, 0x92, 0x85,
+  0xa8, 0xb5, 0x5e, 0x87, 0xed, 0xcd, 0xe7, 0x2f, 0xc3, 0xcb, 0xc1, 0x82, 0x12, 0x0e, 0x9b, 0x46,
+  0xf4, 0x7e, 0xb6, 0x47, 0x49, 0x7f, 0xf9, 0xd6, 0x33, 0x1d, 0x7e, 0xee, 0x9f, 0x0d, 0x17, 0xf5,
+  0x78, 0x74, 0x68, 0x58, 0x5c, 0x04, 0x1c, 0x8f, 0xd8, 0xeb, 0xae, 0x49, 0x1c, 0x37, 0x9f, 0x2f,
+  0x7a, 0x5d, 0xa3, 0xc4, 0xb2, 0x04, 0x5d, 0x9d, 0x2e, 0xc8, 0x9d, 0x88, 0xb9, 0xb7, 0x8e, 0x43,
+  0xf7, 0x95, 0x11, 0x75, 0x44, 0x5e, 0xe1, 0x1d, 0xed, 0x66, 0xea, 0xab, 0xe5, 0x89, 0xab, 0x9f,
+  0x8e, 0xa0, 0x49, 0x9c, 0x96, 0x7b, 0xff, 0x0d, 0xae, 0x77, 0x9e, 0xa1, 0x79, 0xc0, 0xde, 0xd6,
+  0xc6, 0xfe, 0x95, 0xe8, 0x26, 0x6b, 0xdb, 0xf2, 0x1e, 0xfe, 0xa5, 0xd4, 0x92, 0xca, 0xae, 0xfd,
+  0x21, 0x2f, 0xec, 0x59, 0x46, 0xc1, 0xf0, 0x9d, 0xbb, 0x31, 0x28, 0x47, 0x31, 0x0c, 0xfd, 0x93,
+  0x41, 0x3c, 0x7f, 0x37, 0xb1, 0x2e, 0x96, 0x75, 0x69, 0xc2, 0xbd, 0xb5, 0x76, 0xfe, 0x10, 0x29,
+  0x14, 0x81, 0x08, 0xb8, 0x43, 0x46, 0x42, 0xc7, 0x06, 0xe0, 0xe0, 0x4f, 0x18, 0xe9, 0xf5, 0x75,
+  0x8e, 0xc2, 0x91, 0x00, 0x91, 0x04, 0x31, 0xe1, 0x06, 0xbb, 0xe9, 0xb1, 0x5f, 0xcf, 0x46, 0x00,
+  0x5a, 0x7e, 0xc5, 0xd4, 0xa6, 0xcb, 0x92, 0xc9, 0x8e, 0x64, 0x0a, 0x7b, 0x83, 0x72, 0xeb, 0x56,
+  0xde, 0xb7, 0xf6, 0x05, 0xa4, 0x6c, 0x94, 0xc8, 0x30, 0x59, 0x08, 0xe7, 0xeb, 0x8f, 0x6b, 0x31,
+  0x0e, 0x74, 0x52, 0x2e, 0xc1, 0x98, 0x7b, 0x29, 0x5d, 0xcf, 0x5f, 0xf7, 0x96, 0xd3, 0x35, 0x9b,
+  0x0b, 0xe8, 0x08, 0x41, 0xd1, 0xa6, 0xae, 0xe7, 0xba, 0x6f, 0xfc, 0x04, 0x72, 0x43, 0x54, 0x03,
+  0x17, 0x31, 0xdd, 0xff, 0x5a, 0xd7, 0xba, 0xd6, 0xd7, 0x64, 0x9f, 0xa2, 0xc6, 0xa7, 0xf1, 0x78,
+  0xc3, 0xed, 0xd8, 0x35, 0x40, 0x2b, 0x32, 0x77, 0x05, 0x48, 0x36, 0xdf, 0xdc, 0x5d, 0x5f, 0x00,
+  0x89, 0xbe, 0xf7, 0x43, 0xb1, 0x50, 0x71, 0xe7, 0xb9, 0x3d, 0x4e, 0xe6, 0x6e, 0xf0, 0xb2, 0xc5,
+  0xcd, 0x57, 0x1d, 0xcf, 0xac, 0x42, 0x2f, 0xf6, 0x29, 0x00, 0xa7, 0x5c, 0x52, 0x2f, 0xe9, 0xbf,
+  0xf5, 0xaa, 0x09, 0xfb, 0x29, 0xf2, 0xfd, 0xd5, 0xf0, 0x20, 0xa7, 0xb6, 0xd6, 0x90, 0x1f, 0x6c,
+  0x26, 0x9f, 0x51, 0xe7, 0x49, 0xbc, 0xaf, 0x2f, 0xfe, 0xd0, 0xd5, 0xe2, 0x54, 0x4e, 0x03, 0x1e,
+  0x3d, 0xe4, 0x69, 0x41, 0x44, 0x73, 0xee, 0x0b, 0xaa, 0x1e, 0xe3, 0xc7, 0x4a, 0x35, 0x85, 0x22,
+  0x2d, 0xe9, 0x63, 0x76, 0x71, 0x84, 0x1f, 0xd6, 0x8b, 0xbc, 0x6c, 0x55, 0x9e, 0xc0, 0xea, 0x19,
+  0xf0, 0xc9, 0x93, 0x7d, 0x34, 0xa9, 0xe6, 0x8a, 0x07, 0x3c, 0xa9, 0x52, 0xf4, 0x20, 0x68, 0x37,
+  0xa3, 0x42, 0x38, 0x1e, 0xcf, 0x9a, 0x36, 0x13, 0x0c, 0xc0, 0x57, 0x47, 0x24, 0x7e, 0xae, 0x84,
+  0x95, 0x05, 0xe0, 0x39, 0x70, 0x87, 0x2c, 0x81, 0x22, 0xa3, 0xc3, 0xfe, 0x9c, 0xa6, 0x3e, 0x49,
+  0x00, 0x7c, 0x95, 0x2f, 0x71, 0xce, 0xbb, 0xaf, 0xda, 0xc2, 0x56, 0xab, 0x8d, 0xb9, 0x13, 0xff,
+  0x34, 0x9b, 0x2b, 0x5b, 0xbe, 0x83, 0x26, 0x64, 0x77, 0xfc, 0x5d, 0xbd, 0xe6, 0xf0, 0xa8, 0x09,
+  0x8d, 0x1a, 0xfe, 0x36, 0x9b, 0x2b, 0x1b, 0x34, 0x13, 0x2b, 0xf8, 0xbb, 0x9a, 0x51, 0xfb, 0xed,
+  0x11, 0xae, 0x81, 0xdf, 0x35, 0x8c, 0xde, 0xed, 0xb7, 0xa0, 0xd1, 0xc2, 0xdf, 0xd5, 0x8c, 0x5a,
+  0x4d, 0xbd, 0x9b, 0xfe, 0xb3, 0x86, 0x55, 0xcb, 0x08, 0xd5, 0x2a, 0x4b, 0xb5, 0xd0, 0x8f, 0x41,
+  0xf2, 0xfa, 0x0f, 0x63, 0x31, 0xc2, 0x30, 0xa3, 0x2a, 0xcc, 0xec, 0x58, 0x9e, 0x7b, 0x61, 0x9c,
+  0x88, 0xc7, 0x3a, 0x19, 0x0a, 0xe8, 0x41, 0x46, 0x82, 0x26, 0xbe, 0x41, 0x84, 0x98, 0x2c, 0xb3,
+  0xc4, 0x48, 0xa6, 0x10, 0x94, 0xda, 0x1e, 0xc5, 0xf5, 0x25, 0x16, 0xab, 0xb5, 0x1f, 0x70, 0x7f,
+  0xe6, 0x5b, 0xac, 0x35, 0xf7, 0x9d, 0x17, 0xbf, 0x37, 0xc3, 0x1f, 0xfc, 0x26, 0x8d, 0x1f, 0xa8,
+  0xf1, 0x7f, 0x76, 0xfd, 0x0f, 0x38, 0x4c, 0xe2, 0xbe, 0xe9, 0x25, 0x00, 0x00
 };
 
 
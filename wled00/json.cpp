@@ -1,6 +1,7 @@
 #include "wled.h"
 
 #include "palettes.h"
+#include <memory>
 
 #define JSON_PATH_STATE      1
 #define JSON_PATH_INFO       2
@@ -9,6 +10,7 @@
 #define JSON_PATH_PALETTES   5
 #define JSON_PATH_FXDATA     6
 #define JSON_PATH_NETWORKS   7
+#define JSON_PATH_EFFECTS    8
 
 /*
  * JSON API (De)serialization
@@ -439,7 +441,149 @@ bool deserializeState(JsonObject root, byte callMode, byte presetId)
   return stateResponse;
 }
 
-void serializeSegment(JsonObject& root, Segment& seg, byte id, bool forPreset, bool segmentBounds)
+/*
+ * Streaming JSON writer
+ * Implements the subset of the ArduinoJson object/array API used by the serializers below, so the same code can
+ * either fill a JsonDocument or write directly to a Print (i.e. an HTTP response) without building a document.
+ * Members have to be written in order: writing to an object or array closes everything nested below it.
+ */
+#define JSON_STREAM_MAX_DEPTH 32 // levels for which the closing bracket is known
+
+class JsonStreamObject;
+class JsonStreamArray;
+
+class JsonStreamWriter {
+  public:
+    JsonStreamWriter(Print &out) : _out(out), _depth(0), _first(true), _objects(0) {}
+
+    JsonStreamObject beginObject();
+    JsonStreamArray  beginArray();
+    void end() { closeTo(0); }
+
+    // starts a nested object or array, returns its level
+    // (nesting is given by the writers below, at most 6 levels; deeper levels would be closed with ']')
+    uint8_t open(char c) {
+      _out.write(c);
+      if (_depth < JSON_STREAM_MAX_DEPTH) {
+        if (c == '{') _objects |= (1UL << _depth);
+        else          _objects &= ~(1UL << _depth);
+      } else {
+        DEBUG_PRINTLN(F("JSON stream nested too deep!"));
+      }
+      _depth++;
+      _first = true;
+      return _depth;
+    }
+    void element(uint8_t level) {
+      closeTo(level);
+      if (!_first) _out.write(',');
+      _first = false;
+    }
+    template<typename TKey> void key(uint8_t level, TKey k) {
+      element(level);
+      value(k);
+      _out.write(':');
+    }
+
+    void value(bool v)                            { _out.print(v ? F("true") : F("false")); }
+    void value(int v)                             { _out.print(v); }
+    void value(unsigned v)                        { _out.print(v); }
+    void value(long v)                            { _out.print(v); }
+    void value(unsigned long v)                   { _out.print(v); }
+    void value(const char *s)                     { if (s) string(s, false); else _out.print(F("null")); }
+    void value(const String &s)                   { string(s.c_str(), false); }
+    void value(const __FlashStringHelper *s)      { string(reinterpret_cast<const char *>(s), true); }
+    void value(JsonVariant v)                     { serializeJson(v, _out); }
+    void value(ARDUINOJSON_NAMESPACE::SerializedValue<const __FlashStringHelper*> v) { _out.print(v.data()); }
+    template<typename TChar> void value(ARDUINOJSON_NAMESPACE::SerializedValue<TChar*> v) { _out.write((const uint8_t*)v.data(), v.size()); }
+
+  private:
+    void closeTo(uint8_t level) {
+      while (_depth > level) {
+        _depth--;
+        _out.write((_depth < JSON_STREAM_MAX_DEPTH && (_objects & (1UL << _depth))) ? '}' : ']');
+        _first = false;
+      }
+    }
+    void string(const char *s, bool progmem) {
+      _out.write('"');
+      for (char c; (c = progmem ? pgm_read_byte(s) : *s); s++) {
+        switch (c) {
+          case '"':  _out.print(F("\\\"")); break;
+          case '\\': _out.print(F("\\\\")); break;
+          case '\n': _out.print(F("\\n"));  break;
+          case '\r': _out.print(F("\\r"));  break;
+          case '\t': _out.print(F("\\t"));  break;
+          default:
+            if ((uint8_t)c < 0x20) { char u[7]; sprintf_P(u, PSTR("\\u%04x"), c); _out.print(u); }
+            else _out.write(c);
+        }
+      }
+      _out.write('"');
+    }
+
+    Print  &_out;
+    uint8_t _depth;
+    bool    _first;   // no member written at current level yet
+    uint32_t _objects; // bit n set if level n+1 is an object
+};
+
+template<typename TKey> class JsonStreamMember {
+  public:
+    JsonStreamMember(JsonStreamWriter *w, uint8_t level, TKey k) : _w(w), _level(level), _key(k) {}
+    template<typename T> void operator=(T v) { _w->key(_level, _key); _w->value(v); }
+  private:
+    JsonStreamWriter *_w;
+    uint8_t _level;
+    TKey    _key;
+};
+
+class JsonStreamObject {
+  public:
+    JsonStreamObject(JsonStreamWriter *w, uint8_t level) : _w(w), _level(level) {}
+    template<typename TKey> JsonStreamMember<TKey> operator[](TKey k) { return JsonStreamMember<TKey>(_w, _level, k); }
+    template<typename TKey> JsonStreamObject createNestedObject(TKey k);
+    template<typename TKey> JsonStreamArray  createNestedArray(TKey k);
+  private:
+    JsonStreamWriter *_w;
+    uint8_t _level;
+};
+
+class JsonStreamArray {
+  public:
+    JsonStreamArray(JsonStreamWriter *w, uint8_t level) : _w(w), _level(level) {}
+    template<typename T> void add(T v) { _w->element(_level); _w->value(v); }
+    JsonStreamObject createNestedObject() { _w->element(_level); return JsonStreamObject(_w, _w->open('{')); }
+    JsonStreamArray  createNestedArray()  { _w->element(_level); return JsonStreamArray(_w, _w->open('[')); }
+  private:
+    JsonStreamWriter *_w;
+    uint8_t _level;
+};
+
+JsonStreamObject JsonStreamWriter::beginObject() { return JsonStreamObject(this, open('{')); }
+JsonStreamArray  JsonStreamWriter::beginArray()  { return JsonStreamArray(this, open('[')); }
+
+template<typename TKey> JsonStreamObject JsonStreamObject::createNestedObject(TKey k) { _w->key(_level, k); return JsonStreamObject(_w, _w->open('{')); }
+template<typename TKey> JsonStreamArray  JsonStreamObject::createNestedArray(TKey k)  { _w->key(_level, k); return JsonStreamArray(_w, _w->open('[')); }
+
+// usermods expect a JsonObject, streamed output uses a temporary document for their members
+static void addUsermodJson(JsonObject root, bool info)
+{
+  if (info) usermods.addToJsonInfo(root);
+  else      usermods.addToJsonState(root);
+}
+
+static void addUsermodJson(JsonStreamObject root, bool info)
+{
+  if (!usermods.getModCount()) return;
+  DynamicJsonDocument umDoc(JSON_STREAM_USERMOD_SIZE);
+  if (umDoc.capacity() == 0) return; // out of memory
+  JsonObject obj = umDoc.to<JsonObject>();
+  addUsermodJson(obj, info);
+  for (JsonPair kv : obj) root[kv.key().c_str()] = kv.value();
+}
+
+template<class TObject> static void writeSegment(TObject& root, Segment& seg, byte id, bool forPreset = false, bool segmentBounds = true)
 {
   root["id"] = id;
   if (segmentBounds) {
@@ -504,7 +648,12 @@ void serializeSegment(JsonObject& root, Segment& seg, byte id, bool forPreset, b
   root["m12"] = seg.map1D2D;
 }
 
-void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segmentBounds, bool selectedSegmentsOnly)
+void serializeSegment(JsonObject& root, Segment& seg, byte id, bool forPreset, bool segmentBounds)
+{
+  writeSegment(root, seg, id, forPreset, segmentBounds);
+}
+
+template<class TObject> static void writeState(TObject root, bool forPreset = false, bool includeBri = true, bool segmentBounds = true, bool selectedSegmentsOnly = false)
 {
   if (includeBri) {
     root["on"] = (bri > 0);
@@ -518,9 +667,9 @@ void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segme
     root["ps"] = (currentPreset > 0) ? currentPreset : -1;
     root[F("pl")] = currentPlaylist;
 
-    usermods.addToJsonState(root);
+    addUsermodJson(root, false);
 
-    JsonObject nl = root.createNestedObject("nl");
+    auto nl = root.createNestedObject("nl");
     nl["on"] = nightlightActive;
     nl["dur"] = nightlightDelayMins;
     nl["mode"] = nightlightMode;
@@ -531,7 +680,7 @@ void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segme
       nl[F("rem")] = -1;
     }
 
-    JsonObject udpn = root.createNestedObject("udpn");
+    auto udpn = root.createNestedObject("udpn");
     udpn["send"] = notifyDirect;
     udpn["recv"] = receiveNotifications;
 
@@ -540,11 +689,11 @@ void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segme
 
   root[F("mainseg")] = strip.getMainSegmentId();
 
-  JsonArray seg = root.createNestedArray("seg");
+  auto seg = root.createNestedArray("seg");
   for (size_t s = 0; s < strip.getMaxSegments(); s++) {
     if (s >= strip.getSegmentsNum()) {
       if (forPreset && segmentBounds && !selectedSegmentsOnly) { //disable segments not part of preset
-        JsonObject seg0 = seg.createNestedObject();
+        auto seg0 = seg.createNestedObject();
         seg0["stop"] = 0;
         continue;
       } else
@@ -553,25 +702,32 @@ void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segme
     Segment &sg = strip.getSegment(s);
     if (forPreset && selectedSegmentsOnly && !sg.isSelected()) continue;
     if (sg.isActive()) {
-      JsonObject seg0 = seg.createNestedObject();
-      serializeSegment(seg0, sg, s, forPreset, segmentBounds);
+      auto seg0 = seg.createNestedObject();
+      writeSegment(seg0, sg, s, forPreset, segmentBounds);
     } else if (forPreset && segmentBounds) { //disable segments not part of preset
-      JsonObject seg0 = seg.createNestedObject();
+      auto seg0 = seg.createNestedObject();
       seg0["stop"] = 0;
     }
   }
 }
 
-void serializeInfo(JsonObject root)
+void serializeState(JsonObject root, bool forPreset, bool includeBri, bool segmentBounds, bool selectedSegmentsOnly)
+{
+  writeState(root, forPreset, includeBri, segmentBounds, selectedSegmentsOnly);
+}
+
+template<class TObject> static void writeInfo(TObject root)
 {
   root[F("ver")] = versionString;
   root[F("vid")] = VERSION;
   //root[F("cn")] = WLED_CODENAME;
 
-  JsonObject leds = root.createNestedObject("leds");
+  auto leds = root.createNestedObject("leds");
   leds[F("count")] = strip.getLengthTotal();
   leds[F("pwr")] = strip.currentMilliamps;
   leds["fps"] = strip.getFps();
+  leds["rt"] = strip.getRenderTime(); // us spent rendering effects per frame
+  leds["st"] = strip.getShowTime();   // us spent in show() (power estimate + bus output) per frame
   leds[F("maxpwr")] = (strip.currentMilliamps)? strip.ablMilliampsMax : 0;
   leds[F("maxseg")] = strip.getMaxSegments();
   //leds[F("actseg")] = strip.getActiveSegmentsNum();
@@ -579,14 +735,14 @@ void serializeInfo(JsonObject root)
 
   #ifndef WLED_DISABLE_2D
   if (strip.isMatrix) {
-    JsonObject matrix = leds.createNestedObject("matrix");
+    auto matrix = leds.createNestedObject("matrix");
     matrix["w"] = Segment::maxWidth;
     matrix["h"] = Segment::maxHeight;
   }
   #endif
 
   uint8_t totalLC = 0;
-  JsonArray lcarr = leds.createNestedArray(F("seglc"));
+  auto lcarr = leds.createNestedArray(F("seglc"));
   size_t nSegs = strip.getSegmentsNum();
   for (size_t s = 0; s < nSegs; s++) {
     if (!strip.getSegment(s).isActive()) continue;
@@ -602,10 +758,10 @@ void serializeInfo(JsonObject root)
   leds["cct"]     = totalLC & 0x04;     // deprecated, use info.leds.lc
 
   #ifdef WLED_DEBUG
-  JsonArray i2c = root.createNestedArray(F("i2c"));
+  auto i2c = root.createNestedArray(F("i2c"));
   i2c.add(i2c_sda);
   i2c.add(i2c_scl);
-  JsonArray spi = root.createNestedArray(F("spi"));
+  auto spi = root.createNestedArray(F("spi"));
   spi.add(spi_mosi);
   spi.add(spi_sclk);
   spi.add(spi_miso);
@@ -613,6 +769,11 @@ void serializeInfo(JsonObject root)
 
   root[F("str")] = syncToggleReceive;
 
+  auto udp_info = root.createNestedObject(F("udp"));
+  udp_info[F("rx")] = udpPacketsReceived;
+  udp_info[F("drop")] = udpPacketsDropped;
+  udp_info[F("ovf")] = udpBudgetExhausted;
+
   root[F("name")] = serverDescription;
   root[F("udpport")] = udpPort;
   root["live"] = (bool)realtimeMode;
@@ -637,6 +798,27 @@ void serializeInfo(JsonObject root)
     root[F("lip")] = realtimeIP.toString();
   }
 
+  if (e131FrameSync) {
+    auto e131_info = root.createNestedObject(F("e131"));
+    e131_info[F("fc")] = e131FramesCommitted;
+    e131_info[F("fd")] = e131FramesDropped;
+    e131_info[F("lu")] = e131LateUniverses;
+  }
+
+  auto jlock = root.createNestedArray(F("jlock")); // JSON buffer lock wait time histogram
+  for (size_t i = 0; i < JSON_LOCK_WAIT_BUCKETS; i++) jlock.add(jsonLockWaits[i]);
+
+  auto sdata = root.createNestedObject(F("sdata")); // segment data arena (bytes)
+  uint16_t arenaFree = Segment::getArenaSize() - Segment::getArenaUsed();
+  uint16_t arenaLargest = Segment::getArenaLargestFree();
+  sdata["t"] = Segment::getArenaSize();
+  sdata["u"] = Segment::getArenaUsed();
+  sdata[F("pk")] = Segment::getArenaPeak();
+  sdata[F("lf")] = arenaLargest;
+  sdata[F("frag")] = arenaFree > arenaLargest ? 100 - (100 * arenaLargest) / arenaFree : 0; // %
+  sdata[F("hp")] = Segment::getArenaHeapAllocs();
+  sdata[F("cmp")] = Segment::getArenaCompactions();
+
   #ifdef WLED_ENABLE_WEBSOCKETS
   root[F("ws")] = ws.count();
   #else
@@ -647,10 +829,10 @@ void serializeInfo(JsonObject root)
   root[F("palcount")] = strip.getPaletteCount();
   root[F("cpalcount")] = strip.customPalettes.size(); //number of custom palettes
 
-  JsonArray ledmaps = root.createNestedArray(F("maps"));
+  auto ledmaps = root.createNestedArray(F("maps"));
   for (size_t i=0; i<WLED_MAX_LEDMAPS; i++) {
     if ((ledMaps>>i) & 0x00000001U) {
-      JsonObject ledmaps0 = ledmaps.createNestedObject();
+      auto ledmaps0 = ledmaps.createNestedObject();
       ledmaps0["id"] = i;
       #ifndef ESP8266
       if (i && ledmapNames[i-1]) ledmaps0["n"] = ledmapNames[i-1];
@@ -658,14 +840,18 @@ void serializeInfo(JsonObject root)
     }
   }
 
-  JsonObject wifi_info = root.createNestedObject("wifi");
+  auto wifi_info = root.createNestedObject("wifi");
   wifi_info[F("bssid")] = WiFi.BSSIDstr();
   int qrssi = WiFi.RSSI();
   wifi_info[F("rssi")] = qrssi;
   wifi_info[F("signal")] = getSignalQuality(qrssi);
   wifi_info[F("channel")] = WiFi.channel();
+  #if defined(ARDUINO_ARCH_ESP32) && defined(WLED_DEBUG)
+  wifi_info[F("txPower")] = (int) WiFi.getTxPower();
+  wifi_info[F("sleep")] = (bool) WiFi.getSleep();
+  #endif
 
-  JsonObject fs_info = root.createNestedObject("fs");
+  auto fs_info = root.createNestedObject("fs");
   fs_info["u"] = fsBytesUsed / 1000;
   fs_info["t"] = fsBytesTotal / 1000;
   fs_info[F("pmt")] = presetsModifiedTime;
@@ -673,10 +859,6 @@ void serializeInfo(JsonObject root)
   root[F("ndc")] = nodeListEnabled ? (int)Nodes.size() : -1;
 
   #ifdef ARDUINO_ARCH_ESP32
-  #ifdef WLED_DEBUG
-    wifi_info[F("txPower")] = (int) WiFi.getTxPower();
-    wifi_info[F("sleep")] = (bool) WiFi.getSleep();
-  #endif
   #if !defined(CONFIG_IDF_TARGET_ESP32C2) && !defined(CONFIG_IDF_TARGET_ESP32C3) && !defined(CONFIG_IDF_TARGET_ESP32S2) && !defined(CONFIG_IDF_TARGET_ESP32S3)
     root[F("arch")] = "esp32";
   #else
@@ -705,7 +887,7 @@ void serializeInfo(JsonObject root)
   #endif
   root[F("uptime")] = millis()/1000 + rolloverMillis*4294967;
 
-  usermods.addToJsonInfo(root);
+  addUsermodJson(root, true);
 
   uint16_t os = 0;
   #ifdef WLED_DEBUG
@@ -750,6 +932,11 @@ void serializeInfo(JsonObject root)
   root["ip"] = s;
 }
 
+void serializeInfo(JsonObject root)
+{
+  writeInfo(root);
+}
+
 void setPaletteColors(JsonArray json, CRGBPalette16 palette)
 {
     for (int i = 0; i < 16; i++) {
@@ -944,7 +1131,7 @@ void serializeNodes(JsonObject root)
 }
 
 // deserializes mode data string into JsonArray
-void serializeModeData(JsonArray fxdata)
+template<class TArray> static void writeModeData(TArray fxdata)
 {
   char lineBuffer[128];
   for (size_t i = 0; i < strip.getModeCount(); i++) {
@@ -959,7 +1146,8 @@ void serializeModeData(JsonArray fxdata)
 
 // deserializes mode names string into JsonArray
 // also removes effect data extensions (@...) from deserialised names
-void serializeModeNames(JsonArray arr) {
+template<class TArray> static void writeModeNames(TArray arr)
+{
   char lineBuffer[128];
   for (size_t i = 0; i < strip.getModeCount(); i++) {
     strncpy_P(lineBuffer, strip.getModeData(i), 127);
@@ -971,6 +1159,113 @@ void serializeModeNames(JsonArray arr) {
   }
 }
 
+static void writeJsonPath(Print &out, byte subJson)
+{
+  JsonStreamWriter writer(out);
+  switch (subJson)
+  {
+    case JSON_PATH_STATE:
+      writeState(writer.beginObject()); break;
+    case JSON_PATH_INFO:
+      writeInfo(writer.beginObject()); break;
+    case JSON_PATH_FXDATA:
+      writeModeData(writer.beginArray()); break;
+    case JSON_PATH_EFFECTS:
+      writeModeNames(writer.beginArray()); break; // remove WLED-SR extensions from effect names
+    default: //all
+      JsonStreamObject root = writer.beginObject();
+      writeState(root.createNestedObject("state"));
+      writeInfo(root.createNestedObject("info"));
+      if (subJson != JSON_PATH_STATE_INFO)
+      {
+        writeModeNames(root.createNestedArray(F("effects"))); // remove WLED-SR extensions from effect names
+        root[F("palettes")] = serialized((const __FlashStringHelper*)JSON_palette_names);
+      }
+  }
+  writer.end();
+}
+
+// effect names and data only change when effects are added, their responses are generated once and
+// revalidated using an ETag derived from the content; ESP32 also keeps the content to serve it from RAM
+class JsonCachePrint : public Print {
+  public:
+    size_t   size = 0;
+    uint32_t hash = 2166136261UL; // FNV-1a
+    char    *buf  = nullptr;      // copy of the output if not nullptr
+    size_t write(uint8_t c) override {
+      if (buf) buf[size] = c;
+      size++;
+      hash = (hash ^ c) * 16777619UL;
+      return 1;
+    }
+    size_t write(const uint8_t *data, size_t len) override {
+      for (size_t i = 0; i < len; i++) write(data[i]);
+      return len;
+    }
+};
+
+typedef struct {
+  uint32_t hash;
+  size_t   len;
+  std::shared_ptr<char> data; // responses keep a reference, so regenerating never frees a buffer being sent
+  uint8_t  rev;   // strip.getModeRevision() when generated
+  bool     valid;
+} json_cache_t;
+
+static json_cache_t modeDataCache[2]; // JSON_PATH_FXDATA, JSON_PATH_EFFECTS
+
+static void serveModeDataCached(AsyncWebServerRequest* request, byte subJson)
+{
+  json_cache_t &cache = modeDataCache[subJson == JSON_PATH_EFFECTS];
+  if (!cache.valid || cache.rev != strip.getModeRevision()) {
+    cache.data.reset(); // freed once no response uses it
+    JsonCachePrint out;
+    writeJsonPath(out, subJson);
+    cache.hash = out.hash;
+    cache.len  = out.size;
+    #ifndef ESP8266
+    out.buf = (char*)malloc(cache.len);
+    if (out.buf) {
+      out.size = 0;
+      writeJsonPath(out, subJson);
+      cache.data = std::shared_ptr<char>(out.buf, free);
+    }
+    #endif
+    cache.rev = strip.getModeRevision();
+    cache.valid = true;
+  }
+
+  if (handleIfNoneMatchCacheHeader(request, cache.hash)) return;
+
+  AsyncWebServerResponse *response;
+  if (cache.data) {
+    std::shared_ptr<char> data = cache.data;
+    size_t len = cache.len;
+    response = request->beginResponse("application/json", len, [data, len](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+      size_t n = (index < len) ? MIN(maxLen, len - index) : 0;
+      memcpy(buffer, data.get() + index, n);
+      return n;
+    });
+  } else {
+    AsyncResponseStream *stream = request->beginResponseStream("application/json", cache.len);
+    writeJsonPath(*stream, subJson);
+    response = stream;
+  }
+  setStaticContentCacheHeaders(response, cache.hash);
+  request->send(response);
+}
+
+// read-only requests are serialized without the JSON buffer (lock) into the response buffer
+// segments are read under strip lock, the response is generated once so it is consistent
+static void serveJsonStream(AsyncWebServerRequest* request, byte subJson)
+{
+  AsyncResponseStream *response = request->beginResponseStream("application/json");
+  strip.lock();
+  writeJsonPath(*response, subJson);
+  strip.unlock();
+  request->send(response);
+}
+
 void serveJson(AsyncWebServerRequest* request)
 {
   byte subJson = 0;
@@ -988,20 +1283,7 @@ void serveJson(AsyncWebServerRequest* request)
     return;
   }
   #endif
-  else if (url.indexOf(F("eff")) > 0) {
-    // this serves just effect names without FX data extensions in names
-    if (requestJSONBufferLock(19)) {
-      AsyncJsonResponse* response = new AsyncJsonResponse(&doc, true);  // array document
-      JsonArray lDoc = response->getRoot();
-      serializeModeNames(lDoc); // remove WLED-SR extensions from effect names
-      response->setLength();
-      request->send(response);
-      releaseJSONBufferLock();
-    } else {
-      request->send(503, "application/json", F("{\"error\":3}"));
-    }
-    return;
-  }
+  else if (url.indexOf(F("eff")) > 0) subJson = JSON_PATH_EFFECTS; // just effect names without FX data extensions
   else if (url.indexOf("pal") > 0) {
     request->send_P(200, "application/json", JSON_palette_names);
     return;
@@ -1014,40 +1296,31 @@ void serveJson(AsyncWebServerRequest* request)
     return;
   }
 
+  if (subJson == JSON_PATH_FXDATA || subJson == JSON_PATH_EFFECTS) {
+    serveModeDataCached(request, subJson);
+    return;
+  }
+  if (subJson != JSON_PATH_NODES && subJson != JSON_PATH_PALETTES && subJson != JSON_PATH_NETWORKS) {
+    serveJsonStream(request, subJson);
+    return;
+  }
+
   if (!requestJSONBufferLock(17)) {
     request->send(503, "application/json", F("{\"error\":3}"));
     return;
   }
-  AsyncJsonResponse *response = new AsyncJsonResponse(&doc, subJson==6);
+  AsyncJsonResponse *response = new AsyncJsonResponse(&doc);
 
   JsonVariant lDoc = response->getRoot();
 
   switch (subJson)
   {
-    case JSON_PATH_STATE:
-      serializeState(lDoc); break;
-    case JSON_PATH_INFO:
-      serializeInfo(lDoc); break;
     case JSON_PATH_NODES:
       serializeNodes(lDoc); break;
     case JSON_PATH_PALETTES:
       serializePalettes(lDoc, request); break;
-    case JSON_PATH_FXDATA:
-      serializeModeData(lDoc.as<JsonArray>()); break;
     case JSON_PATH_NETWORKS:
       serializeNetworks(lDoc); break;
-    default: //all
-      JsonObject state = lDoc.createNestedObject("state");
-      serializeState(state);
-      JsonObject info = lDoc.createNestedObject("info");
-      serializeInfo(info);
-      if (subJson != JSON_PATH_STATE_INFO)
-      {
-        JsonArray effects = lDoc.createNestedArray(F("effects"));
-        serializeModeNames(effects); // remove WLED-SR extensions from effect names
-        lDoc[F("palettes")] = serialized((const __FlashStringHelper*)JSON_palette_names);
-      }
-      //lDoc["m"] = lDoc.memoryUsage(); // JSON buffer usage, for remote debugging
   }
 
   DEBUG_PRINTF("JSON buffer size: %u for request: %d\n", lDoc.memoryUsage(), subJson);
@@ -1079,12 +1352,13 @@ bool serveLiveLeds(AsyncWebServerRequest* request, uint32_t wsClient)
 
   for (size_t i= 0; i < used; i += n)
   {
-    uint32_t c = strip.getPixelColor(i);
-    uint8_t r = qadd8(W(c), R(c)); //add white channel to RGB channels as a simple RGBW -> RGB map
-    uint8_t g = qadd8(W(c), G(c));
-    uint8_t b = qadd8(W(c), B(c));
-    olen += sprintf(obuf + olen, "\"%06X\",", RGBW32(r,g,b,0));
+    uint32_t c = strip.getPixelColorAvg(i, n); //average of the n LEDs, white already added to RGB
+    obuf[olen++] = '"';
+    for (int8_t s = 20; s >= 0; s -= 4) obuf[olen++] = "0123456789ABCDEF"[(c >> s) & 0xF];
+    obuf[olen++] = '"';
+    obuf[olen++] = ',';
   }
+  obuf[olen] = '\0';
   olen -= 1;
   oappend((const char*)F("],\"n\":"));
   oappendi(n);
@@ -294,5 +294,5 @@ void handleNightlight()
 //utility for FastLED to use our custom timer
 uint32_t get_millisecond_timer()
 {
-  return strip.now;
+  return strip.now + strip.renderContext().timeOffset;
 }
@@ -86,11 +86,12 @@ void onMqttMessage(char* topic, char* payload, AsyncMqttClientMessageProperties
 
   //Prefix is stripped from the topic at this point
 
+  strip.lock(); // strip lock has to be acquired before JSON buffer lock
   if (strcmp_P(topic, PSTR("/col")) == 0) {
     colorFromDecOrHexString(col, (char*)payloadStr);
     colorUpdated(CALL_MODE_DIRECT_CHANGE);
   } else if (strcmp_P(topic, PSTR("/api")) == 0) {
-    if (!requestJSONBufferLock(15)) { delete[] payloadStr; return; }
+    if (!requestJSONBufferLock(15)) { strip.unlock(); delete[] payloadStr; return; }
     if (payload[0] == '{') { //JSON API
       deserializeJson(doc, payloadStr);
       deserializeState(doc.as<JsonObject>());
@@ -107,6 +108,7 @@ void onMqttMessage(char* topic, char* payload, AsyncMqttClientMessageProperties
     // topmost topic (just wled/MAC)
     parseMQTTBriPayload(payloadStr);
   }
+  strip.unlock();
   delete[] payloadStr;
 }
 
@@ -109,6 +109,7 @@ void initPresetsFile()
   }
   serializeJson(doc, f);
   f.close();
+  invalidateObjectIndex();
 }
 
 bool applyPreset(byte index, byte callMode)
@@ -59,6 +59,11 @@ typedef struct ip_addr ip4_addr_t;
 #define ARTNET_OPCODE_OPDMX 0x5000
 #define ARTNET_OPCODE_OPPOLL 0x2000
 #define ARTNET_OPCODE_OPPOLLREPLY 0x2100
+#define ARTNET_OPCODE_OPSYNC 0x5200
+
+// E1.31 synchronization packet (E1.31: 6.3)
+#define E131_VECTOR_ROOT_EXTENDED 0x00000008
+#define E131_VECTOR_EXTENDED_SYNC 0x00000001
 
 #define P_E131   0
 #define P_ARTNET 1
@@ -77,6 +82,7 @@ typedef struct ip_addr ip4_addr_t;
 #define E131_FRAME_SOURCE 44
 #define E131_FRAME_PRIORITY 108
 #define E131_FRAME_RESERVED 109
+#define E131_FRAME_SYNC_ADDR 109 // E1.31-2016 uses the reserved field as synchronization address
 #define E131_FRAME_SEQ 111
 #define E131_FRAME_OPT 112
 #define E131_FRAME_UNIVERSE 113
@@ -89,6 +95,10 @@ typedef struct ip_addr ip4_addr_t;
 #define E131_DMP_COUNT 123
 #define E131_DMP_DATA 125
 
+#define E131_SYNC_SEQ 44
+#define E131_SYNC_ADDR 45
+#define E131_SYNC_PACKET_SIZE 49
+
 // E1.31 Packet Structure
 typedef union {
     struct { //E1.31 packet
@@ -105,7 +115,7 @@ typedef union {
       uint32_t frame_vector;
       uint8_t  source_name[64];
       uint8_t  priority;
-      uint16_t reserved;
+      uint16_t sync_address; // reserved before E1.31-2016
       uint8_t  sequence_number;
       uint8_t  options;
       uint16_t universe;
@@ -132,6 +142,15 @@ typedef union {
     uint8_t  art_data[512];
   } __attribute__((packed));
 
+  struct { //E1.31 synchronization packet
+    uint8_t  sync_root_layer[38];
+    uint16_t sync_flength;
+    uint32_t sync_vector;
+    uint8_t  sync_sequence_number;
+    uint16_t sync_universe;
+    uint16_t sync_reserved;
+  } __attribute__((packed));
+
   struct { //DDP Header
     uint8_t flags;
     uint8_t sequenceNum;
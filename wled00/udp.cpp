@@ -202,6 +202,8 @@ void exitRealtime() {
 
 #define TMP2NET_OUT_PORT 65442
 
+static bool udpShowPending = false; // realtime data received, show once all pending packets are handled
+
 void sendTPM2Ack() {
   notifierUdp.beginPacket(notifierUdp.remoteIP(), TMP2NET_OUT_PORT);
   uint8_t response_ack = 0xac;
@@ -210,63 +212,34 @@ void sendTPM2Ack() {
 }
 
 
-void handleNotifications()
+//hyperion / raw RGB
+static void handleRgbPacket(size_t packetSize)
 {
-  IPAddress localIP;
-
-  //send second notification if enabled
-  if(udpConnected && (notificationCount < udpNumRetries) && ((millis()-notificationSentTime) > 250)){
-    notify(notificationSentCallMode,true);
-  }
-
-  if (e131NewData && millis() - strip.getLastShow() > 15)
-  {
-    e131NewData = false;
-    strip.show();
-  }
-
-  //unlock strip when realtime UDP times out
-  if (realtimeMode && millis() > realtimeTimeout) exitRealtime();
-
-  //receive UDP notifications
-  if (!udpConnected) return;
-
-  bool isSupp = false;
-  size_t packetSize = notifierUdp.parsePacket();
-  if (!packetSize && udp2Connected) {
-    packetSize = notifier2Udp.parsePacket();
-    isSupp = true;
-  }
-
-  //hyperion / raw RGB
-  if (!packetSize && udpRgbConnected) {
-    packetSize = rgbUdp.parsePacket();
-    if (packetSize) {
-      if (!receiveDirect) return;
-      if (packetSize > UDP_IN_MAXSIZE || packetSize < 3) return;
-      realtimeIP = rgbUdp.remoteIP();
-      DEBUG_PRINTLN(rgbUdp.remoteIP());
-      uint8_t lbuf[packetSize];
-      rgbUdp.read(lbuf, packetSize);
-      realtimeLock(realtimeTimeoutMs, REALTIME_MODE_HYPERION);
-      if (realtimeOverride && !(realtimeMode && useMainSegmentOnly)) return;
-      uint16_t id = 0;
-      uint16_t totalLen = strip.getLengthTotal();
-      for (size_t i = 0; i < packetSize -2; i += 3)
-      {
-        setRealtimePixel(id, lbuf[i], lbuf[i+1], lbuf[i+2], 0);
-        id++; if (id >= totalLen) break;
-      }
-      if (!(realtimeMode && useMainSegmentOnly)) strip.show();
-      return;
-    }
+  if (!receiveDirect) return;
+  if (packetSize > UDP_IN_MAXSIZE || packetSize < 3) {
+    udpPacketsDropped++;
+    return;
   }
+  realtimeIP = rgbUdp.remoteIP();
+  DEBUG_PRINTLN(rgbUdp.remoteIP());
+  uint8_t lbuf[packetSize];
+  rgbUdp.read(lbuf, packetSize);
+  realtimeLock(realtimeTimeoutMs, REALTIME_MODE_HYPERION);
+  if (realtimeOverride && !(realtimeMode && useMainSegmentOnly)) return;
+  setRealtimePixels(0, lbuf, packetSize / 3, 3);
+  if (!(realtimeMode && useMainSegmentOnly)) udpShowPending = true;
+}
 
+//notifier and UDP realtime
+static void handleNotifierPacket(size_t packetSize, bool isSupp)
+{
   if (!(receiveNotifications || receiveDirect)) return;
 
-  localIP = Network.localIP();
-  //notifier and UDP realtime
-  if (!packetSize || packetSize > UDP_IN_MAXSIZE) return;
+  IPAddress localIP = Network.localIP();
+  if (packetSize > UDP_IN_MAXSIZE) {
+    udpPacketsDropped++;
+    return;
+  }
   if (!isSupp && notifierUdp.remoteIP() == localIP) return; //don't process broadcasts we send ourselves
 
   uint8_t udpIn[packetSize +1];
@@ -486,20 +459,13 @@ void handleNotifications()
     byte numPackets = udpIn[5];
 
     uint16_t id = (tpmPayloadFrameSize/3)*(packetNum-1); //start LED
-    uint16_t totalLen = strip.getLengthTotal();
-    for (size_t i = 6; i < tpmPayloadFrameSize + 4U; i += 3)
-    {
-      if (id < totalLen)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-        id++;
-      }
-      else break;
-    }
+    uint16_t count = tpmPayloadFrameSize/3;
+    if (packetSize < 6U + count*3) count = packetSize > 6 ? (packetSize - 6) / 3 : 0; // do not read past received data
+    setRealtimePixels(id, udpIn + 6, count, 3);
     if (tpmPacketCount == numPackets) //reset packet count and show if all packets were received
     {
       tpmPacketCount = 0;
-      strip.show();
+      udpShowPending = true;
     }
     return;
   }
@@ -520,7 +486,6 @@ void handleNotifications()
     }
     if (realtimeOverride && !(realtimeMode && useMainSegmentOnly)) return;
 
-    uint16_t totalLen = strip.getLengthTotal();
     if (udpIn[0] == 1) //warls
     {
       for (size_t i = 2; i < packetSize -3; i += 4)
@@ -529,42 +494,20 @@ void handleNotifications()
       }
     } else if (udpIn[0] == 2) //drgb
     {
-      uint16_t id = 0;
-      for (size_t i = 2; i < packetSize -2; i += 3)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-
-        id++; if (id >= totalLen) break;
-      }
+      setRealtimePixels(0, udpIn + 2, (packetSize - 2) / 3, 3);
     } else if (udpIn[0] == 3) //drgbw
     {
-      uint16_t id = 0;
-      for (size_t i = 2; i < packetSize -3; i += 4)
-      {
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], udpIn[i+3]);
-
-        id++; if (id >= totalLen) break;
-      }
-    } else if (udpIn[0] == 4) //dnrgb
+      setRealtimePixels(0, udpIn + 2, (packetSize - 2) / 4, 4);
+    } else if (udpIn[0] == 4 && packetSize > 4) //dnrgb
     {
       uint16_t id = ((udpIn[3] << 0) & 0xFF) + ((udpIn[2] << 8) & 0xFF00);
-      for (size_t i = 4; i < packetSize -2; i += 3)
-      {
-        if (id >= totalLen) break;
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], 0);
-        id++;
-      }
-    } else if (udpIn[0] == 5) //dnrgbw
+      setRealtimePixels(id, udpIn + 4, (packetSize - 4) / 3, 3);
+    } else if (udpIn[0] == 5 && packetSize > 4) //dnrgbw
     {
       uint16_t id = ((udpIn[3] << 0) & 0xFF) + ((udpIn[2] << 8) & 0xFF00);
-      for (size_t i = 4; i < packetSize -2; i += 4)
-      {
-        if (id >= totalLen) break;
-        setRealtimePixel(id, udpIn[i], udpIn[i+1], udpIn[i+2], udpIn[i+3]);
-        id++;
-      }
+      setRealtimePixels(id, udpIn + 4, (packetSize - 4) / 4, 4);
     }
-    strip.show();
+    udpShowPending = true;
     return;
   }
 
@@ -585,6 +528,61 @@ void handleNotifications()
   }
 }
 
+//processes one pending datagram, returns false if there was none
+static bool handleUDPPacket()
+{
+  bool isSupp = false;
+  size_t packetSize = notifierUdp.parsePacket();
+  if (!packetSize && udp2Connected) {
+    packetSize = notifier2Udp.parsePacket();
+    isSupp = true;
+  }
+  if (!packetSize && udpRgbConnected) {
+    packetSize = rgbUdp.parsePacket();
+    if (!packetSize) return false;
+    udpPacketsReceived++;
+    handleRgbPacket(packetSize);
+    return true;
+  }
+  if (!packetSize) return false;
+  udpPacketsReceived++;
+  handleNotifierPacket(packetSize, isSupp);
+  return true;
+}
+
+void handleNotifications()
+{
+  //send second notification if enabled
+  if(udpConnected && (notificationCount < udpNumRetries) && ((millis()-notificationSentTime) > 250)){
+    notify(notificationSentCallMode,true);
+  }
+
+  if (e131NewData && millis() - strip.getLastShow() > 15)
+  {
+    e131NewData = false;
+    strip.show();
+  }
+
+  //unlock strip when realtime UDP times out
+  if (realtimeMode && millis() > realtimeTimeout) exitRealtime();
+
+  //receive UDP notifications
+  if (!udpConnected) return;
+
+  //drain all pending datagrams (within budget) so bursts of realtime packets do not pile up in lwIP queue
+  //realtime data is shown once after all received packets have been applied
+  unsigned long rxStart = millis();
+  uint8_t packets = 0;
+  udpShowPending = false;
+  while (handleUDPPacket()) {
+    if (++packets >= WLED_UDP_RX_MAX_PACKETS || millis() - rxStart >= WLED_UDP_RX_MAX_MS) {
+      udpBudgetExhausted++; // remaining packets are handled in next loop()
+      break;
+    }
+  }
+  if (udpShowPending) strip.show();
+}
+
 
 void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w)
 {
@@ -605,6 +603,34 @@ void setRealtimePixel(uint16_t i, byte r, byte g, byte b, byte w)
   }
 }
 
+// bulk version of setRealtimePixel(): writes count pixels from a buffer of RGB (channels = 3) or RGBW (channels = 4)
+// values starting at LED i, gamma corrects in one pass and hands spans of pixels to the strip/segment at once
+void setRealtimePixels(uint16_t i, const uint8_t *data, uint16_t count, uint8_t channels)
+{
+  uint16_t pix = i + arlsOffset;
+  Segment *seg = useMainSegmentOnly ? &strip.getMainSegment() : nullptr;
+  uint16_t len = strip.getLengthTotal();
+  if (seg && seg->length() < len) len = seg->length();
+  if (pix >= len || !count) return;
+  if (pix + count > len) count = len - pix;
+
+  const bool gamma = !arlsDisableGammaCorrection && gammaCorrectCol;
+  const bool rgbw = channels > 3;
+  uint32_t span[PIXEL_SPAN_LEN];
+  while (count) {
+    uint16_t n = count > PIXEL_SPAN_LEN ? PIXEL_SPAN_LEN : count;
+    if (gamma) {
+      for (uint16_t j = 0; j < n; j++, data += channels)
+        span[j] = RGBW32(gamma8(data[0]), gamma8(data[1]), gamma8(data[2]), rgbw ? gamma8(data[3]) : 0);
+    } else {
+      for (uint16_t j = 0; j < n; j++, data += channels)
+        span[j] = RGBW32(data[0], data[1], data[2], rgbw ? data[3] : 0);
+    }
+    if (seg) seg->setPixelColors(pix, span, n);
+    else     strip.setPixelColors(pix, span, n);
+    pix += n; count -= n;
+  }
+}
 /*********************************************************************************************\
    Refresh aging for remote units, drop if too old...
 \*********************************************************************************************/
@@ -711,16 +737,114 @@ void sendSysInfoUDP()
 // client - the IP address to send to
 // length - the number of pixels
 // buffer - a buffer of at least length*4 bytes long
+// packet - packet buffer of realtimePacketSize(type) bytes, initialised by realtimePacketInit()
 // isRGBW - true if the buffer contains 4 components per pixel
 
 static       size_t sequenceNumber = 0; // this needs to be shared across all outputs
 static const size_t ART_NET_HEADER_SIZE = 12;
 static const byte   ART_NET_HEADER[] PROGMEM = {0x41,0x72,0x74,0x2d,0x4e,0x65,0x74,0x00,0x00,0x50,0x00,0x0e};
 
-uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, uint8_t bri, bool isRGBW)  {
-  if (!(apActive || interfacesInited) || !client[0] || !length) return 1;  // network not initialised or dummy/unset IP address  031522 ajn added check for ap
+// E1.31 output: universes start at 1, each universe holds 170 RGB (or 128 RGBW) pixels
+#define E131_OUT_START_UNIVERSE 1
+#define E131_OUT_PRIORITY       100 // default priority (E1.31: 6.2.3)
+#define E131_OUT_SEQ_UNIVERSES  64  // number of universes with own sequence number (wraps around)
+static uint8_t e131SequenceNumbers[E131_OUT_SEQ_UNIVERSES] = {0};
+static uint8_t e131SyncSequenceNumber = 0;
+
+static inline void writeE131Length(byte *p, uint16_t offset, uint16_t packetLength) {
+  uint16_t flength = 0x7000 | (packetLength - offset); // flags (0x7) and length of PDU
+  p[offset]   = flength >> 8;
+  p[offset+1] = flength & 0xFF;
+}
+
+// fills the parts of E1.31 data packet that do not change between packets
+static void prepareE131Packet(byte *p) {
+  static const byte acnId[] PROGMEM = {0x41,0x53,0x43,0x2d,0x45,0x31,0x2e,0x31,0x37,0x00,0x00,0x00}; // "ASC-E1.17"
+  memset(p, 0, E131_DMP_DATA);
+  // root layer
+  p[E131_ROOT_PREAMBLE_SIZE+1] = 0x10;
+  memcpy_P(p + E131_ROOT_ID, acnId, sizeof(acnId));
+  p[E131_ROOT_VECTOR+3] = 0x04;                    // VECTOR_ROOT_E131_DATA
+  // CID: unique per device, use MAC address
+  uint8_t mac[6];
+  WiFi.macAddress(mac);
+  memcpy_P(p + E131_ROOT_CID, PSTR("WLED-E131-"), 10);
+  memcpy(p + E131_ROOT_CID + 10, mac, 6);
+  // framing layer
+  p[E131_FRAME_VECTOR+3] = 0x02;                   // VECTOR_E131_DATA_PACKET
+  p[E131_FRAME_PRIORITY] = E131_OUT_PRIORITY;
+  // DMP layer
+  p[E131_DMP_VECTOR]     = 0x02;                   // VECTOR_DMP_SET_PROPERTY
+  p[E131_DMP_TYPE]       = 0xA1;                   // address & data type
+  p[E131_DMP_ADDR_INC+1] = 0x01;
+  p[E131_DMP_DATA]       = 0x00;                   // DMX start code
+}
+
+// size of packet buffer needed by realtimeBroadcast() for given protocol
+size_t realtimePacketSize(uint8_t type) {
+  switch (type) {
+    case 0: return DDP_HEADER_LEN + DDP_CHANNELS_PER_PACKET;
+    case 1: return E131_DMP_DATA + 513; // start code + 512 channels
+    case 2: return ART_NET_HEADER_SIZE + 6 + 512;
+  }
+  return 0;
+}
+
+// writes header fields that do not change between packets (called once when bus is created)
+void realtimePacketInit(uint8_t type, byte *packet) {
+  switch (type) {
+    case 0: // DDP
+      memset(packet, 0, DDP_HEADER_LEN);
+      packet[3] = DDP_ID_DISPLAY;
+      break;
+    case 1: // E1.31
+      prepareE131Packet(packet);
+      break;
+    case 2: // ArtNet
+      memcpy_P(packet, ART_NET_HEADER, ART_NET_HEADER_SIZE); // hard coded ID, OpCode, and protocol version
+      packet[ART_NET_HEADER_SIZE+1] = 0x00; // physical - more an FYI, not really used for anything. 0..3
+      packet[ART_NET_HEADER_SIZE+3] = 0x00; // Universe MSB, unused.
+      break;
+  }
+}
+
+// copies len channel values scaled by bri (same result as scale8()), processes 4 channels at once
+static void copyScaled(byte *dst, const byte *src, size_t len, uint8_t bri) {
+  if (bri == 255) {
+    memcpy(dst, src, len);
+    return;
+  }
+  const uint32_t scale = bri + 1;
+  size_t i = 0;
+  for (; i + 4 <= len; i += 4) {
+    uint32_t w;
+    memcpy(&w, src + i, 4); // may be unaligned
+    uint32_t rb = (((w & 0x00FF00FF) * scale) >> 8) & 0x00FF00FF; // each channel * 256 fits in 16 bits
+    uint32_t ag = (((w >> 8) & 0x00FF00FF) * scale) & 0xFF00FF00;
+    w = rb | ag;
+    memcpy(dst + i, &w, 4);
+  }
+  for (; i < len; i++) dst[i] = scale8(src[i], bri);
+}
+
+// sends one assembled packet (header and channel data) with a single write
+static uint8_t sendRealtimePacket(WiFiUDP &udp, IPAddress ip, uint16_t port, const byte *packet, size_t len) {
+  if (!udp.beginPacket(ip, port)) {
+    DEBUG_PRINTLN(F("WiFiUDP.beginPacket returned an error"));
+    return 1; // problem
+  }
+  udp.write(packet, len);
+  if (!udp.endPacket()) {
+    DEBUG_PRINTLN(F("WiFiUDP.endPacket returned an error"));
+    return 1; // problem
+  }
+  return 0;
+}
+
+uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8_t *buffer, byte *packet, uint8_t bri, bool isRGBW)  {
+  if (!(apActive || interfacesInited) || !client[0] || !length || !packet) return 1;  // network not initialised or dummy/unset IP address  031522 ajn added check for ap
 
-  WiFiUDP ddpUdp;
+  static WiFiUDP ddpUdp; // only used for sending, kept to avoid construction per frame
 
   switch (type) {
     case 0: // DDP
@@ -737,11 +861,6 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
       for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
         if (sequenceNumber > 15) sequenceNumber = 0;
 
-        if (!ddpUdp.beginPacket(client, DDP_DEFAULT_PORT)) {  // port defined in ESPAsyncE131.h
-          DEBUG_PRINTLN(F("WiFiUDP.beginPacket returned an error"));
-          return 1; // problem
-        }
-
         // the amount of data is AFTER the header in the current packet
         size_t packetSize = DDP_CHANNELS_PER_PACKET;
 
@@ -755,33 +874,23 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
           }
         }
 
-        // write the header
-        /*0*/ddpUdp.write(flags);
-        /*1*/ddpUdp.write(sequenceNumber++ & 0x0F); // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
-        /*2*/ddpUdp.write(isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24);
-        /*3*/ddpUdp.write(DDP_ID_DISPLAY);
+        // fill the header (byte 3, destination ID, does not change)
+        /*0*/packet[0] = flags;
+        /*1*/packet[1] = sequenceNumber++ & 0x0F; // sequence may be unnecessary unless we are sending twice (as requested in Sync settings)
+        /*2*/packet[2] = isRGBW ?  DDP_TYPE_RGBW32 : DDP_TYPE_RGB24;
         // data offset in bytes, 32-bit number, MSB first
-        /*4*/ddpUdp.write(0xFF & (channel >> 24));
-        /*5*/ddpUdp.write(0xFF & (channel >> 16));
-        /*6*/ddpUdp.write(0xFF & (channel >>  8));
-        /*7*/ddpUdp.write(0xFF & (channel      ));
+        /*4*/packet[4] = 0xFF & (channel >> 24);
+        /*5*/packet[5] = 0xFF & (channel >> 16);
+        /*6*/packet[6] = 0xFF & (channel >>  8);
+        /*7*/packet[7] = 0xFF & (channel      );
         // data length in bytes, 16-bit number, MSB first
-        /*8*/ddpUdp.write(0xFF & (packetSize >> 8));
-        /*9*/ddpUdp.write(0xFF & (packetSize     ));
-
-        // write the colors, the write write(const uint8_t *buffer, size_t size)
-        // function is just a loop internally too
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+        /*8*/packet[8] = 0xFF & (packetSize >> 8);
+        /*9*/packet[9] = 0xFF & (packetSize     );
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("WiFiUDP.endPacket returned an error"));
-          return 1; // problem
-        }
+        copyScaled(packet + DDP_HEADER_LEN, buffer + bufferOffset, packetSize, bri);
+        bufferOffset += packetSize;
+
+        if (sendRealtimePacket(ddpUdp, client, DDP_DEFAULT_PORT, packet, DDP_HEADER_LEN + packetSize)) return 1; // port defined in ESPAsyncE131.h
 
         channel += packetSize;
       }
@@ -789,6 +898,57 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
 
     case 1: //E1.31
     {
+      const size_t channelCount = length * (isRGBW?4:3); // 1 channel for every R,G,B,(W?) value
+      const size_t E131_CHANNELS_PER_PACKET = isRGBW?512:510; // 512/4=128 RGBW LEDs, 510/3=170 RGB LEDs
+      const size_t packetCount = ((channelCount-1)/E131_CHANNELS_PER_PACKET)+1;
+      const bool   multicast = (client[0] == 239); // send each universe to its own multicast group (E1.31: 9.3.1)
+      size_t bufferOffset = 0;
+
+      strlcpy((char*)packet + E131_FRAME_SOURCE, serverDescription, 64); // source name may change at any time
+      // multi-universe frames are synchronised on the first universe, receivers hold data until sync packet
+      const uint16_t syncUniverse = (e131FrameSync && packetCount > 1) ? E131_OUT_START_UNIVERSE : 0;
+      packet[E131_FRAME_SYNC_ADDR]   = syncUniverse >> 8;
+      packet[E131_FRAME_SYNC_ADDR+1] = syncUniverse & 0xFF;
+
+      for (size_t currentPacket = 0; currentPacket < packetCount; currentPacket++) {
+        uint16_t universe = E131_OUT_START_UNIVERSE + currentPacket;
+        size_t packetSize = E131_CHANNELS_PER_PACKET;
+        if (currentPacket == (packetCount - 1U) && (channelCount % E131_CHANNELS_PER_PACKET)) {
+          packetSize = channelCount % E131_CHANNELS_PER_PACKET; // last packet
+        }
+        uint16_t packetLength = E131_DMP_DATA + 1 + packetSize;
+
+        writeE131Length(packet, E131_ROOT_FLENGTH,  packetLength);
+        writeE131Length(packet, E131_FRAME_FLENGTH, packetLength);
+        writeE131Length(packet, E131_DMP_FLENGTH,   packetLength);
+        packet[E131_FRAME_SEQ]        = e131SequenceNumbers[currentPacket % E131_OUT_SEQ_UNIVERSES]++;
+        packet[E131_FRAME_UNIVERSE]   = universe >> 8;
+        packet[E131_FRAME_UNIVERSE+1] = universe & 0xFF;
+        packet[E131_DMP_COUNT]        = (packetSize + 1) >> 8; // channels + start code
+        packet[E131_DMP_COUNT+1]      = (packetSize + 1) & 0xFF;
+
+        copyScaled(packet + E131_DMP_DATA + 1, buffer + bufferOffset, packetSize, bri);
+        bufferOffset += packetSize;
+
+        IPAddress dest = multicast ? IPAddress(239, 255, universe >> 8, universe & 0xFF) : client;
+        if (sendRealtimePacket(ddpUdp, dest, E131_DEFAULT_PORT, packet, packetLength)) return 1;
+      }
+
+      if (syncUniverse) {
+        // E1.31 synchronization packet (E1.31: 6.3), same root layer with extended vector
+        byte syncPacket[E131_SYNC_PACKET_SIZE];
+        memcpy(syncPacket, packet, E131_FRAME_FLENGTH);
+        memset(syncPacket + E131_FRAME_FLENGTH, 0, E131_SYNC_PACKET_SIZE - E131_FRAME_FLENGTH);
+        syncPacket[E131_ROOT_VECTOR+3] = E131_VECTOR_ROOT_EXTENDED;
+        writeE131Length(syncPacket, E131_ROOT_FLENGTH,  E131_SYNC_PACKET_SIZE);
+        writeE131Length(syncPacket, E131_FRAME_FLENGTH, E131_SYNC_PACKET_SIZE);
+        syncPacket[E131_FRAME_VECTOR+3] = E131_VECTOR_EXTENDED_SYNC;
+        syncPacket[E131_SYNC_SEQ]    = e131SyncSequenceNumber++;
+        syncPacket[E131_SYNC_ADDR]   = syncUniverse >> 8;
+        syncPacket[E131_SYNC_ADDR+1] = syncUniverse & 0xFF;
+        IPAddress dest = multicast ? IPAddress(239, 255, syncUniverse >> 8, syncUniverse & 0xFF) : client;
+        if (sendRealtimePacket(ddpUdp, dest, E131_DEFAULT_PORT, syncPacket, E131_SYNC_PACKET_SIZE)) return 1;
+      }
     } break;
 
     case 2: //ArtNet
@@ -807,11 +967,6 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
 
         if (sequenceNumber > 255) sequenceNumber = 0;
 
-        if (!ddpUdp.beginPacket(client, ARTNET_DEFAULT_PORT)) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.beginPacket returned an error"));
-          return 1; // borked
-        }
-
         size_t packetSize = ARTNET_CHANNELS_PER_PACKET;
 
         if (currentPacket == (packetCount - 1U)) {
@@ -821,29 +976,29 @@ uint8_t realtimeBroadcast(uint8_t type, IPAddress client, uint16_t length, uint8
           }
         }
 
-        byte header_buffer[ART_NET_HEADER_SIZE];
-        memcpy_P(header_buffer, ART_NET_HEADER, ART_NET_HEADER_SIZE);
-        ddpUdp.write(header_buffer, ART_NET_HEADER_SIZE); // This doesn't change. Hard coded ID, OpCode, and protocol version.
-        ddpUdp.write(sequenceNumber & 0xFF); // sequence number. 1..255
-        ddpUdp.write(0x00); // physical - more an FYI, not really used for anything. 0..3
-        ddpUdp.write((currentPacket) & 0xFF); // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
-        ddpUdp.write(0x00); // Universe MSB, unused.
-        ddpUdp.write(0xFF & (packetSize >> 8)); // 16-bit length of channel data, MSB
-        ddpUdp.write(0xFF & (packetSize     )); // 16-bit length of channel data, LSB
-
-        for (size_t i = 0; i < packetSize; i += (isRGBW?4:3)) {
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // R
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // G
-          ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // B
-          if (isRGBW) ddpUdp.write(scale8(buffer[bufferOffset++], bri)); // W
-        }
+        // ID, OpCode, protocol version, physical and universe MSB do not change
+        packet[ART_NET_HEADER_SIZE]   = sequenceNumber & 0xFF; // sequence number. 1..255
+        packet[ART_NET_HEADER_SIZE+2] = currentPacket & 0xFF;  // Universe LSB. 1 full packet == 1 full universe, so just use current packet number.
+        packet[ART_NET_HEADER_SIZE+4] = 0xFF & (packetSize >> 8); // 16-bit length of channel data, MSB
+        packet[ART_NET_HEADER_SIZE+5] = 0xFF & (packetSize     ); // 16-bit length of channel data, LSB
 
-        if (!ddpUdp.endPacket()) {
-          DEBUG_PRINTLN(F("Art-Net WiFiUDP.endPacket returned an error"));
-          return 1; // borked
-        }
+        copyScaled(packet + ART_NET_HEADER_SIZE + 6, buffer + bufferOffset, packetSize, bri);
+        bufferOffset += packetSize;
+
+        if (sendRealtimePacket(ddpUdp, client, ARTNET_DEFAULT_PORT, packet, ART_NET_HEADER_SIZE + 6 + packetSize)) return 1; // borked
         channel += packetSize;
       }
+
+      if (e131FrameSync && packetCount > 1) {
+        // ArtSync: receivers show all universes received so far at once
+        byte syncPacket[ART_NET_HEADER_SIZE + 2];
+        memcpy_P(syncPacket, ART_NET_HEADER, ART_NET_HEADER_SIZE);
+        syncPacket[8] = ARTNET_OPCODE_OPSYNC & 0xFF; // OpCode, little endian
+        syncPacket[9] = ARTNET_OPCODE_OPSYNC >> 8;
+        syncPacket[ART_NET_HEADER_SIZE]   = 0x00; // Aux1
+        syncPacket[ART_NET_HEADER_SIZE+1] = 0x00; // Aux2
+        if (sendRealtimePacket(ddpUdp, client, ARTNET_DEFAULT_PORT, syncPacket, sizeof(syncPacket))) return 1;
+      }
     } break;
   }
   return 0;
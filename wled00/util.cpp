@@ -198,7 +198,9 @@ bool requestJSONBufferLock(uint8_t module)
 
   while (jsonBufferLock && millis()-now < 1000) delay(1); // wait for a second for buffer lock
 
-  if (millis()-now >= 1000) {
+  unsigned long waited = millis()-now;
+  jsonLockWaits[waited >= 1000 ? 4 : waited >= 100 ? 3 : waited >= 10 ? 2 : waited ? 1 : 0]++;
+  if (waited >= 1000) {
     DEBUG_PRINT(F("ERROR: Locking JSON buffer failed! ("));
     DEBUG_PRINT(jsonBufferLock);
     DEBUG_PRINTLN(")");
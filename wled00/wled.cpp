@@ -32,6 +32,26 @@ void WLED::reset()
   ESP.restart();
 }
 
+#ifdef WLED_ENABLE_RENDER_TASK
+/*
+ * Effects are rendered (and frames handed over to busses) by this task on core 0 while loop() runs on core 1.
+ * RMT/I2S output is asynchronous (NeoPixelBus keeps separate edit and send buffers) so the next frame is
+ * rendered into strip and bus buffers while the previous one is still being transmitted.
+ * Anything changing segments or busses from another task must hold strip.lock().
+ */
+static void renderTask(void *parameter)
+{
+  for (;;) {
+    strip.lock();
+    // while busses still send the previous frame show() would wait with the lock held and block loop()
+    if (busses.canAllShow() && (!realtimeMode || realtimeOverride || (realtimeMode && useMainSegmentOnly)) && (!offMode || strip.isOffRefreshRequired()))
+      strip.service();
+    strip.unlock();
+    vTaskDelay(1); // let other tasks on this core run (service() returns early if it is not yet time for next frame)
+  }
+}
+#endif
+
 void WLED::loop()
 {
   #ifdef WLED_DEBUG
@@ -43,9 +63,12 @@ void WLED::loop()
 
   handleTime();
   #ifndef WLED_DISABLE_INFRARED
+  strip.lock();
   handleIR();        // 2nd call to function needed for ESP32 to return valid results -- should be good for ESP8266, too
+  strip.unlock();
   #endif
   handleConnection();
+  strip.lock(); // handlers below may change segments (async web handlers read them)
   handleSerial();
   handleNotifications();
   handleTransitions();
@@ -63,8 +86,10 @@ void WLED::loop()
   avgUsermodMillis += usermodMillis;
   if (usermodMillis > maxUsermodMillis) maxUsermodMillis = usermodMillis;
   #endif
+  strip.unlock();
 
   yield();
+  strip.lock();
   handleIO();
   #ifndef WLED_DISABLE_INFRARED
   handleIR();
@@ -72,6 +97,7 @@ void WLED::loop()
   #ifndef WLED_DISABLE_ALEXA
   handleAlexa();
   #endif
+  strip.unlock();
 
   yield();
 
@@ -91,18 +117,25 @@ void WLED::loop()
     #ifndef WLED_DISABLE_OTA
     if (WLED_CONNECTED && aOtaEnabled && !otaLock && correctPIN) ArduinoOTA.handle();
     #endif
+    strip.lock();
     handleNightlight();
     handlePlaylist();
+    strip.unlock();
     yield();
 
     #ifndef WLED_DISABLE_HUESYNC
+    strip.lock();
     handleHue();
+    strip.unlock();
     yield();
     #endif
 
+    strip.lock();
     handlePresets();
+    strip.unlock();
     yield();
 
+    #ifndef WLED_ENABLE_RENDER_TASK
     #ifdef WLED_DEBUG
     unsigned long stripMillis = millis();
     #endif
@@ -118,6 +151,7 @@ void WLED::loop()
     avgStripMillis += stripMillis;
     if (stripMillis > maxStripMillis) maxStripMillis = stripMillis;
     #endif
+    #endif
   }
 
   yield();
@@ -155,6 +189,7 @@ void WLED::loop()
   if (doInitBusses) {
     doInitBusses = false;
     DEBUG_PRINTLN(F("Re-init busses."));
+    strip.lock();
     bool aligned = strip.checkSegmentAlignment(); //see if old segments match old bus(ses)
     busses.removeAll();
     uint32_t mem = 0;
@@ -169,11 +204,14 @@ void WLED::loop()
     strip.finalizeInit(); // also loads default ledmap if present
     if (aligned) strip.makeAutoSegments();
     else strip.fixInvalidSegments();
+    strip.unlock();
     yield();
     serializeConfig();
   }
   if (loadLedmap >= 0) {
+    strip.lock();
     if (!strip.deserializeMap(loadLedmap) && strip.isMatrix && loadLedmap == 0) strip.setUpMatrix();
+    strip.unlock();
     loadLedmap = -1;
   }
 
@@ -463,6 +501,11 @@ void WLED::setup()
 
   enableWatchdog();
 
+  #ifdef WLED_ENABLE_RENDER_TASK
+  // loop() runs on core 1 (ARDUINO_RUNNING_CORE)
+  xTaskCreatePinnedToCore(renderTask, "render", WLED_RENDER_TASK_STACK, NULL, 1, NULL, 0);
+  #endif
+
   #if defined(ARDUINO_ARCH_ESP32) && defined(WLED_DISABLE_BROWNOUT_DET)
   WRITE_PERI_REG(RTC_CNTL_BROWN_OUT_REG, 1); //enable brownout detector
   #endif
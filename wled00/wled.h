@@ -45,6 +45,8 @@
 #endif
 
 #define WLED_ENABLE_FS_EDITOR      // enable /edit page for editing FS content. Will also be disabled with OTA lock
+//#define WLED_ENABLE_RENDER_TASK  // ESP32 (dual core) only: render effects on a dedicated task on core 0 (uses 8kB of RAM for its stack)
+//#define WLED_ENABLE_PARALLEL_RENDER // ESP32 (dual core) only: render segments on both cores (uses 8kB of RAM for helper task stack)
 
 // to toggle usb serial debug (un)comment the following line
 //#define WLED_DEBUG
@@ -90,6 +92,13 @@
   #endif
   #include "esp_task_wdt.h"
 #endif
+#if !defined(ARDUINO_ARCH_ESP32) || defined(CONFIG_FREERTOS_UNICORE)
+  #undef WLED_ENABLE_RENDER_TASK     // render task needs a 2nd core
+  #undef WLED_ENABLE_PARALLEL_RENDER // as does parallel rendering
+#endif
+#if (defined(WLED_ENABLE_RENDER_TASK) || defined(WLED_ENABLE_PARALLEL_RENDER)) && !defined(WLED_RENDER_TASK_STACK)
+  #define WLED_RENDER_TASK_STACK 8192 // same as loop() task
+#endif
 #include <Wire.h>
 #include <SPI.h>
 
@@ -402,6 +411,10 @@ WLED_GLOBAL uint16_t DMXSegmentSpacing _INIT(0);                  // Number of v
 WLED_GLOBAL byte e131LastSequenceNumber[E131_MAX_UNIVERSE_COUNT]; // to detect packet loss
 WLED_GLOBAL bool e131Multicast _INIT(false);                      // multicast or unicast
 WLED_GLOBAL bool e131SkipOutOfSequence _INIT(false);              // freeze instead of flickering
+WLED_GLOBAL bool e131FrameSync _INIT(false);                      // stage universes and show complete frames only (ArtSync/E1.31 sync or all universes received), send sync on network busses
+WLED_GLOBAL uint32_t e131FramesCommitted _INIT(0);                // frame sync statistics
+WLED_GLOBAL uint32_t e131FramesDropped _INIT(0);                  // incomplete frames (shown with the universes received)
+WLED_GLOBAL uint32_t e131LateUniverses _INIT(0);                  // universes arriving after their frame was shown
 WLED_GLOBAL uint16_t pollReplyCount _INIT(0);                     // count number of replies for ArtPoll node report
 
 // mqtt
@@ -543,6 +556,7 @@ WLED_GLOBAL bool stateChanged _INIT(false);
 
 // network
 WLED_GLOBAL bool udpConnected _INIT(false), udp2Connected _INIT(false), udpRgbConnected _INIT(false);
+WLED_GLOBAL uint32_t udpPacketsReceived _INIT(0), udpPacketsDropped _INIT(0), udpBudgetExhausted _INIT(0); // UDP receive statistics
 
 // ui style
 WLED_GLOBAL bool showWelcomePage _INIT(false);
@@ -719,6 +733,7 @@ WLED_GLOBAL int8_t spi_sclk  _INIT(SPISCLKPIN);
 // global ArduinoJson buffer
 WLED_GLOBAL StaticJsonDocument<JSON_BUFFER_SIZE> doc;
 WLED_GLOBAL volatile uint8_t jsonBufferLock _INIT(0);
+WLED_GLOBAL uint32_t jsonLockWaits[JSON_LOCK_WAIT_BUCKETS] _INIT_N(({0})); // lock requests by wait time, see const.h
 
 // enable additional debug output
 #if defined(WLED_DEBUG_HOST)
@@ -14,9 +14,6 @@
  * Integrated HTTP web server page declarations
  */
 
-bool handleIfNoneMatchCacheHeader(AsyncWebServerRequest* request);
-void setStaticContentCacheHeaders(AsyncWebServerResponse *response);
-
 // define flash strings once (saves flash memory)
 static const char s_redirecting[] PROGMEM = "Redirecting...";
 static const char s_content_enc[] PROGMEM = "Content-Encoding";
@@ -48,7 +45,10 @@ void handleUpload(AsyncWebServerRequest *request, const String& filename, size_t
     request->_tempFile = WLED_FS.open(finalname, "w");
     DEBUG_PRINT(F("Uploading "));
     DEBUG_PRINTLN(finalname);
-    if (finalname.equals("/presets.json")) presetsModifiedTime = toki.second();
+    if (finalname.equals("/presets.json")) {
+      presetsModifiedTime = toki.second();
+      invalidateObjectIndex();
+    }
   }
   if (len) {
     request->_tempFile.write(data,len);
@@ -64,14 +64,34 @@ void handleUpload(AsyncWebServerRequest *request, const String& filename, size_t
   }
 }
 
+#ifdef WLED_ENABLE_FS_EDITOR
+// file editor changes files behind writeObjectToFile(), its handlers are final so it is wrapped
+class WLEDFSEditor : public AsyncWebHandler {
+  public:
+    template<typename... Args> WLEDFSEditor(Args&&... args) : _editor(std::forward<Args>(args)...) {}
+    bool canHandle(AsyncWebServerRequest *request) override { return _editor.canHandle(request); }
+    void handleRequest(AsyncWebServerRequest *request) override {
+      if (request->method() != HTTP_GET) invalidateObjectIndex(); // file created or deleted
+      _editor.handleRequest(request);
+    }
+    void handleUpload(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final) override {
+      invalidateObjectIndex();
+      _editor.handleUpload(request, filename, index, data, len, final);
+    }
+    bool isRequestHandlerTrivial() override { return _editor.isRequestHandlerTrivial(); }
+  private:
+    SPIFFSEditor _editor;
+};
+#endif
+
 void createEditHandler(bool enable) {
   if (editHandler != nullptr) server.removeHandler(editHandler);
   if (enable) {
     #ifdef WLED_ENABLE_FS_EDITOR
       #ifdef ARDUINO_ARCH_ESP32
-      editHandler = &server.addHandler(new SPIFFSEditor(WLED_FS));//http_username,http_password));
+      editHandler = &server.addHandler(new WLEDFSEditor(WLED_FS));//http_username,http_password));
       #else
-      editHandler = &server.addHandler(new SPIFFSEditor("","",WLED_FS));//http_username,http_password));
+      editHandler = &server.addHandler(new WLEDFSEditor("","",WLED_FS));//http_username,http_password));
       #endif
     #else
       editHandler = &server.on("/edit", HTTP_GET, [](AsyncWebServerRequest *request){
@@ -186,12 +206,14 @@ void initServer()
     bool verboseResponse = false;
     bool isConfig = false;
 
-    if (!requestJSONBufferLock(14)) return;
+    strip.lock(); // strip lock has to be acquired before JSON buffer lock
+    if (!requestJSONBufferLock(14)) { strip.unlock(); return; }
 
     DeserializationError error = deserializeJson(doc, (uint8_t*)(request->_tempObject));
     JsonObject root = doc.as<JsonObject>();
     if (error || root.isNull()) {
       releaseJSONBufferLock();
+      strip.unlock();
       request->send(400, "application/json", F("{\"error\":9}"));
       return;
     }
@@ -210,6 +232,7 @@ void initServer()
       verboseResponse = deserializeConfig(root); //use verboseResponse to determine whether cfg change should be saved immediately
     }
     releaseJSONBufferLock();
+    strip.unlock();
 
     if (verboseResponse) {
       if (!isConfig) {
@@ -378,10 +401,13 @@ void initServer()
       return;
     }
 
-    if(handleSet(request, request->url())) return;
+    strip.lock();
+    bool handled = handleSet(request, request->url());
     #ifndef WLED_DISABLE_ALEXA
-    if(espalexa.handleAlexaApiCall(request)) return;
+    if (!handled) handled = espalexa.handleAlexaApiCall(request);
     #endif
+    strip.unlock();
+    if (handled) return;
     if(handleFileRead(request, request->url())) return;
     AsyncWebServerResponse *response = request->beginResponse_P(404, "text/html", PAGE_404, PAGE_404_length);
     response->addHeader(FPSTR(s_content_enc),"gzip");
@@ -401,19 +427,27 @@ void serveIndexOrWelcome(AsyncWebServerRequest *request)
   }
 }
 
-bool handleIfNoneMatchCacheHeader(AsyncWebServerRequest* request)
+// ETag of static content, suffix identifies dynamically generated content
+static void generateEtag(char *etag, uint32_t eTagSuffix)
+{
+  sprintf_P(etag, PSTR("%7d-%02x-%08x"), VERSION, cacheInvalidate, (unsigned)eTagSuffix);
+}
+
+bool handleIfNoneMatchCacheHeader(AsyncWebServerRequest* request, uint32_t eTagSuffix)
 {
   AsyncWebHeader* header = request->getHeader("If-None-Match");
-  if (header && header->value() == String(VERSION)) {
+  char etag[24];
+  generateEtag(etag, eTagSuffix);
+  if (header && header->value() == etag) {
     request->send(304);
     return true;
   }
   return false;
 }
 
-void setStaticContentCacheHeaders(AsyncWebServerResponse *response)
+void setStaticContentCacheHeaders(AsyncWebServerResponse *response, uint32_t eTagSuffix)
 {
-  char tmp[12];
+  char tmp[24];
   // https://medium.com/@codebyamir/a-web-developers-guide-to-browser-caching-cc41f3b73e7c
   #ifndef WLED_DEBUG
   //this header name is misleading, "no-cache" will not disable cache,
@@ -422,7 +456,7 @@ void setStaticContentCacheHeaders(AsyncWebServerResponse *response)
   #else
   response->addHeader(F("Cache-Control"),"no-store,max-age=0"); // prevent caching if debug build
   #endif
-  sprintf_P(tmp, PSTR("%8d-%02x"), VERSION, cacheInvalidate);
+  generateEtag(tmp, eTagSuffix);
   response->addHeader(F("ETag"), tmp);
 }
 
@@ -571,7 +605,11 @@ void serveSettings(AsyncWebServerRequest* request, bool post)
   }
 
   if (post) { //settings/set POST request, saving
-    if (subPage != 1 || !(wifiLock && otaLock)) handleSettingsSet(request, subPage);
+    if (subPage != 1 || !(wifiLock && otaLock)) {
+      strip.lock();
+      handleSettingsSet(request, subPage);
+      strip.unlock();
+    }
 
     char s[32];
     char s2[45] = "";
@@ -8,8 +8,142 @@
 uint16_t wsLiveClientId = 0;
 unsigned long wsLastLiveTime = 0;
 //uint8_t* wsFrameBuffer = nullptr;
-
 #define WS_LIVE_INTERVAL 40
+#define WS_LIVE_INTERVAL_MAX 500 // live frame interval grows up to this if client can not keep up
+#define WS_LIVE_KEYFRAME 64      // compressed live preview: full frame after this many delta frames
+#ifdef ESP8266
+  #define MAX_LIVE_LEDS_WS  256U // uncompressed live preview
+  #define MAX_LIVE_LEDS_WSZ 512U // compressed live preview
+#else
+  #define MAX_LIVE_LEDS_WS  1024U
+  #define MAX_LIVE_LEDS_WSZ 4096U
+#endif
+#define WS_MIN_BROADCAST_INTERVAL 100 // state broadcasts within this time are coalesced into one
+#define WS_INFO_INTERVAL 10000        // info is sent with deltas only if it changed or after this time
+
+static bool     wsLiveCompressed = false;  // live client asked for compressed frames ("lvz")
+static uint8_t *wsLiveFrame = nullptr;     // current and previous live frame (RGB) for delta compression
+static size_t   wsLiveFrameSize = 0;       // size of one frame in wsLiveFrame
+static uint8_t  wsLiveDeltas = WS_LIVE_KEYFRAME; // delta frames since last key frame
+static uint16_t wsLiveInterval = WS_LIVE_INTERVAL;
+
+static void setLiveClient(uint32_t id, bool compressed)
+{
+  wsLiveClientId = id;
+  wsLiveCompressed = id && compressed;
+  free(wsLiveFrame);
+  wsLiveFrame = nullptr;
+  wsLiveFrameSize = 0;
+  wsLiveInterval = WS_LIVE_INTERVAL;
+}
+
+/*
+ * State broadcasts are sent as deltas if all connected clients asked for them ({"delta":true}): segments that
+ * did not change since the last broadcast are left out and removed segment IDs are listed in "rm".
+ * Each broadcast carries a sequence number ("sv"), clients that missed one request a full snapshot ({"v":true}).
+ * New clients always receive a full snapshot.
+ */
+static uint32_t wsSegHash[MAX_NUM_SEGMENTS] = {0}; // hash of each segment as last broadcast (0 = not active)
+static uint32_t wsInfoHash = 0;
+static uint32_t wsSegHashNext[MAX_NUM_SEGMENTS];    // hashes of the broadcast being prepared, applied once it was sent
+static uint32_t wsInfoHashNext = 0;                 // 0 if info was left out of the broadcast being prepared
+static unsigned long wsLastInfo = 0;
+static unsigned long wsLastBroadcast = 0;
+static uint16_t wsStateSeq = 0;
+static bool     wsForceFull = true;   // next broadcast must be a full snapshot
+static bool     wsBroadcastPending = false;
+static uint8_t  wsAllocFailures = 0;
+#define WS_MAX_DELTA_CLIENTS 8
+static uint32_t wsDeltaClients[WS_MAX_DELTA_CLIENTS] = {0}; // IDs of clients that understand deltas (sent {"delta":true})
+
+static void setDeltaClient(uint32_t id, bool enable)
+{
+  for (size_t i = 0; i < WS_MAX_DELTA_CLIENTS; i++) if (wsDeltaClients[i] == id) wsDeltaClients[i] = 0;
+  if (!enable) return;
+  for (size_t i = 0; i < WS_MAX_DELTA_CLIENTS; i++) if (!wsDeltaClients[i]) { wsDeltaClients[i] = id; return; }
+}
+
+// deltas are only sent if every connected client can apply them, others (i.e. home automation) get full state
+static bool allClientsUseDelta()
+{
+  size_t n = 0;
+  for (size_t i = 0; i < WS_MAX_DELTA_CLIENTS; i++) if (wsDeltaClients[i]) n++;
+  return n >= ws.count();
+}
+
+// FNV-1a hash of serialized JSON, no buffer needed
+class HashPrint : public Print {
+  public:
+    uint32_t hash = 2166136261UL;
+    size_t write(uint8_t c) { hash = (hash ^ c) * 16777619UL; return 1; }
+    size_t write(const uint8_t *buf, size_t size) { for (size_t i = 0; i < size; i++) write(buf[i]); return size; }
+};
+
+// hash of info object without values that change all the time (uptime, heap, signal, power...)
+static uint32_t hashInfo(JsonObject info)
+{
+  HashPrint h;
+  for (JsonPair kv : info) {
+    const char *key = kv.key().c_str();
+    if (!strcmp_P(key, PSTR("uptime")) || !strcmp_P(key, PSTR("freeheap")) || !strcmp_P(key, PSTR("time")) ||
+        !strcmp_P(key, PSTR("wifi"))   || !strcmp_P(key, PSTR("udp"))      || !strcmp_P(key, PSTR("e131")) || !strcmp_P(key, PSTR("jlock")) || !strcmp_P(key, PSTR("sdata")) || !strcmp(key, "u")) continue;
+    h.print(key);
+    if (!strcmp_P(key, PSTR("leds"))) {
+      for (JsonPair lv : kv.value().as<JsonObject>()) {
+        const char *lkey = lv.key().c_str();
+        if (!strcmp_P(lkey, PSTR("pwr")) || !strcmp_P(lkey, PSTR("fps")) || !strcmp(lkey, "rt") || !strcmp(lkey, "st")) continue;
+        h.print(lkey);
+        serializeJson(lv.value(), h);
+      }
+    } else {
+      serializeJson(kv.value(), h);
+    }
+  }
+  return h.hash;
+}
+
+// turns the full state in doc into a delta against the last broadcast
+// hashes and sequence number are only updated by commitStateDelta() once the broadcast was sent
+static void makeStateDelta(JsonObject state, JsonObject info, bool full)
+{
+  memset(wsSegHashNext, 0, sizeof(wsSegHashNext));
+  JsonArray segs = state["seg"];
+  for (size_t i = 0; i < segs.size(); ) {
+    JsonObject seg = segs[i];
+    uint8_t id = seg["id"];
+    if (id >= MAX_NUM_SEGMENTS) { i++; continue; }
+    HashPrint h;
+    serializeJson(seg, h);
+    wsSegHashNext[id] = h.hash;
+    if (h.hash == wsSegHash[id] && !full) segs.remove(i); // unchanged
+    else i++;
+  }
+  JsonArray rm;
+  for (size_t id = 0; id < MAX_NUM_SEGMENTS && !full; id++) {
+    if (wsSegHashNext[id] || !wsSegHash[id]) continue;
+    if (rm.isNull()) rm = doc.createNestedArray("rm");
+    rm.add(id);
+  }
+
+  wsInfoHashNext = hashInfo(info);
+  if (!full && wsInfoHashNext == wsInfoHash && millis() - wsLastInfo < WS_INFO_INTERVAL) {
+    doc.remove("info");
+    wsInfoHashNext = 0;
+  }
+  if (!full) doc["delta"] = true;
+  doc["sv"] = (uint16_t)(wsStateSeq + 1);
+}
+
+// broadcast prepared by makeStateDelta() was sent, following deltas are made against it
+static void commitStateDelta()
+{
+  memcpy(wsSegHash, wsSegHashNext, sizeof(wsSegHash));
+  if (wsInfoHashNext) {
+    wsInfoHash = wsInfoHashNext;
+    wsLastInfo = millis();
+  }
+  wsStateSeq++;
+}
 
 void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len)
 {
@@ -19,7 +153,8 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
     sendDataWs(client);
   } else if(type == WS_EVT_DISCONNECT){
     //client disconnected
-    if (client->id() == wsLiveClientId) wsLiveClientId = 0;
+    if (client->id() == wsLiveClientId) setLiveClient(0, false);
+    setDeltaClient(client->id(), false);
     DEBUG_PRINTLN(F("WS client disconnected."));
   } else if(type == WS_EVT_DATA){
     // data packet
@@ -36,23 +171,28 @@ void wsEvent(AsyncWebSocket * server, AsyncWebSocketClient * client, AwsEventTyp
         }
 
         bool verboseResponse = false;
-        if (!requestJSONBufferLock(11)) return;
+        strip.lock(); // strip lock has to be acquired before JSON buffer lock
+        if (!requestJSONBufferLock(11)) { strip.unlock(); return; }
 
         DeserializationError error = deserializeJson(doc, data, len);
         JsonObject root = doc.as<JsonObject>();
         if (error || root.isNull()) {
           releaseJSONBufferLock();
+          strip.unlock();
           return;
         }
         if (root["v"] && root.size() == 1) {
           //if the received value is just "{"v":true}", send only to this client
           verboseResponse = true;
         } else if (root.containsKey("lv")) {
-          wsLiveClientId = root["lv"] ? client->id() : 0;
+          setLiveClient(root["lv"] ? client->id() : 0, root[F("lvz")]);
+        } else if (root.containsKey("delta") && root.size() == 1) {
+          setDeltaClient(client->id(), root["delta"]);
         } else {
           verboseResponse = deserializeState(root);
         }
         releaseJSONBufferLock(); // will clean fileDoc
+        strip.unlock();
 
         // force broadcast in 500ms after updating client
         if (verboseResponse) {
@@ -100,13 +240,29 @@ void sendDataWs(AsyncWebSocketClient * client)
   if (!ws.count()) return;
   AsyncWebSocketMessageBuffer * buffer;
 
-  if (!requestJSONBufferLock(12)) return;
+  if (!client && millis() - wsLastBroadcast < WS_MIN_BROADCAST_INTERVAL) {
+    wsBroadcastPending = true; // sent from handleWs()
+    return;
+  }
+
+  if (!requestJSONBufferLock(12)) {
+    if (!client) wsBroadcastPending = true; // try again later
+    return;
+  }
 
   JsonObject state = doc.createNestedObject("state");
   serializeState(state);
   JsonObject info  = doc.createNestedObject("info");
   serializeInfo(info);
 
+  bool full = wsForceFull || !allClientsUseDelta();
+  if (client) {
+    doc["sv"] = wsStateSeq;
+    wsForceFull = true; // client is now ahead of last broadcast, others may not be able to use the same delta
+  } else {
+    makeStateDelta(state, info, full);
+  }
+
   size_t len = measureJson(doc);
   DEBUG_PRINTF("JSON buffer size: %u for WS request (%u).\n", doc.memoryUsage(), len);
 
@@ -114,6 +270,8 @@ void sendDataWs(AsyncWebSocketClient * client)
   DEBUG_PRINT(F("heap ")); DEBUG_PRINTLN(ESP.getFreeHeap());
   #ifdef ESP8266
   if (len>heap1) {
+    if (!client) wsForceFull = true;
+    releaseJSONBufferLock();
     DEBUG_PRINTLN(F("Out of memory (WS)!"));
     return;
   }
@@ -128,6 +286,14 @@ void sendDataWs(AsyncWebSocketClient * client)
   if (!buffer || heap1-heap2<len) {
     releaseJSONBufferLock();
     DEBUG_PRINTLN(F("WS buffer allocation failed."));
+    wsForceFull = true; // clients did not get this update
+    if (!client && ++wsAllocFailures < 3) {
+      wsBroadcastPending = true; // retry before giving up on clients
+      wsLastBroadcast = millis();
+      ws._cleanBuffers();
+      return;
+    }
+    wsAllocFailures = 0;
     ws.closeAll(1013); //code 1013 = temporary overload, try again later
     ws.cleanupClients(0); //disconnect all clients to release memory
     ws._cleanBuffers();
@@ -144,6 +310,11 @@ void sendDataWs(AsyncWebSocketClient * client)
   } else {
     ws.textAll(buffer);
     DEBUG_PRINTLN(F("to multiple clients."));
+    commitStateDelta();
+    if (full) wsForceFull = false;
+    wsAllocFailures = 0;
+    wsBroadcastPending = false;
+    wsLastBroadcast = millis();
   }
   buffer->unlock();
   ws._cleanBuffers();
@@ -151,64 +322,137 @@ void sendDataWs(AsyncWebSocketClient * client)
   releaseJSONBufferLock();
 }
 
+// fills buf with w*h RGB pixels, each the average of a bw*bh block of the strip
+static void getLiveFrame(uint8_t *buf, uint16_t w, uint16_t h, uint16_t bw, uint16_t bh)
+{
+  for (uint16_t y = 0; y < h; y++) for (uint16_t x = 0; x < w; x++) {
+    uint32_t c = strip.getPixelColorAvg(y * bh * Segment::maxWidth + x * bw, bw, bh);
+    *buf++ = R(c);
+    *buf++ = G(c);
+    *buf++ = B(c);
+  }
+}
+
+// compressed live frame data: sequence of
+//  0b00nnnnnn + (n+1) RGB values, 0b01nnnnnn + RGB (n+1 pixels of that color), 0b1nnnnnnn (n+1 pixels unchanged)
+// unchanged pixels are only used if prev frame is given; returns size, only counts if out is nullptr
+static size_t encodeLiveFrame(uint8_t *out, const uint8_t *cur, const uint8_t *prev, size_t count)
+{
+  size_t len = 0;
+  for (size_t i = 0; i < count; ) {
+    const uint8_t *px = cur + i*3;
+    size_t n = 1;
+    if (prev && !memcmp(px, prev + i*3, 3)) {
+      while (i+n < count && n < 128 && !memcmp(cur + (i+n)*3, prev + (i+n)*3, 3)) n++;
+      if (out) out[len] = 0x80 | (n-1);
+      len++;
+    } else {
+      while (i+n < count && n < 64 && !memcmp(cur + (i+n)*3, px, 3)) n++;
+      if (n > 1) {
+        if (out) { out[len] = 0x40 | (n-1); memcpy(out + len + 1, px, 3); }
+        len += 4;
+      } else {
+        // literals until an unchanged pixel or two equal pixels follow
+        while (i+n < count && n < 64) {
+          const uint8_t *q = cur + (i+n)*3;
+          if (prev && !memcmp(q, prev + (i+n)*3, 3)) break;
+          if (i+n+1 < count && !memcmp(q, q+3, 3)) break;
+          n++;
+        }
+        if (out) { out[len] = n-1; memcpy(out + len + 1, px, n*3); }
+        len += 1 + n*3;
+      }
+    }
+    i += n;
+  }
+  return len;
+}
+
 bool sendLiveLedsWs(uint32_t wsClient)
 {
   AsyncWebSocketClient * wsc = ws.client(wsClient);
-  if (!wsc || wsc->queueLength() > 0) return false; //only send if queue free
+  if (!wsc) return false;
+  if (wsc->queueLength() > 0) { //only send if queue free, lower frame rate as client does not keep up
+    wsLiveInterval = MIN(wsLiveInterval * 3 / 2, WS_LIVE_INTERVAL_MAX);
+    return false;
+  }
+  if (wsLiveInterval > WS_LIVE_INTERVAL) wsLiveInterval = MAX(wsLiveInterval - 5, WS_LIVE_INTERVAL);
 
+  // downsample by averaging blocks of bw*bh pixels if there are too many LEDs
+  const size_t maxLeds = wsLiveCompressed ? MAX_LIVE_LEDS_WSZ : MAX_LIVE_LEDS_WS;
   size_t used = strip.getLengthTotal();
-#ifdef ESP8266
-  const size_t MAX_LIVE_LEDS_WS = 256U;
-#else
-  const size_t MAX_LIVE_LEDS_WS = 1024U;
-#endif
-  size_t n = ((used -1)/MAX_LIVE_LEDS_WS) +1; //only serve every n'th LED if count over MAX_LIVE_LEDS_WS
-  size_t pos = (strip.isMatrix ? 4 : 2);  // start of data
-  size_t bufSize = pos + (used/n)*3;
-  size_t skipLines = 0;
-
-  AsyncWebSocketMessageBuffer * wsBuf = ws.makeBuffer(bufSize);
-  if (!wsBuf) return false; //out of memory
-  uint8_t* buffer = wsBuf->get();
-  buffer[0] = 'L';
-  buffer[1] = 1; //version
+  uint16_t w = used, h = 1, bw = 1, bh = 1;
+  bool is2D = false;
 #ifndef WLED_DISABLE_2D
   if (strip.isMatrix) {
-    buffer[1] = 2; //version
-    buffer[2] = Segment::maxWidth;
-    buffer[3] = Segment::maxHeight;
-    if (Segment::maxWidth * Segment::maxHeight > MAX_LIVE_LEDS_WS*4) {
-      buffer[2] = Segment::maxWidth/4;
-      buffer[3] = Segment::maxHeight/4;
-      skipLines = 3;
-    } else if (Segment::maxWidth * Segment::maxHeight > MAX_LIVE_LEDS_WS) {
-      buffer[2] = Segment::maxWidth/2;
-      buffer[3] = Segment::maxHeight/2;
-      skipLines = 1;
-    }
-  }
+    is2D = true;
+    uint16_t f = 1;
+    // uncompressed frames store width and height in one byte each
+    while ((size_t)(Segment::maxWidth/f) * (Segment::maxHeight/f) > maxLeds || (!wsLiveCompressed && (Segment::maxWidth/f > 255 || Segment::maxHeight/f > 255))) f++;
+    w = Segment::maxWidth/f;
+    h = Segment::maxHeight/f;
+    bw = bh = f;
+  } else
 #endif
-
-  for (size_t i = 0; pos < bufSize -2; i += n)
   {
-#ifndef WLED_DISABLE_2D
-    if (strip.isMatrix && skipLines) {
-      if ((i/Segment::maxWidth)%(skipLines+1)) i += Segment::maxWidth * skipLines;
+    bw = ((used -1)/maxLeds) +1;
+    w = used/bw;
+  }
+  const size_t count = (size_t)w * h;
+
+  if (!wsLiveCompressed) {
+    size_t pos = is2D ? 4 : 2;  // start of data
+    AsyncWebSocketMessageBuffer * wsBuf = ws.makeBuffer(pos + count*3);
+    if (!wsBuf) return false; //out of memory
+    uint8_t* buffer = wsBuf->get();
+    buffer[0] = 'L';
+    buffer[1] = is2D ? 2 : 1; //version
+    if (is2D) {
+      buffer[2] = w;
+      buffer[3] = h;
     }
-#endif
-    uint32_t c = strip.getPixelColor(i);
-    buffer[pos++] = qadd8(W(c), R(c)); //R, add white channel to RGB channels as a simple RGBW -> RGB map
-    buffer[pos++] = qadd8(W(c), G(c)); //G
-    buffer[pos++] = qadd8(W(c), B(c)); //B
+    getLiveFrame(buffer + pos, w, h, bw, bh);
+    wsc->binary(wsBuf);
+    return true;
+  }
+
+  // compressed (version 3), delta to previously sent frame
+  const size_t frameSize = count*3;
+  if (wsLiveFrameSize != frameSize) {
+    free(wsLiveFrame);
+    wsLiveFrame = (uint8_t*)malloc(frameSize * 2);
+    wsLiveFrameSize = wsLiveFrame ? frameSize : 0;
+    wsLiveDeltas = WS_LIVE_KEYFRAME; // previous frame unknown
+    if (!wsLiveFrame) return false; //out of memory
   }
+  uint8_t *cur = wsLiveFrame, *prev = wsLiveFrame + frameSize;
+  getLiveFrame(cur, w, h, bw, bh);
+  bool delta = wsLiveDeltas < WS_LIVE_KEYFRAME;
+  size_t len = 7 + encodeLiveFrame(nullptr, cur, delta ? prev : nullptr, count);
 
+  AsyncWebSocketMessageBuffer * wsBuf = ws.makeBuffer(len);
+  if (!wsBuf) return false; //out of memory
+  uint8_t* buffer = wsBuf->get();
+  buffer[0] = 'L';
+  buffer[1] = 3; //version
+  buffer[2] = (delta ? 0x01 : 0) | (is2D ? 0x02 : 0);
+  buffer[3] = w >> 8;
+  buffer[4] = w & 0xFF;
+  buffer[5] = h >> 8;
+  buffer[6] = h & 0xFF;
+  encodeLiveFrame(buffer + 7, cur, delta ? prev : nullptr, count);
   wsc->binary(wsBuf);
+
+  memcpy(prev, cur, frameSize);
+  wsLiveDeltas = delta ? wsLiveDeltas + 1 : 0;
   return true;
 }
 
 void handleWs()
 {
-  if (millis() - wsLastLiveTime > WS_LIVE_INTERVAL)
+  if (wsBroadcastPending && millis() - wsLastBroadcast >= WS_MIN_BROADCAST_INTERVAL) sendDataWs();
+
+  if (millis() - wsLastLiveTime > wsLiveInterval)
   {
     #ifdef ESP8266
     ws.cleanupClients(3);